@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include <Kokkos_Core.hpp>
+
+#include <benchmark/benchmark.h>
+
+/**
+ * @brief Set the throughput counters of a benchmark.
+ *
+ * Two rates are reported: the number of grid points treated per second ("points/s")
+ * and the memory bandwidth (bytes_per_second, which Google Benchmark prints in GB/s).
+ * These counters appear in the JSON output and are the quantities which should be
+ * compared between releases.
+ *
+ * @param state The benchmark state.
+ * @param n_points The number of grid points treated by each iteration.
+ * @param n_bytes The number of bytes which are read and written by each iteration.
+ */
+inline void set_throughput_counters(
+        benchmark::State& state,
+        std::size_t n_points,
+        std::size_t n_bytes)
+{
+    state.SetItemsProcessed(state.iterations() * n_points);
+    state.SetBytesProcessed(state.iterations() * n_bytes);
+    state.counters["points/s"] = benchmark::Counter(
+            state.iterations() * n_points,
+            benchmark::Counter::kIsRate,
+            benchmark::Counter::OneK::kIs1000);
+}
+
+/**
+ * @brief Get an object which is shared by all the runs of the benchmarks of a process.
+ *
+ * Google Benchmark calls a benchmark function several times (for the calibration and for
+ * each set of arguments). Objects whose constructor calls ddc::init_discrete_space (e.g.
+ * the FFT operators) can only be built once per process so they must outlive these calls.
+ * The object is built by the first call, the arguments of the following calls are ignored.
+ * It is destroyed when Kokkos is finalised.
+ *
+ * @param args The arguments of the constructor of the object.
+ *
+ * @return A reference to the shared object.
+ */
+template <class T, class... Args>
+T& get_shared_benchmark_object(Args&&... args)
+{
+    static std::unique_ptr<T> object;
+    if (!object) {
+        object = std::make_unique<T>(std::forward<Args>(args)...);
+        Kokkos::push_finalize_hook([]() { object.reset(); });
+    }
+    return *object;
+}
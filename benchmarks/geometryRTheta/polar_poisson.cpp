@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: MIT
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_utils.hpp"
+#include "circular_to_cartesian.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "discrete_mapping_builder.hpp"
+#include "discrete_to_cartesian.hpp"
+#include "geometry.hpp"
+#include "mesh_builder.hpp"
+#include "polarpoissonlikesolver.hpp"
+
+namespace {
+
+using PoissonSolver = PolarSplineFEMPoissonLikeSolver<
+        GridR,
+        GridTheta,
+        PolarBSplinesRTheta,
+        SplineRThetaEvaluatorNullBound>;
+
+using Mapping = CircularToCartesian<R, Theta, X, Y>;
+
+using DiscreteMappingBuilder
+        = DiscreteToCartesianBuilder<X, Y, SplineRThetaBuilder, SplineRThetaEvaluatorNullBound>;
+using DiscreteMappingBuilder_host = DiscreteToCartesianBuilder<
+        X,
+        Y,
+        SplineRThetaBuilder_host,
+        SplineRThetaEvaluatorNullBound_host>;
+
+/// The number of cells of the (r, theta) mesh shared by all the benchmarks.
+constexpr std::size_t r_ncells = 64;
+constexpr std::size_t theta_ncells = 128;
+
+/**
+ * Initialise the discrete spaces of the (r, theta) mesh and return the interpolation grid.
+ * A discrete space can only be initialised once per process while Google Benchmark calls
+ * each benchmark several times, so the mesh is only initialised by the first call.
+ */
+IdxRangeRTheta init_polar_mesh()
+{
+    if (!ddc::is_discrete_space_initialized<GridR>()) {
+        std::vector<CoordR> r_knots
+                = build_uniform_break_points(CoordR(0.0), CoordR(1.0), IdxStepR(r_ncells));
+        std::vector<CoordTheta> theta_knots = build_uniform_break_points(
+                CoordTheta(0.0),
+                CoordTheta(2.0 * M_PI),
+                IdxStepTheta(theta_ncells));
+
+        ddc::init_discrete_space<BSplinesR>(r_knots);
+        ddc::init_discrete_space<BSplinesTheta>(theta_knots);
+        ddc::init_discrete_space<GridR>(SplineInterpPointsR::get_sampling<GridR>());
+        ddc::init_discrete_space<GridTheta>(SplineInterpPointsTheta::get_sampling<GridTheta>());
+    }
+
+    return IdxRangeRTheta(
+            SplineInterpPointsR::get_domain<GridR>(),
+            SplineInterpPointsTheta::get_domain<GridTheta>());
+}
+
+/**
+ * The objects needed to construct a polar Poisson solver on a circular mapping with
+ * coefficients alpha = 1 and beta = 0.
+ */
+class PolarPoissonProblem
+{
+    IdxRangeRTheta m_grid;
+    SplineRThetaBuilder m_builder;
+    SplineRThetaBuilder_host m_builder_host;
+    ddc::NullExtrapolationRule m_bv_r;
+    ddc::PeriodicExtrapolationRule<Theta> m_bv_theta;
+    SplineRThetaEvaluatorNullBound m_evaluator;
+    SplineRThetaEvaluatorNullBound_host m_evaluator_host;
+    Mapping m_mapping;
+    DiscreteMappingBuilder m_discrete_mapping_builder;
+    DiscreteMappingBuilder_host m_discrete_mapping_builder_host;
+    DiscreteMappingBuilder::MappingType m_discrete_mapping;
+    Spline2DMem m_coeff_alpha_spline;
+    Spline2DMem m_coeff_beta_spline;
+
+public:
+    PolarPoissonProblem()
+        : m_grid(init_polar_mesh())
+        , m_builder(m_grid)
+        , m_builder_host(m_grid)
+        , m_evaluator(m_bv_r, m_bv_r, m_bv_theta, m_bv_theta)
+        , m_evaluator_host(m_bv_r, m_bv_r, m_bv_theta, m_bv_theta)
+        , m_discrete_mapping_builder(
+                  Kokkos::DefaultExecutionSpace(),
+                  m_mapping,
+                  m_builder,
+                  m_evaluator)
+        , m_discrete_mapping_builder_host(
+                  Kokkos::DefaultHostExecutionSpace(),
+                  m_mapping,
+                  m_builder_host,
+                  m_evaluator_host)
+        , m_discrete_mapping(m_discrete_mapping_builder())
+        , m_coeff_alpha_spline(get_spline_idx_range(m_builder))
+        , m_coeff_beta_spline(get_spline_idx_range(m_builder))
+    {
+        if (!ddc::is_discrete_space_initialized<PolarBSplinesRTheta>()) {
+            ddc::init_discrete_space<PolarBSplinesRTheta>(m_discrete_mapping_builder_host());
+        }
+
+        DFieldMemRTheta coeff_alpha(m_grid);
+        DFieldMemRTheta coeff_beta(m_grid);
+        ddc::parallel_fill(get_field(coeff_alpha), 1.0);
+        ddc::parallel_fill(get_field(coeff_beta), 0.0);
+        m_builder(get_field(m_coeff_alpha_spline), get_const_field(coeff_alpha));
+        m_builder(get_field(m_coeff_beta_spline), get_const_field(coeff_beta));
+    }
+
+    PoissonSolver build_solver(
+            PoissonSolver::Preconditioner preconditioner
+            = PoissonSolver::Preconditioner::Jacobi) const
+    {
+        return PoissonSolver(
+                get_const_field(m_coeff_alpha_spline),
+                get_const_field(m_coeff_beta_spline),
+                m_discrete_mapping,
+                m_evaluator,
+                OperatorCache(false),
+                PoissonSolver::OperatorStorage::Assembled,
+                preconditioner);
+    }
+
+    IdxRangeRTheta grid() const
+    {
+        return m_grid;
+    }
+};
+
+/// The construction of the solver: the assembly and the factorisation of the FEM matrix.
+void polar_poisson_setup(benchmark::State& state)
+{
+    PolarPoissonProblem const problem;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(problem.build_solver());
+        Kokkos::fence();
+    }
+    set_throughput_counters(state, problem.grid().size(), problem.grid().size() * sizeof(double));
+}
+
+/**
+ * The solution of the equation for a right-hand side given as a function.
+ * The argument selects the preconditioner (0: Jacobi, 1: radial-line block).
+ */
+void polar_poisson_solve(benchmark::State& state)
+{
+    PolarPoissonProblem const problem;
+    PoissonSolver const solver = problem.build_solver(
+            state.range(0) == 0 ? PoissonSolver::Preconditioner::Jacobi
+                                : PoissonSolver::Preconditioner::RadialLineBlock);
+
+    DFieldMemRTheta phi(problem.grid());
+    auto rhs = [](CoordRTheta const& coord) {
+        double const r = ddc::get<R>(coord);
+        return r * (1.0 - r) * Kokkos::cos(ddc::get<Theta>(coord));
+    };
+    for (auto _ : state) {
+        solver(rhs, get_field(phi));
+        Kokkos::fence();
+    }
+    // The right-hand side is evaluated and the solution is written.
+    set_throughput_counters(
+            state,
+            problem.grid().size(),
+            2 * problem.grid().size() * sizeof(double));
+    state.counters["iterations"] = solver.get_n_iterations();
+}
+
+} // namespace
+
+BENCHMARK(polar_poisson_setup)->UseRealTime()->Unit(benchmark::kMillisecond);
+// {preconditioner}
+BENCHMARK(polar_poisson_solve)->Arg(0)->Arg(1)->UseRealTime()->Unit(benchmark::kMillisecond);
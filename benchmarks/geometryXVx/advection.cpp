@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/splines.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_utils.hpp"
+#include "bsl_advection_vx.hpp"
+#include "bsl_advection_x.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "geometry.hpp"
+#include "species_info.hpp"
+#include "spline_interpolator.hpp"
+#include "xvx_mesh.hpp"
+
+namespace {
+
+/**
+ * Initialise the kinetic species once per process: electrons followed by ions with a mass
+ * ratio of one. The benchmarks use the first nb_species species.
+ */
+IdxRangeSp init_benchmark_species(std::size_t nb_species)
+{
+    IdxRangeSp const idx_range_sp(IdxSp(0), IdxStepSp(2));
+    if (!ddc::is_discrete_space_initialized<Species>()) {
+        host_t<DFieldMemSp> masses_host(idx_range_sp);
+        host_t<DFieldMemSp> charges_host(idx_range_sp);
+        ddc::for_each(idx_range_sp, [&](IdxSp const isp) {
+            masses_host(isp) = 1.0;
+            charges_host(isp) = (isp == idx_range_sp.front()) ? -1.0 : 1.0;
+        });
+        ddc::init_discrete_space<Species>(std::move(charges_host), std::move(masses_host));
+    }
+    return idx_range_sp.take_first(IdxStepSp(nb_species));
+}
+
+/// Initialise a Maxwellian distribution function.
+void init_distribution(DFieldSpXVx const allfdistribu)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(allfdistribu),
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                double const vx = ddc::coordinate(ddc::select<GridVx>(ispxvx));
+                allfdistribu(ispxvx) = Kokkos::exp(-0.5 * vx * vx);
+            });
+}
+
+void bsl_advection_x(benchmark::State& state)
+{
+    IdxRangeXVx const mesh = init_xvx_mesh();
+    IdxRangeXVx const idx_range_xvx(
+            IdxRangeX(mesh),
+            IdxRangeVx(mesh).take_first(IdxStepVx(state.range(0))));
+    SplineXBuilder const builder_x(idx_range_xvx);
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+    BslAdvectionSpatial<GeometryXVx, GridX> const advection_x(spline_x_interpolator);
+
+    IdxRangeSpXVx const idx_range(init_benchmark_species(state.range(1)), idx_range_xvx);
+    DFieldMemSpXVx allfdistribu_alloc(idx_range);
+    init_distribution(get_field(allfdistribu_alloc));
+
+    for (auto _ : state) {
+        advection_x(get_field(allfdistribu_alloc), 0.1);
+        Kokkos::fence();
+    }
+    // The distribution function and the spline coefficients are each read and written once,
+    // the feet are written then read.
+    set_throughput_counters(state, idx_range.size(), 6 * idx_range.size() * sizeof(double));
+}
+
+void bsl_advection_vx(benchmark::State& state)
+{
+    IdxRangeXVx const mesh = init_xvx_mesh();
+    IdxRangeXVx const idx_range_xvx(
+            IdxRangeX(mesh).take_first(IdxStepX(state.range(0))),
+            IdxRangeVx(mesh));
+    SplineVxBuilder const builder_vx(idx_range_xvx);
+    ddc::ConstantExtrapolationRule<Vx> bv_v_min(ddc::discrete_space<BSplinesVx>().rmin());
+    ddc::ConstantExtrapolationRule<Vx> bv_v_max(ddc::discrete_space<BSplinesVx>().rmax());
+    SplineVxEvaluator const spline_vx_evaluator(bv_v_min, bv_v_max);
+    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+    BslAdvectionVelocity<GeometryXVx, GridVx> const advection_vx(spline_vx_interpolator);
+
+    IdxRangeSpXVx const idx_range(init_benchmark_species(state.range(1)), idx_range_xvx);
+    DFieldMemSpXVx allfdistribu_alloc(idx_range);
+    init_distribution(get_field(allfdistribu_alloc));
+
+    IdxRangeX const idx_range_x(idx_range);
+    DFieldMemX electric_field(idx_range_x);
+    ddc::parallel_fill(get_field(electric_field), 0.5);
+
+    for (auto _ : state) {
+        advection_vx(get_field(allfdistribu_alloc), get_const_field(electric_field), 0.1);
+        Kokkos::fence();
+    }
+    // The distribution function and the spline coefficients are each read and written once,
+    // the feet are written then read.
+    set_throughput_counters(state, idx_range.size(), 6 * idx_range.size() * sizeof(double));
+}
+
+void sizes(benchmark::internal::Benchmark* b)
+{
+    // {batch size, number of species}, the advected dimension has xvx_mesh_ncells cells
+    b->ArgsProduct({{16, 128, 1024}, {1, 2}});
+}
+
+} // namespace
+
+BENCHMARK(bsl_advection_x)->Apply(sizes)->UseRealTime();
+BENCHMARK(bsl_advection_vx)->Apply(sizes)->UseRealTime();
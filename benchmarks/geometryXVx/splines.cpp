@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/splines.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_utils.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "geometry.hpp"
+#include "xvx_mesh.hpp"
+
+namespace {
+
+/**
+ * Build a batch of splines along the interpolation dimension of the builder and evaluate
+ * them at shifted positions, which is the operation carried out by a semi-Lagrangian advection.
+ */
+template <class Builder, class Evaluator>
+void spline_build_evaluate(
+        benchmark::State& state,
+        IdxRangeXVx const idx_range,
+        Builder const& builder,
+        Evaluator const& evaluator)
+{
+    using GridInterp = typename Builder::interpolation_discrete_dimension_type;
+    using Dim = typename GridInterp::continuous_dimension_type;
+
+    DFieldMem<IdxRangeXVx> values_alloc(idx_range);
+    FieldMem<Coord<Dim>, IdxRangeXVx> feet_alloc(idx_range);
+    DFieldMem<typename Builder::batched_spline_domain_type> coefs_alloc(
+            builder.batched_spline_domain());
+
+    DField<IdxRangeXVx> values = get_field(values_alloc);
+    Field<Coord<Dim>, IdxRangeXVx> feet = get_field(feet_alloc);
+    double const min = ddc::coordinate(Idx<GridInterp>(idx_range.front()));
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range,
+            KOKKOS_LAMBDA(IdxXVx const idx) {
+                double const coord = ddc::coordinate(Idx<GridInterp>(idx));
+                values(idx) = Kokkos::cos(coord - min);
+                feet(idx) = Coord<Dim>(0.5 * (coord + min));
+            });
+
+    for (auto _ : state) {
+        builder(get_field(coefs_alloc), get_const_field(values));
+        evaluator(values, get_const_field(feet), get_const_field(coefs_alloc));
+        Kokkos::fence();
+    }
+    // The values and the coefficients are each read and written once, the feet are read once.
+    set_throughput_counters(state, idx_range.size(), 5 * idx_range.size() * sizeof(double));
+}
+
+void spline_x(benchmark::State& state)
+{
+    IdxRangeXVx const mesh = init_xvx_mesh();
+    IdxRangeXVx const idx_range(
+            IdxRangeX(mesh),
+            IdxRangeVx(mesh).take_first(IdxStepVx(state.range(0))));
+    SplineXBuilder const builder(idx_range);
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator const evaluator(bv_x_min, bv_x_max);
+    spline_build_evaluate(state, idx_range, builder, evaluator);
+}
+
+void spline_vx(benchmark::State& state)
+{
+    IdxRangeXVx const mesh = init_xvx_mesh();
+    IdxRangeXVx const idx_range(
+            IdxRangeX(mesh).take_first(IdxStepX(state.range(0))),
+            IdxRangeVx(mesh));
+    SplineVxBuilder const builder(idx_range);
+    ddc::ConstantExtrapolationRule<Vx> bv_v_min(ddc::discrete_space<BSplinesVx>().rmin());
+    ddc::ConstantExtrapolationRule<Vx> bv_v_max(ddc::discrete_space<BSplinesVx>().rmax());
+    SplineVxEvaluator const evaluator(bv_v_min, bv_v_max);
+    spline_build_evaluate(state, idx_range, builder, evaluator);
+}
+
+void sizes(benchmark::internal::Benchmark* b)
+{
+    // {batch size}, the interpolation dimension has xvx_mesh_ncells cells
+    b->Arg(16)->Arg(128)->Arg(1024);
+}
+
+} // namespace
+
+BENCHMARK(spline_x)->Apply(sizes)->UseRealTime();
+BENCHMARK(spline_vx)->Apply(sizes)->UseRealTime();
@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <ddc/ddc.hpp>
+
+#include "geometry.hpp"
+
+/// The number of cells of the (x, vx) mesh shared by all the XVx benchmarks.
+inline constexpr std::size_t xvx_mesh_ncells = 1024;
+
+/**
+ * @brief Initialise the discrete spaces of the (x, vx) mesh used by the XVx benchmarks.
+ *
+ * Google Benchmark calls a benchmark function several times (for the calibration and for
+ * each set of arguments) but a discrete space can only be initialised once per process.
+ * The mesh is therefore initialised at a fixed size by the first call, the following calls
+ * only return its index range. The benchmarks are parametrised by the size of the batch,
+ * which is a sub-range of this mesh.
+ *
+ * @returns The index range of the interpolation points.
+ */
+inline IdxRangeXVx init_xvx_mesh()
+{
+    if (!ddc::is_discrete_space_initialized<GridX>()) {
+        ddc::init_discrete_space<
+                BSplinesX>(CoordX(-M_PI), CoordX(M_PI), IdxStepX(xvx_mesh_ncells));
+        ddc::init_discrete_space<
+                BSplinesVx>(CoordVx(-6.0), CoordVx(6.0), IdxStepVx(xvx_mesh_ncells));
+        ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+        ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+    }
+    return IdxRangeXVx(
+            SplineInterpPointsX::get_domain<GridX>(),
+            SplineInterpPointsVx::get_domain<GridVx>());
+}
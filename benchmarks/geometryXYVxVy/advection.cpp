@@ -0,0 +1,172 @@
+// SPDX-License-Identifier: MIT
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/splines.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_utils.hpp"
+#include "bsl_advection_x.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "fft_advection_x.hpp"
+#include "geometry.hpp"
+#include "species_info.hpp"
+#include "spline_interpolator.hpp"
+#include "tiled_spline_interpolator.hpp"
+
+namespace {
+
+using IdxSpVxVyXY = typename IdxRangeSpVxVyXY::discrete_element_type;
+
+/// The number of cells in each spatial direction.
+constexpr int nx = 64;
+/// The number of cells in each velocity direction. The non-periodic grids have nv + 1 points.
+constexpr int nv = 31;
+
+/**
+ * @brief Initialise the discrete spaces of the (vx, vy, x, y) mesh and of a single species
+ * (electrons).
+ *
+ * A discrete space can only be initialised once per process while Google Benchmark calls
+ * each benchmark several times, so the mesh is only initialised by the first call.
+ *
+ * @returns The index range of the distribution function.
+ */
+IdxRangeSpVxVyXY init_vxvyxy_mesh()
+{
+    IdxRangeSp const idx_range_sp(IdxSp(0), IdxStepSp(1));
+    if (!ddc::is_discrete_space_initialized<GridX>()) {
+        ddc::init_discrete_space<BSplinesX>(CoordX(0.0), CoordX(4 * M_PI), IdxStepX(nx));
+        ddc::init_discrete_space<BSplinesY>(CoordY(0.0), CoordY(4 * M_PI), IdxStepY(nx));
+        ddc::init_discrete_space<BSplinesVx>(CoordVx(-6.0), CoordVx(6.0), IdxStepVx(nv));
+        ddc::init_discrete_space<BSplinesVy>(CoordVy(-6.0), CoordVy(6.0), IdxStepVy(nv));
+        ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+        ddc::init_discrete_space<GridY>(SplineInterpPointsY::get_sampling<GridY>());
+        ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+        ddc::init_discrete_space<GridVy>(SplineInterpPointsVy::get_sampling<GridVy>());
+
+        host_t<DFieldMemSp> masses_host(idx_range_sp);
+        host_t<DFieldMemSp> charges_host(idx_range_sp);
+        ddc::parallel_fill(get_field(masses_host), 1.0);
+        ddc::parallel_fill(get_field(charges_host), -1.0);
+        ddc::init_discrete_space<Species>(std::move(charges_host), std::move(masses_host));
+    }
+
+    return IdxRangeSpVxVyXY(
+            idx_range_sp,
+            SplineInterpPointsVx::get_domain<GridVx>(),
+            SplineInterpPointsVy::get_domain<GridVy>(),
+            SplineInterpPointsX::get_domain<GridX>(),
+            SplineInterpPointsY::get_domain<GridY>());
+}
+
+/**
+ * @brief Get the index range of the distribution function where only the first nvy points
+ * of the vy grid are kept. This changes the size of the batch without redefining the mesh.
+ */
+IdxRangeSpVxVyXY restrict_vy(IdxRangeSpVxVyXY const idx_range, int nvy)
+{
+    return IdxRangeSpVxVyXY(
+            ddc::remove_dims_of<GridVy>(idx_range),
+            IdxRangeVy(idx_range).take_first(IdxStepVy(nvy)));
+}
+
+/// Initialise a Maxwellian distribution function with a perturbation along x.
+void init_distribution(DFieldSpVxVyXY const allfdistribu)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(allfdistribu),
+            KOKKOS_LAMBDA(IdxSpVxVyXY const idx) {
+                double const x = ddc::coordinate(ddc::select<GridX>(idx));
+                double const vx = ddc::coordinate(ddc::select<GridVx>(idx));
+                double const vy = ddc::coordinate(ddc::select<GridVy>(idx));
+                double const maxwellian = Kokkos::exp(-0.5 * (vx * vx + vy * vy));
+                allfdistribu(idx) = (1.0 + 0.05 * Kokkos::cos(0.5 * x)) * maxwellian;
+            });
+}
+
+void bsl_advection_x_4d(benchmark::State& state)
+{
+    IdxRangeSpVxVyXY const idx_range = restrict_vy(init_vxvyxy_mesh(), state.range(0));
+    IdxRangeVxVyXY const idx_range_vxvyxy(idx_range);
+    SplineXBuilder const builder_x(idx_range_vxvyxy);
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+    BslAdvectionSpatial<GeometryVxVyXY, GridX> const advection_x(spline_x_interpolator);
+
+    DFieldMemSpVxVyXY allfdistribu_alloc(idx_range);
+    init_distribution(get_field(allfdistribu_alloc));
+
+    for (auto _ : state) {
+        advection_x(get_field(allfdistribu_alloc), 0.1);
+        Kokkos::fence();
+    }
+    // The distribution function and the spline coefficients are each read and written once,
+    // the feet are written then read.
+    set_throughput_counters(state, idx_range.size(), 6 * idx_range.size() * sizeof(double));
+}
+
+void bsl_advection_x_4d_tiled(benchmark::State& state)
+{
+    IdxRangeSpVxVyXY const idx_range = restrict_vy(init_vxvyxy_mesh(), state.range(0));
+    IdxRangeVxVyXY const idx_range_vxvyxy(idx_range);
+    SplineXBuilder const builder_x(idx_range_vxvyxy);
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableTiledSplineInterpolator const
+            spline_x_interpolator(builder_x, spline_x_evaluator, state.range(1));
+    BslAdvectionSpatial<GeometryVxVyXY, GridX> const advection_x(spline_x_interpolator);
+
+    DFieldMemSpVxVyXY allfdistribu_alloc(idx_range);
+    init_distribution(get_field(allfdistribu_alloc));
+
+    for (auto _ : state) {
+        advection_x(get_field(allfdistribu_alloc), 0.1);
+        Kokkos::fence();
+    }
+    // The distribution function is read and written once and the feet are written then read.
+    // The spline coefficients of a tile are expected to remain in cache.
+    set_throughput_counters(state, idx_range.size(), 4 * idx_range.size() * sizeof(double));
+}
+
+void fft_advection_x_4d(benchmark::State& state)
+{
+    // The operator initialises the Fourier space and creates the FFT plans for the whole mesh
+    // so it is built once and shared by all the runs.
+    IdxRangeSpVxVyXY const idx_range = init_vxvyxy_mesh();
+    FFTAdvectionSpatial<GeometryVxVyXY, GridX> const& advection_x
+            = get_shared_benchmark_object<FFTAdvectionSpatial<GeometryVxVyXY, GridX>>(idx_range);
+
+    DFieldMemSpVxVyXY allfdistribu_alloc(idx_range);
+    init_distribution(get_field(allfdistribu_alloc));
+
+    for (auto _ : state) {
+        advection_x(get_field(allfdistribu_alloc), 0.1);
+        Kokkos::fence();
+    }
+    // The distribution function is read and written once and the (half-size) complex Fourier
+    // modes are written, read and written again then read.
+    set_throughput_counters(state, idx_range.size(), 6 * idx_range.size() * sizeof(double));
+}
+
+void sizes(benchmark::internal::Benchmark* b)
+{
+    // {number of vy points}, at most nv + 1
+    b->Arg(8)->Arg(nv + 1);
+}
+
+void tiled_sizes(benchmark::internal::Benchmark* b)
+{
+    // {number of vy points, maximum number of vx points in a tile}
+    // The nv + 1 = 32 vx points are split into tiles of equal size.
+    b->ArgsProduct({{8, nv + 1}, {1, 8}});
+}
+
+} // namespace
+
+BENCHMARK(bsl_advection_x_4d)->Apply(sizes)->UseRealTime();
+BENCHMARK(bsl_advection_x_4d_tiled)->Apply(tiled_sizes)->UseRealTime();
+BENCHMARK(fft_advection_x_4d)->UseRealTime();
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+#include <algorithm>
+
+#include <Kokkos_Core.hpp>
+#include <benchmark/benchmark.h>
+
+#include "benchmark_utils.hpp"
+#include "matrix_batch_csr.hpp"
+#include "matrix_batch_tridiag.hpp"
+
+namespace {
+
+using DeviceView2D = Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace>;
+using DeviceIntView1D = Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace>;
+
+void tridiag_solve(benchmark::State& state)
+{
+    int const mat_size = state.range(0);
+    int const batch_size = state.range(1);
+
+    DeviceView2D A_view("A", batch_size, mat_size);
+    DeviceView2D B_view("B", batch_size, mat_size);
+    DeviceView2D C_view("C", batch_size, mat_size);
+    DeviceView2D rhs_view("R", batch_size, mat_size);
+    Kokkos::deep_copy(A_view, -1.);
+    Kokkos::deep_copy(B_view, 4.);
+    Kokkos::deep_copy(C_view, -1.);
+    Kokkos::deep_copy(rhs_view, 1.);
+
+    MatrixBatchTridiag<Kokkos::DefaultExecutionSpace>
+            matrix(batch_size, mat_size, A_view, B_view, C_view);
+    matrix.setup_solver();
+
+    for (auto _ : state) {
+        matrix.solve(rhs_view);
+        Kokkos::fence();
+    }
+    std::size_t const n_points = std::size_t(batch_size) * mat_size;
+    // The 3 diagonals are read, the right-hand side is read and written.
+    set_throughput_counters(state, n_points, 5 * n_points * sizeof(double));
+}
+
+/**
+ * Solve a batch of 1D Laplacian-like systems (diagonally dominant) stored in CSR format.
+ */
+template <MatrixBatchCsrSolver Solver>
+void csr_solve(benchmark::State& state)
+{
+    int const mat_size = state.range(0);
+    int const batch_size = state.range(1);
+    int const nnz = 3 * mat_size - 2;
+
+    auto values_host = Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::HostSpace>(
+            "values",
+            batch_size,
+            nnz);
+    auto cols_idx_host = Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::HostSpace>("cols", nnz);
+    auto nnz_per_row_host = Kokkos::View<
+            int*,
+            Kokkos::LayoutRight,
+            Kokkos::HostSpace>("nnz_per_row", mat_size + 1);
+
+    int k = 0;
+    nnz_per_row_host(0) = 0;
+    for (int i = 0; i < mat_size; ++i) {
+        for (int j = std::max(i - 1, 0); j < std::min(i + 2, mat_size); ++j) {
+            cols_idx_host(k) = j;
+            for (int batch_idx = 0; batch_idx < batch_size; ++batch_idx) {
+                values_host(batch_idx, k) = (i == j) ? 4. : -1.;
+            }
+            k++;
+        }
+        nnz_per_row_host(i + 1) = k;
+    }
+
+    DeviceView2D values("values", batch_size, nnz);
+    DeviceIntView1D cols_idx("cols", nnz);
+    DeviceIntView1D nnz_per_row("nnz_per_row", mat_size + 1);
+    Kokkos::deep_copy(values, values_host);
+    Kokkos::deep_copy(cols_idx, cols_idx_host);
+    Kokkos::deep_copy(nnz_per_row, nnz_per_row_host);
+
+    MatrixBatchCsr<Kokkos::DefaultExecutionSpace, Solver>
+            matrix(values, cols_idx, nnz_per_row, 1000, 1e-12);
+    matrix.setup_solver();
+
+    DeviceView2D rhs_view("R", batch_size, mat_size);
+    DeviceView2D x_view("X", batch_size, mat_size);
+    Kokkos::deep_copy(rhs_view, 1.);
+
+    for (auto _ : state) {
+        Kokkos::deep_copy(x_view, 0.);
+        matrix.solve(x_view, rhs_view);
+        Kokkos::fence();
+    }
+    std::size_t const n_points = std::size_t(batch_size) * mat_size;
+    // Lower bound: the matrix and the vectors are each read or written once.
+    set_throughput_counters(
+            state,
+            n_points,
+            (std::size_t(batch_size) * nnz + 2 * n_points) * sizeof(double));
+}
+
+void sizes(benchmark::internal::Benchmark* b)
+{
+    // {matrix size, batch size}
+    b->ArgsProduct({{64, 256, 1024}, {1, 64, 1024}});
+}
+
+} // namespace
+
+BENCHMARK(tridiag_solve)->Apply(sizes)->UseRealTime();
+BENCHMARK(csr_solve<MatrixBatchCsrSolver::CG>)->Apply(sizes)->UseRealTime();
+BENCHMARK(csr_solve<MatrixBatchCsrSolver::BICGSTAB>)->Apply(sizes)->UseRealTime();
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+#include <chrono>
+
+#include <mpi.h>
+
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_utils.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "mpilayout.hpp"
+#include "mpitransposealltoall.hpp"
+
+namespace {
+
+struct Batch
+{
+};
+struct Y
+{
+};
+struct Z
+{
+};
+
+struct GridBatch : UniformGridBase<Batch>
+{
+};
+struct GridY : UniformGridBase<Y>
+{
+};
+struct GridZ : UniformGridBase<Z>
+{
+};
+
+using IdxBYZ = Idx<GridBatch, GridY, GridZ>;
+using IdxStepBYZ = IdxStep<GridBatch, GridY, GridZ>;
+using IdxRangeBYZ = IdxRange<GridBatch, GridY, GridZ>;
+using IdxRangeYZB = IdxRange<GridY, GridZ, GridBatch>;
+
+using YDistribLayout = MPILayout<IdxRangeBYZ, GridY>;
+using ZDistribLayout = MPILayout<IdxRangeYZB, GridZ>;
+
+/**
+ * Redistribute a 3D field distributed along y into a field distributed along z.
+ *
+ * The time of an iteration is the time of the slowest rank. The number of iterations is
+ * fixed so that all the ranks take part in the same number of collective calls.
+ */
+void alltoall_transpose(benchmark::State& state)
+{
+    std::size_t const n = state.range(0);
+    std::size_t const nbatch = state.range(1);
+    IdxRangeBYZ const full_idx_range(IdxBYZ(0, 0, 0), IdxStepBYZ(nbatch, n, n));
+
+    MPITransposeAllToAll<YDistribLayout, ZDistribLayout> transpose(full_idx_range, MPI_COMM_WORLD);
+
+    DFieldMem<IdxRangeBYZ> send_buffer(transpose.get_local_idx_range<YDistribLayout>());
+    DFieldMem<IdxRangeYZB> recv_buffer(transpose.get_local_idx_range<ZDistribLayout>());
+    ddc::parallel_fill(get_field(send_buffer), 1.0);
+
+    for (auto _ : state) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        auto const start = std::chrono::high_resolution_clock::now();
+        transpose(
+                Kokkos::DefaultExecutionSpace(),
+                get_field(recv_buffer),
+                get_const_field(send_buffer));
+        Kokkos::fence();
+        auto const end = std::chrono::high_resolution_clock::now();
+        double elapsed_seconds = std::chrono::duration<double>(end - start).count();
+        MPI_Allreduce(MPI_IN_PLACE, &elapsed_seconds, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        state.SetIterationTime(elapsed_seconds);
+    }
+    // Each element of the global field is sent once and received once.
+    set_throughput_counters(
+            state,
+            full_idx_range.size(),
+            2 * full_idx_range.size() * sizeof(double));
+}
+
+} // namespace
+
+// {grid size in the distributed dimensions, batch size}
+BENCHMARK(alltoall_transpose)
+        ->ArgsProduct({{64, 256}, {1, 64}})
+        ->UseManualTime()
+        ->Iterations(20);
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: MIT
+#include <algorithm>
+#include <string_view>
+#include <vector>
+
+#include <mpi.h>
+
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+/// A reporter which discards the results. It is used on all ranks except rank 0.
+class NullReporter : public ::benchmark::BenchmarkReporter
+{
+public:
+    bool ReportContext(Context const&) override
+    {
+        return true;
+    }
+
+    void ReportRuns(std::vector<Run> const&) override {}
+};
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv);
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    // Only rank 0 writes the output file.
+    std::vector<char*> args(argv, argv + argc);
+    if (rank != 0) {
+        args.erase(
+                std::remove_if(
+                        args.begin(),
+                        args.end(),
+                        [](char* arg) {
+                            return std::string_view(arg).substr(0, 15) == "--benchmark_out";
+                        }),
+                args.end());
+    }
+    int nargs = args.size();
+
+    ::benchmark::Initialize(&nargs, args.data());
+    if (::benchmark::ReportUnrecognizedArguments(nargs, args.data())) {
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+    {
+        ::Kokkos::ScopeGuard kokkos_scope(nargs, args.data());
+        ::ddc::ScopeGuard ddc_scope(nargs, args.data());
+        if (rank == 0) {
+            ::benchmark::RunSpecifiedBenchmarks();
+        } else {
+            NullReporter null_reporter;
+            ::benchmark::RunSpecifiedBenchmarks(&null_reporter);
+        }
+        ::benchmark::Shutdown();
+    }
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,202 @@
+// SPDX-License-Identifier: MIT
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "9patches_2d_periodic_strips_uniform.hpp"
+#include "benchmark_utils.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "multipatch_field.hpp"
+#include "multipatch_field_mem.hpp"
+#include "multipatch_flat_idx_range.hpp"
+#include "multipatch_type.hpp"
+#include "rk4.hpp"
+#include "types.hpp"
+
+namespace {
+
+using namespace periodic_strips_uniform_2d_9patches;
+
+/// The number of cells along each dimension of a patch.
+constexpr int patch_ncells = 512;
+
+/**
+ * Initialise the grids of a patch with patch_ncells x patch_ncells cells on [0, 1] x [0, 1]
+ * and return the first n + 1 points along each dimension.
+ *
+ * A discrete space can only be initialised once per process while Google Benchmark calls
+ * each benchmark several times and both benchmarks use the same patches. The grids are
+ * therefore only initialised by the first call and the size of the problem is chosen by
+ * taking a sub-range of these grids.
+ */
+template <class Patch>
+typename Patch::IdxRange12 init_patch(int n)
+{
+    if (!ddc::is_discrete_space_initialized<typename Patch::Grid1>()) {
+        typename Patch::IdxStep1 const n1(patch_ncells + 1);
+        typename Patch::IdxStep2 const n2(patch_ncells + 1);
+        ddc::init_discrete_space<typename Patch::Grid1>(Patch::Grid1::init(
+                typename Patch::Coord1(0.0),
+                typename Patch::Coord1(1.0),
+                n1));
+        ddc::init_discrete_space<typename Patch::Grid2>(Patch::Grid2::init(
+                typename Patch::Coord2(0.0),
+                typename Patch::Coord2(1.0),
+                n2));
+    }
+    return typename Patch::IdxRange12(
+            typename Patch::Idx12(0, 0),
+            typename Patch::IdxStep12(n + 1, n + 1));
+}
+
+/// Carry out one RK4 step of y' = -y on one patch.
+template <class Patch>
+void rk4_step_on_patch(RK4<DFieldMemOnPatch<Patch>> const& timestepper, DFieldOnPatch<Patch> y)
+{
+    timestepper.update(y, 0.1, [](DFieldOnPatch<Patch> dy, DConstFieldOnPatch<Patch> y) {
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                get_idx_range(dy),
+                KOKKOS_LAMBDA(typename Patch::Idx12 const idx) { dy(idx) = -y(idx); });
+    });
+}
+
+/// Calculate dy = -y at one point if this point is found on the patch.
+template <class Patch, class FlatIdxRange, class MultipatchDerivField, class MultipatchConstField>
+KOKKOS_FUNCTION void derivative_on_patch(
+        FlatIdxRange const& flat_idx_range,
+        int const flat_idx,
+        MultipatchDerivField const& dy,
+        MultipatchConstField const& y)
+{
+    if (flat_idx_range.template contains<Patch>(flat_idx)) {
+        typename Patch::Idx12 const idx
+                = flat_idx_range.template to_discrete_element<Patch>(flat_idx);
+        dy.template get<Patch>()(idx) = -y.template get<Patch>()(idx);
+    }
+}
+
+/// Calculate y = y + dt * dy at one point if this point is found on the patch.
+template <class Patch, class FlatIdxRange, class MultipatchValField, class MultipatchConstField>
+KOKKOS_FUNCTION void update_on_patch(
+        FlatIdxRange const& flat_idx_range,
+        int const flat_idx,
+        MultipatchValField const& y,
+        MultipatchConstField const& dy,
+        double const dt)
+{
+    if (flat_idx_range.template contains<Patch>(flat_idx)) {
+        typename Patch::Idx12 const idx
+                = flat_idx_range.template to_discrete_element<Patch>(flat_idx);
+        y.template get<Patch>()(idx) += dt * dy.template get<Patch>()(idx);
+    }
+}
+
+/**
+ * Advance y' = -y with a RK4 scheme on the 9 patches. Each patch is treated separately
+ * so there are as many kernel launches as there are patches.
+ */
+template <class... Patches>
+void rk4_per_patch_impl(benchmark::State& state)
+{
+    int const n = state.range(0);
+    std::tuple<typename Patches::IdxRange12...> const idx_ranges(init_patch<Patches>(n)...);
+    std::tuple<DFieldMemOnPatch<Patches>...> values_alloc(
+            DFieldMemOnPatch<Patches>(std::get<typename Patches::IdxRange12>(idx_ranges))...);
+    std::tuple<RK4<DFieldMemOnPatch<Patches>>...> const timesteppers(
+            RK4<DFieldMemOnPatch<Patches>>(std::get<typename Patches::IdxRange12>(idx_ranges))...);
+    (ddc::parallel_fill(get_field(std::get<DFieldMemOnPatch<Patches>>(values_alloc)), 1.0), ...);
+
+    for (auto _ : state) {
+        (rk4_step_on_patch<Patches>(
+                 std::get<RK4<DFieldMemOnPatch<Patches>>>(timesteppers),
+                 get_field(std::get<DFieldMemOnPatch<Patches>>(values_alloc))),
+         ...);
+        Kokkos::fence();
+    }
+    std::size_t const n_points = (std::get<typename Patches::IdxRange12>(idx_ranges).size() + ...);
+    // 3 copies, 4 derivatives, 4 updates and the assembly of the derivatives
+    set_throughput_counters(state, n_points, 31 * n_points * sizeof(double));
+}
+
+/**
+ * Advance y' = -y with a RK4 scheme on the 9 patches. All the patches are treated in
+ * a single kernel using MultipatchFlatIdxRange.
+ */
+template <class... Patches>
+void rk4_multipatch_fused_impl(benchmark::State& state)
+{
+    using DMultipatchFieldMem = MultipatchFieldMem<DFieldMemOnPatch, Patches...>;
+    using DMultipatchField = typename DMultipatchFieldMem::span_type;
+    using DMultipatchConstField = typename DMultipatchFieldMem::view_type;
+
+    int const n = state.range(0);
+    MultipatchType<IdxRangeOnPatch, Patches...> const idx_ranges(init_patch<Patches>(n)...);
+    DMultipatchFieldMem values_alloc(idx_ranges);
+    DMultipatchField values(values_alloc);
+    (ddc::parallel_fill(values.template get<Patches>(), 1.0), ...);
+    RK4<DMultipatchFieldMem> const timestepper(idx_ranges);
+
+    MultipatchFlatIdxRange const flat_idx_range(idx_ranges);
+    Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace> const
+            policy(Kokkos::DefaultExecutionSpace(), 0, flat_idx_range.size());
+
+    for (auto _ : state) {
+        timestepper.update(
+                Kokkos::DefaultExecutionSpace(),
+                values,
+                0.1,
+                [&](DMultipatchField dy, DMultipatchConstField y) {
+                    Kokkos::parallel_for(
+                            policy,
+                            KOKKOS_LAMBDA(int const flat_idx) {
+                                ((derivative_on_patch<Patches>(flat_idx_range, flat_idx, dy, y)),
+                                 ...);
+                            });
+                },
+                [&](DMultipatchField y, DMultipatchConstField dy, double dt) {
+                    Kokkos::parallel_for(
+                            policy,
+                            KOKKOS_LAMBDA(int const flat_idx) {
+                                ((update_on_patch<Patches>(flat_idx_range, flat_idx, y, dy, dt)),
+                                 ...);
+                            });
+                });
+        Kokkos::fence();
+    }
+    std::size_t const n_points = flat_idx_range.size();
+    // 3 copies, 4 derivatives, 4 updates and the assembly of the derivatives
+    set_throughput_counters(state, n_points, 31 * n_points * sizeof(double));
+}
+
+void rk4_per_patch(benchmark::State& state)
+{
+    rk4_per_patch_impl<Patch1, Patch2, Patch3, Patch4, Patch5, Patch6, Patch7, Patch8, Patch9>(
+            state);
+}
+
+void rk4_multipatch_fused(benchmark::State& state)
+{
+    rk4_multipatch_fused_impl<
+            Patch1,
+            Patch2,
+            Patch3,
+            Patch4,
+            Patch5,
+            Patch6,
+            Patch7,
+            Patch8,
+            Patch9>(state);
+}
+
+void sizes(benchmark::internal::Benchmark* b)
+{
+    // {number of cells along each dimension of a patch}, at most patch_ncells
+    b->Arg(8)->Arg(32)->Arg(128)->Arg(patch_ncells);
+}
+
+} // namespace
+
+BENCHMARK(rk4_per_patch)->Apply(sizes)->UseRealTime();
+BENCHMARK(rk4_multipatch_fused)->Apply(sizes)->UseRealTime();
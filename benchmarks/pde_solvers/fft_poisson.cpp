@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: MIT
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_utils.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "fft_poisson_solver.hpp"
+
+namespace {
+
+struct Batch
+{
+};
+
+struct X
+{
+    static bool constexpr PERIODIC = true;
+};
+
+struct Y
+{
+    static bool constexpr PERIODIC = true;
+};
+
+struct GridBatch : UniformGridBase<Batch>
+{
+};
+struct GridX : UniformGridBase<X>
+{
+};
+struct GridY : UniformGridBase<Y>
+{
+};
+
+using IdxBXY = Idx<GridBatch, GridX, GridY>;
+using IdxStepBXY = IdxStep<GridBatch, GridX, GridY>;
+using IdxRangeXY = IdxRange<GridX, GridY>;
+using IdxRangeBXY = IdxRange<GridBatch, GridX, GridY>;
+
+using VectorFieldMemBXY = VectorFieldMem<double, IdxRangeBXY, VectorIndexSet<X, Y>>;
+
+using PoissonSolver = FFTPoissonSolver<IdxRangeXY, IdxRangeBXY, Kokkos::DefaultExecutionSpace>;
+
+/// The number of cells in each dimension and the maximum batch size.
+constexpr std::size_t ncells = 256;
+constexpr std::size_t nbatch_max = 8;
+
+/// Initialise the discrete spaces of the (batch, x, y) mesh and return its index range.
+IdxRangeBXY init_bxy_mesh()
+{
+    Coord<Batch> const batch_min(0.0);
+    Coord<Batch> const batch_max(1.0);
+    ddc::init_discrete_space<GridBatch>(
+            GridBatch::init<GridBatch>(batch_min, batch_max, IdxStep<GridBatch>(nbatch_max)));
+    ddc::init_discrete_space<GridX>(
+            GridX::init<GridX>(Coord<X>(0.0), Coord<X>(2.0 * M_PI), IdxStep<GridX>(ncells + 1)));
+    ddc::init_discrete_space<GridY>(
+            GridY::init<GridY>(Coord<Y>(0.0), Coord<Y>(2.0 * M_PI), IdxStep<GridY>(ncells + 1)));
+    return IdxRangeBXY(IdxBXY(0, 0, 0), IdxStepBXY(nbatch_max, ncells, ncells));
+}
+
+/**
+ * The mesh and the solver, whose constructor initialises the Fourier space. They are built
+ * once per process and shared by all the runs of the benchmark.
+ */
+struct FFTPoissonProblem
+{
+    IdxRangeBXY const idx_range;
+    PoissonSolver const poisson;
+
+    FFTPoissonProblem() : idx_range(init_bxy_mesh()), poisson(IdxRangeXY(idx_range)) {}
+};
+
+void fft_poisson_2d(benchmark::State& state)
+{
+    FFTPoissonProblem const& problem = get_shared_benchmark_object<FFTPoissonProblem>();
+    IdxRangeBXY const idx_range(
+            IdxRange<GridBatch>(problem.idx_range).take_first(IdxStep<GridBatch>(state.range(0))),
+            IdxRangeXY(problem.idx_range));
+    PoissonSolver const& poisson = problem.poisson;
+
+    DFieldMem<IdxRangeBXY> phi_alloc(idx_range);
+    DFieldMem<IdxRangeBXY> rho_alloc(idx_range);
+    VectorFieldMemBXY efield_alloc(idx_range);
+    DField<IdxRangeBXY> rho = get_field(rho_alloc);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range,
+            KOKKOS_LAMBDA(IdxBXY const idx) {
+                double const x = ddc::coordinate(ddc::select<GridX>(idx));
+                double const y = ddc::coordinate(ddc::select<GridY>(idx));
+                rho(idx) = Kokkos::cos(x) + Kokkos::cos(y);
+            });
+
+    for (auto _ : state) {
+        poisson(get_field(phi_alloc), get_field(efield_alloc), get_field(rho_alloc));
+        Kokkos::fence();
+    }
+    // Lower bound: rho is read, phi and the 2 components of the electric field are written.
+    set_throughput_counters(state, idx_range.size(), 4 * idx_range.size() * sizeof(double));
+}
+
+} // namespace
+
+// {batch size}, each dimension of the grid has ncells cells
+BENCHMARK(fft_poisson_2d)->Arg(1)->Arg(nbatch_max)->UseRealTime();
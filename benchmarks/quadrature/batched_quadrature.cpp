@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: MIT
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_utils.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "quadrature.hpp"
+#include "trapezoid_quadrature.hpp"
+
+namespace {
+
+struct Batch
+{
+};
+
+struct X
+{
+    static bool constexpr PERIODIC = false;
+};
+
+struct GridBatch : UniformGridBase<Batch>
+{
+};
+struct GridX : UniformGridBase<X>
+{
+};
+
+using IdxBX = Idx<GridBatch, GridX>;
+using IdxStepBX = IdxStep<GridBatch, GridX>;
+using IdxRangeBatch = IdxRange<GridBatch>;
+using IdxRangeX = IdxRange<GridX>;
+using IdxRangeBX = IdxRange<GridBatch, GridX>;
+
+/// The number of points of the quadrature and the maximum batch size.
+constexpr std::size_t nx = 256;
+constexpr std::size_t nbatch_max = 16384;
+
+/**
+ * Initialise the discrete spaces of the (batch, x) mesh. A discrete space can only be
+ * initialised once per process while Google Benchmark calls each benchmark several times,
+ * so the mesh is only initialised by the first call.
+ */
+IdxRangeBX init_bx_mesh()
+{
+    if (!ddc::is_discrete_space_initialized<GridX>()) {
+        Coord<Batch> const batch_min(0.0);
+        Coord<Batch> const batch_max(1.0);
+        ddc::init_discrete_space<GridBatch>(
+                GridBatch::init<GridBatch>(batch_min, batch_max, IdxStep<GridBatch>(nbatch_max)));
+        ddc::init_discrete_space<GridX>(
+                GridX::init<GridX>(Coord<X>(0.0), Coord<X>(1.0), IdxStep<GridX>(nx)));
+    }
+    return IdxRangeBX(IdxBX(0, 0), IdxStepBX(nbatch_max, nx));
+}
+
+/// Integrate a field which is stored in memory (e.g. the computation of a moment).
+void batched_quadrature_field(benchmark::State& state)
+{
+    IdxRangeBX const mesh = init_bx_mesh();
+    IdxRangeBX const idx_range(
+            IdxRangeBatch(mesh).take_first(IdxStep<GridBatch>(state.range(0))),
+            IdxRangeX(mesh));
+    IdxRangeX const idx_range_x(idx_range);
+    IdxRangeBatch const idx_range_batch(idx_range);
+
+    DFieldMem<IdxRangeX> quad_coeffs(
+            trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(idx_range_x));
+    Quadrature<IdxRangeX, IdxRangeBX> const integrate(get_const_field(quad_coeffs));
+
+    DFieldMem<IdxRangeBX> values_alloc(idx_range);
+    DFieldMem<IdxRangeBatch> results_alloc(idx_range_batch);
+    ddc::parallel_fill(get_field(values_alloc), 1.0);
+    DConstField<IdxRangeBX> values = get_const_field(values_alloc);
+
+    for (auto _ : state) {
+        integrate(Kokkos::DefaultExecutionSpace(), get_field(results_alloc), values);
+        Kokkos::fence();
+    }
+    set_throughput_counters(
+            state,
+            idx_range.size(),
+            (idx_range.size() + idx_range_x.size() + idx_range_batch.size()) * sizeof(double));
+}
+
+void sizes(benchmark::internal::Benchmark* b)
+{
+    // {batch size}, the quadrature has nx points
+    b->Arg(1)->Arg(1024)->Arg(nbatch_max);
+}
+
+} // namespace
+
+BENCHMARK(batched_quadrature_field)->Apply(sizes)->UseRealTime();
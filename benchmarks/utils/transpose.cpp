@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MIT
+#include <ddc/ddc.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_utils.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "transpose.hpp"
+
+namespace {
+
+struct GridX
+{
+};
+struct GridY
+{
+};
+struct GridZ
+{
+};
+
+using IdxRangeXYZ = IdxRange<GridX, GridY, GridZ>;
+using IdxRangeXZY = IdxRange<GridX, GridZ, GridY>;
+using IdxRangeZYX = IdxRange<GridZ, GridY, GridX>;
+
+template <class IdxRangeEnd>
+void transpose(benchmark::State& state)
+{
+    std::size_t const nx = state.range(0);
+    std::size_t const ny = state.range(1);
+    std::size_t const nz = state.range(2);
+    IdxRangeXYZ const start_idx_range(
+            Idx<GridX, GridY, GridZ>(0, 0, 0),
+            IdxStep<GridX, GridY, GridZ>(nx, ny, nz));
+    IdxRangeEnd const end_idx_range(start_idx_range);
+
+    DFieldMem<IdxRangeXYZ> start_values_alloc(start_idx_range);
+    DFieldMem<IdxRangeEnd> end_values_alloc(end_idx_range);
+    ddc::parallel_fill(get_field(start_values_alloc), 1.0);
+
+    for (auto _ : state) {
+        transpose_layout(
+                Kokkos::DefaultExecutionSpace(),
+                get_field(end_values_alloc),
+                get_const_field(start_values_alloc));
+        Kokkos::fence();
+    }
+    set_throughput_counters(
+            state,
+            start_idx_range.size(),
+            2 * start_idx_range.size() * sizeof(double));
+}
+
+/// The reference: a copy with no change of layout.
+void deep_copy(benchmark::State& state)
+{
+    std::size_t const nx = state.range(0);
+    std::size_t const ny = state.range(1);
+    std::size_t const nz = state.range(2);
+    IdxRangeXYZ const idx_range(
+            Idx<GridX, GridY, GridZ>(0, 0, 0),
+            IdxStep<GridX, GridY, GridZ>(nx, ny, nz));
+
+    DFieldMem<IdxRangeXYZ> start_values_alloc(idx_range);
+    DFieldMem<IdxRangeXYZ> end_values_alloc(idx_range);
+    ddc::parallel_fill(get_field(start_values_alloc), 1.0);
+
+    for (auto _ : state) {
+        ddc::parallel_deepcopy(get_field(end_values_alloc), get_const_field(start_values_alloc));
+        Kokkos::fence();
+    }
+    set_throughput_counters(state, idx_range.size(), 2 * idx_range.size() * sizeof(double));
+}
+
+void sizes(benchmark::internal::Benchmark* b)
+{
+    b->Args({8, 512, 512})->Args({64, 256, 256})->Args({1024, 32, 32})->Args({16, 1000, 1000});
+}
+
+} // namespace
+
+BENCHMARK(deep_copy)->Apply(sizes)->UseRealTime();
+// Fastest dimension is changed: tiled transpose
+BENCHMARK(transpose<IdxRangeXZY>)->Apply(sizes)->UseRealTime();
+BENCHMARK(transpose<IdxRangeZYX>)->Apply(sizes)->UseRealTime();
@@ -25,6 +25,7 @@
 #include "geometry.hpp"
 #include "input.hpp"
 #include "l_norm_tools.hpp"
+#include "operator_cache.hpp"
 #include "output.hpp"
 #include "paraconfpp.hpp"
 #include "params.yaml.hpp"
@@ -216,7 +217,8 @@ int main(int argc, char** argv)
             get_const_field(coeff_alpha_spline),
             get_const_field(coeff_beta_spline),
             discrete_mapping,
-            spline_evaluator);
+            spline_evaluator,
+            OperatorCache::init_from_input(conf_gyselalibxx));
 
     // --- Predictor corrector operator ---------------------------------------------------------------
 #if defined(PREDCORR)
@@ -278,6 +280,8 @@ int main(int argc, char** argv)
     ddc::expose_to_pdi("delta_t", dt);
     ddc::expose_to_pdi("final_T", final_T);
     ddc::expose_to_pdi("time_step_diag", PCpp_int(conf_gyselalibxx, ".Output.time_step_diag"));
+    // The mass is recorded at each iteration, including the initial and final states
+    ddc::expose_to_pdi("diag_nrecords", iter_nb + 1);
 
     ddc::expose_to_pdi("slope", exact_rho.get_slope());
 
@@ -21,6 +21,9 @@ Perturbation:
   r_min: 0.45
   r_max: 0.50
   
+PoissonSolver:
+  operator_cache: false
+
 Output:
   time_step_diag: 10
 )PDI_CFG";
@@ -22,6 +22,9 @@ Perturbation:
   y_star_2: 0.14
   sigma: 0.08
   
+PoissonSolver:
+  operator_cache: false
+
 Output:
   time_step_diag: 5
 )PDI_CFG";
@@ -10,9 +10,11 @@ metadata:
 
   iter_saved: int
   time_step_diag: int
+  diag_nrecords: int
 
   iter: int
   time: double
+  poisson_iterations: int
   delta_t: double
   final_T: double
 
@@ -40,6 +42,8 @@ metadata:
 
 
 data:
+  mass: double
+
   x_coords_extents: {type: array,  subtype: int64, size: 2 }
   x_coords:
     type: array
@@ -86,6 +90,23 @@ data:
     subtype: double
     size: [ '$electrical_potential_extents[0]', '$electrical_potential_extents[1]' ]
 
+  operator_cache_key: int64
+  operator_cache_size: int
+  operator_cache_nnz: int
+  operator_cache_stored_key: int64
+  operator_cache_values:
+    type: array
+    subtype: double
+    size: [ 1, '$operator_cache_nnz' ]
+  operator_cache_col_idx:
+    type: array
+    subtype: int
+    size: '$operator_cache_nnz'
+  operator_cache_row_ptr:
+    type: array
+    subtype: int
+    size: '${operator_cache_size} + 1'
+
 
 
 plugins:
@@ -110,6 +131,24 @@ plugins:
       on_event: [iteration, last_iteration]
       when: '${iter} % ${time_step_diag} = 0'
       collision_policy: replace_and_warn
-      write: [time, density, electrical_potential]
+      write: [time, density, electrical_potential, poisson_iterations]
+
+    - file: 'output/GYSELALIBXX_reduced_diagnostics.h5'
+      on_event: [iteration, last_iteration]
+      collision_policy: write_into
+      datasets:
+        mass: { type: array, subtype: double, size: [ '$diag_nrecords' ] }
+      write:
+        mass:
+          dataset_selection: { start: [ '$iter' ], size: [ 1 ] }
+
+    - file: 'GYSELALIBXX_operator_${operator_cache_key}.h5'
+      on_event: [operator_cache_read]
+      read: [operator_cache_values, operator_cache_col_idx, operator_cache_row_ptr, operator_cache_stored_key]
+
+    - file: 'GYSELALIBXX_operator_${operator_cache_key}.h5'
+      on_event: [operator_cache_write]
+      collision_policy: replace_and_warn
+      write: [operator_cache_values, operator_cache_col_idx, operator_cache_row_ptr, operator_cache_stored_key]
   #trace: ~
 )PDI_CFG";
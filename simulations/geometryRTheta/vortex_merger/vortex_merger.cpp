@@ -25,6 +25,7 @@
 #include "geometry.hpp"
 #include "input.hpp"
 #include "l_norm_tools.hpp"
+#include "operator_cache.hpp"
 #include "paraconfpp.hpp"
 #include "params.yaml.hpp"
 #include "pdi_out.yml.hpp"
@@ -189,7 +190,8 @@ int main(int argc, char** argv)
             get_const_field(coeff_alpha_spline),
             get_const_field(coeff_beta_spline),
             discrete_mapping,
-            spline_evaluator);
+            spline_evaluator,
+            OperatorCache::init_from_input(conf_gyselalibxx));
 
     // --- Predictor corrector operator ---------------------------------------------------------------
     BslImplicitPredCorrRTheta predcorr_operator(
@@ -235,6 +237,8 @@ int main(int argc, char** argv)
     ddc::expose_to_pdi("delta_t", dt);
     ddc::expose_to_pdi("final_T", final_T);
     ddc::expose_to_pdi("time_step_diag", PCpp_int(conf_gyselalibxx, ".Output.time_step_diag"));
+    // The mass is recorded at each iteration, including the initial and final states
+    ddc::expose_to_pdi("diag_nrecords", iter_nb + 1);
 
 
     // ================================================================================================
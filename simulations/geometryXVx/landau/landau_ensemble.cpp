@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: MIT
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/fft.hpp>
+#include <ddc/pdi.hpp>
+
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "bsl_advection_vx.hpp"
+#include "bsl_advection_x.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "ensemble_predcorr.hpp"
+#include "ensembleqnsolver.hpp"
+#include "fft_poisson_solver.hpp"
+#include "geometry.hpp"
+#include "input.hpp"
+#include "maxwellianequilibrium.hpp"
+#include "neumann_spline_quadrature.hpp"
+#include "output.hpp"
+#include "paraconfpp.hpp"
+#include "params_ensemble.yaml.hpp"
+#include "pdi_out_ensemble.yml.hpp"
+#include "profiling_collector.hpp"
+#include "singlemodeperturbinitialisation.hpp"
+#include "species_info.hpp"
+#include "species_init.hpp"
+#include "spline_interpolator.hpp"
+
+using std::chrono::steady_clock;
+
+/*
+    This executable runs an ensemble of independent Landau damping simulations (e.g. a scan
+    over the wavenumber or the amplitude of the initial perturbation) as a single batched
+    simulation. All the members share the same mesh and species and are advanced together
+    by the same kernels.
+*/
+int main(int argc, char** argv)
+{
+    PC_tree_t conf_gyselalibxx = parse_executable_arguments(argc, argv, params_ensemble_yaml);
+    PC_tree_t conf_pdi = PC_parse_string(PDI_ENSEMBLE_CFG);
+    PC_errhandler(PC_NULL_HANDLER);
+    PDI_init(conf_pdi);
+
+    Kokkos::ScopeGuard kokkos_scope(argc, argv);
+    ddc::ScopeGuard ddc_scope(argc, argv);
+
+    // Reading config
+    // --> Mesh info
+    IdxRangeX const mesh_x = init_spline_dependent_idx_range<
+            GridX,
+            BSplinesX,
+            SplineInterpPointsX>(conf_gyselalibxx, "x");
+    IdxRangeVx const mesh_vx = init_spline_dependent_idx_range<
+            GridVx,
+            BSplinesVx,
+            SplineInterpPointsVx>(conf_gyselalibxx, "vx");
+
+    IdxStepEnsemble const ensemble_size(PCpp_len(conf_gyselalibxx, ".Ensemble"));
+    IdxRangeEnsemble const idx_range_ensemble(IdxEnsemble(0), ensemble_size);
+    IdxRangeEnsX const meshEnsX(idx_range_ensemble, mesh_x);
+    IdxRangeEnsXVx const meshEnsXVx(idx_range_ensemble, mesh_x, mesh_vx);
+
+    IdxRangeSp const idx_range_kinsp = init_species(conf_gyselalibxx);
+    IdxRangeSpEnsXVx const meshSpEnsXVx(idx_range_kinsp, meshEnsXVx);
+    IdxRangeSpVx const meshSpVx(idx_range_kinsp, mesh_vx);
+
+    SplineXBuilder_EnsXVx const builder_x(meshEnsXVx);
+    SplineVxBuilder_EnsXVx const builder_vx(meshEnsXVx);
+
+    // Initialisation of the distribution function
+    DFieldMemSpVx allfequilibrium(meshSpVx);
+    MaxwellianEquilibrium const init_fequilibrium
+            = MaxwellianEquilibrium::init_from_input(idx_range_kinsp, conf_gyselalibxx);
+    init_fequilibrium(get_field(allfequilibrium));
+
+    // Each member of the ensemble has its own perturbation mode and amplitude
+    SingleModePerturbEnsembleInitialisation const init
+            = SingleModePerturbEnsembleInitialisation::init_from_input(
+                    get_const_field(allfequilibrium),
+                    idx_range_ensemble,
+                    conf_gyselalibxx);
+    DFieldMemSpEnsXVx allfdistribu(meshSpEnsXVx);
+    init(get_field(allfdistribu));
+    auto allfequilibrium_host = ddc::create_mirror_view_and_copy(get_field(allfequilibrium));
+
+    // --> Algorithm info
+    double const deltat = PCpp_double(conf_gyselalibxx, ".Algorithm.deltat");
+    int const nbiter = static_cast<int>(PCpp_int(conf_gyselalibxx, ".Algorithm.nbiter"));
+
+    // --> Output info
+    double const time_diag = PCpp_double(conf_gyselalibxx, ".Output.time_diag");
+    int const nbstep_diag = int(time_diag / deltat);
+
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+
+    // Creating operators
+    SplineXEvaluator_EnsXVx const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+
+    ddc::ConstantExtrapolationRule<Vx> bv_v_min(ddc::coordinate(mesh_vx.front()));
+    ddc::ConstantExtrapolationRule<Vx> bv_v_max(ddc::coordinate(mesh_vx.back()));
+
+    SplineVxEvaluator_EnsXVx const spline_vx_evaluator(bv_v_min, bv_v_max);
+    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+
+    BslAdvectionSpatial<GeometryEnsXVx, GridX> const advection_x(spline_x_interpolator);
+    BslAdvectionVelocity<GeometryEnsXVx, GridVx> const advection_vx(spline_vx_interpolator);
+
+    DFieldMemVx const quadrature_coeffs(neumann_spline_quadrature_coefficients<
+                                        Kokkos::DefaultExecutionSpace>(mesh_vx, builder_vx));
+
+    // The Poisson solver is batched over the members of the ensemble
+    FFTPoissonSolver<IdxRangeX, IdxRangeEnsX> const fft_poisson_solver(mesh_x);
+    EnsembleQNSolver const poisson(fft_poisson_solver, get_const_field(quadrature_coeffs));
+
+    EnsemblePredCorr const predcorr(advection_x, advection_vx, poisson);
+
+    // Starting the code
+    /*
+        The saved fields have a dimension indexing the members of the ensemble after the
+        species dimension. The parameters of each member are saved in the initial state file.
+    */
+    ddc::expose_to_pdi("Nx_spline_cells", ddc::discrete_space<BSplinesX>().ncells());
+    ddc::expose_to_pdi("Nvx_spline_cells", ddc::discrete_space<BSplinesVx>().ncells());
+    expose_mesh_to_pdi("MeshX", mesh_x);
+    expose_mesh_to_pdi("MeshVx", mesh_vx);
+    ddc::expose_to_pdi("nbstep_diag", nbstep_diag);
+    ddc::expose_to_pdi("Nkinspecies", idx_range_kinsp.size());
+    ddc::expose_to_pdi(
+            "fdistribu_charges",
+            ddc::discrete_space<Species>().charges()[idx_range_kinsp]);
+    ddc::expose_to_pdi(
+            "fdistribu_masses",
+            ddc::discrete_space<Species>().masses()[idx_range_kinsp]);
+    ddc::expose_to_pdi("perturb_amplitude", init.get_perturb_amplitude());
+    ddc::expose_to_pdi("perturb_mode", init.get_perturb_mode());
+    ddc::PdiEvent("initial_state").with("fdistribu_eq", allfequilibrium_host);
+
+    ProfilingCollector const profiler = ProfilingCollector::init_from_input(conf_gyselalibxx);
+
+    steady_clock::time_point const start = steady_clock::now();
+
+    predcorr(get_field(allfdistribu), 0., deltat, nbiter);
+
+    steady_clock::time_point const end = steady_clock::now();
+
+    double const simulation_time = std::chrono::duration<double>(end - start).count();
+    std::cout << "Simulation time: " << simulation_time << "s\n";
+
+    profiler.report();
+    profiler.write_to_pdi();
+
+    PC_tree_destroy(&conf_pdi);
+
+    PDI_finalize();
+
+    PC_tree_destroy(&conf_gyselalibxx);
+
+    return EXIT_SUCCESS;
+}
@@ -27,6 +27,7 @@
 #include "params.yaml.hpp"
 #include "pdi_out.yml.hpp"
 #include "predcorr.hpp"
+#include "profiling_collector.hpp"
 #include "qnsolver.hpp"
 #include "restartinitialisation.hpp"
 #include "singlemodeperturbinitialisation.hpp"
@@ -154,6 +155,8 @@ int main(int argc, char** argv)
             ddc::discrete_space<Species>().masses()[idx_range_kinsp]);
     ddc::PdiEvent("initial_state").with("fdistribu_eq", allfequilibrium_host);
 
+    ProfilingCollector const profiler = ProfilingCollector::init_from_input(conf_gyselalibxx);
+
     steady_clock::time_point const start = steady_clock::now();
 
     predcorr(get_field(allfdistribu), time_start, deltat, nbiter);
@@ -163,6 +166,9 @@ int main(int argc, char** argv)
     double const simulation_time = std::chrono::duration<double>(end - start).count();
     std::cout << "Simulation time: " << simulation_time << "s\n";
 
+    profiler.report();
+    profiler.write_to_pdi();
+
     PC_tree_destroy(&conf_pdi);
 
     PDI_finalize();
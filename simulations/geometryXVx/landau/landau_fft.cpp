@@ -4,7 +4,9 @@
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <optional>
 #include <string_view>
 
 #include <ddc/ddc.hpp>
@@ -18,6 +20,7 @@
 #include "chargedensitycalculator.hpp"
 #include "ddc_alias_inline_functions.hpp"
 #include "fft_poisson_solver.hpp"
+#include "field_extrapolation_time_solver.hpp"
 #include "geometry.hpp"
 #include "input.hpp"
 #include "maxwellianequilibrium.hpp"
@@ -27,13 +30,17 @@
 #include "params.yaml.hpp"
 #include "pdi_out.yml.hpp"
 #include "predcorr.hpp"
+#include "profiling_collector.hpp"
 #include "qnsolver.hpp"
+#include "quadrature.hpp"
+#include "reduced_diagnostics.hpp"
 #include "restartinitialisation.hpp"
 #include "singlemodeperturbinitialisation.hpp"
 #include "species_info.hpp"
 #include "species_init.hpp"
 #include "spline_interpolator.hpp"
 #include "splitvlasovsolver.hpp"
+#include "trapezoid_quadrature.hpp"
 
 using std::cerr;
 using std::endl;
@@ -97,10 +104,23 @@ int main(int argc, char** argv)
     // --> Algorithm info
     double const deltat = PCpp_double(conf_gyselalibxx, ".Algorithm.deltat");
     int const nbiter = static_cast<int>(PCpp_int(conf_gyselalibxx, ".Algorithm.nbiter"));
+    bool field_extrapolation = false;
+    if (PCpp_get(conf_gyselalibxx, ".Algorithm.field_extrapolation").status == PC_OK) {
+        field_extrapolation = PCpp_bool(conf_gyselalibxx, ".Algorithm.field_extrapolation");
+    }
 
     // --> Output info
     double const time_diag = PCpp_double(conf_gyselalibxx, ".Output.time_diag");
     int const nbstep_diag = int(time_diag / deltat);
+    // The reduced diagnostics are only computed if their period is provided and positive.
+    // They are computed by the predictor-corrector scheme only.
+    int nbstep_reduced_diag = 0;
+    int nb_phi_modes = 0;
+    if (!field_extrapolation
+        && PCpp_get(conf_gyselalibxx, ".Output.nbstep_reduced_diag").status == PC_OK) {
+        nbstep_reduced_diag = PCpp_int(conf_gyselalibxx, ".Output.nbstep_reduced_diag");
+        nb_phi_modes = PCpp_int(conf_gyselalibxx, ".Output.nb_phi_modes");
+    }
 
 #ifdef PERIODIC_RDIMX
     ddc::PeriodicExtrapolationRule<X> bv_x_min;
@@ -132,7 +152,46 @@ int main(int argc, char** argv)
     FFTPoissonSolver<IdxRangeX> fft_poisson_solver(mesh_x);
     QNSolver const poisson(fft_poisson_solver, rhs);
 
-    PredCorr const predcorr(vlasov, poisson);
+    // The diagnostics use the trapezoid rule in x and the spline quadrature in vx.
+    DFieldMemX const quadrature_coeffs_x(
+            trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(mesh_x));
+    std::function<DFieldMemVx(IdxRangeVx)> const neumann_coeffs_vx
+            = [&](IdxRangeVx const idx_range_vx) {
+                  return neumann_spline_quadrature_coefficients<
+                          Kokkos::DefaultExecutionSpace>(idx_range_vx, builder_vx);
+              };
+    DFieldMem<IdxRangeXVx> const quadrature_coeffs_xvx(
+            quadrature_coeffs_nd<Kokkos::DefaultExecutionSpace>(
+                    meshXVx,
+                    std::function<DFieldMemX(IdxRangeX)>(
+                            trapezoid_quadrature_coefficients_1d<
+                                    Kokkos::DefaultExecutionSpace,
+                                    GridX>),
+                    neumann_coeffs_vx));
+    Quadrature<IdxRangeXVx, IdxRangeSpXVx> const integrate_xv(
+            get_const_field(quadrature_coeffs_xvx));
+    Quadrature<IdxRangeX> const integrate_x(get_const_field(quadrature_coeffs_x));
+    Quadrature<IdxRangeVx, IdxRangeSpXVx> const integrate_v(get_const_field(quadrature_coeffs));
+    std::optional<ReducedDiagnostics> reduced_diagnostics;
+    if (nbstep_reduced_diag > 0) {
+        reduced_diagnostics.emplace(
+                integrate_xv,
+                integrate_x,
+                integrate_v,
+                nb_phi_modes,
+                nbstep_reduced_diag);
+    }
+
+    // Create the time solver
+    PredCorr const predcorr(
+            vlasov,
+            poisson,
+            {},
+            reduced_diagnostics ? &*reduced_diagnostics : nullptr);
+    FieldExtrapolationTimeSolver const field_extrapolation_solver(vlasov, poisson);
+    ITimeSolver const& time_solver
+            = field_extrapolation ? static_cast<ITimeSolver const&>(field_extrapolation_solver)
+                                  : static_cast<ITimeSolver const&>(predcorr);
 
     // Starting the code
     ddc::expose_to_pdi("Nx_spline_cells", ddc::discrete_space<BSplinesX>().ncells());
@@ -140,6 +199,9 @@ int main(int argc, char** argv)
     expose_mesh_to_pdi("MeshX", mesh_x);
     expose_mesh_to_pdi("MeshVx", mesh_vx);
     ddc::expose_to_pdi("nbstep_diag", nbstep_diag);
+    if (reduced_diagnostics) {
+        ddc::expose_to_pdi("diag_nrecords", reduced_diagnostics->nb_records(nbiter));
+    }
     ddc::expose_to_pdi("Nkinspecies", idx_range_kinsp.size());
     ddc::expose_to_pdi(
             "fdistribu_charges",
@@ -149,15 +211,20 @@ int main(int argc, char** argv)
             ddc::discrete_space<Species>().masses()[idx_range_kinsp]);
     ddc::PdiEvent("initial_state").with("fdistribu_eq", allfequilibrium_host);
 
+    ProfilingCollector const profiler = ProfilingCollector::init_from_input(conf_gyselalibxx);
+
     steady_clock::time_point const start = steady_clock::now();
 
-    predcorr(get_field(allfdistribu), time_start, deltat, nbiter);
+    time_solver(get_field(allfdistribu), time_start, deltat, nbiter);
 
     steady_clock::time_point const end = steady_clock::now();
 
     double const simulation_time = std::chrono::duration<double>(end - start).count();
     std::cout << "Simulation time: " << simulation_time << "s\n";
 
+    profiler.report();
+    profiler.write_to_pdi();
+
     PC_tree_destroy(&conf_pdi);
 
     PDI_finalize();
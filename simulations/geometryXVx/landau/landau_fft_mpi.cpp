@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include <mpi.h>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/fft.hpp>
+
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "bsl_advection_vx.hpp"
+#include "bsl_advection_x.hpp"
+#include "chargedensitycalculator.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "fft_poisson_solver.hpp"
+#include "geometry.hpp"
+#include "input.hpp"
+#include "maxwellianequilibrium.hpp"
+#include "mpichargedensitycalculator.hpp"
+#include "mpisplitvlasovsolver.hpp"
+#include "mpitransposealltoall.hpp"
+#include "neumann_spline_quadrature.hpp"
+#include "output.hpp"
+#include "paraconfpp.hpp"
+#include "params.yaml.hpp"
+#include "pdi_helper.hpp"
+#include "pdi_out_mpi.yml.hpp"
+#include "predcorr.hpp"
+#include "qnsolver.hpp"
+#include "singlemodeperturbinitialisation.hpp"
+#include "species_info.hpp"
+#include "species_init.hpp"
+#include "spline_interpolator.hpp"
+
+using std::chrono::steady_clock;
+
+int main(int argc, char** argv)
+{
+    PC_tree_t conf_gyselalibxx = parse_executable_arguments(argc, argv, params_yaml);
+    PC_tree_t conf_pdi = PC_parse_string(PDI_CFG);
+    PC_errhandler(PC_NULL_HANDLER);
+    MPI_Init(&argc, &argv);
+    PDI_init(conf_pdi);
+
+    Kokkos::ScopeGuard kokkos_scope(argc, argv);
+    ddc::ScopeGuard ddc_scope(argc, argv);
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    // Reading config
+    // --> Mesh info
+    IdxRangeX const mesh_x = init_spline_dependent_idx_range<
+            GridX,
+            BSplinesX,
+            SplineInterpPointsX>(conf_gyselalibxx, "x");
+    IdxRangeVx const mesh_vx = init_spline_dependent_idx_range<
+            GridVx,
+            BSplinesVx,
+            SplineInterpPointsVx>(conf_gyselalibxx, "vx");
+
+    IdxRangeSp const idx_range_kinsp = init_species(conf_gyselalibxx);
+    IdxRangeSpXVx const meshSpXVx(idx_range_kinsp, mesh_x, mesh_vx);
+    IdxRangeSpVx const meshSpVx(idx_range_kinsp, mesh_vx);
+
+    MPITransposeAllToAll<XSplit, VxSplit> transpose(meshSpXVx, MPI_COMM_WORLD);
+
+    // The spatial advection and the Poisson solver work in the VxSplit layout,
+    // the velocity advection works in the XSplit layout.
+    IdxRangeSpXVx const idxrange_vxsplit(transpose.get_local_idx_range<VxSplit>());
+    IdxRangeSpXVx const idxrange_xsplit(transpose.get_local_idx_range<XSplit>());
+    IdxRangeVx const mesh_vx_vxsplit(idxrange_vxsplit);
+
+    SplineXBuilder const builder_x((IdxRangeXVx(idxrange_vxsplit)));
+    SplineVxBuilder const builder_vx((IdxRangeXVx(idxrange_xsplit)));
+    SplineVxBuilder_1d const builder_vx_1d(mesh_vx);
+
+    // Initialisation of the distribution function
+    DFieldMemSpVx allfequilibrium(meshSpVx);
+    MaxwellianEquilibrium const init_fequilibrium
+            = MaxwellianEquilibrium::init_from_input(idx_range_kinsp, conf_gyselalibxx);
+    init_fequilibrium(get_field(allfequilibrium));
+
+    DFieldMemSpXVx allfdistribu(idxrange_vxsplit);
+    SingleModePerturbInitialisation const init = SingleModePerturbInitialisation::
+            init_from_input(get_const_field(allfequilibrium), idx_range_kinsp, conf_gyselalibxx);
+    init(get_field(allfdistribu));
+
+    // --> Algorithm info
+    double const deltat = PCpp_double(conf_gyselalibxx, ".Algorithm.deltat");
+    int const nbiter = static_cast<int>(PCpp_int(conf_gyselalibxx, ".Algorithm.nbiter"));
+
+    // --> Output info
+    double const time_diag = PCpp_double(conf_gyselalibxx, ".Output.time_diag");
+    int const nbstep_diag = int(time_diag / deltat);
+
+    // Creating operators
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+
+    ddc::ConstantExtrapolationRule<Vx> bv_v_min(ddc::coordinate(mesh_vx.front()));
+    ddc::ConstantExtrapolationRule<Vx> bv_v_max(ddc::coordinate(mesh_vx.back()));
+    SplineVxEvaluator const spline_vx_evaluator(bv_v_min, bv_v_max);
+    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+
+    BslAdvectionSpatial<GeometryXVx, GridX> const advection_x(spline_x_interpolator);
+    BslAdvectionVelocity<GeometryXVx, GridVx> const advection_vx(spline_vx_interpolator);
+
+    MpiSplitVlasovSolver const vlasov(advection_x, advection_vx, transpose);
+
+    // The quadrature coefficients are computed on the global velocity grid then restricted
+    // to the velocities stored locally.
+    DFieldMemVx const quadrature_coeffs(neumann_spline_quadrature_coefficients<
+                                        Kokkos::DefaultExecutionSpace>(mesh_vx, builder_vx_1d));
+    DFieldMemVx local_quadrature_coeffs(mesh_vx_vxsplit);
+    ddc::parallel_deepcopy(
+            get_field(local_quadrature_coeffs),
+            quadrature_coeffs[mesh_vx_vxsplit]);
+
+    ChargeDensityCalculator const rhs_local(get_const_field(local_quadrature_coeffs));
+    MpiChargeDensityCalculator const rhs(MPI_COMM_WORLD, rhs_local);
+    FFTPoissonSolver<IdxRangeX> fft_poisson_solver(mesh_x);
+    QNSolver const poisson(fft_poisson_solver, rhs);
+
+    PredCorr const predcorr(vlasov, poisson);
+
+    // Starting the code
+    ddc::expose_to_pdi("Nx_spline_cells", ddc::discrete_space<BSplinesX>().ncells());
+    ddc::expose_to_pdi("Nvx_spline_cells", ddc::discrete_space<BSplinesVx>().ncells());
+    expose_mesh_to_pdi("MeshX", mesh_x);
+    expose_mesh_to_pdi("MeshVx", mesh_vx);
+    ddc::expose_to_pdi("nbstep_diag", nbstep_diag);
+    ddc::expose_to_pdi("Nkinspecies", idx_range_kinsp.size());
+    ddc::expose_to_pdi(
+            "fdistribu_charges",
+            ddc::discrete_space<Species>().charges()[idx_range_kinsp]);
+    ddc::expose_to_pdi(
+            "fdistribu_masses",
+            ddc::discrete_space<Species>().masses()[idx_range_kinsp]);
+    if (rank == 0) {
+        auto allfequilibrium_host = ddc::create_mirror_view_and_copy(get_field(allfequilibrium));
+        ddc::PdiEvent("initial_state").with("fdistribu_eq", allfequilibrium_host);
+    }
+
+    // Save the output index range
+    PDI_expose_idx_range(idxrange_vxsplit, "local_fdistribu");
+
+    steady_clock::time_point const start = steady_clock::now();
+
+    predcorr(get_field(allfdistribu), 0., deltat, nbiter);
+
+    steady_clock::time_point const end = steady_clock::now();
+
+    double const simulation_time = std::chrono::duration<double>(end - start).count();
+    if (rank == 0) {
+        std::cout << "Simulation time: " << simulation_time << "s\n";
+    }
+
+    PC_tree_destroy(&conf_pdi);
+
+    PDI_finalize();
+
+    MPI_Finalize();
+
+    PC_tree_destroy(&conf_gyselalibxx);
+
+    return EXIT_SUCCESS;
+}
@@ -22,7 +22,11 @@ SpeciesInfo:
 Algorithm:
   deltat: 0.125
   nbiter: 360
+  field_extrapolation: false
 
 Output:
   time_diag: 0.25
+  nbstep_reduced_diag: 0
+  nb_phi_modes: 4
+  profiling: false
 )PDI_CFG";
@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+constexpr char const* const params_ensemble_yaml = R"PDI_CFG(SplineMesh:
+  x_min: 0.0
+  x_max: 12.56637061435917
+  x_ncells: 128
+  vx_min: -6.0
+  vx_max: +6.0
+  vx_ncells: 127
+
+SpeciesInfo:
+- charge: -1.
+  mass: 0.0005
+  density_eq: 1.
+  temperature_eq: 1.
+  mean_velocity_eq: 0.
+
+Ensemble:
+  - perturb_amplitude: 0.01
+    perturb_mode: 1
+  - perturb_amplitude: 0.01
+    perturb_mode: 2
+  - perturb_amplitude: 0.01
+    perturb_mode: 3
+  - perturb_amplitude: 0.05
+    perturb_mode: 1
+
+Algorithm:
+  deltat: 0.125
+  nbiter: 360
+
+Output:
+  time_diag: 0.25
+  profiling: false
+)PDI_CFG";
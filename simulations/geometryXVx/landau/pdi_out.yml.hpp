@@ -10,6 +10,7 @@ metadata:
   time_saved : double
   nbstep_diag: int
   iter_saved : int
+  diag_nrecords: int
   MeshX_extents: { type: array, subtype: int64, size: 1 }
   MeshX:
     type: array
@@ -48,6 +49,49 @@ data:
     type: array
     subtype: double
     size: [ '$electrostatic_potential_extents[0]' ]
+  diag_index: int
+  diag_time: double
+  diag_mass_extents: { type: array, subtype: int64, size: 1 }
+  diag_mass: { type: array, subtype: double, size: [ '$diag_mass_extents[0]' ] }
+  diag_momentum_extents: { type: array, subtype: int64, size: 1 }
+  diag_momentum: { type: array, subtype: double, size: [ '$diag_momentum_extents[0]' ] }
+  diag_kinetic_energy_extents: { type: array, subtype: int64, size: 1 }
+  diag_kinetic_energy:
+    type: array
+    subtype: double
+    size: [ '$diag_kinetic_energy_extents[0]' ]
+  diag_l2_norm_extents: { type: array, subtype: int64, size: 1 }
+  diag_l2_norm: { type: array, subtype: double, size: [ '$diag_l2_norm_extents[0]' ] }
+  diag_entropy_extents: { type: array, subtype: int64, size: 1 }
+  diag_entropy: { type: array, subtype: double, size: [ '$diag_entropy_extents[0]' ] }
+  diag_electrostatic_energy: double
+  diag_phi_modes_extents: { type: array, subtype: int64, size: 1 }
+  diag_phi_modes: { type: array, subtype: double, size: [ '$diag_phi_modes_extents[0]' ] }
+  diag_density_extents: { type: array, subtype: int64, size: 2 }
+  diag_density:
+    type: array
+    subtype: double
+    size: [ '$diag_density_extents[0]', '$diag_density_extents[1]' ]
+  diag_mean_velocity_extents: { type: array, subtype: int64, size: 2 }
+  diag_mean_velocity:
+    type: array
+    subtype: double
+    size: [ '$diag_mean_velocity_extents[0]', '$diag_mean_velocity_extents[1]' ]
+  diag_temperature_extents: { type: array, subtype: int64, size: 2 }
+  diag_temperature:
+    type: array
+    subtype: double
+    size: [ '$diag_temperature_extents[0]', '$diag_temperature_extents[1]' ]
+  profiling_rank: int
+  profiling_nregions: int64
+  profiling_region_names:
+    type: array
+    subtype: char
+    size: [ '$profiling_nregions', 64 ]
+  profiling_time: { type: array, subtype: double, size: '$profiling_nregions' }
+  profiling_nb_calls: { type: array, subtype: int64, size: '$profiling_nregions' }
+  profiling_allocated_bytes: { type: array, subtype: int64, size: '$profiling_nregions' }
+  profiling_peak_allocated_bytes: int64
 
 plugins:
   set_value:
@@ -73,5 +117,92 @@ plugins:
     - file: 'GYSELALIBXX_${iter_start:05}.h5'
       on_event: restart
       read: [time_saved, fdistribu]
+    - file: 'GYSELALIBXX_reduced_diagnostics_${iter_start:05}.h5'
+      on_event: reduced_diagnostics
+      collision_policy: write_into
+      datasets:
+        diag_time: { type: array, subtype: double, size: [ '$diag_nrecords' ] }
+        diag_electrostatic_energy: { type: array, subtype: double, size: [ '$diag_nrecords' ] }
+        diag_mass:
+          type: array
+          subtype: double
+          size: [ '$diag_nrecords', '$diag_mass_extents[0]' ]
+        diag_momentum:
+          type: array
+          subtype: double
+          size: [ '$diag_nrecords', '$diag_momentum_extents[0]' ]
+        diag_kinetic_energy:
+          type: array
+          subtype: double
+          size: [ '$diag_nrecords', '$diag_kinetic_energy_extents[0]' ]
+        diag_l2_norm:
+          type: array
+          subtype: double
+          size: [ '$diag_nrecords', '$diag_l2_norm_extents[0]' ]
+        diag_entropy:
+          type: array
+          subtype: double
+          size: [ '$diag_nrecords', '$diag_entropy_extents[0]' ]
+        diag_phi_modes:
+          type: array
+          subtype: double
+          size: [ '$diag_nrecords', '$diag_phi_modes_extents[0]' ]
+        diag_density:
+          type: array
+          subtype: double
+          size: [ '$diag_nrecords', '$diag_density_extents[0]', '$diag_density_extents[1]' ]
+        diag_mean_velocity:
+          type: array
+          subtype: double
+          size: [ '$diag_nrecords', '$diag_mean_velocity_extents[0]', '$diag_mean_velocity_extents[1]' ]
+        diag_temperature:
+          type: array
+          subtype: double
+          size: [ '$diag_nrecords', '$diag_temperature_extents[0]', '$diag_temperature_extents[1]' ]
+      write:
+        diag_time:
+          dataset_selection: { start: [ '$diag_index' ], size: [ 1 ] }
+        diag_electrostatic_energy:
+          dataset_selection: { start: [ '$diag_index' ], size: [ 1 ] }
+        diag_mass:
+          dataset_selection:
+            start: [ '$diag_index', 0 ]
+            size: [ 1, '$diag_mass_extents[0]' ]
+        diag_momentum:
+          dataset_selection:
+            start: [ '$diag_index', 0 ]
+            size: [ 1, '$diag_momentum_extents[0]' ]
+        diag_kinetic_energy:
+          dataset_selection:
+            start: [ '$diag_index', 0 ]
+            size: [ 1, '$diag_kinetic_energy_extents[0]' ]
+        diag_l2_norm:
+          dataset_selection:
+            start: [ '$diag_index', 0 ]
+            size: [ 1, '$diag_l2_norm_extents[0]' ]
+        diag_entropy:
+          dataset_selection:
+            start: [ '$diag_index', 0 ]
+            size: [ 1, '$diag_entropy_extents[0]' ]
+        diag_phi_modes:
+          dataset_selection:
+            start: [ '$diag_index', 0 ]
+            size: [ 1, '$diag_phi_modes_extents[0]' ]
+        diag_density:
+          dataset_selection:
+            start: [ '$diag_index', 0, 0 ]
+            size: [ 1, '$diag_density_extents[0]', '$diag_density_extents[1]' ]
+        diag_mean_velocity:
+          dataset_selection:
+            start: [ '$diag_index', 0, 0 ]
+            size: [ 1, '$diag_mean_velocity_extents[0]', '$diag_mean_velocity_extents[1]' ]
+        diag_temperature:
+          dataset_selection:
+            start: [ '$diag_index', 0, 0 ]
+            size: [ 1, '$diag_temperature_extents[0]', '$diag_temperature_extents[1]' ]
+    - file: 'GYSELALIBXX_profiling_${profiling_rank:05}.h5'
+      on_event: profiling
+      collision_policy: replace_and_warn
+      write: [profiling_region_names, profiling_time, profiling_nb_calls, profiling_allocated_bytes, profiling_peak_allocated_bytes]
   #trace: ~
 )PDI_CFG";
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+constexpr char const* const PDI_ENSEMBLE_CFG = R"PDI_CFG(
+metadata:
+  Nx_spline_cells : int
+  Nvx_spline_cells : int
+  iter : int
+  time_saved : double
+  nbstep_diag: int
+  iter_saved : int
+  MeshX_extents: { type: array, subtype: int64, size: 1 }
+  MeshX:
+    type: array
+    subtype: double
+    size: [ '$MeshX_extents[0]' ]
+  MeshVx_extents: { type: array, subtype: int64, size: 1 }
+  MeshVx:
+    type: array
+    subtype: double
+    size: [ '$MeshVx_extents[0]' ]
+  Nkinspecies: int
+  fdistribu_charges_extents : { type: array, subtype: int64, size: 1 }
+  fdistribu_charges:
+    type: array
+    subtype: double
+    size: [ '$fdistribu_charges_extents[0]' ]
+  fdistribu_masses_extents : { type: array, subtype: int64, size: 1 }
+  fdistribu_masses:
+    type: array
+    subtype: double
+    size: [ '$fdistribu_masses_extents[0]' ]
+  perturb_amplitude_extents: { type: array, subtype: int64, size: 1 }
+  perturb_amplitude:
+    type: array
+    subtype: double
+    size: [ '$perturb_amplitude_extents[0]' ]
+  perturb_mode_extents: { type: array, subtype: int64, size: 1 }
+  perturb_mode:
+    type: array
+    subtype: int
+    size: [ '$perturb_mode_extents[0]' ]
+  fdistribu_eq_extents : { type: array, subtype: int64, size: 2 }
+  fdistribu_eq:
+    type: array
+    subtype: double
+    size: [ '$fdistribu_eq_extents[0]', '$fdistribu_eq_extents[1]' ]
+
+data:
+  fdistribu_extents: { type: array, subtype: int64, size: 4 }
+  fdistribu:
+    type: array
+    subtype: double
+    size: [ '$fdistribu_extents[0]', '$fdistribu_extents[1]', '$fdistribu_extents[2]', '$fdistribu_extents[3]' ]
+  electrostatic_potential_extents: { type: array, subtype: int64, size: 2 }
+  electrostatic_potential:
+    type: array
+    subtype: double
+    size: [ '$electrostatic_potential_extents[0]', '$electrostatic_potential_extents[1]' ]
+  profiling_rank: int
+  profiling_nregions: int64
+  profiling_region_names:
+    type: array
+    subtype: char
+    size: [ '$profiling_nregions', 64 ]
+  profiling_time: { type: array, subtype: double, size: '$profiling_nregions' }
+  profiling_nb_calls: { type: array, subtype: int64, size: '$profiling_nregions' }
+  profiling_allocated_bytes: { type: array, subtype: int64, size: '$profiling_nregions' }
+  profiling_peak_allocated_bytes: int64
+
+plugins:
+  set_value:
+    on_init:
+      - share:
+        - iter_saved: 0
+    on_data:
+      iter:
+        - set:
+          - iter_saved: '${iter}/${nbstep_diag}'
+    on_finalize:
+      - release: [iter_saved]
+  decl_hdf5:
+    - file: 'GYSELALIBXX_ensemble_initstate.h5'
+      on_event: [initial_state]
+      collision_policy: replace_and_warn
+      write: [Nx_spline_cells, Nvx_spline_cells, MeshX, MeshVx, nbstep_diag, Nkinspecies, fdistribu_charges, fdistribu_masses, perturb_amplitude, perturb_mode, fdistribu_eq]
+    - file: 'GYSELALIBXX_ensemble_${iter_saved:05}.h5'
+      on_event: [iteration, last_iteration]
+      when: '${iter} % ${nbstep_diag} = 0'
+      collision_policy: replace_and_warn
+      write: [time_saved, fdistribu, electrostatic_potential]
+    - file: 'GYSELALIBXX_profiling_${profiling_rank:05}.h5'
+      on_event: profiling
+      collision_policy: replace_and_warn
+      write: [profiling_region_names, profiling_time, profiling_nb_calls, profiling_allocated_bytes, profiling_peak_allocated_bytes]
+  #trace: ~
+)PDI_CFG";
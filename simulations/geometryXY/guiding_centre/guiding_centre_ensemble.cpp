@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: MIT
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+
+#include <ddc/ddc.hpp>
+#include <ddc/pdi.hpp>
+
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "bsl_advection_1d.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "euler.hpp"
+#include "fft_poisson_solver.hpp"
+#include "geometry.hpp"
+#include "initialisation_Kelvin_Helmholtz.hpp"
+#include "input.hpp"
+#include "output.hpp"
+#include "paraconfpp.hpp"
+#include "params_ensemble.yaml.hpp"
+#include "pdi_out_ensemble.yml.hpp"
+#include "predcorr_RK2.hpp"
+#include "simulation_utils_tools.hpp"
+#include "spline_interpolator.hpp"
+#include "vector_field.hpp"
+#include "vector_field_mem.hpp"
+
+
+using std::chrono::steady_clock;
+namespace fs = std::filesystem;
+
+
+/*
+    This executable runs an ensemble of independent guiding-centre simulations (e.g. a scan
+    over the perturbation parameters) as a single batched simulation. All the members share
+    the same mesh and are advanced together by the same kernels.
+*/
+int main(int argc, char** argv)
+{
+    // Create a folder for the output files.
+    fs::create_directory("output");
+
+    PC_tree_t conf_gyselalibxx = parse_executable_arguments(argc, argv, params_ensemble_yaml);
+    PC_tree_t conf_pdi = PC_parse_string(PDI_ENSEMBLE_CFG);
+    PC_errhandler(PC_NULL_HANDLER);
+    PDI_init(conf_pdi);
+
+    Kokkos::ScopeGuard kokkos_scope(argc, argv);
+    ddc::ScopeGuard ddc_scope(argc, argv);
+
+    // CREATING MESH AND SUPPORTS ----------------------------------------------------------------
+    IdxRangeX const interpolation_idx_range_x = init_spline_dependent_idx_range<
+            GridX,
+            BSplinesX,
+            SplineInterpPointsX>(conf_gyselalibxx, "x");
+
+    IdxRangeY const interpolation_idx_range_y = init_spline_dependent_idx_range<
+            GridY,
+            BSplinesY,
+            SplineInterpPointsY>(conf_gyselalibxx, "y");
+
+    IdxRangeXY meshXY(interpolation_idx_range_x, interpolation_idx_range_y);
+
+    IdxStepEnsemble const ensemble_size(PCpp_len(conf_gyselalibxx, ".Ensemble"));
+    IdxRangeEnsemble const idx_range_ensemble(IdxEnsemble(0), ensemble_size);
+
+    IdxRangeEnsXY meshEnsXY(idx_range_ensemble, meshXY);
+
+
+    // READING CONFIGURATION ---------------------------------------------------------------------
+    // --> Algorithm info
+    double const delta_t = PCpp_double(conf_gyselalibxx, ".Algorithm.delta_t");
+    double const final_time = PCpp_double(conf_gyselalibxx, ".Algorithm.final_time");
+    int const nbiter = int(final_time / delta_t);
+
+    // --> Output info
+    int const nbstep_diag = PCpp_int(conf_gyselalibxx, ".Output.nbstep_diag");
+
+    // --> Initial function infos of each member of the ensemble
+    /*
+        The perturbation mode is given as a number of periods on the x dimension so the
+        perturbation of each member is compatible with the periodic boundary conditions.
+    */
+    double const length_x = ddcHelper::total_interval_length(interpolation_idx_range_x);
+    host_t<DFieldMemEnsemble> epsilon(idx_range_ensemble);
+    host_t<DFieldMemEnsemble> mode_k(idx_range_ensemble);
+    for (IdxEnsemble const ie : idx_range_ensemble) {
+        PC_tree_t const conf_member
+                = PCpp_get(conf_gyselalibxx, ".Ensemble[%d]", (ie - IdxEnsemble(0)).value());
+        epsilon(ie) = PCpp_double(conf_member, ".perturb_amplitude");
+        mode_k(ie) = 2 * M_PI * PCpp_int(conf_member, ".perturb_mode") / length_x;
+    }
+
+
+    // DEFINING OPERATORS ------------------------------------------------------------------------
+    // Create spline builders ---
+    SplineXBuilder_EnsXY const builder_x(meshEnsXY);
+    SplineYBuilder_EnsXY const builder_y(meshEnsXY);
+
+    // Create spline evaluators ---
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator_EnsXY const spline_x_evaluator(bv_x_min, bv_x_max);
+
+    ddc::PeriodicExtrapolationRule<Y> bv_y_min;
+    ddc::PeriodicExtrapolationRule<Y> bv_y_max;
+    SplineYEvaluator_EnsXY const spline_y_evaluator(bv_y_min, bv_y_max);
+
+    // Create spline interpolators ---
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+    PreallocatableSplineInterpolator const spline_y_interpolator(builder_y, spline_y_evaluator);
+
+    // Create Poisson solver (batched over the members of the ensemble) ---
+    FFTPoissonSolver<IdxRangeXY, IdxRangeEnsXY> const poisson_solver(meshXY);
+
+    // Create advection operators ---
+    Euler<FieldMemEnsXY<CoordX>, DFieldMemEnsXY> euler_x(meshEnsXY);
+    BslAdvection1D<
+            GridX,
+            IdxRangeEnsXY,
+            IdxRangeEnsXY,
+            SplineXBuilder_EnsXY,
+            SplineXEvaluator_EnsXY,
+            Euler<FieldMemEnsXY<CoordX>, DFieldMemEnsXY>>
+            advection_x(spline_x_interpolator, builder_x, spline_x_evaluator, euler_x);
+
+    Euler<FieldMemEnsXY<CoordY>, DFieldMemEnsXY> euler_y(meshEnsXY);
+    BslAdvection1D<
+            GridY,
+            IdxRangeEnsXY,
+            IdxRangeEnsXY,
+            SplineYBuilder_EnsXY,
+            SplineYEvaluator_EnsXY,
+            Euler<FieldMemEnsXY<CoordY>, DFieldMemEnsXY>>
+            advection_y(spline_y_interpolator, builder_y, spline_y_evaluator, euler_y);
+
+
+    // Create an initialiser ---
+    KelvinHelmholtzInstabilityEnsembleInitialisation
+            initialise(get_const_field(epsilon), get_const_field(mode_k));
+
+
+    // Create predcorr operator: predictor-corrector method based on RK2 ---
+    PredCorrRK2XY predictor_corrector(poisson_solver, advection_x, advection_y);
+
+
+    // INITIALISATION ----------------------------------------------------------------------------
+    // Initialisation of the distributed function
+    DFieldMemEnsXY allfdistribu_equilibrium_alloc(meshEnsXY);
+    DFieldEnsXY allfdistribu_equilibrium = get_field(allfdistribu_equilibrium_alloc);
+
+    DFieldMemEnsXY allfdistribu_alloc(meshEnsXY);
+    DFieldEnsXY allfdistribu = get_field(allfdistribu_alloc);
+
+    initialise(allfdistribu, allfdistribu_equilibrium);
+
+
+    // Initialisation of the electrostatic potential and electric field (for saving data)
+    DFieldMemEnsXY electrostatic_potential_alloc(meshEnsXY);
+    DFieldEnsXY electrostatic_potential = get_field(electrostatic_potential_alloc);
+
+    VectorFieldMemEnsXY_XY electric_field_alloc(meshEnsXY);
+    VectorFieldEnsXY_XY electric_field = get_field(electric_field_alloc);
+
+    poisson_solver(electrostatic_potential, electric_field, allfdistribu);
+
+
+    // Save the data ---
+    /*
+        The saved fields have a leading dimension indexing the members of the ensemble.
+        The parameters of each member are saved in the initial state file.
+    */
+    ddc::expose_to_pdi("Nx_spline_cells", PCpp_int(conf_gyselalibxx, ".SplineMesh.x_ncells"));
+    ddc::expose_to_pdi("Ny_spline_cells", PCpp_int(conf_gyselalibxx, ".SplineMesh.y_ncells"));
+    expose_mesh_to_pdi("MeshX", interpolation_idx_range_x);
+    expose_mesh_to_pdi("MeshY", interpolation_idx_range_y);
+
+    ddc::expose_to_pdi("nbstep_diag", nbstep_diag);
+    ddc::expose_to_pdi("time_step", delta_t);
+    ddc::expose_to_pdi("final_time", final_time);
+    ddc::expose_to_pdi("perturb_amplitude", epsilon);
+    ddc::expose_to_pdi("perturb_mode_k", mode_k);
+
+    auto allfdistribu_equilibrium_host = ddc::create_mirror_and_copy(allfdistribu_equilibrium);
+    ddc::expose_to_pdi("fdistribu_equilibrium", allfdistribu_equilibrium_host);
+    PDI_event("initialisation");
+
+    int const iter = 0;
+    auto allfdistribu_host = ddc::create_mirror_and_copy(allfdistribu);
+    auto electrostatic_potential_host = ddc::create_mirror_and_copy(electrostatic_potential);
+    auto electric_field_x_host = ddc::create_mirror_and_copy(ddcHelper::get<X>(electric_field));
+    auto electric_field_y_host = ddc::create_mirror_and_copy(ddcHelper::get<Y>(electric_field));
+    ddc::PdiEvent("iteration")
+            .with("iter", iter)
+            .with("time_saved", iter * delta_t)
+            .with("fdistribu", allfdistribu_host)
+            .with("electrostatic_potential", electrostatic_potential_host)
+            .with("electric_field_x", electric_field_x_host)
+            .with("electric_field_y", electric_field_y_host);
+
+    // SIMULATION --------------------------------------------------------------------------------
+    std::chrono::time_point<std::chrono::system_clock> const start
+            = std::chrono::system_clock::now();
+
+    predictor_corrector(allfdistribu, delta_t, nbiter);
+
+    std::chrono::time_point<std::chrono::system_clock> const end = std::chrono::system_clock::now();
+
+    display_time_difference("Simulation time: ", start, end);
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+    PC_tree_destroy(&conf_gyselalibxx);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+constexpr char const* const params_ensemble_yaml = R"PDI_CFG(SplineMesh:
+  x_min: 0.0
+  x_max: 12.56637061435917
+  x_ncells: 64
+  y_min: 0.0
+  y_max: 12.56637061435917
+  y_ncells : 64
+
+Ensemble:
+  - perturb_amplitude: 0.015
+    perturb_mode: 1
+  - perturb_amplitude: 0.015
+    perturb_mode: 2
+  - perturb_amplitude: 0.005
+    perturb_mode: 1
+  - perturb_amplitude: 0.005
+    perturb_mode: 2
+
+Algorithm:
+  delta_t: 0.05
+  final_time: 30
+
+Output:
+  nbstep_diag: 4
+)PDI_CFG";
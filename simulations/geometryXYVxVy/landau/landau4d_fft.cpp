@@ -5,6 +5,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <optional>
 #include <string_view>
 
 #include <ddc/ddc.hpp>
@@ -18,10 +19,15 @@
 #include "chargedensitycalculator.hpp"
 #include "ddc_alias_inline_functions.hpp"
 #include "fft_poisson_solver.hpp"
+#include "field_extrapolation_time_solver.hpp"
 #include "geometry.hpp"
 #include "input.hpp"
 #include "maxwellianequilibrium.hpp"
+#include "mpi_lagrange_advection_x.hpp"
 #include "mpichargedensitycalculator.hpp"
+#include "mpigatherqnsolver.hpp"
+#include "mpihalosplitvlasovsolver.hpp"
+#include "mpinodeqnsolver.hpp"
 #include "mpisplitvlasovsolver.hpp"
 #include "mpitransposealltoall.hpp"
 #include "neumann_spline_quadrature.hpp"
@@ -30,11 +36,11 @@
 #include "params.yaml.hpp"
 #include "pdi_out.yml.hpp"
 #include "predcorr.hpp"
-#include "qnsolver.hpp"
 #include "singlemodeperturbinitialisation.hpp"
 #include "species_info.hpp"
 #include "species_init.hpp"
 #include "spline_interpolator.hpp"
+#include "transpose.hpp"
 
 using std::cerr;
 using std::endl;
@@ -92,8 +98,8 @@ int main(int argc, char** argv)
     IdxRangeXYVxVy idxrange_xyvxvy_x2Dsplit(idxrange_spxyvxvy_x2Dsplit);
     SplineXBuilder const builder_x(idxrange_vxvyxy_v2Dsplit);
     SplineYBuilder const builder_y(idxrange_vxvyxy_v2Dsplit);
-    SplineVxBuilder const builder_vx(idxrange_xyvxvy_x2Dsplit);
-    SplineVyBuilder const builder_vy(idxrange_xyvxvy_x2Dsplit);
+    SplineVxBuilder const builder_vx(idxrange_spxyvxvy_x2Dsplit);
+    SplineVyBuilder const builder_vy(idxrange_spxyvxvy_x2Dsplit);
 
     IdxRangeSpVxVy idxrange_spvxvy_local(idxrange_spxyvxvy_x2Dsplit);
     // Initialisation of the distribution function
@@ -102,7 +108,6 @@ int main(int argc, char** argv)
             = MaxwellianEquilibrium::init_from_input(idx_range_kinsp, conf_gyselalibxx);
     init_fequilibrium(get_field(allfequilibrium));
     DFieldMemSpXYVxVy allfdistribu_x2D_split(idxrange_spxyvxvy_x2Dsplit);
-    DFieldMemSpVxVyXY allfdistribu_v2D_split(idxrange_spvxvyxy_v2Dsplit);
     SingleModePerturbInitialisation const init = SingleModePerturbInitialisation::
             init_from_input(get_const_field(allfequilibrium), idx_range_kinsp, conf_gyselalibxx);
     init(get_field(allfdistribu_x2D_split));
@@ -110,6 +115,19 @@ int main(int argc, char** argv)
     // --> Algorithm info
     double const deltat = PCpp_double(conf_gyselalibxx, ".Algorithm.deltat");
     int const nbiter = static_cast<int>(PCpp_int(conf_gyselalibxx, ".Algorithm.nbiter"));
+    bool field_extrapolation = false;
+    if (PCpp_get(conf_gyselalibxx, ".Algorithm.field_extrapolation").status == PC_OK) {
+        field_extrapolation = PCpp_bool(conf_gyselalibxx, ".Algorithm.field_extrapolation");
+    }
+    bool single_precision_transposes = false;
+    if (PCpp_get(conf_gyselalibxx, ".Algorithm.single_precision_transposes").status == PC_OK) {
+        single_precision_transposes
+                = PCpp_bool(conf_gyselalibxx, ".Algorithm.single_precision_transposes");
+    }
+    bool halo_exchange = false;
+    if (PCpp_get(conf_gyselalibxx, ".Algorithm.halo_exchange").status == PC_OK) {
+        halo_exchange = PCpp_bool(conf_gyselalibxx, ".Algorithm.halo_exchange");
+    }
 
     // --> Output info
     double const time_diag = PCpp_double(conf_gyselalibxx, ".Output.time_diag");
@@ -146,8 +164,37 @@ int main(int argc, char** argv)
     BslAdvectionVelocity<GeometryXYVxVy, GridVx> const advection_vx(spline_vx_interpolator);
     BslAdvectionVelocity<GeometryXYVxVy, GridVy> const advection_vy(spline_vy_interpolator);
 
-    MpiSplitVlasovSolver const
-            vlasov(advection_x, advection_y, advection_vx, advection_vy, transpose);
+    MpiSplitVlasovSolver const vlasov(
+            advection_x,
+            advection_y,
+            advection_vx,
+            advection_vy,
+            transpose,
+            single_precision_transposes ? MpiSplitVlasovSolver::TransposePrecision::Single
+                                        : MpiSplitVlasovSolver::TransposePrecision::Double);
+
+    // With halo exchanges the distribution function remains distributed along x and y. The
+    // spatial advections only exchange ghost layers with the neighbouring processes.
+    int const halo_lagrange_degree = 5;
+    std::optional<MpiLagrangeAdvectionSpatial<GeometryXYVxVy, GridX, X2DSplit>> halo_advection_x;
+    std::optional<MpiLagrangeAdvectionSpatial<GeometryXYVxVy, GridY, X2DSplit>> halo_advection_y;
+    std::optional<MpiHaloSplitVlasovSolver> halo_vlasov;
+    if (halo_exchange) {
+        halo_advection_x.emplace(
+                idxrange_glob_spxyvxvy,
+                halo_lagrange_degree,
+                deltat,
+                MPI_COMM_WORLD);
+        halo_advection_y.emplace(
+                idxrange_glob_spxyvxvy,
+                halo_lagrange_degree,
+                deltat,
+                MPI_COMM_WORLD);
+        halo_vlasov.emplace(*halo_advection_x, *halo_advection_y, advection_vx, advection_vy);
+    }
+    IVlasovSolver const& vlasov_solver
+            = halo_exchange ? static_cast<IVlasovSolver const&>(*halo_vlasov)
+                            : static_cast<IVlasovSolver const&>(vlasov);
 
     DFieldMemVxVy const quadrature_coeffs(
             neumann_spline_quadrature_coefficients<
@@ -159,11 +206,22 @@ int main(int argc, char** argv)
 
     FFTPoissonSolver<IdxRangeXY> fft_poisson_solver(idxrange_xy);
     ChargeDensityCalculator const rhs_local(get_const_field(local_quadrature_coeffs));
-    MpiChargeDensityCalculator const rhs(MPI_COMM_WORLD, rhs_local);
-    QNSolver const poisson(fft_poisson_solver, rhs);
-
-    // Create predcorr operator
-    PredCorr const predcorr(vlasov, poisson);
+    MpiChargeDensityCalculator const
+            rhs(MPI_COMM_WORLD, rhs_local, MpiChargeDensityCalculator::Reduction::NodeAware);
+    MpiNodeQNSolver const node_poisson(fft_poisson_solver, rhs);
+    // With halo exchanges the velocity integral is local and the charge density is gathered
+    ChargeDensityCalculator const rhs_x2Dsplit(get_const_field(quadrature_coeffs));
+    MpiGatherQNSolver const
+            gather_poisson(fft_poisson_solver, rhs_x2Dsplit, idxrange_xy, MPI_COMM_WORLD);
+    IQNSolver const& poisson = halo_exchange ? static_cast<IQNSolver const&>(gather_poisson)
+                                             : static_cast<IQNSolver const&>(node_poisson);
+
+    // Create the time solver
+    PredCorr const predcorr(vlasov_solver, poisson);
+    FieldExtrapolationTimeSolver const field_extrapolation_solver(vlasov_solver, poisson);
+    ITimeSolver const& time_solver
+            = field_extrapolation ? static_cast<ITimeSolver const&>(field_extrapolation_solver)
+                                  : static_cast<ITimeSolver const&>(predcorr);
 
     // Starting the code
     ddc::expose_to_pdi("Nx_spline_cells", ddc::discrete_space<BSplinesX>().ncells());
@@ -189,16 +247,28 @@ int main(int argc, char** argv)
 
     steady_clock::time_point const start = steady_clock::now();
 
-    transpose(
-            Kokkos::DefaultExecutionSpace(),
-            get_field(allfdistribu_v2D_split),
-            get_const_field(allfdistribu_x2D_split));
+    // The time solver uses the (Sp, Vx, Vy, X, Y) order. With halo exchanges the local block
+    // is only reordered, otherwise it is transposed to the V2DSplit layout.
+    DFieldMemSpVxVyXY allfdistribu_vxvyxy(
+            halo_exchange ? IdxRangeSpVxVyXY(idxrange_spxyvxvy_x2Dsplit)
+                          : idxrange_spvxvyxy_v2Dsplit);
+    if (halo_exchange) {
+        transpose_layout(
+                Kokkos::DefaultExecutionSpace(),
+                get_field(allfdistribu_vxvyxy),
+                get_const_field(allfdistribu_x2D_split));
+    } else {
+        transpose(
+                Kokkos::DefaultExecutionSpace(),
+                get_field(allfdistribu_vxvyxy),
+                get_const_field(allfdistribu_x2D_split));
+    }
 
     // Save the output index range
-    IdxRangeSpXYVxVy idxrange_spxyvxvy_v2Dsplit(idxrange_spvxvyxy_v2Dsplit);
-    PDI_expose_idx_range(idxrange_spxyvxvy_v2Dsplit, "local_fdistribu");
+    IdxRangeSpXYVxVy idxrange_spxyvxvy_output(get_idx_range(allfdistribu_vxvyxy));
+    PDI_expose_idx_range(idxrange_spxyvxvy_output, "local_fdistribu");
 
-    predcorr(get_field(allfdistribu_v2D_split), deltat, nbiter);
+    time_solver(get_field(allfdistribu_vxvyxy), deltat, nbiter);
 
     steady_clock::time_point const end = steady_clock::now();
 
@@ -28,6 +28,9 @@ SpeciesInfo:
 Algorithm:
   deltat: 0.12
   nbiter: 140
+  field_extrapolation: false
+  single_precision_transposes: false
+  halo_exchange: false
 
 Output:
   time_diag: 0.24
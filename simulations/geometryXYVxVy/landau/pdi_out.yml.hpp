@@ -91,12 +91,19 @@ plugins:
           type: array
           subtype: double
           size: [ '$Nkinspecies', '$MeshX_extents[0]', '$MeshY_extents[0]', '$MeshVx_extents[0]', '$MeshVy_extents[0]' ]
+        electrostatic_potential:
+          type: array
+          subtype: double
+          size: [ '$MeshX_extents[0]', '$MeshY_extents[0]' ]
       write:
         time_saved: ~
         fdistribu:
           dataset_selection:
             size: [ '$local_fdistribu_extents[0]', '$local_fdistribu_extents[1]', '$local_fdistribu_extents[2]', '$local_fdistribu_extents[3]', '$local_fdistribu_extents[4]' ]
             start: [ '$local_fdistribu_starts[0]', '$local_fdistribu_starts[1]', '$local_fdistribu_starts[2]', '$local_fdistribu_starts[3]', '$local_fdistribu_starts[4]' ]
-        electrostatic_potential: ~
+        electrostatic_potential:
+          dataset_selection:
+            size: [ '$local_fdistribu_extents[1]', '$local_fdistribu_extents[2]' ]
+            start: [ '$local_fdistribu_starts[1]', '$local_fdistribu_starts[2]' ]
   #trace: ~
 )PDI_CFG";
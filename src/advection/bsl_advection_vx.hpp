@@ -30,7 +30,14 @@ private:
             IdxRangeSpaceVelocity>;
     using InterpolatorType
             = interpolator_on_idx_range_t<IInterpolator, GridV, IdxRangeSpaceVelocity>;
-    PreallocatableInterpolatorType const& m_interpolator_v;
+    using PreallocatableSpeciesInterpolatorType
+            = interpolator_on_idx_range_t<IPreallocatableInterpolator, GridV, IdxRangeFdistribu>;
+    using SpeciesInterpolatorType
+            = interpolator_on_idx_range_t<IInterpolator, GridV, IdxRangeFdistribu>;
+
+    // Only one of these interpolators is provided
+    PreallocatableInterpolatorType const* m_interpolator_v;
+    PreallocatableSpeciesInterpolatorType const* m_interpolator_v_sp;
 
 public:
     /**
@@ -38,7 +45,20 @@ public:
      * @param[in] interpolator_v interpolator along the GridV direction which refers to the velocity space.  
      */
     explicit BslAdvectionVelocity(PreallocatableInterpolatorType const& interpolator_v)
-        : m_interpolator_v(interpolator_v)
+        : m_interpolator_v(&interpolator_v)
+        , m_interpolator_v_sp(nullptr)
+    {
+    }
+
+    /**
+     * @brief Constructor taking an interpolator which is also batched over the species.
+     * With this interpolator the distribution functions of all the species are interpolated
+     * by a single batched operation.
+     * @param[in] interpolator_v interpolator along the GridV direction which refers to the velocity space.
+     */
+    explicit BslAdvectionVelocity(PreallocatableSpeciesInterpolatorType const& interpolator_v)
+        : m_interpolator_v(nullptr)
+        , m_interpolator_v_sp(&interpolator_v)
     {
     }
 
@@ -56,59 +76,69 @@ public:
             Field<const double, IdxRangeSpatial> const electric_field,
             double const dt) const override
     {
-        using IdxRangeBatch = ddc::remove_dims_of_t<IdxRangeFdistribu, Species, GridV>;
+        using IdxRangeBatch = ddc::remove_dims_of_t<IdxRangeFdistribu, GridV>;
         using IdxBatch = typename IdxRangeBatch::discrete_element_type;
 
-
         Kokkos::Profiling::pushRegion("BslAdvectionVelocity");
         IdxRangeFdistribu const idx_range = get_idx_range(allfdistribu);
         IdxRange<GridV> const idx_range_v = ddc::select<GridV>(idx_range);
         IdxRange<Species> const idx_range_sp = ddc::select<Species>(idx_range);
 
-        FieldMem<double, typename InterpolatorType::batched_derivs_idx_range_type> derivs_min(
-                m_interpolator_v.batched_derivs_idx_range_xmin(
-                        ddc::remove_dims_of<Species>(idx_range)));
-        FieldMem<double, typename InterpolatorType::batched_derivs_idx_range_type> derivs_max(
-                m_interpolator_v.batched_derivs_idx_range_xmax(
-                        ddc::remove_dims_of<Species>(idx_range)));
-        ddc::parallel_fill(derivs_min, 0.);
-        ddc::parallel_fill(derivs_max, 0.);
-
-        // pre-allocate some memory to prevent allocation later in loop
-        IdxRangeSpaceVelocity batched_feet_idx_range(idx_range);
-        FieldMem<Coord<DimV>, IdxRangeSpaceVelocity> feet_coords_alloc(batched_feet_idx_range);
-        Field<Coord<DimV>, IdxRangeSpaceVelocity> feet_coords(get_field(feet_coords_alloc));
-        std::unique_ptr<InterpolatorType> const interpolator_v_ptr = m_interpolator_v.preallocate();
-        InterpolatorType const& interpolator_v = *interpolator_v_ptr;
-
-        IdxRangeSpatial const idx_range_spatial(get_idx_range(allfdistribu));
-
+        // Compute the feet of the characteristics of all the species in a single kernel.
+        // The charges and the masses are read from the device copy of the species information.
+        FieldMem<Coord<DimV>, IdxRangeFdistribu> feet_coords_alloc(idx_range);
+        Field<Coord<DimV>, IdxRangeFdistribu> feet_coords(get_field(feet_coords_alloc));
         IdxRangeBatch batch_idx_range(idx_range);
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                batch_idx_range,
+                KOKKOS_LAMBDA(IdxBatch const ib) {
+                    IdxSp const isp(ib);
+                    IdxSpatial const ix(ib);
+                    double const sqrt_me_on_mspecies = Kokkos::sqrt(mass(ielec()) / mass(isp));
+                    // compute the displacement
+                    double const dvx = charge(isp) * sqrt_me_on_mspecies * dt * electric_field(ix);
 
-        ddc::for_each(idx_range_sp, [&](IdxSp const isp) {
-            double const charge_proxy
-                    = charge(isp); // TODO: consider proper way to access charge from device
-            double const sqrt_me_on_mspecies = std::sqrt(mass(ielec()) / mass(isp));
-            ddc::parallel_for_each(
-                    Kokkos::DefaultExecutionSpace(),
-                    batch_idx_range,
-                    KOKKOS_LAMBDA(IdxBatch const ib) {
-                        IdxSpatial const ix(ib);
-                        // compute the displacement
-                        double const dvx
-                                = charge_proxy * sqrt_me_on_mspecies * dt * electric_field(ix);
+                    // compute the coordinates of the feet
+                    for (IdxV const iv : idx_range_v) {
+                        feet_coords(iv, ib) = Coord<DimV>(ddc::coordinate(iv) - dvx);
+                    }
+                });
 
-                        // compute the coordinates of the feet
-                        for (IdxV const iv : idx_range_v) {
-                            feet_coords(iv, ib) = Coord<DimV>(ddc::coordinate(iv) - dvx);
-                        }
-                    });
-            interpolator_v(
-                    allfdistribu[isp],
+        if (m_interpolator_v_sp) {
+            FieldMem<double, typename SpeciesInterpolatorType::batched_derivs_idx_range_type>
+                    derivs_min(m_interpolator_v_sp->batched_derivs_idx_range_xmin(idx_range));
+            FieldMem<double, typename SpeciesInterpolatorType::batched_derivs_idx_range_type>
+                    derivs_max(m_interpolator_v_sp->batched_derivs_idx_range_xmax(idx_range));
+            ddc::parallel_fill(derivs_min, 0.);
+            ddc::parallel_fill(derivs_max, 0.);
+            std::unique_ptr<SpeciesInterpolatorType> const interpolator_v_ptr
+                    = m_interpolator_v_sp->preallocate();
+            (*interpolator_v_ptr)(
+                    allfdistribu,
                     get_const_field(feet_coords),
                     get_const_field(derivs_min),
                     get_const_field(derivs_max));
-        });
+        } else {
+            FieldMem<double, typename InterpolatorType::batched_derivs_idx_range_type> derivs_min(
+                    m_interpolator_v->batched_derivs_idx_range_xmin(
+                            ddc::remove_dims_of<Species>(idx_range)));
+            FieldMem<double, typename InterpolatorType::batched_derivs_idx_range_type> derivs_max(
+                    m_interpolator_v->batched_derivs_idx_range_xmax(
+                            ddc::remove_dims_of<Species>(idx_range)));
+            ddc::parallel_fill(derivs_min, 0.);
+            ddc::parallel_fill(derivs_max, 0.);
+            std::unique_ptr<InterpolatorType> const interpolator_v_ptr
+                    = m_interpolator_v->preallocate();
+            InterpolatorType const& interpolator_v = *interpolator_v_ptr;
+            ddc::for_each(idx_range_sp, [&](IdxSp const isp) {
+                interpolator_v(
+                        allfdistribu[isp],
+                        get_const_field(feet_coords[isp]),
+                        get_const_field(derivs_min),
+                        get_const_field(derivs_max));
+            });
+        }
 
         Kokkos::Profiling::popRegion();
         return allfdistribu;
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <cassert>
+#include <memory>
+#include <utility>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/fft.hpp>
+
+#include <KokkosFFT.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "iadvectionx.hpp"
+#include "species_info.hpp"
+
+/**
+ * @brief A class which computes the spatial advection along the dimension of interest GridX
+ * using Fourier transforms.
+ *
+ * The displacement @f$ \sqrt{m_e/m_s} v dt @f$ is constant on each line of the spatial
+ * dimension, so the advection is an exact shift. It is applied by multiplying the Fourier
+ * modes by @f$ e^{-i k_x v dt} @f$. This gives spectral accuracy and requires neither a spline
+ * build nor the computation of the feet of the characteristics.
+ *
+ * The advected dimension must be periodic and uniform. A single batched real-to-complex 1D
+ * transform along GridX is applied to the whole distribution function, the modes are shifted
+ * in one kernel and a single batched inverse transform is applied. The other dimensions
+ * (including the other spatial dimensions) are not transformed.
+ *
+ * The FFT plans and the buffer which stores the Fourier modes are created once by the
+ * constructor for the index range of the distribution function. The operator can therefore
+ * only be applied to a distribution function defined on this index range.
+ */
+template <class Geometry, class GridX>
+class FFTAdvectionSpatial : public IAdvectionSpatial<Geometry, GridX>
+{
+public:
+    /// The discrete dimension of the Fourier modes associated with the continuous dimension Dim.
+    template <class Dim>
+    struct GridFourier : ddc::PeriodicSampling<ddc::Fourier<Dim>>
+    {
+    };
+
+private:
+    using GridV = typename Geometry::template velocity_dim_for<GridX>;
+    using IdxRangeFdistrib = typename Geometry::IdxRangeFdistribu;
+    using IdxV = Idx<GridV>;
+    using DimX = typename GridX::continuous_dimension_type;
+    using GridKx = GridFourier<DimX>;
+
+public:
+    /// The type of the index range of the Fourier modes along GridX.
+    using fourier_idx_range_type = IdxRange<GridKx>;
+    /// The type of the index range of the distribution function in Fourier space along GridX.
+    using fourier_fdistribu_idx_range_type = ddc::replace_dim_of_t<IdxRangeFdistrib, GridX, GridKx>;
+    /// The type of an index of the distribution function in Fourier space along GridX.
+    using fourier_index_type = typename fourier_fdistribu_idx_range_type::discrete_element_type;
+    /// The type of a Field storing the Fourier transform along GridX of the distribution function.
+    using fourier_field_type = Field<Kokkos::complex<double>, fourier_fdistribu_idx_range_type>;
+
+private:
+    using fourier_field_mem_type
+            = FieldMem<Kokkos::complex<double>, fourier_fdistribu_idx_range_type>;
+    using IdxRangeNoX = ddc::remove_dims_of_t<IdxRangeFdistrib, GridX>;
+
+    using real_view_type = decltype(std::declval<Field<double, IdxRangeFdistrib>>()
+                                            .allocation_kokkos_view());
+    using fourier_view_type
+            = decltype(std::declval<fourier_field_type>().allocation_kokkos_view());
+    using forward_plan_type = KokkosFFT::
+            Plan<Kokkos::DefaultExecutionSpace, real_view_type, fourier_view_type, 1>;
+    using backward_plan_type = KokkosFFT::
+            Plan<Kokkos::DefaultExecutionSpace, fourier_view_type, real_view_type, 1>;
+
+    static_assert(DimX::PERIODIC, "The advected dimension must be periodic.");
+    static_assert(ddc::is_uniform_point_sampling_v<GridX>, "The advected grid must be uniform.");
+
+    /// The position of GridX in the dimensions of the distribution function.
+    static constexpr int s_axis_x
+            = ddc::type_seq_rank_v<GridX, ddc::to_type_seq_t<IdxRangeFdistrib>>;
+
+    IdxRangeFdistrib m_idx_range;
+
+    mutable fourier_field_mem_type m_fourier_values;
+
+    std::unique_ptr<forward_plan_type> m_forward_plan;
+
+    std::unique_ptr<backward_plan_type> m_backward_plan;
+
+public:
+    /**
+     * @brief Constructor.
+     * This constructor calls ddc::init_discrete_space so it should only be called once per
+     * simulation. It also creates the FFT plans.
+     *
+     * @param[in] idx_range The index range of the distribution function. The advected
+     *                      dimension must not contain the duplicated periodic point.
+     */
+    explicit FFTAdvectionSpatial(IdxRangeFdistrib idx_range)
+        : m_idx_range(idx_range)
+        , m_fourier_values(init_fourier_idx_range(idx_range))
+    {
+        Kokkos::DefaultExecutionSpace const exec_space;
+        // The plans only use the buffer to get the shape and the layout of the data
+        DFieldMem<IdxRangeFdistrib> real_values_alloc(idx_range);
+        real_view_type real_values = get_field(real_values_alloc).allocation_kokkos_view();
+        fourier_view_type fourier_values = get_field(m_fourier_values).allocation_kokkos_view();
+        m_forward_plan = std::make_unique<forward_plan_type>(
+                exec_space,
+                real_values,
+                fourier_values,
+                KokkosFFT::Direction::forward,
+                s_axis_x);
+        m_backward_plan = std::make_unique<backward_plan_type>(
+                exec_space,
+                fourier_values,
+                real_values,
+                KokkosFFT::Direction::backward,
+                s_axis_x);
+    }
+
+    ~FFTAdvectionSpatial() override = default;
+
+    /**
+     * @brief Advects fdistribu along GridX for a duration dt.
+     * @param[in, out] allfdistribu Reference to the whole distribution function for one species, allocated on the device (ie it lets the choice of the location depend on the build configuration).
+     * @param[in] dt Time step
+     * @return A reference to the allfdistribu array containing the value of the function at the coordinates.
+     */
+    Field<double, IdxRangeFdistrib> operator()(
+            Field<double, IdxRangeFdistrib> const allfdistribu,
+            double const dt) const override
+    {
+        Kokkos::Profiling::pushRegion("FFTAdvectionSpatial");
+        assert(get_idx_range(allfdistribu) == m_idx_range);
+        fourier_field_type fourier_values = get_field(m_fourier_values);
+
+        // Batched transform along GridX of all the lines of the distribution function
+        KokkosFFT::execute(
+                *m_forward_plan,
+                allfdistribu.allocation_kokkos_view(),
+                fourier_values.allocation_kokkos_view(),
+                KokkosFFT::Normalization::backward);
+        shift_fourier_modes(fourier_values, dt);
+        KokkosFFT::execute(
+                *m_backward_plan,
+                fourier_values.allocation_kokkos_view(),
+                allfdistribu.allocation_kokkos_view(),
+                KokkosFFT::Normalization::backward);
+
+        Kokkos::Profiling::popRegion();
+        return allfdistribu;
+    }
+
+    /**
+     * @brief Shift each line along GridX by its displacement @f$ \sqrt{m_e/m_s} v dt @f$
+     * by multiplying its Fourier modes by @f$ e^{-i k_x \sqrt{m_e/m_s} v dt} @f$.
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA
+     *
+     * @param[in, out] fourier_values The Fourier modes along GridX of the distribution function.
+     * @param[in] dt Time step
+     */
+    void shift_fourier_modes(fourier_field_type const fourier_values, double const dt) const
+    {
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                get_idx_range(fourier_values),
+                KOKKOS_LAMBDA(fourier_index_type const ik) {
+                    IdxSp const isp(ik);
+                    double const dx = Kokkos::sqrt(mass(ielec()) / mass(isp)) * dt
+                                      * ddc::coordinate(IdxV(ik));
+                    double const kx = ddc::coordinate(ddc::select<GridKx>(ik));
+                    fourier_values(ik)
+                            *= Kokkos::complex<double>(Kokkos::cos(kx * dx), -Kokkos::sin(kx * dx));
+                });
+    }
+
+private:
+    /**
+     * @brief Initialise the Fourier space along GridX and get the index range of the
+     * distribution function in Fourier space. Only the positive modes are stored by a
+     * real-to-complex transform.
+     *
+     * @param[in] idx_range The index range of the distribution function.
+     * @return The index range of the distribution function in Fourier space.
+     */
+    static fourier_fdistribu_idx_range_type init_fourier_idx_range(IdxRangeFdistrib idx_range)
+    {
+        IdxRange<GridX> const idx_range_x(idx_range);
+        ddc::init_discrete_space<GridKx>(ddc::init_fourier_space<GridKx>(idx_range_x));
+        fourier_idx_range_type const k_mesh = ddc::fourier_mesh<GridKx>(idx_range_x, false);
+        return fourier_fdistribu_idx_range_type(k_mesh, IdxRangeNoX(idx_range));
+    }
+};
@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "iadvectionx.hpp"
+#include "mpihaloexchange.hpp"
+#include "species_info.hpp"
+
+/**
+ * @brief A class which computes the spatial advection along the dimension of interest GridX
+ * on a distribution function which is distributed across MPI processes along GridX.
+ *
+ * The displacement @f$ \sqrt{m_e/m_s} v dt @f$ is constant on each line of the spatial
+ * dimensions so, on a uniform grid, the value at the foot of the characteristic of each point
+ * is interpolated from the same number of neighbouring points. A local Lagrange interpolation
+ * of odd degree is used, centred on the cell containing the foot. The points which lie on the
+ * neighbouring MPI processes are obtained from a halo exchange (MPIHaloExchange) with these
+ * neighbours only, so the distribution function never needs to be transposed to make GridX
+ * local.
+ *
+ * The width of the ghost layers is chosen at construction from the maximum displacement
+ * allowed by the maximum time step (a CFL-like condition) and the degree of the interpolation.
+ *
+ * @tparam Geometry The geometry of the distribution function.
+ * @tparam GridX The periodic uniform dimension along which the advection is computed.
+ * @tparam Layout The layout describing how the distribution function is distributed across
+ *              MPI processes. It must be distributed along GridX.
+ */
+template <class Geometry, class GridX, class Layout>
+class MpiLagrangeAdvectionSpatial : public IAdvectionSpatial<Geometry, GridX>
+{
+    using GridV = typename Geometry::template velocity_dim_for<GridX>;
+    using IdxRangeFdistrib = typename Geometry::IdxRangeFdistribu;
+    using IdxFdistrib = typename IdxRangeFdistrib::discrete_element_type;
+    using IdxRangeBatch = ddc::remove_dims_of_t<IdxRangeFdistrib, IdxRange<GridX>>;
+    using IdxBatch = typename IdxRangeBatch::discrete_element_type;
+    using IdxX = Idx<GridX>;
+    using IdxStepX = IdxStep<GridX>;
+    using IdxV = Idx<GridV>;
+    using DimX = typename GridX::continuous_dimension_type;
+
+    static_assert(
+            std::is_same_v<IdxRangeFdistrib, typename Layout::discrete_domain_type>,
+            "The layout must describe the index range of the distribution function.");
+    static_assert(DimX::PERIODIC, "The advected dimension must be periodic.");
+    static_assert(ddc::is_uniform_point_sampling_v<GridX>, "The advected grid must be uniform.");
+
+private:
+    int m_degree;
+
+    MPIHaloExchange<Layout, GridX> m_halo_exchange;
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] global_idx_range The global index range of the distribution function.
+     * @param[in] degree The (odd) degree of the Lagrange interpolation.
+     * @param[in] max_dt The largest time step which will be used with this operator.
+     * @param[in] comm The MPI communicator.
+     */
+    MpiLagrangeAdvectionSpatial(
+            IdxRangeFdistrib global_idx_range,
+            int degree,
+            double max_dt,
+            MPI_Comm comm)
+        : m_degree(degree)
+        , m_halo_exchange(global_idx_range, get_n_ghosts(global_idx_range, degree, max_dt), comm)
+    {
+        assert(degree % 2 == 1);
+    }
+
+    ~MpiLagrangeAdvectionSpatial() override = default;
+
+    /**
+     * @brief Get the number of ghost points needed on each side of the local index range.
+     *
+     * A foot located in the cell [x_{i-m-1}, x_{i-m}] is interpolated from the (degree+1)/2
+     * points on each side of this cell, where m is the displacement expressed as a number of
+     * cells rounded down.
+     *
+     * @param[in] idx_range The index range of the distribution function.
+     * @param[in] degree The (odd) degree of the Lagrange interpolation.
+     * @param[in] dt The time step.
+     *
+     * @return The number of ghost points.
+     */
+    static int get_n_ghosts(IdxRangeFdistrib idx_range, int degree, double dt)
+    {
+        IdxRange<Species> const idx_range_sp(idx_range);
+        IdxRange<GridV> const idx_range_v(idx_range);
+        double const max_abs_v = std::max(
+                std::abs(ddc::coordinate(idx_range_v.front())),
+                std::abs(ddc::coordinate(idx_range_v.back())));
+        double max_sqrt_mass_ratio = 0.0;
+        for (IdxSp const isp : idx_range_sp) {
+            max_sqrt_mass_ratio
+                    = std::max(max_sqrt_mass_ratio, std::sqrt(mass(ielec()) / mass(isp)));
+        }
+        double const max_n_cells = max_sqrt_mass_ratio * max_abs_v * dt / ddc::step<GridX>();
+        return int(std::ceil(max_n_cells)) + (degree + 1) / 2;
+    }
+
+    /**
+     * @brief Advects fdistribu along GridX for a duration dt.
+     * @param[in, out] allfdistribu Reference to the local part of the distribution function, allocated on the device (ie it lets the choice of the location depend on the build configuration).
+     * @param[in] dt Time step
+     * @return A reference to the allfdistribu array containing the value of the function at the coordinates.
+     */
+    Field<double, IdxRangeFdistrib> operator()(
+            Field<double, IdxRangeFdistrib> const allfdistribu,
+            double const dt) const override
+    {
+        Kokkos::Profiling::pushRegion("MpiLagrangeAdvectionSpatial");
+        IdxRangeFdistrib const idx_range = get_idx_range(allfdistribu);
+        assert(idx_range == m_halo_exchange.get_local_idx_range());
+        if (get_n_ghosts(idx_range, m_degree, dt) > m_halo_exchange.get_n_ghosts()) {
+            throw std::runtime_error("The time step is too large for the width of the ghost "
+                                     "layers used by the advection operator.");
+        }
+
+        Kokkos::DefaultExecutionSpace const exec_space;
+
+        // The values are copied as the result is written in place
+        DFieldMem<IdxRangeFdistrib> fdistribu_local_alloc(idx_range);
+        DFieldMem<IdxRangeFdistrib> left_ghosts_alloc(m_halo_exchange.get_left_ghosts_idx_range());
+        DFieldMem<IdxRangeFdistrib> right_ghosts_alloc(
+                m_halo_exchange.get_right_ghosts_idx_range());
+        ddc::parallel_deepcopy(exec_space, get_field(fdistribu_local_alloc), allfdistribu);
+
+        m_halo_exchange(
+                exec_space,
+                get_field(left_ghosts_alloc),
+                get_field(right_ghosts_alloc),
+                get_const_field(fdistribu_local_alloc));
+
+        interpolate_at_feet(
+                allfdistribu,
+                get_const_field(fdistribu_local_alloc),
+                get_const_field(left_ghosts_alloc),
+                get_const_field(right_ghosts_alloc),
+                dt);
+
+        Kokkos::Profiling::popRegion();
+        return allfdistribu;
+    }
+
+    /**
+     * @brief Interpolate the distribution function at the feet of the characteristics.
+     * This function should be private. It is not due to the inclusion of a KOKKOS_LAMBDA
+     *
+     * @param[out] allfdistribu The distribution function at the end of the advection.
+     * @param[in] fdistribu_local The distribution function at the start of the advection.
+     * @param[in] left_ghosts The distribution function on the left ghost layer.
+     * @param[in] right_ghosts The distribution function on the right ghost layer.
+     * @param[in] dt Time step
+     */
+    void interpolate_at_feet(
+            Field<double, IdxRangeFdistrib> const allfdistribu,
+            DConstField<IdxRangeFdistrib> const fdistribu_local,
+            DConstField<IdxRangeFdistrib> const left_ghosts,
+            DConstField<IdxRangeFdistrib> const right_ghosts,
+            double const dt) const
+    {
+        IdxRange<GridX> const idx_range_x(get_idx_range(allfdistribu));
+        IdxX const local_front = idx_range_x.front();
+        IdxX const left_ghosts_front = IdxRange<GridX>(get_idx_range(left_ghosts)).front();
+        IdxX const right_ghosts_front = IdxRange<GridX>(get_idx_range(right_ghosts)).front();
+        int const n_local = idx_range_x.size();
+        int const n_ghosts = m_halo_exchange.get_n_ghosts();
+        int const half_stencil = (m_degree + 1) / 2;
+        int const stencil_size = m_degree + 1;
+        double const dt_over_dx = dt / ddc::step<GridX>();
+
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                get_idx_range(allfdistribu),
+                KOKKOS_LAMBDA(IdxFdistrib const idx) {
+                    IdxSp const isp(idx);
+                    IdxV const iv(idx);
+                    IdxBatch const ib(idx);
+                    // The displacement expressed as a number of cells
+                    double const shift = Kokkos::sqrt(mass(ielec()) / mass(isp))
+                                         * ddc::coordinate(iv) * dt_over_dx;
+                    double const shift_floor = Kokkos::floor(shift);
+                    int const shift_cells = int(shift_floor);
+                    // The position of the foot relative to the first point of the stencil
+                    double const s = half_stencil - (shift - shift_floor);
+                    int const stencil_start = (IdxX(idx) - local_front).value() - shift_cells
+                                              - half_stencil;
+
+                    double value = 0.0;
+                    for (int k(0); k < stencil_size; ++k) {
+                        double weight = 1.0;
+                        for (int l(0); l < stencil_size; ++l) {
+                            if (l != k) {
+                                weight *= (s - l) / (k - l);
+                            }
+                        }
+                        int const i_local = stencil_start + k;
+                        double f_k;
+                        if (i_local < 0) {
+                            IdxX const ix_ghost
+                                    = left_ghosts_front + IdxStepX(n_ghosts + i_local);
+                            f_k = left_ghosts(IdxFdistrib(ib, ix_ghost));
+                        } else if (i_local >= n_local) {
+                            IdxX const ix_ghost
+                                    = right_ghosts_front + IdxStepX(i_local - n_local);
+                            f_k = right_ghosts(IdxFdistrib(ib, ix_ghost));
+                        } else {
+                            f_k = fdistribu_local(IdxFdistrib(ib, local_front + IdxStepX(i_local)));
+                        }
+                        value += weight * f_k;
+                    }
+                    allfdistribu(idx) = value;
+                });
+    }
+};
@@ -127,7 +127,8 @@ public:
 
 public:
     /**
-     * @brief Construct a new Collision Configuration Data object/
+     * @brief Construct a new Collision Configuration Data object for a distribution
+     * function which is not distributed over MPI processes.
      *
      * @param[in] yaml_input_file simulation input file.
      * @param[in] index_range_fdistribution the index range that will represent the
@@ -140,30 +141,79 @@ public:
             IdxRangeDistributionFunctionType index_range_fdistribution,
             DConstField<IdxRangeMuType> coeff_intdmu,
             DConstField<IdxRangeVparType> coeff_intdvpar)
-        : m_hat_As_allocation {extract_md_index_range<GridSpType>(index_range_fdistribution)}
-        , m_hat_Zs_allocation {extract_md_index_range<GridSpType>(index_range_fdistribution)}
-        , m_mask_buffer_r_allocation {extract_md_index_range<GridRType>(index_range_fdistribution)}
+        : CollisionConfigurationData(
+                yaml_input_file,
+                index_range_fdistribution,
+                index_range_fdistribution,
+                coeff_intdmu,
+                coeff_intdvpar)
+    {
+    }
+
+    /**
+     * @brief Construct a new Collision Configuration Data object for a distribution
+     * function which may be distributed over MPI processes along the r and theta
+     * dimensions (e.g. using an MPILayout).
+     *
+     * The fields depending on r and theta (masks, B norm, Bstar_s, coeff_AD) are
+     * only allocated on the local index range. As the local index range is a
+     * sub-range of the global index range, these fields can be filled by slicing
+     * global profiles with the local index range.
+     *
+     * @param[in] yaml_input_file simulation input file.
+     * @param[in] global_index_range_fdistribution the index range of the distribution
+     * function across all MPI processes.
+     * @param[in] local_index_range_fdistribution the index range that will represent the
+     * distribution function given to the operator on this MPI process.
+     * @param[in] coeff_intdmu quadrature coefficient.
+     * @param[in] coeff_intdvpar quadrature coefficient.
+     */
+    CollisionConfigurationData(
+            PC_tree_t const& yaml_input_file,
+            IdxRangeDistributionFunctionType global_index_range_fdistribution,
+            IdxRangeDistributionFunctionType local_index_range_fdistribution,
+            DConstField<IdxRangeMuType> coeff_intdmu,
+            DConstField<IdxRangeVparType> coeff_intdvpar)
+        : m_hat_As_allocation {extract_md_index_range<GridSpType>(local_index_range_fdistribution)}
+        , m_hat_Zs_allocation {extract_md_index_range<GridSpType>(local_index_range_fdistribution)}
+        , m_mask_buffer_r_allocation {extract_md_index_range<GridRType>(
+                  local_index_range_fdistribution)}
         , m_mask_LIM_allocation {extract_md_index_range<GridThetaType, GridRType>(
-                  index_range_fdistribution)}
+                  local_index_range_fdistribution)}
         , m_B_norm_allocation {extract_md_index_range<GridThetaType, GridRType>(
-                  index_range_fdistribution)}
+                  local_index_range_fdistribution)}
         , m_Bstar_s_allocation {extract_md_index_range<
                   GridSpType,
                   GridThetaType,
                   GridRType,
-                  GridVparType>(index_range_fdistribution)}
-        , m_mug_allocation {extract_md_index_range<GridMuType>(index_range_fdistribution)}
-        , m_vparg_allocation {extract_md_index_range<GridVparType>(index_range_fdistribution)}
-        , m_coeff_AD_allocation {extract_md_index_range<GridRType>(index_range_fdistribution)}
+                  GridVparType>(local_index_range_fdistribution)}
+        , m_mug_allocation {extract_md_index_range<GridMuType>(local_index_range_fdistribution)}
+        , m_vparg_allocation {extract_md_index_range<GridVparType>(
+                  local_index_range_fdistribution)}
+        , m_coeff_AD_allocation {extract_md_index_range<GridRType>(
+                  local_index_range_fdistribution)}
         , m_coeff_intdmu {coeff_intdmu}
         , m_coeff_intdvpar {coeff_intdvpar}
         , m_collisions_interspecies {::PCpp_bool(yaml_input_file, ".Collisions.interspecies")}
-        , m_mu_extent {extract_md_index_range<GridMuType>(index_range_fdistribution).size()}
-        , m_vpar_extent {extract_md_index_range<GridVparType>(index_range_fdistribution).size()}
-        , m_r_extent {extract_md_index_range<GridRType>(index_range_fdistribution).size()}
-        , m_theta_extent {extract_md_index_range<GridThetaType>(index_range_fdistribution).size()}
-        , m_phi_extent {extract_md_index_range<GridPhiType>(index_range_fdistribution).size()}
-        , m_sp_extent {extract_md_index_range<GridSpType>(index_range_fdistribution).size()}
+        , m_mu_extent {extract_md_index_range<GridMuType>(local_index_range_fdistribution).size()}
+        , m_vpar_extent {
+                  extract_md_index_range<GridVparType>(local_index_range_fdistribution).size()}
+        , m_r_extent {extract_md_index_range<GridRType>(global_index_range_fdistribution).size()}
+        , m_theta_extent {extract_md_index_range<GridThetaType>(global_index_range_fdistribution)
+                                  .size()}
+        , m_phi_extent {
+                  extract_md_index_range<GridPhiType>(global_index_range_fdistribution).size()}
+        , m_sp_extent {extract_md_index_range<GridSpType>(global_index_range_fdistribution).size()}
+        , m_local_r_extent {
+                  extract_md_index_range<GridRType>(local_index_range_fdistribution).size()}
+        , m_local_theta_extent {
+                  extract_md_index_range<GridThetaType>(local_index_range_fdistribution).size()}
+        , m_local_r_offset {local_offset<GridRType>(
+                  global_index_range_fdistribution,
+                  local_index_range_fdistribution)}
+        , m_local_theta_offset {local_offset<GridThetaType>(
+                  global_index_range_fdistribution,
+                  local_index_range_fdistribution)}
     {
         if (!((m_r_extent > 0) && ((m_r_extent & (m_r_extent - 1)) == 0) && (m_theta_extent > 0)
               && ((m_theta_extent & (m_theta_extent - 1)) == 0) && (m_phi_extent > 0)
@@ -172,13 +222,26 @@ public:
                                      "each dimension must be a power of 2.");
         }
 
+        /* Koliop needs the full velocity space, all species and all toroidal
+         * points on each process. Only r and theta may be distributed.
+         */
+        if (!(extract_md_index_range<GridSpType, GridPhiType, GridVparType, GridMuType>(
+                      global_index_range_fdistribution)
+              == extract_md_index_range<GridSpType, GridPhiType, GridVparType, GridMuType>(
+                      local_index_range_fdistribution))
+            || (m_local_r_offset + m_local_r_extent > m_r_extent)
+            || (m_local_theta_offset + m_local_theta_extent > m_theta_extent)) {
+            throw std::invalid_argument("The collision operator can only be distributed along the "
+                                        "r and theta dimensions.");
+        }
+
         /* Define default array values. The user of CollisionConfigurationData
          * is free to modify these.
          */
 
         {
             IdxRangeSpType const index_range_sp
-                    = extract_md_index_range<GridSpType>(index_range_fdistribution);
+                    = extract_md_index_range<GridSpType>(local_index_range_fdistribution);
 
             /* Initialise the mass species.
              */
@@ -297,6 +360,23 @@ protected:
         return IdxRange<Grid1D...>(extract_1d_index_range<Grid1D>(index_range)...);
     }
 
+    /**
+     * @brief Get the offset of the local index range with respect to the global index
+     * range along a specific grid dimension. The offset of a spoofed dimension is 0.
+     *
+     * @tparam Grid1D The tag for the specific grid.
+     * @param[in] global_index_range The multi-D index range across all MPI processes.
+     * @param[in] local_index_range The multi-D index range on this MPI process.
+     * @returns The offset of the first local index along the grid dimension.
+     */
+    template <class Grid1D, class IdxRange0>
+    static std::size_t local_offset(IdxRange0 global_index_range, IdxRange0 local_index_range)
+    {
+        return (extract_1d_index_range<Grid1D>(local_index_range).front()
+                - extract_1d_index_range<Grid1D>(global_index_range).front())
+                .value();
+    }
+
     /* Not protected nor private because there is no internal state to
      * protect/condition to satisfy.
      */
@@ -378,12 +458,12 @@ public:
     std::size_t m_vpar_extent;
 
     /**
-     * @brief R dimension extent.
+     * @brief R dimension extent (across all MPI processes).
      */
     std::size_t m_r_extent;
 
     /**
-     * @brief Theta dimension extent.
+     * @brief Theta dimension extent (across all MPI processes).
      */
     std::size_t m_theta_extent;
 
@@ -396,5 +476,25 @@ public:
      * @brief Species dimension extent.
      */
     std::size_t m_sp_extent;
+
+    /**
+     * @brief R dimension extent on this MPI process.
+     */
+    std::size_t m_local_r_extent;
+
+    /**
+     * @brief Theta dimension extent on this MPI process.
+     */
+    std::size_t m_local_theta_extent;
+
+    /**
+     * @brief Global index of the first r point on this MPI process.
+     */
+    std::size_t m_local_r_offset;
+
+    /**
+     * @brief Global index of the first theta point on this MPI process.
+     */
+    std::size_t m_local_theta_offset;
 };
 } // namespace detail
@@ -3,11 +3,6 @@
 #include "assert.hpp"
 #include "collision_operator.hpp"
 
-// NOTE: Offset of in the r dimension. Used in the Fortran code.
-static inline constexpr std::size_t local_idx_range_r_offset = 0;
-// NOTE: Offset of in the theta dimension. Used in the Fortran code.
-static inline constexpr std::size_t local_idx_range_theta_offset = 0;
-
 // NOTE: For now, these are constant. When more physics get implemented, pass
 // them to the Collisions operator's constructor.
 // NOTE: Enable masking.
@@ -23,6 +18,10 @@ namespace detail {
         std::size_t tor2_extent,
         std::size_t tor3_extent,
         std::size_t species_extent,
+        std::size_t local_tor1_extent,
+        std::size_t local_tor2_extent,
+        std::size_t local_tor1_offset,
+        std::size_t local_tor2_offset,
         std::int8_t collision_interspecies,
         std::int64_t ir_sol_separatrix,
         double const* hat_As,
@@ -37,6 +36,9 @@ namespace detail {
         double const* B_norm,
         double const* Bstar_s)
 {
+    GSLX_ASSERT(local_tor1_offset + local_tor1_extent <= tor1_extent);
+    GSLX_ASSERT(local_tor2_offset + local_tor2_extent <= tor2_extent);
+
     ::koliop_Operator operator_handle;
 
     if (::koliop_Create(
@@ -47,10 +49,10 @@ namespace detail {
                 tor2_extent,
                 tor3_extent,
                 species_extent,
-                tor1_extent, // NOTE: No MPI index range decomposition.
-                tor2_extent, // NOTE: No MPI index range decomposition.
-                local_idx_range_r_offset,
-                local_idx_range_theta_offset,
+                local_tor1_extent,
+                local_tor2_extent,
+                local_tor1_offset,
+                local_tor2_offset,
                 collision_interspecies,
                 is_sol_enabled,
                 is_limiter_mask_enabled,
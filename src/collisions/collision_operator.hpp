@@ -23,10 +23,14 @@ namespace detail {
  *
  * @param[in] mu_extent The number of points in the magnetic moment dimension.
  * @param[in] vpar_extent The number of points in the parallel velocity dimension.
- * @param[in] tor1_extent The number of points in the tor1 dimension.
- * @param[in] tor2_extent The number of points in the tor2 dimension.
+ * @param[in] tor1_extent The global number of points in the tor1 dimension.
+ * @param[in] tor2_extent The global number of points in the tor2 dimension.
  * @param[in] tor3_extent The number of points in the tor3 dimension.
  * @param[in] species_extent The number of species.
+ * @param[in] local_tor1_extent The number of points in the tor1 dimension on this MPI rank.
+ * @param[in] local_tor2_extent The number of points in the tor2 dimension on this MPI rank.
+ * @param[in] local_tor1_offset The global index of the first tor1 point on this MPI rank.
+ * @param[in] local_tor2_offset The global index of the first tor2 point on this MPI rank.
  * @param[in] collision_interspecies Boolean that is equal to true if inter-species collisions are taken into account.
  * @param[in] ir_sol_separatrix The index in the radial dimension where the SOL separatrix is found.
  * @param[in] hat_As The normalised masses for all species.
@@ -50,6 +54,10 @@ namespace detail {
         std::size_t tor2_extent,
         std::size_t tor3_extent,
         std::size_t species_extent,
+        std::size_t local_tor1_extent,
+        std::size_t local_tor2_extent,
+        std::size_t local_tor1_offset,
+        std::size_t local_tor2_offset,
         std::int8_t collision_interspecies,
         std::int64_t ir_sol_separatrix,
         double const* hat_As,
@@ -107,9 +115,13 @@ public:
                 collision_configuration.configuration().m_theta_extent,
                 collision_configuration.configuration().m_phi_extent,
                 collision_configuration.configuration().m_sp_extent,
+                collision_configuration.configuration().m_local_r_extent,
+                collision_configuration.configuration().m_local_theta_extent,
+                collision_configuration.configuration().m_local_r_offset,
+                collision_configuration.configuration().m_local_theta_offset,
                 collision_configuration.configuration().m_collisions_interspecies,
-                /* One less than the number of point in the r direction. */
-                0 /* Null offset */ + collision_configuration.configuration().m_r_extent - 1,
+                /* One less than the global number of point in the r direction. */
+                collision_configuration.configuration().m_r_extent - 1,
                 collision_configuration.configuration().m_hat_As_allocation.data_handle(),
                 collision_configuration.configuration().m_hat_Zs_allocation.data_handle(),
                 collision_configuration.configuration().m_mug_allocation.data_handle(),
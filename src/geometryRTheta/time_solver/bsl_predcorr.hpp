@@ -18,7 +18,10 @@
 #include "l_norm_tools.hpp"
 #include "poisson_like_rhs_function.hpp"
 #include "polarpoissonlikesolver.hpp"
+#include "quadrature.hpp"
 #include "rk2.hpp"
+#include "trapezoid_quadrature.hpp"
+#include "volume_quadrature_nd.hpp"
 
 /**
  * @brief Predictor-corrector for the Vlasov-Poisson equations.
@@ -116,6 +119,19 @@ public:
 
         // Grid. ------------------------------------------------------------------------------------------
         IdxRangeRTheta grid(get_idx_range<GridR, GridTheta>(allfdistribu_host));
+
+        // Mass diagnostic, recorded at each iteration. ---------------------------------------------------
+        host_t<DFieldMemRTheta> const mass_quadrature_coeffs = compute_coeffs_on_mapping(
+                Kokkos::DefaultHostExecutionSpace(),
+                m_mapping,
+                trapezoid_quadrature_coefficients<Kokkos::DefaultHostExecutionSpace>(grid));
+        host_t<Quadrature<IdxRangeRTheta>> const integrate_rtheta(
+                get_const_field(mass_quadrature_coeffs));
+        auto const compute_mass = [&]() {
+            return integrate_rtheta(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    get_const_field(allfdistribu_host));
+        };
         AdvectionFieldFinder advection_field_computer(m_mapping);
 
         IdxRangeBSR radial_bsplines(ddc::discrete_space<BSplinesR>().full_domain().remove_first(
@@ -142,7 +158,9 @@ public:
                 .with("iter", 0)
                 .with("time", 0)
                 .with("density", allfdistribu_host)
-                .with("electrical_potential", electrical_potential0_host);
+                .with("electrical_potential", electrical_potential0_host)
+                .with("mass", compute_mass())
+                .with("poisson_iterations", m_poisson_solver.get_n_iterations());
 
 
         std::function<void(host_t<DVectorFieldRTheta<X, Y>>, host_t<DConstFieldRTheta>)>
@@ -198,7 +216,9 @@ public:
                     .with("iter", iter + 1)
                     .with("time", iter * dt)
                     .with("density", allfdistribu_host)
-                    .with("electrical_potential", electrical_potential_host);
+                    .with("electrical_potential", electrical_potential_host)
+                    .with("mass", compute_mass())
+                    .with("poisson_iterations", m_poisson_solver.get_n_iterations());
         }
         end_time = std::chrono::system_clock::now();
 
@@ -18,7 +18,10 @@
 #include "itimesolver.hpp"
 #include "poisson_like_rhs_function.hpp"
 #include "polarpoissonlikesolver.hpp"
+#include "quadrature.hpp"
 #include "spline_polar_foot_finder.hpp"
+#include "trapezoid_quadrature.hpp"
+#include "volume_quadrature_nd.hpp"
 
 
 
@@ -167,6 +170,19 @@ public:
         // Grid. ------------------------------------------------------------------------------------------
         IdxRangeRTheta const grid(get_idx_range<GridR, GridTheta>(allfdistribu_host));
 
+        // Mass diagnostic, recorded at each iteration. ---------------------------------------------------
+        host_t<DFieldMemRTheta> const mass_quadrature_coeffs = compute_coeffs_on_mapping(
+                Kokkos::DefaultHostExecutionSpace(),
+                m_logical_to_physical,
+                trapezoid_quadrature_coefficients<Kokkos::DefaultHostExecutionSpace>(grid));
+        host_t<Quadrature<IdxRangeRTheta>> const integrate_rtheta(
+                get_const_field(mass_quadrature_coeffs));
+        auto const compute_mass = [&]() {
+            return integrate_rtheta(
+                    Kokkos::DefaultHostExecutionSpace(),
+                    get_const_field(allfdistribu_host));
+        };
+
         host_t<FieldMemRTheta<CoordRTheta>> coords(grid);
         ddc::for_each(grid, [&](IdxRTheta const irtheta) {
             coords(irtheta) = ddc::coordinate(irtheta);
@@ -223,7 +239,9 @@ public:
                     .with("iter", iter)
                     .with("time", time)
                     .with("density", allfdistribu_host)
-                    .with("electrical_potential", electrical_potential_host);
+                    .with("electrical_potential", electrical_potential_host)
+                    .with("mass", compute_mass())
+                    .with("poisson_iterations", m_poisson_solver.get_n_iterations());
 
             // STEP 2: From phi^n, we compute A^n:
             advection_field_computer(electrostatic_potential_coef, advection_field_host);
@@ -314,7 +332,9 @@ public:
                 .with("iter", steps)
                 .with("time", steps * dt)
                 .with("density", allfdistribu_host)
-                .with("electrical_potential", electrical_potential_host);
+                .with("electrical_potential", electrical_potential_host)
+                .with("mass", compute_mass())
+                .with("poisson_iterations", m_poisson_solver.get_n_iterations());
 
 
         end_time = std::chrono::system_clock::now();
@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: MIT
+
+#include <utility>
+
+#include "mpisplitvlasovsolver.hpp"
+
+MpiSplitVlasovSolver::MpiSplitVlasovSolver(
+        IAdvectionSpatial<GeometryXVx, GridX> const& advec_x,
+        IAdvectionVelocity<GeometryXVx, GridVx> const& advec_vx,
+        MPITransposeAllToAll<XSplit, VxSplit> const& transpose,
+        std::vector<std::reference_wrapper<IRightHandSide const>> rhs)
+    : m_advec_x(advec_x)
+    , m_advec_vx(advec_vx)
+    , m_transpose(transpose)
+    , m_rhs(std::move(rhs))
+{
+}
+
+DFieldSpXVx MpiSplitVlasovSolver::operator()(
+        DFieldSpXVx const allfdistribu_vxsplit,
+        DConstFieldX const electric_field,
+        double const dt) const
+{
+    IdxRangeSpXVx idxrange_xsplit(m_transpose.get_local_idx_range<XSplit>());
+    IdxRangeX idx_range_x_xsplit(idxrange_xsplit);
+    DFieldMemSpXVx allfdistribu_xsplit_alloc(idxrange_xsplit);
+    DFieldSpXVx allfdistribu_xsplit = get_field(allfdistribu_xsplit_alloc);
+
+    // Create contiguous memory space to contain the relevant section of the electric field
+    DFieldMemX local_electric_field(idx_range_x_xsplit);
+    ddc::parallel_deepcopy(get_field(local_electric_field), electric_field[idx_range_x_xsplit]);
+
+    // Advect in the spatial dimension
+    m_advec_x(allfdistribu_vxsplit, dt / 2);
+    // Transpose to the layout distributed along x so each rank holds all vx values
+    m_transpose.transpose_to<XSplit>(
+            Kokkos::DefaultExecutionSpace(),
+            allfdistribu_xsplit,
+            get_const_field(allfdistribu_vxsplit));
+    // Solve the sources and advect in the velocity dimension
+    for (auto rhsit = m_rhs.begin(); rhsit != m_rhs.end(); ++rhsit) {
+        (*rhsit)(allfdistribu_xsplit, dt / 2.);
+    }
+    m_advec_vx(allfdistribu_xsplit, get_const_field(local_electric_field), dt);
+    for (auto rhsit = m_rhs.rbegin(); rhsit != m_rhs.rend(); ++rhsit) {
+        (*rhsit)(allfdistribu_xsplit, dt / 2.);
+    }
+    // Transpose back to the layout distributed along vx so each rank holds all x values
+    m_transpose.transpose_to<VxSplit>(
+            Kokkos::DefaultExecutionSpace(),
+            allfdistribu_vxsplit,
+            get_const_field(allfdistribu_xsplit));
+    // Advect in the spatial dimension
+    m_advec_x(allfdistribu_vxsplit, dt / 2);
+
+    return allfdistribu_vxsplit;
+}
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "geometry.hpp"
+#include "iadvectionvx.hpp"
+#include "iadvectionx.hpp"
+#include "iboltzmannsolver.hpp"
+#include "irighthandside.hpp"
+#include "mpitransposealltoall.hpp"
+
+/**
+ * @brief A class that solves a Boltzmann equation using Strang's splitting
+ * on an MPI distributed mesh.
+ *
+ * The distribution function is provided in the VxSplit layout (distributed along the
+ * velocity dimension) so the x-direction advection can be carried out locally on a time
+ * interval of length dt/2. The distribution function is then transposed to the XSplit
+ * layout (distributed along the spatial dimension) where the source terms are solved on
+ * dt/2, the vx-direction advection is solved on dt and the source terms are solved again
+ * on dt/2 in reverse order. Finally the distribution function is transposed back to the
+ * VxSplit layout and the x-direction advection is solved again on dt/2.
+ *
+ * The source terms (e.g. the collisions) are therefore always applied to data where the
+ * velocity dimension and the species are stored locally.
+ */
+class MpiSplitVlasovSolver : public IBoltzmannSolver
+{
+    /// Advection operator in the x direction
+    IAdvectionSpatial<GeometryXVx, GridX> const& m_advec_x;
+
+    /// Advection operator in the vx direction
+    IAdvectionVelocity<GeometryXVx, GridVx> const& m_advec_vx;
+
+    /// MPI transpose operator
+    MPITransposeAllToAll<XSplit, VxSplit> const& m_transpose;
+
+    /// The source terms solved in the XSplit layout
+    std::vector<std::reference_wrapper<IRightHandSide const>> m_rhs;
+
+public:
+    /**
+     * @brief Creates an instance of the split vlasov solver class.
+     * @param[in] advec_x An advection operator along the x direction.
+     * @param[in] advec_vx An advection operator along the vx direction.
+     * @param[in] transpose A MPI transpose operator to move between layouts.
+     * @param[in] rhs A vector containing the source terms of the Boltzmann equation.
+     *                These operators are applied in the XSplit layout.
+     */
+    MpiSplitVlasovSolver(
+            IAdvectionSpatial<GeometryXVx, GridX> const& advec_x,
+            IAdvectionVelocity<GeometryXVx, GridVx> const& advec_vx,
+            MPITransposeAllToAll<XSplit, VxSplit> const& transpose,
+            std::vector<std::reference_wrapper<IRightHandSide const>> rhs = {});
+
+    ~MpiSplitVlasovSolver() override = default;
+
+    /**
+     * @brief Solves a Boltzmann equation on a timestep dt.
+     *
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function
+     *                              in the VxSplit layout.
+     *                              On output : the value of the distribution function after solving
+     *                              the Boltzmann equation.
+     * @param[in] electric_field The electric field computed at all spatial positions.
+     * @param[in] dt The timestep.
+     *
+     * @return The distribution function after solving the Boltzmann equation.
+     */
+    DFieldSpXVx operator()(DFieldSpXVx allfdistribu, DConstFieldX electric_field, double dt)
+            const override;
+};
@@ -8,6 +8,7 @@
 #include "ddc_aliases.hpp"
 #include "ddc_helper.hpp"
 #include "moments.hpp"
+#include "mpilayout.hpp"
 #include "non_uniform_interpolation_points.hpp"
 #include "species_info.hpp"
 
@@ -188,6 +189,63 @@ using SplineVxEvaluator_1d = ddc::SplineEvaluator<
         ddc::ConstantExtrapolationRule<Vx>,
         GridVx>;
 
+/**
+ * @brief A class which describes the members of an ensemble of independent simulations
+ * which are advanced together (e.g. the different parameters of a parameter scan).
+ */
+struct GridEnsemble
+{
+};
+
+// SplineBuilder and SplineEvaluator definitions for an ensemble of simulations
+using SplineXBuilder_EnsXVx = ddc::SplineBuilder<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesX,
+        GridX,
+        SplineXBoundary,
+        SplineXBoundary,
+        ddc::SplineSolver::LAPACK,
+        GridEnsemble,
+        GridX,
+        GridVx>;
+using SplineXEvaluator_EnsXVx = ddc::SplineEvaluator<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesX,
+        GridX,
+#ifdef PERIODIC_RDIMX
+        ddc::PeriodicExtrapolationRule<X>,
+        ddc::PeriodicExtrapolationRule<X>,
+#else
+        ddc::ConstantExtrapolationRule<X>,
+        ddc::ConstantExtrapolationRule<X>,
+#endif
+        GridEnsemble,
+        GridX,
+        GridVx>;
+using SplineVxBuilder_EnsXVx = ddc::SplineBuilder<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesVx,
+        GridVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        ddc::SplineSolver::LAPACK,
+        GridEnsemble,
+        GridX,
+        GridVx>;
+using SplineVxEvaluator_EnsXVx = ddc::SplineEvaluator<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesVx,
+        GridVx,
+        ddc::ConstantExtrapolationRule<Vx>,
+        ddc::ConstantExtrapolationRule<Vx>,
+        GridEnsemble,
+        GridX,
+        GridVx>;
+
 struct GridMom : Moments
 {
 };
@@ -211,6 +269,14 @@ using IdxSpXVx = Idx<Species, GridX, GridVx>;
 
 using IdxXVx = Idx<GridX, GridVx>;
 
+using IdxEnsemble = Idx<GridEnsemble>;
+
+using IdxEnsX = Idx<GridEnsemble, GridX>;
+
+using IdxEnsXVx = Idx<GridEnsemble, GridX, GridVx>;
+
+using IdxSpEnsXVx = Idx<Species, GridEnsemble, GridX, GridVx>;
+
 
 
 using IdxStepMom = IdxStep<GridMom>;
@@ -232,6 +298,8 @@ using IdxStepSpXVx = IdxStep<Species, GridX, GridVx>;
 
 using IdxStepXVx = IdxStep<GridX, GridVx>;
 
+using IdxStepEnsemble = IdxStep<GridEnsemble>;
+
 
 
 using IdxRangeBSX = IdxRange<BSplinesX>;
@@ -258,6 +326,14 @@ using IdxRangeSpXVx = IdxRange<Species, GridX, GridVx>;
 
 using IdxRangeXVx = IdxRange<GridX, GridVx>;
 
+using IdxRangeEnsemble = IdxRange<GridEnsemble>;
+
+using IdxRangeEnsX = IdxRange<GridEnsemble, GridX>;
+
+using IdxRangeEnsXVx = IdxRange<GridEnsemble, GridX, GridVx>;
+
+using IdxRangeSpEnsXVx = IdxRange<Species, GridEnsemble, GridX, GridVx>;
+
 
 template <class ElementType>
 using FieldMemVx = FieldMem<ElementType, IdxRangeVx>;
@@ -304,6 +380,22 @@ using DFieldMemSpX = FieldMemSpX<double>;
 using DFieldMemSpXVx = FieldMemSpXVx<double>;
 
 
+template <class ElementType>
+using FieldMemEnsemble = FieldMem<ElementType, IdxRangeEnsemble>;
+
+template <class ElementType>
+using FieldMemEnsX = FieldMem<ElementType, IdxRangeEnsX>;
+
+template <class ElementType>
+using FieldMemSpEnsXVx = FieldMem<ElementType, IdxRangeSpEnsXVx>;
+
+using DFieldMemEnsemble = FieldMemEnsemble<double>;
+
+using DFieldMemEnsX = FieldMemEnsX<double>;
+
+using DFieldMemSpEnsXVx = FieldMemSpEnsXVx<double>;
+
+
 
 template <class ElementType>
 using BSFieldX = Field<ElementType, IdxRangeBSX>;
@@ -347,6 +439,22 @@ using DFieldSpX = FieldSpX<double>;
 using DFieldSpXVx = FieldSpXVx<double>;
 
 
+template <class ElementType>
+using FieldEnsemble = Field<ElementType, IdxRangeEnsemble>;
+
+template <class ElementType>
+using FieldEnsX = Field<ElementType, IdxRangeEnsX>;
+
+template <class ElementType>
+using FieldSpEnsXVx = Field<ElementType, IdxRangeSpEnsXVx>;
+
+using DFieldEnsemble = FieldEnsemble<double>;
+
+using DFieldEnsX = FieldEnsX<double>;
+
+using DFieldSpEnsXVx = FieldSpEnsXVx<double>;
+
+
 template <class ElementType>
 using ConstFieldVx = Field<ElementType const, IdxRangeVx>;
 
@@ -397,6 +505,35 @@ using DConstFieldSpVx = ConstFieldSpVx<double>;
 using DConstFieldSpXVx = ConstFieldSpXVx<double>;
 
 
+template <class ElementType>
+using ConstFieldEnsemble = ConstField<ElementType, IdxRangeEnsemble>;
+
+template <class ElementType>
+using ConstFieldEnsX = ConstField<ElementType, IdxRangeEnsX>;
+
+template <class ElementType>
+using ConstFieldSpEnsXVx = ConstField<ElementType, IdxRangeSpEnsXVx>;
+
+using DConstFieldEnsemble = ConstFieldEnsemble<double>;
+
+using DConstFieldEnsX = ConstFieldEnsX<double>;
+
+using DConstFieldSpEnsXVx = ConstFieldSpEnsXVx<double>;
+
+
+/**
+ * The MPI layout where the distribution function is distributed along the spatial dimension.
+ * The velocity dimension is stored locally so this layout is used for the velocity advection
+ * and the collisions. The species are not distributed as the inter-species operators couple
+ * all the species at a given spatial position.
+ */
+using XSplit = MPILayout<IdxRangeSpXVx, GridX>;
+/**
+ * The MPI layout where the distribution function is distributed along the velocity dimension.
+ * The spatial dimension is stored locally so this layout is used for the spatial advection.
+ */
+using VxSplit = MPILayout<IdxRangeSpXVx, GridVx>;
+
 /**
  * @brief A class providing aliases for useful subindex ranges of the geometry. It is used as template parameter for generic dimensionality-agnostic operators such as advections.
  */
@@ -432,3 +569,40 @@ public:
      */
     using IdxRangeFdistribu = IdxRangeSpXVx;
 };
+
+/**
+ * @brief A class providing aliases for useful subindex ranges of the geometry when an ensemble
+ * of independent simulations is advanced together. The members of the ensemble are indexed by
+ * the batch dimension GridEnsemble. It is used as template parameter for generic
+ * dimensionality-agnostic operators such as advections.
+ */
+class GeometryEnsXVx
+{
+public:
+    /**
+     * @brief A templated type giving the velocity discretised dimension type associated to a spatial discretised dimension type.
+     */
+    template <class T>
+    using velocity_dim_for = std::conditional_t<std::is_same_v<T, GridX>, GridVx, void>;
+
+    /**
+     * @brief A templated type giving the spatial discretised dimension type associated to a velocity discretised dimension type.
+     */
+    template <class T>
+    using spatial_dim_for = std::conditional_t<std::is_same_v<T, GridVx>, GridX, void>;
+
+    /**
+     * @brief An alias for the spatial discrete index range type of all the members.
+     */
+    using IdxRangeSpatial = IdxRangeEnsX;
+
+    /**
+     * @brief An alias for the velocity discrete index range type.
+     */
+    using IdxRangeVelocity = IdxRangeVx;
+
+    /**
+     * @brief An alias for the whole distribution function discrete index range type.
+     */
+    using IdxRangeFdistribu = IdxRangeSpEnsXVx;
+};
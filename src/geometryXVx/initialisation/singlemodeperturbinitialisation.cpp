@@ -89,3 +89,78 @@ void SingleModePerturbInitialisation::perturbation_initialisation(
                 perturbation(ix) = perturb_amplitude * Kokkos::cos(kx * x);
             });
 }
+
+
+SingleModePerturbEnsembleInitialisation::SingleModePerturbEnsembleInitialisation(
+        DConstFieldSpVx fequilibrium,
+        host_t<FieldMemEnsemble<int>> init_perturb_mode,
+        host_t<DFieldMemEnsemble> init_perturb_amplitude)
+    : m_fequilibrium(fequilibrium)
+    , m_init_perturb_mode(std::move(init_perturb_mode))
+    , m_init_perturb_amplitude(std::move(init_perturb_amplitude))
+{
+}
+
+
+DFieldSpEnsXVx SingleModePerturbEnsembleInitialisation::operator()(
+        DFieldSpEnsXVx const allfdistribu) const
+{
+    IdxRangeX const gridx = get_idx_range<GridX>(allfdistribu);
+    double const Lx = ddcHelper::total_interval_length(gridx);
+
+    // The wavenumber and the amplitude of the perturbation of each member are copied to the
+    // device so all the members are initialised in a single kernel
+    auto const perturb_mode_alloc = ddc::create_mirror_view_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_const_field(m_init_perturb_mode));
+    auto const perturb_amplitude_alloc = ddc::create_mirror_view_and_copy(
+            Kokkos::DefaultExecutionSpace(),
+            get_const_field(m_init_perturb_amplitude));
+    ConstFieldEnsemble<int> const perturb_mode = get_const_field(perturb_mode_alloc);
+    DConstFieldEnsemble const perturb_amplitude = get_const_field(perturb_amplitude_alloc);
+    DConstFieldSpVx const fequilibrium = m_fequilibrium;
+
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(allfdistribu),
+            KOKKOS_LAMBDA(IdxSpEnsXVx const ispexvx) {
+                IdxSp const isp(ispexvx);
+                IdxEnsemble const ie(ispexvx);
+                IdxX const ix(ispexvx);
+                IdxVx const ivx(ispexvx);
+                double const kx = perturb_mode(ie) * 2. * M_PI / Lx;
+                double const perturbation
+                        = perturb_amplitude(ie) * Kokkos::cos(kx * ddc::coordinate(ix));
+                double fdistribu_val = fequilibrium(isp, ivx) * (1. + perturbation);
+                if (fdistribu_val < 1.e-60) {
+                    fdistribu_val = 1.e-60;
+                }
+                allfdistribu(ispexvx) = fdistribu_val;
+            });
+    return allfdistribu;
+}
+
+
+SingleModePerturbEnsembleInitialisation SingleModePerturbEnsembleInitialisation::init_from_input(
+        DConstFieldSpVx allfequilibrium,
+        IdxRangeEnsemble idx_range_ensemble,
+        PC_tree_t const& yaml_input_file)
+{
+    host_t<FieldMemEnsemble<int>> init_perturb_mode(idx_range_ensemble);
+    host_t<DFieldMemEnsemble> init_perturb_amplitude(idx_range_ensemble);
+
+    for (IdxEnsemble const ie : idx_range_ensemble) {
+        PC_tree_t const conf_member = PCpp_get(
+                yaml_input_file,
+                ".Ensemble[%d]",
+                (ie - idx_range_ensemble.front()).value());
+
+        init_perturb_amplitude(ie) = PCpp_double(conf_member, ".perturb_amplitude");
+        init_perturb_mode(ie) = static_cast<int>(PCpp_int(conf_member, ".perturb_mode"));
+    }
+
+    return SingleModePerturbEnsembleInitialisation(
+            allfequilibrium,
+            std::move(init_perturb_mode),
+            std::move(init_perturb_amplitude));
+}
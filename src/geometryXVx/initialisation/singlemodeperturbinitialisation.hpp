@@ -71,3 +71,72 @@ public:
      */
     DFieldSpXVx operator()(DFieldSpXVx allfdistribu) const override;
 };
+
+/**
+ * @brief A class that initialises the distribution functions of an ensemble of simulations
+ * as perturbed Maxwellians.
+ *
+ * The distribution function of the member e of the ensemble is initialised as
+ * $f_e = f_{maxw}(v) * (1 + perturb_e(x))$, where $perturb_e(x)$ is a sinusoidal perturbation
+ * whose mode and amplitude are specific to the member (e.g. for a scan of the growth rate as
+ * a function of the wavenumber). All the species of a member are perturbed in the same way.
+ */
+class SingleModePerturbEnsembleInitialisation
+{
+    DConstFieldSpVx m_fequilibrium;
+
+    host_t<FieldMemEnsemble<int>> m_init_perturb_mode;
+
+    host_t<DFieldMemEnsemble> m_init_perturb_amplitude;
+
+public:
+    /**
+     * @brief Creates an instance of the SingleModePerturbEnsembleInitialisation class.
+     * @param[in] fequilibrium A Maxwellian.
+     * @param[in] init_perturb_mode The perturbation mode of each member of the ensemble.
+     * @param[in] init_perturb_amplitude The perturbation amplitude of each member of the ensemble.
+     */
+    SingleModePerturbEnsembleInitialisation(
+            DConstFieldSpVx fequilibrium,
+            host_t<FieldMemEnsemble<int>> init_perturb_mode,
+            host_t<DFieldMemEnsemble> init_perturb_amplitude);
+
+    /**
+     * @brief Read the perturbation mode and amplitude of each member of the ensemble in the
+     *      `Ensemble` list of a YAML input file.
+     * @param[in] allfequilibrium equilibrium distribution function.
+     * @param[in] idx_range_ensemble Index range for the members of the ensemble.
+     * @param[in] yaml_input_file YAML input file.
+     * @return an instance of SingleModePerturbEnsembleInitialisation class.
+     */
+    static SingleModePerturbEnsembleInitialisation init_from_input(
+            DConstFieldSpVx allfequilibrium,
+            IdxRangeEnsemble idx_range_ensemble,
+            PC_tree_t const& yaml_input_file);
+
+    /**
+     * @brief Get the perturbation mode of each member of the ensemble.
+     * @return The perturbation modes.
+     */
+    host_t<ConstFieldEnsemble<int>> get_perturb_mode() const
+    {
+        return get_const_field(m_init_perturb_mode);
+    }
+
+    /**
+     * @brief Get the perturbation amplitude of each member of the ensemble.
+     * @return The perturbation amplitudes.
+     */
+    host_t<DConstFieldEnsemble> get_perturb_amplitude() const
+    {
+        return get_const_field(m_init_perturb_amplitude);
+    }
+
+    /**
+     * @brief Initialises the distribution function of each member of the ensemble as a
+     *      perturbed Maxwellian.
+     * @param[in, out] allfdistribu The initialised distribution function.
+     * @return The initialised distribution function.
+     */
+    DFieldSpEnsXVx operator()(DFieldSpEnsXVx allfdistribu) const;
+};
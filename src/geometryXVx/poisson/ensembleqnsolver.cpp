@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT
+
+#include <cassert>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ensembleqnsolver.hpp"
+#include "species_info.hpp"
+
+EnsembleQNSolver::EnsembleQNSolver(PoissonSolver const& solve_poisson, DConstFieldVx coeffs)
+    : m_solve_poisson(solve_poisson)
+    , m_quadrature(coeffs)
+{
+}
+
+void EnsembleQNSolver::operator()(
+        DFieldEnsX const electrostatic_potential,
+        DFieldEnsX const electric_field,
+        DConstFieldSpEnsXVx const allfdistribu) const
+{
+    Kokkos::Profiling::pushRegion("EnsembleQNSolver");
+    assert((get_idx_range(electrostatic_potential)
+            == get_idx_range<GridEnsemble, GridX>(allfdistribu)));
+    IdxRangeEnsX const idx_range_ensx = get_idx_range(electrostatic_potential);
+    IdxRangeSp const kin_species_idx_range = get_idx_range<Species>(allfdistribu);
+
+    // Compute the RHS of the Quasi-Neutrality equation of all the members.
+    DFieldMemEnsX rho_alloc(idx_range_ensx);
+    DFieldEnsX rho = get_field(rho_alloc);
+    m_quadrature(
+            Kokkos::DefaultExecutionSpace(),
+            rho,
+            KOKKOS_LAMBDA(IdxEnsXVx const iexvx) {
+                double sum = 0.0;
+                for (IdxSp isp : kin_species_idx_range) {
+                    sum += charge(isp) * allfdistribu(isp, iexvx);
+                }
+                return sum;
+            });
+
+    IdxSp const last_kin_species = kin_species_idx_range.back();
+    host_t<DConstFieldSp> const charges_host = ddc::host_discrete_space<Species>().charges();
+    IdxSp const last_species = get_idx_range(charges_host).back();
+    if (last_kin_species != last_species) {
+        double const chargedens_adiabspecies = double(charge(last_species));
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                idx_range_ensx,
+                KOKKOS_LAMBDA(IdxEnsX const iex) { rho(iex) += chargedens_adiabspecies; });
+    }
+
+    m_solve_poisson(electrostatic_potential, electric_field, rho);
+
+    Kokkos::Profiling::popRegion();
+}
@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include "ddc_aliases.hpp"
+#include "geometry.hpp"
+#include "ipoisson_solver.hpp"
+#include "quadrature.hpp"
+
+/**
+ * @brief An operator which solves the Quasi-Neutrality equation of each member of an ensemble
+ * of independent simulations.
+ *
+ * The operator solves the same equation as QNSolver for each member of the ensemble (see
+ * GridEnsemble). The charge densities of all the members are computed by a single batched
+ * quadrature and the Poisson equation is solved by a Poisson solver which is batched over
+ * the members of the ensemble.
+ */
+class EnsembleQNSolver
+{
+    using PoissonSolver = IPoissonSolver<
+            IdxRangeX,
+            IdxRangeEnsX,
+            typename Kokkos::DefaultExecutionSpace::memory_space,
+            Kokkos::layout_right>;
+    PoissonSolver const& m_solve_poisson;
+    Quadrature<IdxRangeVx, IdxRangeEnsXVx> m_quadrature;
+
+public:
+    /**
+     * Construct the EnsembleQNSolver operator.
+     *
+     * @param solve_poisson The operator which solves the Poisson equation of all the members.
+     * @param coeffs The coefficients of the quadrature in the velocity dimension.
+     */
+    EnsembleQNSolver(PoissonSolver const& solve_poisson, DConstFieldVx coeffs);
+
+    /**
+     * The operator which solves the equation of each member of the ensemble.
+     *
+     * @param[out] electrostatic_potential The electrostatic potential of each member.
+     * @param[out] electric_field The electric field of each member.
+     * @param[in] allfdistribu The distribution function of each member.
+     */
+    void operator()(
+            DFieldEnsX electrostatic_potential,
+            DFieldEnsX electric_field,
+            DConstFieldSpEnsXVx allfdistribu) const;
+};
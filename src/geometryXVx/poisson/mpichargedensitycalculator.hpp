@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <mpi.h>
+
+#include <ddc/ddc.hpp>
+
+#include "geometry.hpp"
+#include "ichargedensitycalculator.hpp"
+
+/**
+ * @brief A class which computes the charge density when the velocity dimension of the
+ * distribution function is distributed over MPI ranks.
+ *
+ * A class which computes charges density by solving the equation:
+ * @f$ \sum_s \int_{v} q_s f_s(x,v) dv @f$
+ * where @f$ q_s @f$ is the charge of the species @f$ s @f$ and
+ * @f$ f_s(x,v) @f$ is the distribution function.
+ *
+ * The local contribution of each rank is calculated by a local charge density calculator
+ * (which should use the quadrature coefficients restricted to the local velocity index range).
+ * The contributions are then summed over the MPI ranks with MPI_Allreduce.
+ */
+class MpiChargeDensityCalculator : public IChargeDensityCalculator
+{
+    IChargeDensityCalculator const& m_local_charge_density_calculator;
+    MPI_Comm m_comm;
+
+public:
+    /**
+     * @brief Create a MpiChargeDensityCalculator object.
+     * @param[in] comm The MPI communicator across which the calculation is carried out.
+     * @param[in] local_charge_density_calculator
+     *                 An operator which calculates the density locally
+     *                 on a given MPI rank. The results from this operator
+     *                 will then be combined using MPI.
+     */
+    MpiChargeDensityCalculator(
+            MPI_Comm comm,
+            IChargeDensityCalculator const& local_charge_density_calculator);
+
+    /**
+     * @brief Computes the charge density rho from the distribution function.
+     * @param[out] rho The charge density on the whole spatial index range.
+     * @param[in] allfdistribu The distribution function on the local velocity index range.
+     *
+     * @return rho The charge density.
+     */
+    DFieldX operator()(DFieldX rho, DConstFieldSpXVx allfdistribu) const final;
+};
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: MIT
+#include <stdexcept>
+
+#include "paraconfpp.hpp"
+#include "scheduled_rhs.hpp"
+
+namespace {
+
+int read_optional_positive_int(
+        PC_tree_t const& yaml_input_file,
+        std::string const& section,
+        std::string const& key)
+{
+    std::string const path = section + "." + key;
+    if (PCpp_get(yaml_input_file, path).status != PC_OK) {
+        return 1;
+    }
+    long const value = PCpp_int(yaml_input_file, path);
+    if (value < 1) {
+        throw std::invalid_argument(path + " must be a strictly positive integer.");
+    }
+    return static_cast<int>(value);
+}
+
+} // namespace
+
+ScheduledRightHandSide::ScheduledRightHandSide(
+        IRightHandSide const& rhs,
+        int const application_period,
+        int const nb_subcycles)
+    : m_rhs(rhs)
+    , m_application_period(application_period)
+    , m_nb_subcycles(nb_subcycles)
+{
+    if (m_application_period < 1) {
+        throw std::invalid_argument("The application period must be strictly positive.");
+    }
+    if (m_nb_subcycles < 1) {
+        throw std::invalid_argument("The number of sub-cycles must be strictly positive.");
+    }
+}
+
+ScheduledRightHandSide ScheduledRightHandSide::init_from_input(
+        IRightHandSide const& rhs,
+        PC_tree_t const& yaml_input_file,
+        std::string const& section)
+{
+    return ScheduledRightHandSide(
+            rhs,
+            read_optional_positive_int(yaml_input_file, section, "application_period"),
+            read_optional_positive_int(yaml_input_file, section, "nb_subcycles"));
+}
+
+DFieldSpXVx ScheduledRightHandSide::operator()(DFieldSpXVx const allfdistribu, double const dt)
+        const
+{
+    if (m_application_period > 1) {
+        throw std::logic_error(
+                "An operator with an application period larger than 1 must be applied by the "
+                "time integrator (see PredCorr).");
+    }
+    return apply_on_block(allfdistribu, dt);
+}
+
+DFieldSpXVx ScheduledRightHandSide::apply_on_block(
+        DFieldSpXVx const allfdistribu,
+        double const dt) const
+{
+    double const dt_subcycle = dt / m_nb_subcycles;
+    for (int i = 0; i < m_nb_subcycles; ++i) {
+        m_rhs(allfdistribu, dt_subcycle);
+    }
+    return allfdistribu;
+}
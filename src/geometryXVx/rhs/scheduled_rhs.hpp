@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include <paraconf.h>
+
+#include "geometry.hpp"
+#include "irighthandside.hpp"
+
+/**
+ * @brief A class that describes how often a right-hand side operator is applied.
+ *
+ * Some operators (e.g. implicit collisions or sources) evolve on a time scale which
+ * is different from the time scale of the Vlasov equation. This class wraps such an
+ * operator in order to decouple its time step from the Vlasov time step:
+ *
+ * - The operator can be sub-cycled: when it is applied on a timestep dt, it is
+ *   applied nb_subcycles times on a timestep dt/nb_subcycles.
+ * - The operator can be applied every application_period Vlasov steps. In this case
+ *   the time integrator is responsible for applying it with the accumulated timestep
+ *   (see PredCorr).
+ *
+ * When application_period equals 1 the scheduled operator can be used anywhere an
+ * IRightHandSide is expected (e.g. in a SplitRightHandSideSolver). Otherwise it can
+ * only be applied by a time integrator through apply_on_block.
+ */
+class ScheduledRightHandSide : public IRightHandSide
+{
+private:
+    std::reference_wrapper<IRightHandSide const> m_rhs;
+    int m_application_period;
+    int m_nb_subcycles;
+
+public:
+    /**
+     * @brief Creates an instance of the ScheduledRightHandSide class.
+     * @param[in] rhs The operator to be scheduled.
+     * @param[in] application_period The number of Vlasov steps between two applications
+     *                  of the operator.
+     * @param[in] nb_subcycles The number of sub-steps used to apply the operator on
+     *                  one timestep.
+     */
+    explicit ScheduledRightHandSide(
+            IRightHandSide const& rhs,
+            int application_period = 1,
+            int nb_subcycles = 1);
+
+    ~ScheduledRightHandSide() override = default;
+
+    /**
+     * @brief Read the scheduling of an operator from the YAML input file.
+     *
+     * The optional keys `application_period` and `nb_subcycles` are read from the
+     * provided section. If they are absent they default to 1.
+     *
+     * @param[in] rhs The operator to be scheduled.
+     * @param[in] yaml_input_file The YAML input file.
+     * @param[in] section The path to the section describing the operator (e.g. ".CollisionsInfo").
+     * @return The scheduled operator.
+     */
+    static ScheduledRightHandSide init_from_input(
+            IRightHandSide const& rhs,
+            PC_tree_t const& yaml_input_file,
+            std::string const& section);
+
+    /**
+     * @brief Get the number of Vlasov steps between two applications of the operator.
+     * @return The application period.
+     */
+    int application_period() const
+    {
+        return m_application_period;
+    }
+
+    /**
+     * @brief Get the number of sub-steps used to apply the operator on one timestep.
+     * @return The number of sub-cycles.
+     */
+    int nb_subcycles() const
+    {
+        return m_nb_subcycles;
+    }
+
+    /**
+     * @brief Apply the operator nb_subcycles times on a timestep dt/nb_subcycles.
+     *
+     * This operator is called on every Vlasov step by the generic right-hand side
+     * solvers, so it throws if the application period is larger than 1.
+     *
+     * @param[in, out] allfdistribu On input: the initial value of the distribution function.
+     *                              On output: the value of the distribution function after
+     *                              solving the source evolution equation on one timestep.
+     * @param[in] dt The timestep.
+     * @return The distribution function after solving the source evolution equation.
+     */
+    DFieldSpXVx operator()(DFieldSpXVx allfdistribu, double dt) const override;
+
+    /**
+     * @brief Apply the operator nb_subcycles times on the accumulated timestep of a block of
+     * application_period Vlasov steps.
+     *
+     * This method is called by the time integrators which handle the application period
+     * (see PredCorr).
+     *
+     * @param[in, out] allfdistribu On input: the initial value of the distribution function.
+     *                              On output: the value of the distribution function after
+     *                              solving the source evolution equation on the block.
+     * @param[in] dt The accumulated timestep of the block.
+     * @return The distribution function after solving the source evolution equation.
+     */
+    DFieldSpXVx apply_on_block(DFieldSpXVx allfdistribu, double dt) const;
+};
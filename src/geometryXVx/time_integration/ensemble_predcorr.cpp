@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+#include <ddc/pdi.hpp>
+
+#include "ensemble_predcorr.hpp"
+#include "ensembleqnsolver.hpp"
+#include "iadvectionvx.hpp"
+#include "iadvectionx.hpp"
+
+EnsemblePredCorr::EnsemblePredCorr(
+        IAdvectionSpatial<GeometryEnsXVx, GridX> const& advec_x,
+        IAdvectionVelocity<GeometryEnsXVx, GridVx> const& advec_vx,
+        EnsembleQNSolver const& poisson_solver)
+    : m_advec_x(advec_x)
+    , m_advec_vx(advec_vx)
+    , m_poisson_solver(poisson_solver)
+{
+}
+
+void EnsemblePredCorr::solve_vlasov(
+        DFieldSpEnsXVx const allfdistribu,
+        DConstFieldEnsX const electric_field,
+        double const dt) const
+{
+    m_advec_x(allfdistribu, dt / 2);
+    m_advec_vx(allfdistribu, electric_field, dt);
+    m_advec_x(allfdistribu, dt / 2);
+}
+
+DFieldSpEnsXVx EnsemblePredCorr::operator()(
+        DFieldSpEnsXVx const allfdistribu,
+        double const time_start,
+        double const dt,
+        int const steps) const
+{
+    auto allfdistribu_alloc = ddc::create_mirror_view(allfdistribu);
+    host_t<DFieldSpEnsXVx> allfdistribu_host = get_field(allfdistribu_alloc);
+
+    // electrostatic potential and electric field of each member (depending only on x)
+    IdxRangeEnsX const idx_range_ensx = get_idx_range<GridEnsemble, GridX>(allfdistribu);
+    host_t<DFieldMemEnsX> electrostatic_potential_host(idx_range_ensx);
+    DFieldMemEnsX electrostatic_potential(idx_range_ensx);
+
+    DFieldMemEnsX electric_field(idx_range_ensx);
+
+    // a chunk of the same size as fdistribu
+    DFieldMemSpEnsXVx allfdistribu_half_t(get_idx_range(allfdistribu));
+
+    int iter = 0;
+    for (; iter < steps; ++iter) {
+        Kokkos::Profiling::pushRegion("Time step");
+        double const iter_time = time_start + iter * dt;
+
+        // computation of the electrostatic potential at time tn and
+        // the associated electric field
+        m_poisson_solver(
+                get_field(electrostatic_potential),
+                get_field(electric_field),
+                get_const_field(allfdistribu));
+        // copies necessary to PDI
+        ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
+        ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
+        Kokkos::Profiling::pushRegion("HDF5_Output");
+        ddc::PdiEvent("iteration")
+                .with("iter", iter)
+                .with("time_saved", iter_time)
+                .with("fdistribu", allfdistribu_host)
+                .with("electrostatic_potential", electrostatic_potential_host);
+        Kokkos::Profiling::popRegion();
+
+        // copy fdistribu
+        ddc::parallel_deepcopy(allfdistribu_half_t, allfdistribu);
+
+        // predictor
+        solve_vlasov(get_field(allfdistribu_half_t), get_const_field(electric_field), dt / 2);
+
+        // computation of the electrostatic potential at time tn+1/2
+        // and the associated electric field
+        m_poisson_solver(
+                get_field(electrostatic_potential),
+                get_field(electric_field),
+                get_const_field(allfdistribu_half_t));
+        // correction on a dt
+        solve_vlasov(allfdistribu, get_const_field(electric_field), dt);
+
+        Kokkos::Profiling::popRegion();
+    }
+
+    double const final_time = time_start + iter * dt;
+    m_poisson_solver(
+            get_field(electrostatic_potential),
+            get_field(electric_field),
+            get_const_field(allfdistribu));
+    //copies necessary to PDI
+    ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
+    ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
+    ddc::PdiEvent("last_iteration")
+            .with("iter", iter)
+            .with("time_saved", final_time)
+            .with("fdistribu", allfdistribu_host)
+            .with("electrostatic_potential", electrostatic_potential_host);
+
+    return allfdistribu;
+}
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "geometry.hpp"
+
+class EnsembleQNSolver;
+/**A generic class for a spatial advection*/
+template <class Geometry, class GridX>
+class IAdvectionSpatial;
+/**A generic class for a velocity advection*/
+template <class Geometry, class GridV>
+class IAdvectionVelocity;
+
+/**
+ * @brief A class that solves the Vlasov-Poisson systems of an ensemble of independent
+ * simulations using a predictor-corrector scheme.
+ *
+ * The scheme is the same as in PredCorr with a Strang splitting of the Vlasov equation (see
+ * SplitVlasovSolver). The distribution functions of all the members of the ensemble (see
+ * GridEnsemble) are stored in a single field so the advections and the Quasi-Neutrality
+ * solver advance all the members together in the same kernels. The members do not interact.
+ */
+class EnsemblePredCorr
+{
+private:
+    IAdvectionSpatial<GeometryEnsXVx, GridX> const& m_advec_x;
+
+    IAdvectionVelocity<GeometryEnsXVx, GridVx> const& m_advec_vx;
+
+    EnsembleQNSolver const& m_poisson_solver;
+
+public:
+    /**
+     * @brief Creates an instance of the predictor-corrector class.
+     * @param[in] advec_x An advection operator along the x direction batched over the ensemble.
+     * @param[in] advec_vx An advection operator along the vx direction batched over the ensemble.
+     * @param[in] poisson_solver A solver for the Quasi-Neutrality equations of the ensemble.
+     */
+    EnsemblePredCorr(
+            IAdvectionSpatial<GeometryEnsXVx, GridX> const& advec_x,
+            IAdvectionVelocity<GeometryEnsXVx, GridVx> const& advec_vx,
+            EnsembleQNSolver const& poisson_solver);
+
+    /**
+     * @brief Solves the Vlasov-Poisson systems of the ensemble.
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function
+     *                              of each member.
+     *                              On output : the value of the distribution function of each
+     *                              member after a given number of iterations.
+     * @param[in] time_start The physical time at the start of the simulation.
+     * @param[in] dt The timestep.
+     * @param[in] steps The number of iterations to be performed by the predictor-corrector.
+     * @return The distribution function after solving the systems.
+     */
+    DFieldSpEnsXVx operator()(
+            DFieldSpEnsXVx allfdistribu,
+            double time_start,
+            double dt,
+            int steps = 1) const;
+
+private:
+    /**
+     * @brief Solves the Vlasov equations of the ensemble on a timestep dt using Strang's
+     * splitting.
+     */
+    void solve_vlasov(DFieldSpEnsXVx allfdistribu, DConstFieldEnsX electric_field, double dt)
+            const;
+};
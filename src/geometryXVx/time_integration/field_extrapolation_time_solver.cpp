@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+#include <ddc/pdi.hpp>
+
+#include "field_extrapolation_time_solver.hpp"
+#include "iboltzmannsolver.hpp"
+#include "iqnsolver.hpp"
+
+FieldExtrapolationTimeSolver::FieldExtrapolationTimeSolver(
+        IBoltzmannSolver const& boltzmann_solver,
+        IQNSolver const& poisson_solver)
+    : m_boltzmann_solver(boltzmann_solver)
+    , m_poisson_solver(poisson_solver)
+{
+}
+
+DFieldSpXVx FieldExtrapolationTimeSolver::operator()(
+        DFieldSpXVx const allfdistribu,
+        double const time_start,
+        double const dt,
+        int const steps) const
+{
+    auto allfdistribu_alloc = ddc::create_mirror_view(allfdistribu);
+    host_t<DFieldSpXVx> allfdistribu_host = get_field(allfdistribu_alloc);
+
+    IdxRangeX const idx_range_x = get_idx_range<GridX>(allfdistribu);
+
+    // electrostatic potential and electric field (depending only on x)
+    host_t<DFieldMemX> electrostatic_potential_host(idx_range_x);
+    DFieldMemX electrostatic_potential(idx_range_x);
+
+    // electric field at times tn, tn-1 and tn+1/2
+    DFieldMemX electric_field_alloc(idx_range_x);
+    DFieldMemX electric_field_prev_alloc(idx_range_x);
+    DFieldMemX electric_field_half_alloc(idx_range_x);
+    DFieldX electric_field = get_field(electric_field_alloc);
+    DFieldX electric_field_prev = get_field(electric_field_prev_alloc);
+    DFieldX electric_field_half = get_field(electric_field_half_alloc);
+
+    int iter = 0;
+    for (; iter < steps; ++iter) {
+        Kokkos::Profiling::pushRegion("Time step");
+        double const iter_time = time_start + iter * dt;
+
+        // computation of the electrostatic potential at time tn and
+        // the associated electric field
+        m_poisson_solver(
+                get_field(electrostatic_potential),
+                electric_field,
+                get_const_field(allfdistribu));
+        // copies necessary to PDI
+        ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
+        ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
+        Kokkos::Profiling::pushRegion("HDF5_Output");
+        ddc::PdiEvent("iteration")
+                .with("iter", iter)
+                .with("time_saved", iter_time)
+                .with("fdistribu", allfdistribu_host)
+                .with("electrostatic_potential", electrostatic_potential_host);
+        Kokkos::Profiling::popRegion();
+
+        if (iter == 0) {
+            // start-up : the electric field at time tn+1/2 is computed with
+            // a predictor step as E at time tn-1 is not known
+            DFieldMemSpXVx allfdistribu_half_t(get_idx_range(allfdistribu));
+            ddc::parallel_deepcopy(allfdistribu_half_t, allfdistribu);
+            m_boltzmann_solver(
+                    get_field(allfdistribu_half_t),
+                    get_const_field(electric_field),
+                    dt / 2);
+            m_poisson_solver(
+                    get_field(electrostatic_potential),
+                    electric_field_half,
+                    get_const_field(allfdistribu_half_t));
+        } else {
+            // extrapolation of the electric field at time tn+1/2
+            ddc::parallel_for_each(
+                    Kokkos::DefaultExecutionSpace(),
+                    idx_range_x,
+                    KOKKOS_LAMBDA(IdxX const ix) {
+                        electric_field_half(ix)
+                                = 1.5 * electric_field(ix) - 0.5 * electric_field_prev(ix);
+                    });
+        }
+        ddc::parallel_deepcopy(electric_field_prev, electric_field);
+
+        // advection on a dt
+        m_boltzmann_solver(allfdistribu, get_const_field(electric_field_half), dt);
+
+        Kokkos::Profiling::popRegion();
+    }
+
+    double const final_time = time_start + iter * dt;
+    m_poisson_solver(
+            get_field(electrostatic_potential),
+            electric_field,
+            get_const_field(allfdistribu));
+    //copies necessary to PDI
+    ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
+    ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
+    ddc::PdiEvent("last_iteration")
+            .with("iter", iter)
+            .with("time_saved", final_time)
+            .with("fdistribu", allfdistribu_host)
+            .with("electrostatic_potential", electrostatic_potential_host);
+
+    return allfdistribu;
+}
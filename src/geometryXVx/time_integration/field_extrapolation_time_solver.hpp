@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "geometry.hpp"
+#include "itimesolver.hpp"
+
+class IQNSolver;
+class IBoltzmannSolver;
+
+/**
+ * @brief A class that solves a Boltzmann-Poisson system of equations by extrapolating the
+ * electric field to the half timestep.
+ *
+ * Like the predictor-corrector scheme (see PredCorr), the distribution function is advanced
+ * from t^n to t^{n+1} with the electric field at t^{n+1/2}. Instead of computing this field
+ * from a prediction of the distribution function at t^{n+1/2} (which costs a second Boltzmann
+ * solve and a copy of the distribution function), it is extrapolated from the fields at t^n
+ * and t^{n-1}:
+ *
+ * E^{n+1/2} = 3/2 E^n - 1/2 E^{n-1}
+ *
+ * The first timestep, for which E^{n-1} is not known, uses the predictor-corrector scheme.
+ * Each following timestep therefore only requires one Boltzmann solve and one
+ * Quasi-Neutrality solve. The extrapolation is second order accurate like the
+ * predictor-corrector scheme but is less stable, so it should only be used with timesteps
+ * for which the electric field varies smoothly.
+ */
+class FieldExtrapolationTimeSolver : public ITimeSolver
+{
+private:
+    IBoltzmannSolver const& m_boltzmann_solver;
+
+    IQNSolver const& m_poisson_solver;
+
+public:
+    /**
+     * @brief Creates an instance of the field extrapolation class.
+     * @param[in] boltzmann_solver A solver for a Boltzmann equation.
+     * @param[in] poisson_solver A solver for a Quasi-Neutrality equation.
+     */
+    FieldExtrapolationTimeSolver(
+            IBoltzmannSolver const& boltzmann_solver,
+            IQNSolver const& poisson_solver);
+
+    ~FieldExtrapolationTimeSolver() override = default;
+
+    /**
+     * @brief Solves the Boltzmann-Poisson system.
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+     *                              On output : the value of the distribution function after solving
+     *                              the Boltzmann-Poisson system a given number of iterations.
+     * @param[in] time_start The physical time at the start of the simulation.
+     * @param[in] dt The timestep.
+     * @param[in] steps The number of iterations to be performed.
+     * @return The distribution function after solving the system.
+     */
+    DFieldSpXVx operator()(DFieldSpXVx allfdistribu, double time_start, double dt, int steps = 1)
+            const override;
+};
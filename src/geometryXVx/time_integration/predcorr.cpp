@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <utility>
 
 #include <ddc/ddc.hpp>
 #include <ddc/pdi.hpp>
@@ -9,13 +11,62 @@
 #include "iboltzmannsolver.hpp"
 #include "iqnsolver.hpp"
 #include "predcorr.hpp"
+#include "reduced_diagnostics.hpp"
 
 PredCorr::PredCorr(IBoltzmannSolver const& boltzmann_solver, IQNSolver const& poisson_solver)
     : m_boltzmann_solver(boltzmann_solver)
     , m_poisson_solver(poisson_solver)
+    , m_diagnostics(nullptr)
 {
 }
 
+PredCorr::PredCorr(
+        IBoltzmannSolver const& boltzmann_solver,
+        IQNSolver const& poisson_solver,
+        std::vector<ScheduledRightHandSide> scheduled_rhs,
+        ReducedDiagnostics const* diagnostics)
+    : m_boltzmann_solver(boltzmann_solver)
+    , m_poisson_solver(poisson_solver)
+    , m_scheduled_rhs(std::move(scheduled_rhs))
+    , m_diagnostics(diagnostics)
+{
+}
+
+bool PredCorr::apply_scheduled_rhs_block_start(
+        DFieldSpXVx const allfdistribu,
+        double const dt,
+        int const iter,
+        int const steps) const
+{
+    bool applied = false;
+    for (auto rhsit = m_scheduled_rhs.begin(); rhsit != m_scheduled_rhs.end(); ++rhsit) {
+        int const period = rhsit->application_period();
+        int const block_start = iter - iter % period;
+        int const block_length = std::min(period, steps - block_start);
+        if (iter == block_start) {
+            rhsit->apply_on_block(allfdistribu, block_length * dt / 2.);
+            applied = true;
+        }
+    }
+    return applied;
+}
+
+void PredCorr::apply_scheduled_rhs_block_end(
+        DFieldSpXVx const allfdistribu,
+        double const dt,
+        int const iter,
+        int const steps) const
+{
+    for (auto rhsit = m_scheduled_rhs.rbegin(); rhsit != m_scheduled_rhs.rend(); ++rhsit) {
+        int const period = rhsit->application_period();
+        int const block_start = iter - iter % period;
+        int const block_length = std::min(period, steps - block_start);
+        if (iter == block_start + block_length - 1) {
+            rhsit->apply_on_block(allfdistribu, block_length * dt / 2.);
+        }
+    }
+}
+
 DFieldSpXVx PredCorr::operator()(
         DFieldSpXVx const allfdistribu,
         double const time_start,
@@ -61,6 +112,24 @@ DFieldSpXVx PredCorr::operator()(
                 .with("fdistribu", allfdistribu_host)
                 .with("electrostatic_potential", electrostatic_potential_host);
         Kokkos::Profiling::popRegion();
+        if (m_diagnostics) {
+            (*m_diagnostics)(
+                    iter,
+                    iter_time,
+                    get_const_field(allfdistribu),
+                    get_const_field(electrostatic_potential),
+                    get_const_field(electric_field));
+        }
+
+        // first half of the operators applied at a lower cadence
+        if (apply_scheduled_rhs_block_start(allfdistribu, dt, iter, steps)) {
+            // the electric field used by the predictor must be computed from
+            // the distribution function modified by these operators
+            m_poisson_solver(
+                    get_field(electrostatic_potential),
+                    get_field(electric_field),
+                    get_const_field(allfdistribu));
+        }
 
         // copy fdistribu
         ddc::parallel_deepcopy(allfdistribu_half_t, allfdistribu);
@@ -77,6 +146,9 @@ DFieldSpXVx PredCorr::operator()(
         // correction on a dt
         m_boltzmann_solver(allfdistribu, get_const_field(electric_field), dt);
 
+        // second half of the operators applied at a lower cadence
+        apply_scheduled_rhs_block_end(allfdistribu, dt, iter, steps);
+
         Kokkos::Profiling::popRegion();
     }
 
@@ -93,6 +165,15 @@ DFieldSpXVx PredCorr::operator()(
             .with("time_saved", final_time)
             .with("fdistribu", allfdistribu_host)
             .with("electrostatic_potential", electrostatic_potential_host);
+    if (m_diagnostics) {
+        (*m_diagnostics)(
+                iter,
+                final_time,
+                get_const_field(allfdistribu),
+                get_const_field(electrostatic_potential),
+                get_const_field(electric_field),
+                true);
+    }
 
     return allfdistribu;
 }
@@ -2,11 +2,15 @@
 
 #pragma once
 
+#include <vector>
+
 #include "geometry.hpp"
 #include "itimesolver.hpp"
+#include "scheduled_rhs.hpp"
 
 class IQNSolver;
 class IBoltzmannSolver;
+class ReducedDiagnostics;
 
 /**
  * @brief A class that solves a Boltzmann-Poisson system of equations using a predictor-corrector scheme.
@@ -17,6 +21,18 @@ class IBoltzmannSolver;
  * of a half-timestep. This potential is then used to compute
  * the value of the distribution function at time t+dt, where 
  * dt is the timestep.
+ *
+ * Right-hand side operators which should not be applied at every
+ * timestep can be provided with an application period N. Such an
+ * operator is applied with a Strang splitting around blocks of N
+ * timesteps: it is applied on N*dt/2 before the first timestep of
+ * the block and on N*dt/2 after the last timestep of the block. The
+ * electric field used by the predictor is computed after the first half
+ * has been applied.
+ *
+ * Reduced diagnostics (e.g. energies and conservation checks) can be
+ * computed in-situ at each diagnostic step by providing a ReducedDiagnostics
+ * operator.
  */
 class PredCorr : public ITimeSolver
 {
@@ -25,6 +41,10 @@ private:
 
     IQNSolver const& m_poisson_solver;
 
+    std::vector<ScheduledRightHandSide> m_scheduled_rhs;
+
+    ReducedDiagnostics const* m_diagnostics;
+
 public:
     /**
      * @brief Creates an instance of the predictor-corrector class.
@@ -33,6 +53,22 @@ public:
      */
     PredCorr(IBoltzmannSolver const& boltzmann_solver, IQNSolver const& poisson_solver);
 
+    /**
+     * @brief Creates an instance of the predictor-corrector class.
+     * @param[in] boltzmann_solver A solver for a Boltzmann equation.
+     * @param[in] poisson_solver A solver for a Quasi-Neutrality equation.
+     * @param[in] scheduled_rhs The right-hand side operators which are applied
+     *                          with their own application period rather than
+     *                          inside the Boltzmann solver.
+     * @param[in] diagnostics An optional operator computing the reduced diagnostics
+     *                        at each diagnostic step (nullptr if they are not required).
+     */
+    PredCorr(
+            IBoltzmannSolver const& boltzmann_solver,
+            IQNSolver const& poisson_solver,
+            std::vector<ScheduledRightHandSide> scheduled_rhs,
+            ReducedDiagnostics const* diagnostics = nullptr);
+
     ~PredCorr() override = default;
 
     /**
@@ -47,4 +83,22 @@ public:
      */
     DFieldSpXVx operator()(DFieldSpXVx allfdistribu, double time_start, double dt, int steps = 1)
             const override;
+
+private:
+    /**
+     * @brief Apply the first half of the scheduled operators whose block of
+     * timesteps starts at the current iteration.
+     *
+     * @return True if at least one operator was applied (i.e. if the distribution
+     *         function may have been modified).
+     */
+    bool apply_scheduled_rhs_block_start(DFieldSpXVx allfdistribu, double dt, int iter, int steps)
+            const;
+
+    /**
+     * @brief Apply the second half of the scheduled operators whose block of
+     * timesteps ends at the current iteration (in reverse order).
+     */
+    void apply_scheduled_rhs_block_end(DFieldSpXVx allfdistribu, double dt, int iter, int steps)
+            const;
 };
@@ -19,7 +19,7 @@ FluidMoments::FluidMoments(
 void FluidMoments::operator()(
         double& density,
         DConstFieldVx const fdistribu,
-        FluidMoments::MomentDensity)
+        FluidMoments::MomentDensity) const
 {
     density = m_integrate_v(Kokkos::DefaultExecutionSpace(), fdistribu);
 }
@@ -30,7 +30,7 @@ void FluidMoments::operator()(
 void FluidMoments::operator()(
         DFieldSpX const density,
         DConstFieldSpXVx const allfdistribu,
-        FluidMoments::MomentDensity)
+        FluidMoments::MomentDensity) const
 {
     m_integrate_v(Kokkos::DefaultExecutionSpace(), density, allfdistribu);
 }
@@ -42,7 +42,7 @@ void FluidMoments::operator()(
         double& mean_velocity,
         DConstFieldVx const fdistribu,
         double density,
-        FluidMoments::MomentVelocity)
+        FluidMoments::MomentVelocity) const
 {
     DFieldMemVx integrand_alloc(get_idx_range(fdistribu));
     DFieldVx integrand = get_field(integrand_alloc);
@@ -64,7 +64,7 @@ void FluidMoments::operator()(
         DFieldSpX const mean_velocity,
         DConstFieldSpXVx const allfdistribu,
         DConstFieldSpX const density,
-        FluidMoments::MomentVelocity)
+        FluidMoments::MomentVelocity) const
 {
     m_integrate_v(
             Kokkos::DefaultExecutionSpace(),
@@ -85,7 +85,7 @@ void FluidMoments::operator()(
         DConstFieldVx const fdistribu,
         double density,
         double mean_velocity,
-        FluidMoments::MomentTemperature)
+        FluidMoments::MomentTemperature) const
 {
     temperature = m_integrate_v(
                           Kokkos::DefaultExecutionSpace(),
@@ -104,7 +104,7 @@ void FluidMoments::operator()(
         DConstFieldSpXVx const allfdistribu,
         DConstFieldSpX const density,
         DConstFieldSpX const mean_velocity,
-        FluidMoments::MomentTemperature)
+        FluidMoments::MomentTemperature) const
 {
     m_integrate_v(
             Kokkos::DefaultExecutionSpace(),
@@ -71,7 +71,7 @@ public:
      *                          at the given point.
      * @param[in] moment_density A tag to ensure that the correct operator is called.
      */
-    void operator()(double& density, DConstFieldVx fdistribu, MomentDensity moment_density);
+    void operator()(double& density, DConstFieldVx fdistribu, MomentDensity moment_density) const;
 
     /**
      * Calculate the density of the distribution function.
@@ -80,7 +80,10 @@ public:
      * @param[in] allfdistribu The distribution function.
      * @param[in] moment_density A tag to ensure that the correct operator is called.
      */
-    void operator()(DFieldSpX density, DConstFieldSpXVx allfdistribu, MomentDensity moment_density);
+    void operator()(
+            DFieldSpX density,
+            DConstFieldSpXVx allfdistribu,
+            MomentDensity moment_density) const;
 
     /**
      * Calculate the mean velocity at a specific point of the distribution function.
@@ -95,7 +98,7 @@ public:
             double& mean_velocity,
             DConstFieldVx fdistribu,
             double density,
-            MomentVelocity moment_velocity);
+            MomentVelocity moment_velocity) const;
 
     /**
      * Calculate the mean velocity of the distribution function.
@@ -109,7 +112,7 @@ public:
             DFieldSpX mean_velocity,
             DConstFieldSpXVx allfdistribu,
             DConstFieldSpX density,
-            MomentVelocity moment_velocity);
+            MomentVelocity moment_velocity) const;
 
     /**
      * Calculate the temperature at a specific point of the distribution function.
@@ -126,7 +129,7 @@ public:
             DConstFieldVx fdistribu,
             double density,
             double mean_velocity,
-            MomentTemperature moment_temperature);
+            MomentTemperature moment_temperature) const;
 
     /**
      * Calculate the mean temperature of the distribution function.
@@ -142,5 +145,5 @@ public:
             DConstFieldSpXVx allfdistribu,
             DConstFieldSpX density,
             DConstFieldSpX mean_velocity,
-            MomentTemperature moment_temperature);
+            MomentTemperature moment_temperature) const;
 };
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: MIT
+
+#include <cassert>
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+#include <ddc/pdi.hpp>
+
+#include "ddc_helper.hpp"
+#include "reduced_diagnostics.hpp"
+#include "species_info.hpp"
+
+ReducedDiagnostics::ReducedDiagnostics(
+        Quadrature<IdxRangeXVx, IdxRangeSpXVx> integrate_xv,
+        Quadrature<IdxRangeX, IdxRangeX> integrate_x,
+        Quadrature<IdxRangeVx, IdxRangeSpXVx> integrate_v,
+        int const nb_modes,
+        int const diag_period)
+    : m_integrate_xv(integrate_xv)
+    , m_integrate_x(integrate_x)
+    , m_fluid_moments(integrate_v)
+    , m_idx_range_modes(Idx<GridMode>(1), IdxStep<GridMode>(nb_modes))
+    , m_diag_period(diag_period)
+{
+    assert(nb_modes >= 0);
+    assert(diag_period > 0);
+}
+
+int ReducedDiagnostics::nb_records(int const steps) const
+{
+    return get_record_index(steps) + 1;
+}
+
+int ReducedDiagnostics::get_record_index(int const iter) const
+{
+    // The final state follows the last diagnostic step, whether or not it is a multiple of
+    // the period
+    return (iter + m_diag_period - 1) / m_diag_period;
+}
+
+void ReducedDiagnostics::operator()(
+        int const iter,
+        double const time,
+        DConstFieldSpXVx const allfdistribu,
+        DConstFieldX const electrostatic_potential,
+        DConstFieldX const electric_field,
+        bool const final_state) const
+{
+    if (!final_state && iter % m_diag_period != 0) {
+        return;
+    }
+    Kokkos::Profiling::pushRegion("ReducedDiagnostics");
+
+    IdxRangeSp const idx_range_sp(get_idx_range(allfdistribu));
+    IdxRangeSpX const idx_range_spx(get_idx_range(allfdistribu));
+
+    DFieldMemSp species_mass(idx_range_sp);
+    DFieldMemSp momentum(idx_range_sp);
+    DFieldMemSp kinetic_energy(idx_range_sp);
+    DFieldMemSp l2_norm(idx_range_sp);
+    DFieldMemSp entropy(idx_range_sp);
+    compute_species_integrals(
+            get_field(species_mass),
+            get_field(momentum),
+            get_field(kinetic_energy),
+            get_field(l2_norm),
+            get_field(entropy),
+            allfdistribu);
+
+    DFieldMemSpX density(idx_range_spx);
+    DFieldMemSpX mean_velocity(idx_range_spx);
+    DFieldMemSpX temperature(idx_range_spx);
+    m_fluid_moments(get_field(density), allfdistribu, FluidMoments::s_density);
+    m_fluid_moments(
+            get_field(mean_velocity),
+            allfdistribu,
+            get_const_field(density),
+            FluidMoments::s_velocity);
+    m_fluid_moments(
+            get_field(temperature),
+            allfdistribu,
+            get_const_field(density),
+            get_const_field(mean_velocity),
+            FluidMoments::s_temperature);
+
+    double const electrostatic_energy = compute_electrostatic_energy(electric_field);
+
+    host_t<DFieldMem<IdxRangeMode>> mode_amplitudes_host(m_idx_range_modes);
+    compute_mode_amplitudes(get_field(mode_amplitudes_host), electrostatic_potential);
+
+    auto mass_host = ddc::create_mirror_view_and_copy(get_field(species_mass));
+    auto momentum_host = ddc::create_mirror_view_and_copy(get_field(momentum));
+    auto kinetic_energy_host = ddc::create_mirror_view_and_copy(get_field(kinetic_energy));
+    auto l2_norm_host = ddc::create_mirror_view_and_copy(get_field(l2_norm));
+    auto entropy_host = ddc::create_mirror_view_and_copy(get_field(entropy));
+    auto density_host = ddc::create_mirror_view_and_copy(get_field(density));
+    auto mean_velocity_host = ddc::create_mirror_view_and_copy(get_field(mean_velocity));
+    auto temperature_host = ddc::create_mirror_view_and_copy(get_field(temperature));
+
+    ddc::PdiEvent("reduced_diagnostics")
+            .with("diag_index", get_record_index(iter))
+            .with("diag_time", time)
+            .with("diag_mass", mass_host)
+            .with("diag_momentum", momentum_host)
+            .with("diag_kinetic_energy", kinetic_energy_host)
+            .with("diag_l2_norm", l2_norm_host)
+            .with("diag_entropy", entropy_host)
+            .with("diag_electrostatic_energy", electrostatic_energy)
+            .with("diag_phi_modes", mode_amplitudes_host)
+            .with("diag_density", density_host)
+            .with("diag_mean_velocity", mean_velocity_host)
+            .with("diag_temperature", temperature_host);
+
+    Kokkos::Profiling::popRegion();
+}
+
+void ReducedDiagnostics::compute_species_integrals(
+        DFieldSp const species_mass,
+        DFieldSp const momentum,
+        DFieldSp const kinetic_energy,
+        DFieldSp const l2_norm,
+        DFieldSp const entropy,
+        DConstFieldSpXVx const allfdistribu) const
+{
+    Kokkos::DefaultExecutionSpace const exec_space;
+    m_integrate_xv(
+            exec_space,
+            species_mass,
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) { return allfdistribu(ispxvx); });
+    m_integrate_xv(
+            exec_space,
+            momentum,
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                double const vx = ddc::coordinate(ddc::select<GridVx>(ispxvx));
+                return mass(IdxSp(ispxvx)) * vx * allfdistribu(ispxvx);
+            });
+    m_integrate_xv(
+            exec_space,
+            kinetic_energy,
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                double const vx = ddc::coordinate(ddc::select<GridVx>(ispxvx));
+                return 0.5 * mass(IdxSp(ispxvx)) * vx * vx * allfdistribu(ispxvx);
+            });
+    m_integrate_xv(
+            exec_space,
+            l2_norm,
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                return allfdistribu(ispxvx) * allfdistribu(ispxvx);
+            });
+    m_integrate_xv(
+            exec_space,
+            entropy,
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                double const f = allfdistribu(ispxvx);
+                return f > 0 ? -f * Kokkos::log(f) : 0.0;
+            });
+    ddc::parallel_for_each(
+            exec_space,
+            get_idx_range(l2_norm),
+            KOKKOS_LAMBDA(IdxSp const isp) { l2_norm(isp) = Kokkos::sqrt(l2_norm(isp)); });
+}
+
+double ReducedDiagnostics::compute_electrostatic_energy(DConstFieldX const electric_field) const
+{
+    return 0.5
+           * m_integrate_x(
+                   Kokkos::DefaultExecutionSpace(),
+                   KOKKOS_LAMBDA(IdxX const ix) {
+                       return electric_field(ix) * electric_field(ix);
+                   });
+}
+
+void ReducedDiagnostics::compute_mode_amplitudes(
+        host_t<DField<IdxRangeMode>> const amplitudes,
+        DConstFieldX const electrostatic_potential) const
+{
+    double const length_x
+            = ddcHelper::total_interval_length(get_idx_range(electrostatic_potential));
+    for (Idx<GridMode> const imode : get_idx_range(amplitudes)) {
+        double const kx = 2 * M_PI * (imode - Idx<GridMode>(0)).value() / length_x;
+        double const real_part = m_integrate_x(
+                Kokkos::DefaultExecutionSpace(),
+                KOKKOS_LAMBDA(IdxX const ix) {
+                    double const x = ddc::coordinate(ix);
+                    return electrostatic_potential(ix) * Kokkos::cos(kx * x);
+                });
+        double const imag_part = m_integrate_x(
+                Kokkos::DefaultExecutionSpace(),
+                KOKKOS_LAMBDA(IdxX const ix) {
+                    double const x = ddc::coordinate(ix);
+                    return -electrostatic_potential(ix) * Kokkos::sin(kx * x);
+                });
+        amplitudes(imode) = 2. / length_x * std::hypot(real_part, imag_part);
+    }
+}
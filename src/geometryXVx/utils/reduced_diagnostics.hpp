@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "fluid_moments.hpp"
+#include "geometry.hpp"
+#include "quadrature.hpp"
+
+/**
+ * @brief A class that computes reduced diagnostics of the simulation in-situ and writes
+ * them as time series through PDI.
+ *
+ * The growth rates, energy and conservation analyses only require scalar or low-dimensional
+ * quantities. These are computed on the device at the end of a diagnostic step so that the
+ * full distribution function only needs to be saved rarely. The quantities are:
+ *
+ * - for each species: the mass @f$ \int\int f dx dv @f$, the momentum
+ *   @f$ \int\int m v f dx dv @f$, the kinetic energy @f$ \int\int \frac{1}{2} m v^2 f dx dv @f$,
+ *   the L2 norm @f$ \sqrt{\int\int f^2 dx dv} @f$ and the entropy
+ *   @f$ -\int\int f \ln(f) dx dv @f$ (where f is positive);
+ * - the electrostatic energy @f$ \frac{1}{2}\int E^2 dx @f$;
+ * - the amplitude of the first Fourier modes of the electrostatic potential
+ *   @f$ |\hat{\phi}_k| = \frac{2}{L}\left|\int \phi e^{-i k x} dx\right| @f$ with
+ *   @f$ k = 2\pi n / L @f$;
+ * - the density, mean velocity and temperature profiles of each species.
+ *
+ * The diagnostics are exposed with the PDI event "reduced_diagnostics". The index of the
+ * record in the time series is exposed as diag_index. A record is written every diag_period
+ * iterations and the final state is always recorded.
+ */
+class ReducedDiagnostics
+{
+public:
+    /// @brief A discrete dimension indexing the Fourier modes of the electrostatic potential.
+    struct GridMode
+    {
+    };
+
+    /// @brief The index range of the Fourier modes of the electrostatic potential.
+    using IdxRangeMode = IdxRange<GridMode>;
+
+private:
+    Quadrature<IdxRangeXVx, IdxRangeSpXVx> m_integrate_xv;
+
+    Quadrature<IdxRangeX, IdxRangeX> m_integrate_x;
+
+    FluidMoments m_fluid_moments;
+
+    IdxRangeMode m_idx_range_modes;
+
+    int m_diag_period;
+
+public:
+    /**
+     * @brief The constructor for the operator.
+     *
+     * @param[in] integrate_xv A quadrature method which integrates over the phase space.
+     * @param[in] integrate_x A quadrature method which integrates over the spatial dimension.
+     * @param[in] integrate_v A quadrature method which integrates over the velocity space.
+     * @param[in] nb_modes The number of Fourier modes of the electrostatic potential which
+     *                  are saved (starting from the mode n=1).
+     * @param[in] diag_period The number of iterations between two diagnostic steps.
+     */
+    ReducedDiagnostics(
+            Quadrature<IdxRangeXVx, IdxRangeSpXVx> integrate_xv,
+            Quadrature<IdxRangeX, IdxRangeX> integrate_x,
+            Quadrature<IdxRangeVx, IdxRangeSpXVx> integrate_v,
+            int nb_modes,
+            int diag_period = 1);
+
+    ~ReducedDiagnostics() = default;
+
+    /**
+     * @brief Get the number of records written in the time series for a simulation.
+     *
+     * The iterations 0, diag_period, 2*diag_period, ... before the end of the simulation are
+     * recorded, followed by the final state (iteration steps).
+     *
+     * @param[in] steps The number of iterations of the simulation.
+     *
+     * @return The number of records (including the initial and final states).
+     */
+    int nb_records(int steps) const;
+
+    /**
+     * @brief Compute the diagnostics and expose them to PDI if the iteration is a
+     * diagnostic step or if it is the final state of the simulation.
+     *
+     * @param[in] iter The current iteration.
+     * @param[in] time The current time.
+     * @param[in] allfdistribu The distribution function.
+     * @param[in] electrostatic_potential The electrostatic potential.
+     * @param[in] electric_field The electric field.
+     * @param[in] final_state True if this is the final state of the simulation, which is
+     *                  always recorded.
+     */
+    void operator()(
+            int iter,
+            double time,
+            DConstFieldSpXVx allfdistribu,
+            DConstFieldX electrostatic_potential,
+            DConstFieldX electric_field,
+            bool final_state = false) const;
+
+    /**
+     * @brief Compute the integrals of the distribution function over the phase space for
+     * each species.
+     *
+     * @param[out] species_mass The mass of each species.
+     * @param[out] momentum The momentum of each species.
+     * @param[out] kinetic_energy The kinetic energy of each species.
+     * @param[out] l2_norm The L2 norm of the distribution function of each species.
+     * @param[out] entropy The entropy of each species.
+     * @param[in] allfdistribu The distribution function.
+     */
+    void compute_species_integrals(
+            DFieldSp species_mass,
+            DFieldSp momentum,
+            DFieldSp kinetic_energy,
+            DFieldSp l2_norm,
+            DFieldSp entropy,
+            DConstFieldSpXVx allfdistribu) const;
+
+    /**
+     * @brief Compute the electrostatic energy.
+     *
+     * @param[in] electric_field The electric field.
+     *
+     * @return The electrostatic energy.
+     */
+    double compute_electrostatic_energy(DConstFieldX electric_field) const;
+
+    /**
+     * @brief Compute the amplitudes of the first Fourier modes of the electrostatic potential.
+     *
+     * @param[out] amplitudes The amplitude of each mode (on the host).
+     * @param[in] electrostatic_potential The electrostatic potential.
+     */
+    void compute_mode_amplitudes(
+            host_t<DField<IdxRangeMode>> amplitudes,
+            DConstFieldX electrostatic_potential) const;
+
+private:
+    int get_record_index(int iter) const;
+};
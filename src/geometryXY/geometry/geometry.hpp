@@ -139,6 +139,59 @@ using SplineYEvaluator_XY = ddc::SplineEvaluator<
         GridX,
         GridY>;
 
+/**
+ * @brief A class which describes the members of an ensemble of independent simulations
+ * which are advanced together (e.g. the different parameters of a parameter scan).
+ */
+struct GridEnsemble
+{
+};
+
+// SplineBuilder and SplineEvaluator definitions for an ensemble of simulations
+using SplineXBuilder_EnsXY = ddc::SplineBuilder<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesX,
+        GridX,
+        SplineXBoundary,
+        SplineXBoundary,
+        ddc::SplineSolver::LAPACK,
+        GridEnsemble,
+        GridX,
+        GridY>;
+using SplineXEvaluator_EnsXY = ddc::SplineEvaluator<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesX,
+        GridX,
+        ddc::PeriodicExtrapolationRule<X>,
+        ddc::PeriodicExtrapolationRule<X>,
+        GridEnsemble,
+        GridX,
+        GridY>;
+
+using SplineYBuilder_EnsXY = ddc::SplineBuilder<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesY,
+        GridY,
+        SplineYBoundary,
+        SplineYBoundary,
+        ddc::SplineSolver::LAPACK,
+        GridEnsemble,
+        GridX,
+        GridY>;
+using SplineYEvaluator_EnsXY = ddc::SplineEvaluator<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesY,
+        GridY,
+        ddc::PeriodicExtrapolationRule<Y>,
+        ddc::PeriodicExtrapolationRule<Y>,
+        GridEnsemble,
+        GridX,
+        GridY>;
+
 // Spline index range
 using IdxRangeBSX = IdxRange<BSplinesX>;
 using IdxRangeBSY = IdxRange<BSplinesY>;
@@ -152,15 +205,20 @@ using DBSConstFieldXY = BSConstFieldXY<double>;
 using IdxX = Idx<GridX>;
 using IdxY = Idx<GridY>;
 using IdxXY = Idx<GridX, GridY>;
+using IdxEnsemble = Idx<GridEnsemble>;
+using IdxEnsXY = Idx<GridEnsemble, GridX, GridY>;
 
 // Index Step definitions
 using IdxStepX = IdxStep<GridX>;
 using IdxStepY = IdxStep<GridY>;
+using IdxStepEnsemble = IdxStep<GridEnsemble>;
 
 // Index Range definitions
 using IdxRangeX = IdxRange<GridX>;
 using IdxRangeY = IdxRange<GridY>;
 using IdxRangeXY = IdxRange<GridX, GridY>;
+using IdxRangeEnsemble = IdxRange<GridEnsemble>;
+using IdxRangeEnsXY = IdxRange<GridEnsemble, GridX, GridY>;
 
 
 // Field definitions
@@ -176,6 +234,14 @@ template <class ElementType>
 using FieldMemXY = FieldMem<ElementType, IdxRangeXY>;
 using DFieldMemXY = FieldMemXY<double>;
 
+template <class ElementType>
+using FieldMemEnsemble = FieldMem<ElementType, IdxRangeEnsemble>;
+using DFieldMemEnsemble = FieldMemEnsemble<double>;
+
+template <class ElementType>
+using FieldMemEnsXY = FieldMem<ElementType, IdxRangeEnsXY>;
+using DFieldMemEnsXY = FieldMemEnsXY<double>;
+
 
 //  Field definitions
 template <class ElementType>
@@ -190,6 +256,14 @@ template <class ElementType>
 using FieldXY = Field<ElementType, IdxRangeXY>;
 using DFieldXY = FieldXY<double>;
 
+template <class ElementType>
+using FieldEnsemble = Field<ElementType, IdxRangeEnsemble>;
+using DFieldEnsemble = FieldEnsemble<double>;
+
+template <class ElementType>
+using FieldEnsXY = Field<ElementType, IdxRangeEnsXY>;
+using DFieldEnsXY = FieldEnsXY<double>;
+
 
 // ConstField definitions
 template <class ElementType>
@@ -202,6 +276,14 @@ template <class ElementType>
 using ConstFieldXY = Field<ElementType const, IdxRangeXY>;
 using DConstFieldXY = ConstFieldXY<double>;
 
+template <class ElementType>
+using ConstFieldEnsemble = Field<ElementType const, IdxRangeEnsemble>;
+using DConstFieldEnsemble = ConstFieldEnsemble<double>;
+
+template <class ElementType>
+using ConstFieldEnsXY = Field<ElementType const, IdxRangeEnsXY>;
+using DConstFieldEnsXY = ConstFieldEnsXY<double>;
+
 
 // VectorFieldMem aliases
 // Represent a vector field (v_x, v_y) on indices (x_i, y_j) : (v_x(x_i, y_j), v_y(x_i,y_j))
@@ -212,3 +294,12 @@ using VectorFieldMemXY_XY = VectorFieldMem<
         Kokkos::DefaultExecutionSpace::memory_space>;
 using VectorFieldXY_XY = typename VectorFieldMemXY_XY::span_type;
 using VectorConstFieldXY_XY = typename VectorFieldMemXY_XY::view_type;
+
+// Represent a vector field on indices (e, x_i, y_j) for each member e of an ensemble
+using VectorFieldMemEnsXY_XY = VectorFieldMem<
+        double,
+        IdxRangeEnsXY,
+        VectorIndexSet<X, Y>,
+        Kokkos::DefaultExecutionSpace::memory_space>;
+using VectorFieldEnsXY_XY = typename VectorFieldMemEnsXY_XY::span_type;
+using VectorConstFieldEnsXY_XY = typename VectorFieldMemEnsXY_XY::view_type;
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+#include <cassert>
 
 #include "ddc_alias_inline_functions.hpp"
 #include "ddc_aliases.hpp"
@@ -63,3 +64,65 @@ public:
                 });
     };
 };
+
+
+/**
+ * @brief Initialise the allfdistribu function of an ensemble of simulations.
+ *
+ * Each member @f$ e @f$ of the ensemble is initialised as in
+ * KelvinHelmholtzInstabilityInitialisation with its own amplitude of perturbation
+ * @f$ \varepsilon_e @f$ and its own perturbation mode @f$ k_e @f$:
+ * @f$ f_{0,e}(x, y) = \sin(y) + \varepsilon_e \cos(k_e x) @f$.
+ */
+class KelvinHelmholtzInstabilityEnsembleInitialisation
+{
+    DFieldMemEnsemble m_epsilon;
+    DFieldMemEnsemble m_mode_k;
+
+public:
+    /**
+     * @brief Instantiate the initializer.
+     *
+     * @param epsilon @f$ \varepsilon_e @f$, the amplitude of perturbation of each member.
+     * @param mode_k @f$ k_e @f$, the perturbation mode of each member.
+     */
+    KelvinHelmholtzInstabilityEnsembleInitialisation(
+            host_t<DConstFieldEnsemble> const epsilon,
+            host_t<DConstFieldEnsemble> const mode_k)
+        : m_epsilon(get_idx_range(epsilon))
+        , m_mode_k(get_idx_range(mode_k))
+    {
+        assert(get_idx_range(epsilon) == get_idx_range(mode_k));
+        ddc::parallel_deepcopy(get_field(m_epsilon), epsilon);
+        ddc::parallel_deepcopy(get_field(m_mode_k), mode_k);
+    }
+
+    ~KelvinHelmholtzInstabilityEnsembleInitialisation() = default;
+
+    /**
+     * @brief Initialise @f$ f_{eq}@f$ and @f$ f @f$ for all the members of the ensemble.
+     *
+     * @param allfdistribu Field referring to the @f$ f @f$ function.
+     * @param allfdistribu_equilibrium Field referring to the @f$ f_{eq} @f$ function.
+     */
+    void operator()(DFieldEnsXY allfdistribu, DFieldEnsXY allfdistribu_equilibrium)
+    {
+        IdxRangeEnsXY const idx_range = get_idx_range(allfdistribu);
+        assert(IdxRangeEnsemble(idx_range) == get_idx_range(m_epsilon));
+        DConstFieldEnsemble const epsilon = get_const_field(m_epsilon);
+        DConstFieldEnsemble const mode_k = get_const_field(m_mode_k);
+
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                idx_range,
+                KOKKOS_LAMBDA(IdxEnsXY const i_exy) {
+                    IdxEnsemble const i_e(i_exy);
+                    CoordXY const coord_xy(ddc::coordinate(IdxXY(i_exy)));
+                    double const x = CoordX(coord_xy);
+                    double const y = CoordY(coord_xy);
+                    allfdistribu_equilibrium(i_exy) = Kokkos::sin(y);
+                    allfdistribu(i_exy) = allfdistribu_equilibrium(i_exy)
+                                          + epsilon(i_e) * Kokkos::cos(mode_k(i_e) * x);
+                });
+    };
+};
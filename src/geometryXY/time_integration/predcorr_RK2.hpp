@@ -39,6 +39,10 @@
  * - 4./5. From @f$f^{n+1/2}@f$, it computes @f$E^{n+1/2}@f$ with a FFTPoissonSolver;
  * - 6. From @f$f^n@f$ and @f$E^{n+1/2}@f$, it computes @f$f^{n+1}@f$ with a BslAdvectionRP on @f$dt@f$.
  * 
+ * The equations are solved on the index range of the fields of the Poisson solver. This index
+ * range may contain a batch dimension (e.g. GridEnsemble) in addition to the spatial
+ * dimensions, in which case all the members of the batch are advanced together.
+ *
  * @tparam PoissonSolver Type of the Poisson solver applied in the method. 
  * @tparam AdvectionX Type of the 1D advection operator applied to advect along X. 
  * @tparam AdvectionY Type of the 1D advection operator applied to advect along Y. 
@@ -47,6 +51,21 @@ template <class PoissonSolver, class AdvectionX, class AdvectionY>
 class PredCorrRK2XY
 {
 private:
+    using IdxRangeFdistribu = typename PoissonSolver::field_type::discrete_domain_type;
+    using IdxFdistribu = typename IdxRangeFdistribu::discrete_element_type;
+
+    using DFieldMemFdistribu = DFieldMem<IdxRangeFdistribu>;
+    using DFieldFdistribu = DField<IdxRangeFdistribu>;
+    using DConstFieldFdistribu = DConstField<IdxRangeFdistribu>;
+
+    using VectorFieldMemFdistribu = VectorFieldMem<
+            double,
+            IdxRangeFdistribu,
+            VectorIndexSet<X, Y>,
+            Kokkos::DefaultExecutionSpace::memory_space>;
+    using VectorFieldFdistribu = typename VectorFieldMemFdistribu::span_type;
+    using VectorConstFieldFdistribu = typename VectorFieldMemFdistribu::view_type;
+
     PoissonSolver const& m_poisson_solver;
 
     AdvectionX const& m_advection_x;
@@ -79,29 +98,31 @@ public:
      * @param dt Time step. 
      * @param nbiter Number of time steps. 
      */
-    void operator()(DFieldXY allfdistribu, double const dt, int const nbiter)
+    void operator()(DFieldFdistribu allfdistribu, double const dt, int const nbiter)
     {
         // Index range
-        IdxRangeXY const meshXY = get_idx_range(allfdistribu);
+        IdxRangeFdistribu const meshXY = get_idx_range(allfdistribu);
 
         // Output of the Poisson solver
-        DFieldMemXY electrostatic_potential_alloc(meshXY);
-        DFieldXY electrostatic_potential = get_field(electrostatic_potential_alloc);
+        DFieldMemFdistribu electrostatic_potential_alloc(meshXY);
+        DFieldFdistribu electrostatic_potential = get_field(electrostatic_potential_alloc);
 
-        VectorFieldMemXY_XY electric_field_alloc(meshXY);
-        VectorFieldXY_XY electric_field = get_field(electric_field_alloc);
+        VectorFieldMemFdistribu electric_field_alloc(meshXY);
+        VectorFieldFdistribu electric_field = get_field(electric_field_alloc);
 
         // Definition of the RK2
-        RK2<DFieldMemXY, VectorFieldMemXY_XY> predictor_corrector(meshXY);
+        RK2<DFieldMemFdistribu, VectorFieldMemFdistribu> predictor_corrector(meshXY);
 
         // Computation of the advection field: Poisson equation ---
-        std::function<void(VectorFieldXY_XY, DConstFieldXY)> define_electric_field
-                = [&](VectorFieldXY_XY electric_field, DConstFieldXY allfdistribu_const) {
-                      IdxRangeXY idx_range_xy(get_idx_range<GridX, GridY>(allfdistribu_const));
+        std::function<void(VectorFieldFdistribu, DConstFieldFdistribu)> define_electric_field
+                = [&](VectorFieldFdistribu electric_field,
+                      DConstFieldFdistribu allfdistribu_const) {
+                      IdxRangeFdistribu idx_range_xy(get_idx_range(allfdistribu_const));
 
                       // --- compute electrostatic potential and electric field:
-                      DFieldMemXY electrostatic_potential_alloc(idx_range_xy);
-                      DFieldXY electrostatic_potential = get_field(electrostatic_potential_alloc);
+                      DFieldMemFdistribu electrostatic_potential_alloc(idx_range_xy);
+                      DFieldFdistribu electrostatic_potential
+                              = get_field(electrostatic_potential_alloc);
 
                       /*
                         The applied Poisson solver needs a modifiable field for allfdistribu.
@@ -109,8 +130,8 @@ public:
                         allfdistribu_alloc chunk containing the values of the constant 
                         allfdistribu to solve the type conflict in the Poisson solver. 
                       */
-                      DFieldMemXY allfdistribu_alloc(idx_range_xy);
-                      DFieldXY allfdistribu = get_field(allfdistribu_alloc);
+                      DFieldMemFdistribu allfdistribu_alloc(idx_range_xy);
+                      DFieldFdistribu allfdistribu = get_field(allfdistribu_alloc);
                       ddc::parallel_deepcopy(
                               Kokkos::DefaultExecutionSpace(),
                               allfdistribu,
@@ -121,21 +142,23 @@ public:
                   };
 
         // Advection operator ---
-        std::function<void(DFieldXY, VectorConstFieldXY_XY, double)> advect_allfdistribu
-                = [&](DFieldXY allfdistribu, VectorConstFieldXY_XY electric_field, double dt) {
-                      DConstFieldXY electric_field_x(ddcHelper::get<X>(electric_field));
-                      DConstFieldXY electric_field_y(ddcHelper::get<Y>(electric_field));
+        std::function<void(DFieldFdistribu, VectorConstFieldFdistribu, double)> advect_allfdistribu
+                = [&](DFieldFdistribu allfdistribu,
+                      VectorConstFieldFdistribu electric_field,
+                      double dt) {
+                      DConstFieldFdistribu electric_field_x(ddcHelper::get<X>(electric_field));
+                      DConstFieldFdistribu electric_field_y(ddcHelper::get<Y>(electric_field));
 
                       // --- compute advection field:
-                      IdxRangeXY idx_range = get_idx_range(electric_field);
-                      DFieldMemXY advection_field_x_alloc(idx_range);
-                      DFieldMemXY advection_field_y_alloc(idx_range);
-                      DFieldXY advection_field_x = get_field(advection_field_x_alloc);
-                      DFieldXY advection_field_y = get_field(advection_field_y_alloc);
+                      IdxRangeFdistribu idx_range = get_idx_range(electric_field);
+                      DFieldMemFdistribu advection_field_x_alloc(idx_range);
+                      DFieldMemFdistribu advection_field_y_alloc(idx_range);
+                      DFieldFdistribu advection_field_x = get_field(advection_field_x_alloc);
+                      DFieldFdistribu advection_field_y = get_field(advection_field_y_alloc);
                       ddc::parallel_for_each(
                               Kokkos::DefaultExecutionSpace(),
                               meshXY,
-                              KOKKOS_LAMBDA(IdxXY const i_xy) {
+                              KOKKOS_LAMBDA(IdxFdistribu const i_xy) {
                                   advection_field_x(i_xy) = -electric_field_y(i_xy);
                                   advection_field_y(i_xy) = electric_field_x(i_xy);
                               });
@@ -205,6 +205,7 @@ using SplineVxBuilder = ddc::SplineBuilder<
         SplineVxBoundary,
         SplineVxBoundary,
         ddc::SplineSolver::LAPACK,
+        Species,
         GridX,
         GridY,
         GridVx,
@@ -216,6 +217,7 @@ using SplineVxEvaluator = ddc::SplineEvaluator<
         GridVx,
         ddc::ConstantExtrapolationRule<Vx>,
         ddc::ConstantExtrapolationRule<Vx>,
+        Species,
         GridX,
         GridY,
         GridVx,
@@ -228,6 +230,7 @@ using SplineVyBuilder = ddc::SplineBuilder<
         SplineVyBoundary,
         SplineVyBoundary,
         ddc::SplineSolver::LAPACK,
+        Species,
         GridX,
         GridY,
         GridVx,
@@ -239,6 +242,7 @@ using SplineVyEvaluator = ddc::SplineEvaluator<
         GridVy,
         ddc::ConstantExtrapolationRule<Vy>,
         ddc::ConstantExtrapolationRule<Vy>,
+        Species,
         GridX,
         GridY,
         GridVx,
@@ -7,7 +7,9 @@
 #include "ddc_helper.hpp"
 #include "species_info.hpp"
 
-ChargeDensityCalculator::ChargeDensityCalculator(DConstFieldVxVy coeffs) : m_quadrature(coeffs) {}
+ChargeDensityCalculator::ChargeDensityCalculator(DConstFieldVxVy coeffs) : m_coefficients(coeffs)
+{
+}
 
 void ChargeDensityCalculator::operator()(DFieldXY rho, DConstFieldSpVxVyXY allfdistribu) const
 {
@@ -21,15 +23,58 @@ void ChargeDensityCalculator::operator()(DFieldXY rho, DConstFieldSpVxVyXY allfd
     auto const kinetic_charges_alloc
             = create_mirror_view_and_copy(Kokkos::DefaultExecutionSpace(), kinetic_charges_host);
     DConstFieldSp kinetic_charges = get_const_field(kinetic_charges_alloc);
-    m_quadrature(
-            Kokkos::DefaultExecutionSpace(),
-            rho,
-            KOKKOS_LAMBDA(IdxXYVxVy idx) {
-                double sum = 0.0;
-                for (IdxSp isp : kin_species_idx_range) {
-                    sum += kinetic_charges(isp) * allfdistribu(isp, idx);
+
+    DConstFieldVxVy const coeffs = m_coefficients;
+    IdxRangeVx const idx_range_vx = get_idx_range<GridVx>(coeffs);
+    IdxRangeVy const idx_range_vy = get_idx_range<GridVy>(coeffs);
+    IdxRangeX const idx_range_x = get_idx_range<GridX>(rho);
+    IdxRangeY const idx_range_y = get_idx_range<GridY>(rho);
+    int const n_y = idx_range_y.size();
+    int const n_xy = get_idx_range(rho).size();
+    int const max_tile_size = s_tile_size;
+    int const n_tiles = (n_xy + max_tile_size - 1) / max_tile_size;
+
+    using ScratchView = Kokkos::View<
+            double*,
+            Kokkos::DefaultExecutionSpace::scratch_memory_space,
+            Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+    Kokkos::parallel_for(
+            "ChargeDensityCalculator",
+            Kokkos::TeamPolicy<>(n_tiles, Kokkos::AUTO)
+                    .set_scratch_size(0, Kokkos::PerTeam(ScratchView::shmem_size(max_tile_size))),
+            KOKKOS_LAMBDA(const Kokkos::TeamPolicy<>::member_type& team) {
+                int const tile_start = team.league_rank() * max_tile_size;
+                int const tile_size = Kokkos::min(max_tile_size, n_xy - tile_start);
+                ScratchView rho_tile(team.team_scratch(0), max_tile_size);
+
+                // Each spatial point of the tile is always treated by the same thread so no
+                // synchronisation is needed between the planes.
+                Kokkos::parallel_for(Kokkos::TeamVectorRange(team, tile_size), [&](int const i) {
+                    rho_tile(i) = 0.0;
+                });
+                for (IdxSp const isp : kin_species_idx_range) {
+                    double const charge_sp = kinetic_charges(isp);
+                    for (IdxVx const ivx : idx_range_vx) {
+                        for (IdxVy const ivy : idx_range_vy) {
+                            double const weight = charge_sp * coeffs(ivx, ivy);
+                            Kokkos::parallel_for(
+                                    Kokkos::TeamVectorRange(team, tile_size),
+                                    [&](int const i) {
+                                        int const ixy = tile_start + i;
+                                        IdxX const ix = idx_range_x.front() + ixy / n_y;
+                                        IdxY const iy = idx_range_y.front() + ixy % n_y;
+                                        rho_tile(i) += weight * allfdistribu(isp, ivx, ivy, ix, iy);
+                                    });
+                        }
+                    }
                 }
-                return sum;
+                Kokkos::parallel_for(Kokkos::TeamVectorRange(team, tile_size), [&](int const i) {
+                    int const ixy = tile_start + i;
+                    IdxX const ix = idx_range_x.front() + ixy / n_y;
+                    IdxY const iy = idx_range_y.front() + ixy % n_y;
+                    rho(ix, iy) = rho_tile(i);
+                });
             });
 
     IdxSp const last_kin_species = kin_species_idx_range.back();
@@ -7,7 +7,6 @@
 #include "ddc_helper.hpp"
 #include "geometry.hpp"
 #include "ichargedensitycalculator.hpp"
-#include "quadrature.hpp"
 
 /**
  * @brief A class which computes charges density with Kokkos.
@@ -16,11 +15,20 @@
  * @f$ \int_{vx} \int_{vy} q_s f_s(x,y,vx,vy) dvx dvy @f$
  * where @f$ q_s @f$ is the charge of the species @f$ s @f$ and
  * @f$ f_s(x,y,vx,vy) @f$ is the distribution function.
+ *
+ * The distribution function is stored with the spatial dimensions as the fastest varying
+ * dimensions. The integral is therefore computed by streaming through the contiguous (x,y)
+ * planes associated with each species and velocity. The spatial index range is split into
+ * tiles. Each tile is treated by a team which accumulates the weighted planes into a copy
+ * of its tile of rho stored in scratch memory.
  */
 class ChargeDensityCalculator : public IChargeDensityCalculator
 {
 private:
-    Quadrature<IdxRangeVxVy, IdxRangeXYVxVy> m_quadrature;
+    /// The number of spatial points treated by a team.
+    static constexpr int s_tile_size = 256;
+
+    DConstFieldVxVy m_coefficients;
 
 public:
     /**
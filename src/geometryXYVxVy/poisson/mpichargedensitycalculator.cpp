@@ -10,28 +10,88 @@
 
 MpiChargeDensityCalculator::MpiChargeDensityCalculator(
         MPI_Comm comm,
-        IChargeDensityCalculator const& local_charge_density_calculator)
+        IChargeDensityCalculator const& local_charge_density_calculator,
+        Reduction reduction)
     : m_local_charge_density_calculator(local_charge_density_calculator)
     , m_comm(comm)
+    , m_reduction(reduction)
+    , m_node_comm(MPI_COMM_NULL)
+    , m_leader_comm(MPI_COMM_NULL)
 {
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &m_node_comm);
+    int node_rank;
+    MPI_Comm_rank(m_node_comm, &node_rank);
+    m_is_node_leader = (node_rank == 0);
+    MPI_Comm_split(comm, m_is_node_leader ? 0 : MPI_UNDEFINED, rank, &m_leader_comm);
+}
+
+MpiChargeDensityCalculator::~MpiChargeDensityCalculator()
+{
+    // The communicators are released by MPI_Finalize if it has already been called
+    int is_finalized;
+    MPI_Finalized(&is_finalized);
+    if (!is_finalized) {
+        if (m_leader_comm != MPI_COMM_NULL) {
+            MPI_Comm_free(&m_leader_comm);
+        }
+        MPI_Comm_free(&m_node_comm);
+    }
 }
 
 void MpiChargeDensityCalculator::operator()(DFieldXY rho, DConstFieldSpVxVyXY allfdistribu) const
 {
     Kokkos::Profiling::pushRegion("MpiChargeDensityCalculator");
 
+    if (m_reduction == Reduction::NodeAware) {
+        compute_on_node_leader(rho, allfdistribu);
+        MPI_Bcast(rho.data_handle(), rho.size(), MPI_type_descriptor_t<double>, 0, m_node_comm);
+    } else {
+        DFieldMemXY rho_local_alloc(get_idx_range(rho));
+        DFieldXY rho_local = get_field(rho_local_alloc);
+
+        m_local_charge_density_calculator(rho_local, allfdistribu);
+
+        MPI_Allreduce(
+                rho_local.data_handle(),
+                rho.data_handle(),
+                rho.size(),
+                MPI_type_descriptor_t<double>,
+                MPI_SUM,
+                m_comm);
+    }
+
+    Kokkos::Profiling::popRegion();
+}
+
+void MpiChargeDensityCalculator::compute_on_node_leader(
+        DFieldXY rho,
+        DConstFieldSpVxVyXY allfdistribu) const
+{
     DFieldMemXY rho_local_alloc(get_idx_range(rho));
     DFieldXY rho_local = get_field(rho_local_alloc);
 
     m_local_charge_density_calculator(rho_local, allfdistribu);
 
-    MPI_Allreduce(
+    // Sum the contributions of the ranks of the node
+    MPI_Reduce(
             rho_local.data_handle(),
             rho.data_handle(),
             rho.size(),
             MPI_type_descriptor_t<double>,
             MPI_SUM,
-            m_comm);
+            0,
+            m_node_comm);
 
-    Kokkos::Profiling::popRegion();
+    // Sum the contributions of the nodes
+    if (m_is_node_leader) {
+        MPI_Allreduce(
+                MPI_IN_PLACE,
+                rho.data_handle(),
+                rho.size(),
+                MPI_type_descriptor_t<double>,
+                MPI_SUM,
+                m_leader_comm);
+    }
 }
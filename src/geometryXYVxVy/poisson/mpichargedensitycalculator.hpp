@@ -18,12 +18,36 @@
  * @f$ \int_{vx} \int_{vy} q_s f_s(x,y,vx,vy) dvx dvy @f$
  * where @f$ q_s @f$ is the charge of the species @f$ s @f$ and
  * @f$ f_s(x,y,vx,vy) @f$ is the distribution function.
+ *
+ * The contributions of the MPI ranks can either be summed with a single reduction over the
+ * whole communicator or with a hierarchical reduction. In the second case the contributions
+ * are first summed on one rank per node (the node leader) using a communicator which only
+ * contains the ranks sharing the same memory. The results are then summed across the node
+ * leaders before being broadcast inside each node. This reduces the inter-node traffic
+ * when many ranks are used on each node.
  */
 class MpiChargeDensityCalculator : public IChargeDensityCalculator
 {
+public:
+    /**
+     * @brief The way in which the contributions of the different MPI ranks are summed.
+     */
+    enum class Reduction {
+        /// A single reduction over the whole communicator.
+        Global,
+        /// A reduction inside each node followed by a reduction across the node leaders.
+        NodeAware
+    };
+
 private:
     IChargeDensityCalculator const& m_local_charge_density_calculator;
     MPI_Comm m_comm;
+    Reduction m_reduction;
+    // The ranks of m_comm sharing the same memory
+    MPI_Comm m_node_comm;
+    // The rank 0 of each node communicator (MPI_COMM_NULL on the other ranks)
+    MPI_Comm m_leader_comm;
+    bool m_is_node_leader;
 
 public:
     /**
@@ -33,10 +57,19 @@ public:
      *                 An operator which calculates the density locally
      *                 on a given MPI node. The results from this operator
      *                 will then be combined using MPI.
+     * @param[in] reduction
+     *                 The way in which the contributions of the different MPI ranks are summed.
      */
     explicit MpiChargeDensityCalculator(
             MPI_Comm comm,
-            IChargeDensityCalculator const& local_charge_density_calculator);
+            IChargeDensityCalculator const& local_charge_density_calculator,
+            Reduction reduction = Reduction::Global);
+
+    MpiChargeDensityCalculator(MpiChargeDensityCalculator const&) = delete;
+
+    MpiChargeDensityCalculator& operator=(MpiChargeDensityCalculator const&) = delete;
+
+    ~MpiChargeDensityCalculator();
 
     /**
      * @brief Computes the charge density rho from the distribution function.
@@ -44,4 +77,34 @@ public:
      * @param[in] allfdistribu 
      */
     void operator()(DFieldXY rho, DConstFieldSpVxVyXY allfdistribu) const final;
+
+    /**
+     * @brief Computes the charge density rho from the distribution function on the node
+     * leaders only.
+     *
+     * The local contributions are summed inside each node then across the node leaders.
+     * On the other ranks the content of rho is unspecified after the call.
+     *
+     * @param[out] rho The charge density.
+     * @param[in] allfdistribu The distribution function.
+     */
+    void compute_on_node_leader(DFieldXY rho, DConstFieldSpVxVyXY allfdistribu) const;
+
+    /**
+     * @brief Indicate whether this rank is the node leader (the rank 0 of the node communicator).
+     * @returns True if this rank is the node leader.
+     */
+    bool is_node_leader() const
+    {
+        return m_is_node_leader;
+    }
+
+    /**
+     * @brief Get the communicator containing the ranks which share the same node.
+     * @returns The node communicator.
+     */
+    MPI_Comm get_node_communicator() const
+    {
+        return m_node_comm;
+    }
 };
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: MIT
+
+#include <cassert>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "geometry.hpp"
+#include "mpigatherqnsolver.hpp"
+#include "mpitools.hpp"
+#include "vector_index_tools.hpp"
+
+MpiGatherQNSolver::MpiGatherQNSolver(
+        PoissonSolver const& solve_poisson,
+        IChargeDensityCalculator const& compute_rho,
+        IdxRangeXY global_idx_range,
+        MPI_Comm comm)
+    : m_solve_poisson(solve_poisson)
+    , m_compute_rho(compute_rho)
+    , m_global_idx_range(global_idx_range)
+    , m_comm(comm)
+{
+}
+
+void MpiGatherQNSolver::operator()(
+        DFieldXY const electrostatic_potential,
+        DFieldXY const electric_field_x,
+        DFieldXY const electric_field_y,
+        DConstFieldSpVxVyXY const allfdistribu) const
+{
+    Kokkos::Profiling::pushRegion("MpiGatherQNSolver");
+    assert((get_idx_range(electrostatic_potential) == get_idx_range<GridX, GridY>(allfdistribu)));
+    IdxRangeXY const local_idx_range_xy = get_idx_range(electrostatic_potential);
+
+    // Compute the RHS of the Quasi-Neutrality equation on the local spatial block.
+    // The velocity dimensions are not distributed so no reduction is needed.
+    DFieldMemXY local_rho(local_idx_range_xy);
+    m_compute_rho(get_field(local_rho), allfdistribu);
+
+    // Gather the blocks of the charge density. The blocks do not overlap so they can be summed.
+    DFieldMemXY rho(m_global_idx_range);
+    ddc::parallel_fill(get_field(rho), 0.0);
+    ddc::parallel_deepcopy(get_field(rho)[local_idx_range_xy], get_const_field(local_rho));
+    Kokkos::fence();
+    MPI_Allreduce(
+            MPI_IN_PLACE,
+            get_field(rho).data_handle(),
+            m_global_idx_range.size(),
+            MPI_type_descriptor_t<double>,
+            MPI_SUM,
+            m_comm);
+
+    DFieldMemXY global_electrostatic_potential(m_global_idx_range);
+    DFieldMemXY global_electric_field_x(m_global_idx_range);
+    DFieldMemXY global_electric_field_y(m_global_idx_range);
+    VectorField<
+            double,
+            IdxRangeXY,
+            VectorIndexSet<X, Y>,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            typename DFieldMemXY::layout_type>
+            electric_field(get_field(global_electric_field_x), get_field(global_electric_field_y));
+    m_solve_poisson(get_field(global_electrostatic_potential), electric_field, get_field(rho));
+
+    // Keep the block matching the local part of the distribution function.
+    ddc::parallel_deepcopy(
+            electrostatic_potential,
+            get_const_field(global_electrostatic_potential)[local_idx_range_xy]);
+    ddc::parallel_deepcopy(
+            electric_field_x,
+            get_const_field(global_electric_field_x)[local_idx_range_xy]);
+    ddc::parallel_deepcopy(
+            electric_field_y,
+            get_const_field(global_electric_field_y)[local_idx_range_xy]);
+
+    Kokkos::Profiling::popRegion();
+}
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <mpi.h>
+
+#include "ddc_aliases.hpp"
+#include "ichargedensitycalculator.hpp"
+#include "ipoisson_solver.hpp"
+#include "iqnsolver.hpp"
+
+/**
+ * @brief An operator which solves the Quasi-Neutrality equation when the distribution function
+ * is distributed along the spatial dimensions.
+ *
+ * The operator solves the same equation as QNSolver. The distribution function only describes
+ * a block of the spatial index range but all the velocities (e.g. the X2DSplit distribution),
+ * so the charge density can be integrated locally. The local blocks of the charge density are
+ * gathered on every rank with an MPI_Allreduce, the Poisson equation is solved on the global
+ * spatial index range and each rank keeps the block of the electrostatic potential and of the
+ * electric field which matches its part of the distribution function.
+ */
+class MpiGatherQNSolver : public IQNSolver
+{
+    using PoissonSolver = IPoissonSolver<
+            IdxRangeXY,
+            IdxRangeXY,
+            typename Kokkos::DefaultExecutionSpace::memory_space,
+            Kokkos::layout_right>;
+    PoissonSolver const& m_solve_poisson;
+    IChargeDensityCalculator const& m_compute_rho;
+    IdxRangeXY m_global_idx_range;
+    MPI_Comm m_comm;
+
+public:
+    /**
+     * Construct the MpiGatherQNSolver operator.
+     *
+     * @param solve_poisson The operator which solves the Poisson solver on the global spatial index range.
+     * @param compute_rho The operator which calculates the local charge density. It must integrate
+     *                  over the whole velocity index range.
+     * @param global_idx_range The global spatial index range.
+     * @param comm The MPI communicator across which the spatial dimensions are distributed.
+     */
+    MpiGatherQNSolver(
+            PoissonSolver const& solve_poisson,
+            IChargeDensityCalculator const& compute_rho,
+            IdxRangeXY global_idx_range,
+            MPI_Comm comm);
+
+    ~MpiGatherQNSolver() override = default;
+
+    /**
+     * The operator which solves the equation using the method described by the class.
+     *
+     * @param[out] electrostatic_potential The local block of the electrostatic potential, the result of the poisson solver.
+     * @param[out] electric_field_x The local block of the x-component of the electric field, the gradient of the electrostatic potential.
+     * @param[out] electric_field_y The local block of the y-component of the electric field, the gradient of the electrostatic potential.
+     * @param[in] allfdistribu The local part of the distribution function.
+     */
+    void operator()(
+            DFieldXY electrostatic_potential,
+            DFieldXY electric_field_x,
+            DFieldXY electric_field_y,
+            DConstFieldSpVxVyXY allfdistribu) const override;
+};
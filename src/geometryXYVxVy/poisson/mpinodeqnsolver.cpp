@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: MIT
+
+#include <cassert>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "geometry.hpp"
+#include "mpinodeqnsolver.hpp"
+#include "mpitools.hpp"
+#include "vector_index_tools.hpp"
+
+MpiNodeQNSolver::MpiNodeQNSolver(
+        PoissonSolver const& solve_poisson,
+        MpiChargeDensityCalculator const& compute_rho)
+    : m_solve_poisson(solve_poisson)
+    , m_compute_rho(compute_rho)
+{
+}
+
+void MpiNodeQNSolver::operator()(
+        DFieldXY const electrostatic_potential,
+        DFieldXY const electric_field_x,
+        DFieldXY const electric_field_y,
+        DConstFieldSpVxVyXY const allfdistribu) const
+{
+    Kokkos::Profiling::pushRegion("MpiNodeQNSolver");
+    assert((get_idx_range(electrostatic_potential) == get_idx_range<GridX, GridY>(allfdistribu)));
+    IdxRangeXY const idx_range_xy = get_idx_range(electrostatic_potential);
+
+    // Compute the RHS of the Quasi-Neutrality equation on the node leader.
+    DFieldMemXY rho(idx_range_xy);
+    m_compute_rho.compute_on_node_leader(get_field(rho), allfdistribu);
+
+    if (m_compute_rho.is_node_leader()) {
+        VectorField<
+                double,
+                IdxRangeXY,
+                VectorIndexSet<X, Y>,
+                Kokkos::DefaultExecutionSpace::memory_space,
+                typename DFieldMemXY::layout_type>
+                electric_field(electric_field_x, electric_field_y);
+        m_solve_poisson(electrostatic_potential, electric_field, get_field(rho));
+        Kokkos::fence();
+    }
+
+    // Share the solution with the other ranks of the node.
+    MPI_Comm const node_comm = m_compute_rho.get_node_communicator();
+    for (DFieldXY const field : {electrostatic_potential, electric_field_x, electric_field_y}) {
+        MPI_Bcast(field.data_handle(), field.size(), MPI_type_descriptor_t<double>, 0, node_comm);
+    }
+
+    Kokkos::Profiling::popRegion();
+}
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include "ddc_aliases.hpp"
+#include "ipoisson_solver.hpp"
+#include "iqnsolver.hpp"
+#include "mpichargedensitycalculator.hpp"
+
+/**
+ * @brief An operator which solves the Quasi-Neutrality equation once per node.
+ *
+ * The operator solves the same equation as QNSolver. However the charge density is only
+ * computed on the node leaders (see MpiChargeDensityCalculator::compute_on_node_leader) and
+ * the Poisson equation is only solved by these ranks. The electrostatic potential and the
+ * electric field are then broadcast to the other ranks of the node. This avoids solving the
+ * same equation on every rank when many ranks are used on each node.
+ */
+class MpiNodeQNSolver : public IQNSolver
+{
+    using PoissonSolver = IPoissonSolver<
+            IdxRangeXY,
+            IdxRangeXY,
+            typename Kokkos::DefaultExecutionSpace::memory_space,
+            Kokkos::layout_right>;
+    PoissonSolver const& m_solve_poisson;
+    MpiChargeDensityCalculator const& m_compute_rho;
+
+public:
+    /**
+     * Construct the MpiNodeQNSolver operator.
+     *
+     * @param solve_poisson The operator which solves the Poisson solver.
+     * @param compute_rho The operator which calculates the charge density, the right hand side of the equation.
+     */
+    MpiNodeQNSolver(
+            PoissonSolver const& solve_poisson,
+            MpiChargeDensityCalculator const& compute_rho);
+
+    ~MpiNodeQNSolver() override = default;
+
+    /**
+     * The operator which solves the equation using the method described by the class.
+     *
+     * @param[out] electrostatic_potential The electrostatic potential, the result of the poisson solver.
+     * @param[out] electric_field_x The x-component of the electric field, the gradient of the electrostatic potential.
+     * @param[out] electric_field_y The y-component of the electric field, the gradient of the electrostatic potential.
+     * @param[in] allfdistribu The distribution function.
+     */
+    void operator()(
+            DFieldXY electrostatic_potential,
+            DFieldXY electric_field_x,
+            DFieldXY electric_field_y,
+            DConstFieldSpVxVyXY allfdistribu) const override;
+};
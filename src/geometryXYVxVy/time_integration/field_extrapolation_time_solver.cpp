@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+#include <ddc/pdi.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "field_extrapolation_time_solver.hpp"
+#include "iqnsolver.hpp"
+#include "ivlasovsolver.hpp"
+#include "transpose.hpp"
+
+FieldExtrapolationTimeSolver::FieldExtrapolationTimeSolver(
+        IVlasovSolver const& vlasov_solver,
+        IQNSolver const& poisson_solver)
+    : m_vlasov_solver(vlasov_solver)
+    , m_poisson_solver(poisson_solver)
+{
+}
+
+DFieldSpVxVyXY FieldExtrapolationTimeSolver::operator()(
+        DFieldSpVxVyXY const allfdistribu_v2D_split,
+        double const dt,
+        int const steps) const
+{
+    IdxRangeSpXYVxVy idx_range_v2D_split_output_layout(get_idx_range(allfdistribu_v2D_split));
+    DFieldMemSpXYVxVy allfdistribu_v2D_split_output_layout(idx_range_v2D_split_output_layout);
+    auto allfdistribu_host_alloc
+            = ddc::create_mirror_view(get_field(allfdistribu_v2D_split_output_layout));
+    host_t<DFieldSpXYVxVy> allfdistribu_host = get_field(allfdistribu_host_alloc);
+
+    IdxRangeXY const idx_range_xy = get_idx_range<GridX, GridY>(allfdistribu_v2D_split);
+
+    // electrostatic potential and electric field at times tn, tn-1 and tn+1/2
+    DFieldMemXY electrostatic_potential(idx_range_xy);
+    DFieldMemXY electric_field_x_alloc(idx_range_xy);
+    DFieldMemXY electric_field_y_alloc(idx_range_xy);
+    DFieldMemXY electric_field_x_prev_alloc(idx_range_xy);
+    DFieldMemXY electric_field_y_prev_alloc(idx_range_xy);
+    DFieldMemXY electric_field_x_half_alloc(idx_range_xy);
+    DFieldMemXY electric_field_y_half_alloc(idx_range_xy);
+    DFieldXY electric_field_x = get_field(electric_field_x_alloc);
+    DFieldXY electric_field_y = get_field(electric_field_y_alloc);
+    DFieldXY electric_field_x_prev = get_field(electric_field_x_prev_alloc);
+    DFieldXY electric_field_y_prev = get_field(electric_field_y_prev_alloc);
+    DFieldXY electric_field_x_half = get_field(electric_field_x_half_alloc);
+    DFieldXY electric_field_y_half = get_field(electric_field_y_half_alloc);
+
+    host_t<DFieldMemXY> electrostatic_potential_host(idx_range_xy);
+
+    int iter = 0;
+    for (; iter < steps; ++iter) {
+        double const iter_time = iter * dt;
+
+        // computation of the electrostatic potential at time tn and
+        // the associated electric field
+        m_poisson_solver(
+                get_field(electrostatic_potential),
+                electric_field_x,
+                electric_field_y,
+                get_const_field(allfdistribu_v2D_split));
+
+        transpose_layout(
+                Kokkos::DefaultExecutionSpace(),
+                get_field(allfdistribu_v2D_split_output_layout),
+                get_const_field(allfdistribu_v2D_split));
+        // copies necessary to PDI
+        ddc::parallel_deepcopy(
+                allfdistribu_host,
+                get_const_field(allfdistribu_v2D_split_output_layout));
+        ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
+        ddc::PdiEvent("iteration")
+                .with("iter", iter)
+                .with("time_saved", iter_time)
+                .with("fdistribu", allfdistribu_host)
+                .with("electrostatic_potential", electrostatic_potential_host);
+
+        if (iter == 0) {
+            // start-up : the electric field at time tn+1/2 is computed with
+            // a predictor step as E at time tn-1 is not known
+            DFieldMemSpVxVyXY allfdistribu_half_t(get_idx_range(allfdistribu_v2D_split));
+            ddc::parallel_deepcopy(allfdistribu_half_t, allfdistribu_v2D_split);
+            m_vlasov_solver(
+                    get_field(allfdistribu_half_t),
+                    get_const_field(electric_field_x),
+                    get_const_field(electric_field_y),
+                    dt / 2);
+            m_poisson_solver(
+                    get_field(electrostatic_potential),
+                    electric_field_x_half,
+                    electric_field_y_half,
+                    get_const_field(allfdistribu_half_t));
+        } else {
+            // extrapolation of the electric field at time tn+1/2
+            ddc::parallel_for_each(
+                    Kokkos::DefaultExecutionSpace(),
+                    idx_range_xy,
+                    KOKKOS_LAMBDA(IdxXY const ixy) {
+                        electric_field_x_half(ixy)
+                                = 1.5 * electric_field_x(ixy) - 0.5 * electric_field_x_prev(ixy);
+                        electric_field_y_half(ixy)
+                                = 1.5 * electric_field_y(ixy) - 0.5 * electric_field_y_prev(ixy);
+                    });
+        }
+        ddc::parallel_deepcopy(electric_field_x_prev, electric_field_x);
+        ddc::parallel_deepcopy(electric_field_y_prev, electric_field_y);
+
+        // advection on a dt
+        m_vlasov_solver(
+                get_field(allfdistribu_v2D_split),
+                get_const_field(electric_field_x_half),
+                get_const_field(electric_field_y_half),
+                dt);
+    }
+
+    double const final_time = iter * dt;
+    m_poisson_solver(
+            get_field(electrostatic_potential),
+            electric_field_x,
+            electric_field_y,
+            get_const_field(allfdistribu_v2D_split));
+
+    transpose_layout(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(allfdistribu_v2D_split_output_layout),
+            get_const_field(allfdistribu_v2D_split));
+    //copies necessary to PDI
+    ddc::parallel_deepcopy(
+            allfdistribu_host,
+            get_const_field(allfdistribu_v2D_split_output_layout));
+    ddc::parallel_deepcopy(electrostatic_potential_host, electrostatic_potential);
+    ddc::PdiEvent("last_iteration")
+            .with("iter", iter)
+            .with("time_saved", final_time)
+            .with("fdistribu", allfdistribu_host)
+            .with("electrostatic_potential", electrostatic_potential_host);
+
+    return allfdistribu_v2D_split;
+}
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "geometry.hpp"
+#include "itimesolver.hpp"
+
+class IQNSolver;
+class IVlasovSolver;
+
+/**
+ * @brief A class that solves a Vlasov-Poisson system of equations by extrapolating the
+ * electric field to the half timestep.
+ *
+ * Like the predictor-corrector scheme (see PredCorr), the distribution function is advanced
+ * from t^n to t^{n+1} with the electric field at t^{n+1/2}. This field is extrapolated from
+ * the fields at t^n and t^{n-1}:
+ *
+ * E^{n+1/2} = 3/2 E^n - 1/2 E^{n-1}
+ *
+ * The first timestep, for which E^{n-1} is not known, uses the predictor-corrector scheme.
+ * Each following timestep therefore only requires one Vlasov solve (and its transpositions)
+ * and no copy of the distribution function.
+ */
+class FieldExtrapolationTimeSolver : public ITimeSolver
+{
+private:
+    IVlasovSolver const& m_vlasov_solver;
+
+    IQNSolver const& m_poisson_solver;
+
+public:
+    /**
+     * @brief Creates an instance of the field extrapolation class.
+     * @param[in] vlasov_solver A solver for a Vlasov equation.
+     * @param[in] poisson_solver A solver for a Poisson equation.
+     */
+    FieldExtrapolationTimeSolver(
+            IVlasovSolver const& vlasov_solver,
+            IQNSolver const& poisson_solver);
+
+    ~FieldExtrapolationTimeSolver() override = default;
+
+    /**
+     * @brief Solves the Vlasov-Poisson system.
+     * @param[in, out] allfdistribu On input : the initial value of the distribution function.
+     *                              On output : the value of the distribution function after solving
+     *                              the Vlasov-Poisson system a given number of iterations.
+     * @param[in] dt The timestep.
+     * @param[in] steps The number of iterations to be performed.
+     * @return The distribution function after solving the system.
+     */
+    DFieldSpVxVyXY operator()(DFieldSpVxVyXY allfdistribu, double dt, int steps = 1) const override;
+};
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MIT
+
+#include <cassert>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "mpihalosplitvlasovsolver.hpp"
+#include "transpose.hpp"
+
+MpiHaloSplitVlasovSolver::MpiHaloSplitVlasovSolver(
+        IAdvectionSpatial<GeometryXYVxVy, GridX> const& advec_x,
+        IAdvectionSpatial<GeometryXYVxVy, GridY> const& advec_y,
+        IAdvectionVelocity<GeometryXYVxVy, GridVx> const& advec_vx,
+        IAdvectionVelocity<GeometryXYVxVy, GridVy> const& advec_vy)
+    : m_advec_x(advec_x)
+    , m_advec_y(advec_y)
+    , m_advec_vx(advec_vx)
+    , m_advec_vy(advec_vy)
+{
+}
+
+DFieldSpXYVxVy MpiHaloSplitVlasovSolver::operator()(
+        DFieldSpXYVxVy const allfdistribu,
+        DConstFieldXY const electric_field_x,
+        DConstFieldXY const electric_field_y,
+        double const dt) const
+{
+    assert(get_idx_range(electric_field_x) == IdxRangeXY(get_idx_range(allfdistribu)));
+    assert(get_idx_range(electric_field_y) == IdxRangeXY(get_idx_range(allfdistribu)));
+
+    // Advect in spatial dimensions (ghost layers are exchanged with the neighbours)
+    m_advec_x(allfdistribu, dt / 2);
+    m_advec_y(allfdistribu, dt / 2);
+    // Advect in velocity dimensions
+    m_advec_vx(allfdistribu, electric_field_x, dt / 2);
+    m_advec_vy(allfdistribu, electric_field_y, dt);
+    m_advec_vx(allfdistribu, electric_field_x, dt / 2);
+    // Advect in spatial dimensions
+    m_advec_y(allfdistribu, dt / 2);
+    m_advec_x(allfdistribu, dt / 2);
+
+    return allfdistribu;
+}
+
+DFieldSpVxVyXY MpiHaloSplitVlasovSolver::operator()(
+        DFieldSpVxVyXY const allfdistribu,
+        DConstFieldXY const electric_field_x,
+        DConstFieldXY const electric_field_y,
+        double const dt) const
+{
+    Kokkos::DefaultExecutionSpace const exec_space;
+
+    // The velocity dimensions are not distributed so the local block can be reordered locally
+    DFieldMemSpXYVxVy allfdistribu_x2Dsplit_alloc(IdxRangeSpXYVxVy(get_idx_range(allfdistribu)));
+    DFieldSpXYVxVy allfdistribu_x2Dsplit = get_field(allfdistribu_x2Dsplit_alloc);
+    transpose_layout(exec_space, allfdistribu_x2Dsplit, get_const_field(allfdistribu));
+
+    (*this)(allfdistribu_x2Dsplit, electric_field_x, electric_field_y, dt);
+
+    transpose_layout(exec_space, allfdistribu, get_const_field(allfdistribu_x2Dsplit));
+
+    return allfdistribu;
+}
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "geometry.hpp"
+#include "iadvectionvx.hpp"
+#include "iadvectionx.hpp"
+#include "ivlasovsolver.hpp"
+
+/**
+ * @brief A class that solves a Vlasov equation using Strang's splitting
+ * on a mesh distributed across MPI processes along the spatial dimensions.
+ *
+ * The splitting is the same as in MpiSplitVlasovSolver but the distribution function
+ * remains in the X2DSplit layout throughout. The velocity advections are local in this
+ * layout. The spatial advections must therefore be operators which handle the distribution
+ * along x and y themselves (e.g. MpiLagrangeAdvectionSpatial which only communicates ghost
+ * layers with the neighbouring processes). No MPI transpose is required.
+ *
+ * The class can also be used as an IVlasovSolver. In this case the distribution function is
+ * stored in the (Sp, Vx, Vy, X, Y) order but it is still distributed along x and y as in the
+ * X2DSplit layout. The local block is reordered into the X2DSplit layout (and back) without
+ * any MPI communication as the velocity dimensions are not distributed. The electric field
+ * and the QN solver must then only describe the local spatial block (e.g. MpiGatherQNSolver).
+ */
+class MpiHaloSplitVlasovSolver : public IVlasovSolver
+{
+    /// Advection operator in the x direction
+    IAdvectionSpatial<GeometryXYVxVy, GridX> const& m_advec_x;
+    /// Advection operator in the y direction
+    IAdvectionSpatial<GeometryXYVxVy, GridY> const& m_advec_y;
+
+    /// Advection operator in the vx direction
+    IAdvectionVelocity<GeometryXYVxVy, GridVx> const& m_advec_vx;
+    /// Advection operator in the vy direction
+    IAdvectionVelocity<GeometryXYVxVy, GridVy> const& m_advec_vy;
+
+public:
+    /**
+     * @brief Creates an instance of the split vlasov solver class.
+     * @param[in] advec_x An advection operator along the distributed x direction.
+     * @param[in] advec_y An advection operator along the distributed y direction.
+     * @param[in] advec_vx An advection operator along the vx direction.
+     * @param[in] advec_vy An advection operator along the vy direction.
+     */
+    MpiHaloSplitVlasovSolver(
+            IAdvectionSpatial<GeometryXYVxVy, GridX> const& advec_x,
+            IAdvectionSpatial<GeometryXYVxVy, GridY> const& advec_y,
+            IAdvectionVelocity<GeometryXYVxVy, GridVx> const& advec_vx,
+            IAdvectionVelocity<GeometryXYVxVy, GridVy> const& advec_vy);
+
+    ~MpiHaloSplitVlasovSolver() override = default;
+
+    /**
+     * @brief Solves a Vlasov equation on a timestep dt.
+     *
+     * @param[in, out] allfdistribu On input : the initial value of the local part of the
+     *                              distribution function, distributed along x and y and
+     *                              stored in the (Sp, Vx, Vy, X, Y) order.
+     *                              On output : the value of the distribution function after
+     *                              solving the Vlasov equation.
+     * @param[in] electric_field_x The electric field in the x direction computed at the local spatial positions.
+     * @param[in] electric_field_y The electric field in the y direction computed at the local spatial positions.
+     * @param[in] dt The timestep.
+     *
+     * @return The distribution function after solving the Vlasov equation.
+     */
+    DFieldSpVxVyXY operator()(
+            DFieldSpVxVyXY allfdistribu,
+            DConstFieldXY electric_field_x,
+            DConstFieldXY electric_field_y,
+            double dt) const override;
+
+    /**
+     * @brief Solves a Vlasov equation on a timestep dt.
+     *
+     * @param[in, out] allfdistribu On input : the initial value of the local part of the
+     *                              distribution function in the X2DSplit layout.
+     *                              On output : the value of the distribution function after
+     *                              solving the Vlasov equation.
+     * @param[in] electric_field_x The electric field in the x direction computed at the local spatial positions.
+     * @param[in] electric_field_y The electric field in the y direction computed at the local spatial positions.
+     * @param[in] dt The timestep.
+     *
+     * @return The distribution function after solving the Vlasov equation.
+     */
+    DFieldSpXYVxVy operator()(
+            DFieldSpXYVxVy allfdistribu,
+            DConstFieldXY electric_field_x,
+            DConstFieldXY electric_field_y,
+            double dt) const;
+};
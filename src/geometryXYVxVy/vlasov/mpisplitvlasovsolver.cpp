@@ -7,15 +7,31 @@ MpiSplitVlasovSolver::MpiSplitVlasovSolver(
         IAdvectionSpatial<GeometryVxVyXY, GridY> const& advec_y,
         IAdvectionVelocity<GeometryXYVxVy, GridVx> const& advec_vx,
         IAdvectionVelocity<GeometryXYVxVy, GridVy> const& advec_vy,
-        MPITransposeAllToAll<X2DSplit, V2DSplit> const& transpose)
+        MPITransposeAllToAll<X2DSplit, V2DSplit> const& transpose,
+        TransposePrecision const transpose_precision)
     : m_advec_x(advec_x)
     , m_advec_y(advec_y)
     , m_advec_vx(advec_vx)
     , m_advec_vy(advec_vy)
     , m_transpose(transpose)
+    , m_transpose_precision(transpose_precision)
 {
 }
 
+template <class OutLayout, class InIdxRange>
+void MpiSplitVlasovSolver::transpose_to(
+        DField<typename OutLayout::discrete_domain_type> const recv_field,
+        DConstField<InIdxRange> const send_field) const
+{
+    Kokkos::DefaultExecutionSpace const exec_space;
+    if (m_transpose_precision == TransposePrecision::Double) {
+        m_transpose.transpose_to<OutLayout>(exec_space, recv_field, send_field);
+    } else {
+        // The values are rounded to float in the buffers of the all-to-all communication
+        m_transpose.transpose_to<OutLayout, float>(exec_space, recv_field, send_field);
+    }
+}
+
 DFieldSpVxVyXY MpiSplitVlasovSolver::operator()(
         DFieldSpVxVyXY const allfdistribu_v2Dsplit,
         DConstFieldXY const electric_field_x,
@@ -42,19 +58,13 @@ DFieldSpVxVyXY MpiSplitVlasovSolver::operator()(
     m_advec_x(allfdistribu_v2Dsplit, dt / 2);
     m_advec_y(allfdistribu_v2Dsplit, dt / 2);
     // Swap to vxvy contiguous layout
-    m_transpose(
-            Kokkos::DefaultExecutionSpace(),
-            allfdistribu_x2Dsplit,
-            get_const_field(allfdistribu_v2Dsplit));
+    transpose_to<X2DSplit>(allfdistribu_x2Dsplit, get_const_field(allfdistribu_v2Dsplit));
     // Advect in velocity dimensions
     m_advec_vx(allfdistribu_x2Dsplit, get_const_field(local_electric_field_x), dt / 2);
     m_advec_vy(allfdistribu_x2Dsplit, get_const_field(local_electric_field_y), dt);
     m_advec_vx(allfdistribu_x2Dsplit, get_const_field(local_electric_field_x), dt / 2);
     // Swap to xy contiguous layout
-    m_transpose(
-            Kokkos::DefaultExecutionSpace(),
-            allfdistribu_v2Dsplit,
-            get_const_field(allfdistribu_x2Dsplit));
+    transpose_to<V2DSplit>(allfdistribu_v2Dsplit, get_const_field(allfdistribu_x2Dsplit));
     // Advect in spatial dimensions
     m_advec_y(allfdistribu_v2Dsplit, dt / 2);
     m_advec_x(allfdistribu_v2Dsplit, dt / 2);
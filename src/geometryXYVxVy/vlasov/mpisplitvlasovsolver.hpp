@@ -17,9 +17,33 @@
  * the advections in the X, Y, and Vx directions first on a time interval
  * of length dt/2, then the Vy-direction advection on a time dt, and
  * finally the X, Y, and Vx directions again in reverse order on dt/2.
+ *
+ * The MPI payload of the transposes can optionally be sent in single precision. In this
+ * case the distribution function is rounded to float while it is packed into the send
+ * buffer of the all-to-all communication and converted back to double when it is unpacked.
+ * This halves the volume of data exchanged by the MPI all-to-all communications.
+ *
+ * Only the communicated values are affected: the distribution function, the advections,
+ * the quadrature and the outputs all remain in double precision, so this option does not
+ * reduce the memory footprint of the distribution function. On the contrary the float send
+ * and receive buffers are always allocated, while in double precision they are not needed
+ * when the data is already ordered as required by the all-to-all call.
  */
 class MpiSplitVlasovSolver : public IVlasovSolver
 {
+public:
+    /**
+     * @brief The precision of the MPI payload of the transposes. The distribution function
+     * is always stored in double precision.
+     */
+    enum class TransposePrecision {
+        /// The values are sent as doubles.
+        Double,
+        /// The values are rounded to floats before they are sent.
+        Single
+    };
+
+private:
     /// Advection operator in the x direction
     IAdvectionSpatial<GeometryVxVyXY, GridX> const& m_advec_x;
     /// Advection operator in the y direction
@@ -33,6 +57,9 @@ class MpiSplitVlasovSolver : public IVlasovSolver
     /// MPI transpose operator
     MPITransposeAllToAll<X2DSplit, V2DSplit> const& m_transpose;
 
+    /// The precision in which the distribution function is communicated
+    TransposePrecision m_transpose_precision;
+
 public:
     /**
      * @brief Creates an instance of the split vlasov solver class.
@@ -41,13 +68,16 @@ public:
      * @param[in] advec_vx An advection operator along the vx direction.
      * @param[in] advec_vy An advection operator along the vy direction.
      * @param[in] transpose A MPI transpose operator to move between layouts.
+     * @param[in] transpose_precision The precision in which the distribution function is
+     *                                communicated during the transposes.
      */
     MpiSplitVlasovSolver(
             IAdvectionSpatial<GeometryVxVyXY, GridX> const& advec_x,
             IAdvectionSpatial<GeometryVxVyXY, GridY> const& advec_y,
             IAdvectionVelocity<GeometryXYVxVy, GridVx> const& advec_vx,
             IAdvectionVelocity<GeometryXYVxVy, GridVy> const& advec_vy,
-            MPITransposeAllToAll<X2DSplit, V2DSplit> const& transpose);
+            MPITransposeAllToAll<X2DSplit, V2DSplit> const& transpose,
+            TransposePrecision transpose_precision = TransposePrecision::Double);
 
     ~MpiSplitVlasovSolver() override = default;
 
@@ -68,4 +98,17 @@ public:
             DConstFieldXY electric_field_x,
             DConstFieldXY electric_field_y,
             double dt) const override;
+
+private:
+    /**
+     * @brief Transpose the distribution function to the layout OutLayout in the
+     * requested precision.
+     *
+     * @param[out] recv_field The distribution function in the layout OutLayout.
+     * @param[in] send_field The distribution function in the other layout.
+     */
+    template <class OutLayout, class InIdxRange>
+    void transpose_to(
+            DField<typename OutLayout::discrete_domain_type> recv_field,
+            DConstField<InIdxRange> send_field) const;
 };
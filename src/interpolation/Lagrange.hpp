@@ -1,6 +1,9 @@
 // SPDX-License-Identifier: MIT
 #pragma once
 
+#include <cassert>
+#include <cmath>
+
 #include <ddc/ddc.hpp>
 
 #include "ddc_aliases.hpp"
@@ -13,6 +16,20 @@ enum class BCond { PERIODIC, DIRICHLET };
  *
  * A simple class which provides the possibility to evaluate
  * an interpolation of a function known only over a restricted set of nodes.
+ *
+ * All the information which only depends on the grid is computed once at construction:
+ * - the barycentric weights of each stencil (a single set of weights is sufficient on a
+ *   uniform grid as the weights are invariant by translation),
+ * - for non-uniform grids, a table which gives the cell containing the start of each bin of
+ *   a uniform partition of the domain.
+ *
+ * The cell containing an evaluation point is therefore found with direct index arithmetic on
+ * uniform grids and with a table lookup followed by a short search on non-uniform grids.
+ * The polynomial is evaluated with the second (true) barycentric formula.
+ *
+ * The object can be copied to a device and used to evaluate the interpolation of the values
+ * stored in any 1D buffer of the size of the grid (e.g. a scratch buffer containing one line
+ * of a batched field).
  */
 template <class Execspace, class GridInterp, BCond BcMin, BCond BcMax>
 class Lagrange
@@ -24,179 +41,207 @@ class Lagrange
 
     using CoordDimI = Coord<typename GridInterp::continuous_dimension_type>;
 
+    using WeightsView
+            = Kokkos::View<double**, Kokkos::LayoutRight, typename Execspace::memory_space>;
+    using CellLocatorView
+            = Kokkos::View<int*, Kokkos::LayoutRight, typename Execspace::memory_space>;
+
+    static constexpr bool s_is_periodic = (BcMin == BCond::PERIODIC);
+    static constexpr bool s_is_uniform = ddc::is_uniform_point_sampling_v<GridInterp>;
+
 private:
     IdxRangeInterp m_idx_range;
-    IdxRangeInterp m_inner_idx_range;
-    Field<double, IdxRangeInterp, typename Execspace::memory_space> m_lagrange_coeffs;
+    int m_npoints;
+    int m_ncells;
+    int m_degree;
     CoordDimI m_left_bound;
     CoordDimI m_right_bound;
-    IdxStepInterp m_poly_support;
+    double m_period;
+    // The inverse of the width of the bins used to locate the cells (the cells themselves on a
+    // uniform grid)
+    double m_inv_bin_width;
+    WeightsView m_weights;
+    CellLocatorView m_cell_locator;
 
 public:
     /**
      * @brief Usual Constructor
      *
      * @param[in] degree integer which correspond to the degree of interpolation.
-     * @param[in] x_nodes_fnodes Field of nodes and associated values of the function.
-     * @param[in] idx_range along interest direction, usedful in periodic case
-     * @param[in] ghost DiscretVector which gives the number of ghosted points
+     * @param[in] idx_range The index range of the interpolation points along the interest
+     *          direction (including the ghost points).
+     * @param[in] ghost DiscretVector which gives the number of ghosted points. The ghost points
+     *          are used to build the stencils but the Dirichlet boundary conditions are applied
+     *          at the last inner points. There must be no ghost points with periodic boundary
+     *          conditions.
      */
-    KOKKOS_FUNCTION Lagrange(
-            int degree,
-            Field<double, IdxRangeInterp, typename Execspace::memory_space> x_nodes_fnodes,
-            IdxRangeInterp idx_range,
-            IdxStepInterp ghost)
+    Lagrange(int degree, IdxRangeInterp idx_range, IdxStepInterp ghost)
         : m_idx_range(idx_range)
-        , m_inner_idx_range(idx_range.remove(ghost, ghost))
-        , m_lagrange_coeffs(x_nodes_fnodes)
-        , m_left_bound(ddc::coordinate(m_inner_idx_range.front()))
-        , m_right_bound(ddc::coordinate(m_inner_idx_range.back()))
-        , m_poly_support(degree + 1)
+        , m_npoints(idx_range.size())
+        , m_ncells(s_is_periodic ? m_npoints : m_npoints - 1)
+        , m_degree(degree)
+        , m_left_bound(ddc::coordinate(idx_range.remove(ghost, ghost).front()))
+        , m_right_bound(ddc::coordinate(idx_range.remove(ghost, ghost).back()))
+        , m_period(0.0)
+    {
+        assert(m_npoints > degree);
+        assert(!s_is_periodic || ghost == IdxStepInterp(0));
+        if constexpr (s_is_periodic) {
+            m_period = ddcHelper::total_interval_length(idx_range);
+        }
+
+        CoordDimI const x_front = ddc::coordinate(idx_range.front());
+        double const domain_length
+                = s_is_periodic ? m_period : double(ddc::coordinate(idx_range.back()) - x_front);
+        m_inv_bin_width = m_ncells / domain_length;
+
+        // Compute the barycentric weights of each stencil
+        int const nstencils = s_is_uniform ? 1 : (s_is_periodic ? m_npoints : m_npoints - degree);
+        m_weights = WeightsView("lagrange_barycentric_weights", nstencils, degree + 1);
+        auto weights_host = Kokkos::create_mirror_view(m_weights);
+        for (int begin = 0; begin < nstencils; ++begin) {
+            for (int k = 0; k <= degree; ++k) {
+                double const xk = node_coordinate(begin + k);
+                double w = 1.0;
+                for (int l = 0; l <= degree; ++l) {
+                    if (l != k) {
+                        w *= xk - node_coordinate(begin + l);
+                    }
+                }
+                weights_host(begin, k) = 1.0 / w;
+            }
+        }
+        Kokkos::deep_copy(m_weights, weights_host);
+
+        // Build the cell locator of non-uniform grids
+        if constexpr (!s_is_uniform) {
+            m_cell_locator = CellLocatorView("lagrange_cell_locator", m_ncells);
+            auto cell_locator_host = Kokkos::create_mirror_view(m_cell_locator);
+            int cell = 0;
+            for (int bin = 0; bin < m_ncells; ++bin) {
+                double const bin_start = x_front + bin / m_inv_bin_width;
+                while (cell < m_ncells - 1 && node_coordinate(cell + 1) <= bin_start) {
+                    ++cell;
+                }
+                cell_locator_host(bin) = cell;
+            }
+            Kokkos::deep_copy(m_cell_locator, cell_locator_host);
+        }
+    }
+
+    /**
+     * @brief Get the index range of the interpolation points.
+     *
+     * @return The index range of the interpolation points.
+     */
+    IdxRangeInterp idx_range() const
     {
+        return m_idx_range;
     }
 
     /**
-     * @brief Evaluates the approximated value of a function on a point 
+     * @brief Evaluates the approximated value of a function on a point
      * current values at a known set of interpolation points.
      *
      * @param[in] x_interp a node where we want to evaluate the function.
+     * @param[in] values The values of the function at the interpolation points. The values
+     *          are accessed with the position of the point in the index range (starting at 0).
      *
      * @return The evaluation of Lagrange interpolation at the point x_intercept.
      */
-    KOKKOS_FUNCTION double evaluate(CoordDimI x_interp) const;
-
-private:
-    IdxInterp getclosest(CoordDimI value) const;
-
-    KOKKOS_FUNCTION IdxInterp getclosest_binsearch(CoordDimI value) const;
-
-    KOKKOS_FUNCTION double evaluate_lagrange(CoordDimI x_interp) const;
-
-    KOKKOS_FUNCTION double apply_bc(CoordDimI x_interp) const;
-
-    KOKKOS_FUNCTION double compute_basis(
-            CoordDimI x_interp,
-            IdxInterp j,
-            IdxRangeInterp polynom_subidx_range) const;
-};
+    template <class ValuesType>
+    KOKKOS_FUNCTION double evaluate(CoordDimI x_interp, ValuesType const& values) const
+    {
+        CoordDimI const x = apply_bc(x_interp);
+        int const cell = locate_cell(x);
 
-template <typename Execspace, class GridInterp, BCond BcMin, BCond BcMax>
-Idx<GridInterp> Lagrange<Execspace, GridInterp, BcMin, BcMax>::getclosest(CoordDimI value) const
-{
-    assert(value >= m_left_bound && value <= m_right_bound);
-    auto it = std::
-            min_element(m_idx_range.begin(), m_idx_range.end(), [=](IdxInterp x, IdxInterp y) {
-                return std::abs(ddc::coordinate(x) - value) < std::abs(ddc::coordinate(y) - value);
-            });
-    return *it;
-}
-template <typename Execspace, class GridInterp, BCond BcMin, BCond BcMax>
-KOKKOS_INLINE_FUNCTION Idx<GridInterp> Lagrange<Execspace, GridInterp, BcMin, BcMax>::
-        getclosest_binsearch(CoordDimI x_interp) const
-{
-    assert(x_interp >= m_left_bound && x_interp <= m_right_bound);
-    IdxInterp begin = m_idx_range.front();
-    IdxInterp end = m_idx_range.back();
-    IdxInterp elm_cell = begin + (end - begin) / 2;
-    while (x_interp < ddc::coordinate(elm_cell)
-           || x_interp > ddc::coordinate(elm_cell + IdxStepInterp(1))) {
-        if (x_interp < ddc::coordinate(elm_cell)) {
-            end = elm_cell;
-        } else {
-            begin = elm_cell;
+        int begin = cell - (m_degree - 1) / 2;
+        if constexpr (!s_is_periodic) {
+            begin = Kokkos::max(0, Kokkos::min(begin, m_npoints - 1 - m_degree));
         }
 
-        elm_cell = begin + (end - begin) / 2;
-    }
-    return elm_cell;
-}
+        int weights_row = 0;
+        if constexpr (!s_is_uniform) {
+            weights_row = s_is_periodic ? wrap_index(begin) : begin;
+        }
 
-/**
- * @brief Computes the basis function of Lagrange.
- *
- * @param[in] x_interp a node where we want to evaluate the function.
- * @param[in] j index of the basis.
- * @param[in] polynom_subidx_range A part of the mesh centred around x_interp.
- *
- * @return The value of the basis at x_intercept
- */
-template <typename Execspace, class GridInterp, BCond BcMin, BCond BcMax>
-KOKKOS_INLINE_FUNCTION double Lagrange<Execspace, GridInterp, BcMin, BcMax>::compute_basis(
-        CoordDimI x_interp,
-        IdxInterp j,
-        IdxRangeInterp polynom_subidx_range) const
-{
-    double w(1);
-    CoordDimI coord_j = ddc::coordinate(j);
-    for (IdxInterp const i : polynom_subidx_range) {
-        CoordDimI coord_i = ddc::coordinate(i);
-        if (coord_i != coord_j) {
-            w *= (x_interp - coord_i) / (coord_j - coord_i);
+        double numerator = 0.0;
+        double denominator = 0.0;
+        for (int k = 0; k <= m_degree; ++k) {
+            int const j = s_is_periodic ? wrap_index(begin + k) : begin + k;
+            double const dx = x - node_coordinate(begin + k);
+            if (dx == 0.0) {
+                return values(j);
+            }
+            double const coeff = m_weights(weights_row, k) / dx;
+            numerator += coeff * values(j);
+            denominator += coeff;
         }
+        return numerator / denominator;
     }
-    return w;
-}
 
-template <typename Execspace, class GridInterp, BCond BcMin, BCond BcMax>
-KOKKOS_INLINE_FUNCTION double Lagrange<Execspace, GridInterp, BcMin, BcMax>::apply_bc(
-        CoordDimI x_interp) const
-{
-    CoordDimI bc_val = x_interp;
-    const double d = m_right_bound - m_left_bound;
-    if constexpr (BcMin == BCond::PERIODIC) {
-        bc_val -= Kokkos::floor((x_interp - m_left_bound) / d) * d;
-    } else {
-        if (x_interp < m_left_bound && BcMin == BCond::DIRICHLET) {
-            bc_val = m_left_bound;
-        } else if (x_interp > m_right_bound && BcMax == BCond::DIRICHLET) {
-            bc_val = m_right_bound;
-        }
+private:
+    /**
+     * @brief Get the index of a point in [0, npoints) from an index which may lie outside
+     * the grid on a periodic domain.
+     */
+    KOKKOS_FUNCTION int wrap_index(int j) const
+    {
+        return (j % m_npoints + m_npoints) % m_npoints;
     }
-    return evaluate_lagrange(bc_val);
-}
 
-template <typename Execspace, class GridInterp, BCond BcMin, BCond BcMax>
-KOKKOS_INLINE_FUNCTION double Lagrange<Execspace, GridInterp, BcMin, BcMax>::evaluate(
-        CoordDimI x_interp) const
-{
-    if (x_interp < m_left_bound || m_right_bound < x_interp) {
-        return apply_bc(x_interp);
-    } else {
-        return evaluate_lagrange(x_interp);
+    /**
+     * @brief Get the coordinate of the j-th node. On a periodic domain j may lie outside
+     * the grid in which case the coordinate is shifted by the period.
+     */
+    KOKKOS_FUNCTION double node_coordinate(int j) const
+    {
+        if constexpr (s_is_periodic) {
+            int const n_periods = (j >= 0) ? j / m_npoints : -((m_npoints - 1 - j) / m_npoints);
+            IdxInterp const node = m_idx_range.front() + IdxStepInterp(j - n_periods * m_npoints);
+            return ddc::coordinate(node) + n_periods * m_period;
+        } else {
+            return ddc::coordinate(m_idx_range.front() + IdxStepInterp(j));
+        }
     }
-}
 
-template <typename Execspace, class GridInterp, BCond BcMin, BCond BcMax>
-KOKKOS_INLINE_FUNCTION double Lagrange<Execspace, GridInterp, BcMin, BcMax>::evaluate_lagrange(
-        CoordDimI x_intern) const
-{
-    assert(x_intern >= m_left_bound && x_intern <= m_right_bound);
-
-    IdxInterp begin, end;
-    IdxInterp icell = getclosest_binsearch(x_intern);
-    IdxInterp mid = icell;
-    if (mid >= m_inner_idx_range.back() && BcMax == BCond::PERIODIC) {
-        begin = mid - m_poly_support / 2;
-        end = Kokkos::min(m_inner_idx_range.back(), begin + m_poly_support);
-    } else if (mid <= m_inner_idx_range.front() && BcMin == BCond::PERIODIC) {
-        begin = Kokkos::max(m_idx_range.front(), mid - m_poly_support / 2);
-        end = begin + m_poly_support;
-    } else {
-        if (m_inner_idx_range.front() + m_poly_support / 2 > mid) {
-            begin = m_inner_idx_range.front();
+    /**
+     * @brief Get the index (relative to the front of the grid) of the cell containing x.
+     */
+    KOKKOS_FUNCTION int locate_cell(CoordDimI x) const
+    {
+        double const x_front = ddc::coordinate(m_idx_range.front());
+        int const bin = Kokkos::max(
+                0,
+                Kokkos::min(int(Kokkos::floor((x - x_front) * m_inv_bin_width)), m_ncells - 1));
+        if constexpr (s_is_uniform) {
+            return bin;
         } else {
-            begin = mid - m_poly_support / 2;
+            int cell = m_cell_locator(bin);
+            while (cell < m_ncells - 1 && x >= node_coordinate(cell + 1)) {
+                ++cell;
+            }
+            return cell;
         }
-        end = Kokkos::min(m_idx_range.back() + IdxStepInterp(1), begin + m_poly_support);
     }
 
-    if (end == m_idx_range.back())
-        begin = end - m_poly_support;
-    IdxStepInterp npoints_subidx_range(end - begin);
-    IdxRangeInterp subidx_range(begin, npoints_subidx_range);
-    double p = 0;
-    for (IdxInterp const ix : subidx_range) {
-        p += compute_basis(x_intern, ix, subidx_range) * m_lagrange_coeffs(ix);
+    /**
+     * @brief Apply the boundary conditions to find the coordinate where the polynomial should be
+     * evaluated.
+     */
+    KOKKOS_FUNCTION CoordDimI apply_bc(CoordDimI x_interp) const
+    {
+        CoordDimI bc_val = x_interp;
+        if constexpr (s_is_periodic) {
+            double const x_front = ddc::coordinate(m_idx_range.front());
+            bc_val -= Kokkos::floor((x_interp - x_front) / m_period) * m_period;
+        } else {
+            if (x_interp < m_left_bound && BcMin == BCond::DIRICHLET) {
+                bc_val = m_left_bound;
+            } else if (x_interp > m_right_bound && BcMax == BCond::DIRICHLET) {
+                bc_val = m_right_bound;
+            }
+        }
+        return bc_val;
     }
-    return p;
-}
+};
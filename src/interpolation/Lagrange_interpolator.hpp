@@ -1,16 +1,25 @@
 // SPDX-License-Identifier: MIT
 #pragma once
+#include <optional>
+
 #include <ddc/ddc.hpp>
 
 #include "Lagrange.hpp"
 #include "ddc_alias_inline_functions.hpp"
 #include "ddc_aliases.hpp"
+#include "ddc_helper.hpp"
 #include "iinterpolator.hpp"
 
 /**
  * @brief A class for interpolating a function using Lagrange polynomials.
  * It is designed to work with both uniform and non-uniform mesh, and have the advantage to be local.
  *
+ * The barycentric weights and the cell locator which only depend on the grid are stored in a
+ * Lagrange object. This object is built once at construction if the index range of the
+ * interpolation points is provided. Otherwise (or if the operator is called on a different
+ * index range) it is built at each call.
+ * Each line of the batched field is copied into a scratch buffer so no copy of the whole field
+ * is required.
  */
 template <class GridInterp, BCond BcMin, BCond BcMax, class... Grid1D>
 class LagrangeInterpolator : public IInterpolator<GridInterp, Grid1D...>
@@ -20,9 +29,13 @@ class LagrangeInterpolator : public IInterpolator<GridInterp, Grid1D...>
     using batched_derivs_idx_range_type =
             typename IInterpolator<GridInterp, Grid1D...>::batched_derivs_idx_range_type;
 
+    using LagrangeType = Lagrange<Kokkos::DefaultExecutionSpace, GridInterp, BcMin, BcMax>;
+    using IdxRangeBatch = ddc::remove_dims_of_t<IdxRange<Grid1D...>, GridInterp>;
+
 private:
     int m_degree;
     IdxStep<GridInterp> m_ghost;
+    std::optional<LagrangeType> m_lagrange;
 
 public:
     /**
@@ -34,6 +47,23 @@ public:
     {
     }
 
+    /**
+     * @brief Create a  Lagrange interpolator object and precompute the quantities which only
+     * depend on the grid.
+     * @param[in] degree Degree of polynomials
+     * @param[in] ghost  Discrete vector which gives the number of ghost points.
+     * @param[in] idx_range_interp The index range of the interpolation points.
+    */
+    LagrangeInterpolator(
+            int degree,
+            IdxStep<GridInterp> ghost,
+            IdxRange<GridInterp> idx_range_interp)
+        : m_degree(degree)
+        , m_ghost(ghost)
+        , m_lagrange(std::in_place, degree, idx_range_interp, ghost)
+    {
+    }
+
     ~LagrangeInterpolator() override = default;
 
     batched_derivs_idx_range_type batched_derivs_idx_range_xmin(
@@ -79,26 +109,35 @@ public:
                     derivs_xmax
             = std::nullopt) const override
     {
-        static_assert(
-                BcMin != BCond::PERIODIC,
-                "PERIODIC Boundary condition is not supported yet in LagrangeInterpolator.");
-
-        int const deg = m_degree;
-        auto const ghost = m_ghost;
-        auto inout_data_tmp_alloc
-                = ddc::create_mirror_and_copy(Kokkos::DefaultExecutionSpace(), inout_data);
-        auto inout_data_tmp = get_field(inout_data_tmp_alloc);
-        auto batch_idx_range = ddc::remove_dims_of<GridInterp>(get_idx_range(inout_data));
-        auto const interp_range = get_idx_range<GridInterp>(inout_data);
-        ddc::parallel_for_each(
-                Kokkos::DefaultExecutionSpace(),
-                batch_idx_range,
-                KOKKOS_LAMBDA(typename decltype(batch_idx_range)::discrete_element_type const i) {
-                    Lagrange<Kokkos::DefaultExecutionSpace, GridInterp, BcMin, BcMax>
-                            evaluator(deg, inout_data_tmp[i], interp_range, ghost);
-                    for (Idx<GridInterp> j : interp_range) {
-                        inout_data(i, j) = evaluator.evaluate(coordinates(i, j));
-                    }
+        using IdxBatch = typename IdxRangeBatch::discrete_element_type;
+        using ScratchView = Kokkos::View<
+                double*,
+                Kokkos::DefaultExecutionSpace::scratch_memory_space,
+                Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+        IdxRangeBatch const batch_idx_range(get_idx_range(inout_data));
+        IdxRange<GridInterp> const interp_range = get_idx_range<GridInterp>(inout_data);
+        LagrangeType const lagrange = (m_lagrange && m_lagrange->idx_range() == interp_range)
+                                              ? *m_lagrange
+                                              : LagrangeType(m_degree, interp_range, m_ghost);
+        int const npoints = interp_range.size();
+
+        Kokkos::parallel_for(
+                "LagrangeInterpolator",
+                Kokkos::TeamPolicy<>(batch_idx_range.size(), Kokkos::AUTO)
+                        .set_scratch_size(0, Kokkos::PerTeam(ScratchView::shmem_size(npoints))),
+                KOKKOS_LAMBDA(const Kokkos::TeamPolicy<>::member_type& team) {
+                    IdxBatch const ib
+                            = ddcHelper::to_discrete_element(team.league_rank(), batch_idx_range);
+                    ScratchView line(team.team_scratch(0), npoints);
+                    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, npoints), [&](int j) {
+                        line(j) = inout_data(ib, interp_range.front() + IdxStep<GridInterp>(j));
+                    });
+                    team.team_barrier();
+                    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, npoints), [&](int j) {
+                        Idx<GridInterp> const ij = interp_range.front() + IdxStep<GridInterp>(j);
+                        inout_data(ib, ij) = lagrange.evaluate(coordinates(ib, ij), line);
+                    });
                 });
         return inout_data;
     }
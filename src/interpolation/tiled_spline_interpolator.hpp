@@ -0,0 +1,371 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+#include <ddc/kernels/splines.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "iinterpolator.hpp"
+
+/**
+ * @brief A class for interpolating a function using splines, one tile of the batch at a time.
+ *
+ * The SplineInterpolator builds the spline coefficients for the whole batched field before
+ * evaluating them. This requires a coefficient array of the size of the field and the data is
+ * streamed through memory several times. This class instead splits the first dimension of the
+ * field (which must be a batch dimension) into tiles. The spline coefficients are built and
+ * evaluated for one tile before moving on to the next one. The coefficient array therefore only
+ * has the size of a tile, and when the tile is small enough it remains in cache between the build
+ * and the evaluation.
+ *
+ * The tiles are contiguous blocks of memory (the fields must have a layout_right and be
+ * contiguous), so the builder (which is constructed on the index range of the first tile) is
+ * applied to each tile without copying the data. When the number of points along the first
+ * dimension is not a multiple of the tile size, the last (shorter) tile is treated by a second
+ * builder constructed on the index range of this tile.
+ *
+ * @tparam GridInterp The dimension over which we interpolate.
+ * @tparam BSplines The BSplines along the dimension of interest.
+ * @tparam BcMin The boundary condition at the lower boundary.
+ * @tparam BcMax The boundary condition at the upper boundary.
+ * @tparam Grid1D... All the dimensions of the interpolation problem (batched + interpolated).
+ */
+template <
+        class GridInterp,
+        class BSplines,
+        ddc::BoundCond BcMin,
+        ddc::BoundCond BcMax,
+        class LeftExtrapolationRule,
+        class RightExtrapolationRule,
+        ddc::SplineSolver Solver,
+        class... Grid1D>
+class TiledSplineInterpolator : public IInterpolator<GridInterp, Grid1D...>
+{
+    using BuilderType = ddc::SplineBuilder<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            BSplines,
+            GridInterp,
+            BcMin,
+            BcMax,
+            Solver,
+            Grid1D...>;
+    using EvaluatorType = ddc::SplineEvaluator<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            BSplines,
+            GridInterp,
+            LeftExtrapolationRule,
+            RightExtrapolationRule,
+            Grid1D...>;
+    using deriv_type = typename IInterpolator<GridInterp, Grid1D...>::deriv_type;
+    using batched_derivs_idx_range_type =
+            typename IInterpolator<GridInterp, Grid1D...>::batched_derivs_idx_range_type;
+    using batched_deriv_field_type = ConstField<double, batched_derivs_idx_range_type>;
+    using CoordInterp = Coord<typename GridInterp::continuous_dimension_type>;
+
+    /// The dimension which is split into tiles.
+    using GridTile = ddc::type_seq_element_t<0, ddc::detail::TypeSeq<Grid1D...>>;
+
+    static_assert(
+            !std::is_same_v<GridTile, GridInterp>,
+            "The first dimension of the field must be a batch dimension to be split into tiles.");
+
+    using field_type = Field<double, IdxRange<Grid1D...>>;
+    using coefs_field_type = DField<typename BuilderType::batched_spline_domain_type>;
+
+    static_assert(
+            std::is_same_v<typename field_type::layout_type, Kokkos::layout_right>,
+            "The tiles can only be described without a copy if the field has a layout_right.");
+
+private:
+    BuilderType const& m_tile_builder;
+
+    BuilderType const& m_last_tile_builder;
+
+    EvaluatorType const& m_evaluator;
+
+    mutable DFieldMem<typename BuilderType::batched_spline_domain_type> m_tile_coefs;
+
+public:
+    /**
+     * @brief Create a tiled spline interpolator object.
+     * @param[in] tile_builder An operator which builds spline coefficients from the values of a
+     *          function at known interpolation points on the index range of the first tile.
+     * @param[in] last_tile_builder An operator which builds spline coefficients on the index
+     *          range of the last tile. This is the same object as tile_builder if all the tiles
+     *          have the same size. Otherwise the last tile must be shorter than the others.
+     * @param[in] evaluator An operator which evaluates the value of a spline at requested coordinates.
+     */
+    TiledSplineInterpolator(
+            BuilderType const& tile_builder,
+            BuilderType const& last_tile_builder,
+            EvaluatorType const& evaluator)
+        : m_tile_builder(tile_builder)
+        , m_last_tile_builder(last_tile_builder)
+        , m_evaluator(evaluator)
+        , m_tile_coefs(tile_builder.batched_spline_domain())
+    {
+    }
+
+    ~TiledSplineInterpolator() override = default;
+
+    batched_derivs_idx_range_type batched_derivs_idx_range_xmin(
+            IdxRange<Grid1D...> idx_range) const override
+    {
+        return ddc::replace_dim_of<GridInterp, deriv_type>(
+                idx_range,
+                IdxRange<deriv_type>(
+                        Idx<deriv_type>(1),
+                        IdxStep<deriv_type>(BuilderType::s_nbc_xmin)));
+    }
+
+    batched_derivs_idx_range_type batched_derivs_idx_range_xmax(
+            IdxRange<Grid1D...> idx_range) const override
+    {
+        return ddc::replace_dim_of<GridInterp, deriv_type>(
+                idx_range,
+                IdxRange<deriv_type>(
+                        Idx<deriv_type>(1),
+                        IdxStep<deriv_type>(BuilderType::s_nbc_xmax)));
+    }
+
+    /**
+     * @brief Approximate the value of a function at a set of coordinates using the
+     * current values at a known set of interpolation points.
+     *
+     * @param[in, out] inout_data On input: an array containing the value of the function at the interpolation points.
+     *           On output: an array containing the value of the function at the coordinates.
+     * @param[in] coordinates The coordinates where the function should be evaluated.
+     * @param[in] derivs_xmin The values of the derivatives at the lower boundary
+     * (used only with ddc::BoundCond::HERMITE lower boundary condition).
+     * @param[in] derivs_xmax The values of the derivatives at the upper boundary
+     * (used only with ddc::BoundCond::HERMITE upper boundary condition).
+     *
+     * @return A reference to the inout_data array containing the value of the function at the coordinates.
+     */
+    Field<double, IdxRange<Grid1D...>> operator()(
+            Field<double, IdxRange<Grid1D...>> const inout_data,
+            ConstField<CoordInterp, IdxRange<Grid1D...>> const coordinates,
+            std::optional<batched_deriv_field_type> derivs_xmin = std::nullopt,
+            std::optional<batched_deriv_field_type> derivs_xmax = std::nullopt) const override
+    {
+        IdxRange<Grid1D...> const idx_range = get_idx_range(inout_data);
+        IdxRange<GridTile> const idx_range_tiled(idx_range);
+        std::size_t const tile_size
+                = IdxRange<GridTile>(m_tile_builder.batched_interpolation_domain()).size();
+        std::size_t const last_tile_size
+                = IdxRange<GridTile>(m_last_tile_builder.batched_interpolation_domain()).size();
+        // The number of elements associated with one index of the tiled dimension
+        std::size_t const line_block_size = idx_range.size() / idx_range_tiled.size();
+        assert(inout_data.allocation_kokkos_view().span_is_contiguous());
+        assert(coordinates.allocation_kokkos_view().span_is_contiguous());
+        assert(last_tile_size <= tile_size);
+        assert((idx_range_tiled.size() - last_tile_size) % tile_size == 0);
+        assert(line_block_size
+               == m_tile_builder.batched_interpolation_domain().size() / tile_size);
+
+        std::size_t const last_tile_start = idx_range_tiled.size() - last_tile_size;
+        for (std::size_t i_start(0); i_start < last_tile_start; i_start += tile_size) {
+            apply_on_tile(
+                    m_tile_builder,
+                    inout_data,
+                    coordinates,
+                    derivs_xmin,
+                    derivs_xmax,
+                    i_start,
+                    line_block_size);
+        }
+        apply_on_tile(
+                m_last_tile_builder,
+                inout_data,
+                coordinates,
+                derivs_xmin,
+                derivs_xmax,
+                last_tile_start,
+                line_block_size);
+        return inout_data;
+    }
+
+private:
+    /**
+     * @brief Build and evaluate the splines on the tile starting at the index i_start of the
+     * tiled dimension. The tile is described with the index range of the builder.
+     */
+    void apply_on_tile(
+            BuilderType const& builder,
+            field_type const inout_data,
+            ConstField<CoordInterp, IdxRange<Grid1D...>> const coordinates,
+            std::optional<batched_deriv_field_type> const& derivs_xmin,
+            std::optional<batched_deriv_field_type> const& derivs_xmax,
+            std::size_t const i_start,
+            std::size_t const line_block_size) const
+    {
+        IdxRange<Grid1D...> const tile_idx_range = builder.batched_interpolation_domain();
+        std::size_t const tile_size = IdxRange<GridTile>(tile_idx_range).size();
+
+        field_type const data_tile(
+                inout_data.data_handle() + i_start * line_block_size,
+                tile_idx_range);
+        ConstField<CoordInterp, IdxRange<Grid1D...>> const coordinates_tile(
+                coordinates.data_handle() + i_start * line_block_size,
+                tile_idx_range);
+        std::optional<batched_deriv_field_type> const derivs_xmin_tile = get_tile(
+                derivs_xmin,
+                batched_derivs_idx_range_xmin(tile_idx_range),
+                i_start,
+                tile_size);
+        std::optional<batched_deriv_field_type> const derivs_xmax_tile = get_tile(
+                derivs_xmax,
+                batched_derivs_idx_range_xmax(tile_idx_range),
+                i_start,
+                tile_size);
+        // The coefficients of a shorter tile are stored at the start of the buffer
+        coefs_field_type const coefs_tile(
+                m_tile_coefs.data_handle(),
+                builder.batched_spline_domain());
+
+        builder(coefs_tile, get_const_field(data_tile), derivs_xmin_tile, derivs_xmax_tile);
+        m_evaluator(data_tile, coordinates_tile, get_const_field(coefs_tile));
+    }
+
+    static std::optional<batched_deriv_field_type> get_tile(
+            std::optional<batched_deriv_field_type> const& derivs,
+            batched_derivs_idx_range_type const tile_derivs_idx_range,
+            std::size_t const i_start,
+            std::size_t const tile_size)
+    {
+        if (!derivs) {
+            return std::nullopt;
+        }
+        std::size_t const line_block_size = tile_derivs_idx_range.size() / tile_size;
+        return batched_deriv_field_type(
+                derivs->data_handle() + i_start * line_block_size,
+                tile_derivs_idx_range);
+    }
+};
+
+/**
+ * @brief A class which stores information necessary to create an instance of the
+ * TiledSplineInterpolator class.
+ *
+ * The builder used on each tile is created and stored by this class so that the spline matrix
+ * is only factorised once. The tiles contain the requested maximum number of points along the
+ * first dimension of the field. If this number of points does not divide the extent of the
+ * first dimension then the remaining points are treated in a shorter last tile with a second
+ * builder.
+ */
+template <
+        class GridInterp,
+        class BSplines,
+        ddc::BoundCond BcMin,
+        ddc::BoundCond BcMax,
+        class LeftExtrapolationRule,
+        class RightExtrapolationRule,
+        ddc::SplineSolver Solver,
+        class... Grid1D>
+class PreallocatableTiledSplineInterpolator
+    : public IPreallocatableInterpolator<GridInterp, Grid1D...>
+{
+    using BuilderType = ddc::SplineBuilder<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            BSplines,
+            GridInterp,
+            BcMin,
+            BcMax,
+            Solver,
+            Grid1D...>;
+    using EvaluatorType = ddc::SplineEvaluator<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            BSplines,
+            GridInterp,
+            LeftExtrapolationRule,
+            RightExtrapolationRule,
+            Grid1D...>;
+
+    using GridTile = ddc::type_seq_element_t<0, ddc::detail::TypeSeq<Grid1D...>>;
+
+    BuilderType const m_tile_builder;
+
+    std::optional<BuilderType> const m_last_tile_builder;
+
+    EvaluatorType const& m_evaluator;
+
+public:
+    /**
+     * @brief Create an object capable of creating TiledSplineInterpolator objects.
+     * @param[in] builder An operator which builds spline coefficients on the whole index range
+     *          of the field (only its index range is used).
+     * @param[in] evaluator An operator which evaluates the value of a spline at requested coordinates.
+     * @param[in] max_tile_size The maximum number of points along the first dimension of the field
+     *          in a tile.
+     */
+    PreallocatableTiledSplineInterpolator(
+            BuilderType const& builder,
+            EvaluatorType const& evaluator,
+            std::size_t max_tile_size)
+        : m_tile_builder(get_tile_idx_range(builder.batched_interpolation_domain(), max_tile_size))
+        , m_last_tile_builder(
+                  get_last_tile_builder(builder.batched_interpolation_domain(), max_tile_size))
+        , m_evaluator(evaluator)
+    {
+    }
+
+    ~PreallocatableTiledSplineInterpolator() override = default;
+
+    /**
+     * Create an instance of the TiledSplineInterpolator class.
+     *
+     * @return A unique pointer to an instance of the TiledSplineInterpolator class.
+     */
+    std::unique_ptr<IInterpolator<GridInterp, Grid1D...>> preallocate() const override
+    {
+        return std::make_unique<TiledSplineInterpolator<
+                GridInterp,
+                BSplines,
+                BcMin,
+                BcMax,
+                LeftExtrapolationRule,
+                RightExtrapolationRule,
+                Solver,
+                Grid1D...>>(
+                m_tile_builder,
+                m_last_tile_builder ? *m_last_tile_builder : m_tile_builder,
+                m_evaluator);
+    }
+
+private:
+    static IdxRange<Grid1D...> get_tile_idx_range(
+            IdxRange<Grid1D...> const idx_range,
+            std::size_t const max_tile_size)
+    {
+        assert(max_tile_size > 0);
+        IdxRange<GridTile> const idx_range_tiled(idx_range);
+        std::size_t const tile_size = std::min(max_tile_size, idx_range_tiled.size());
+        return ddc::replace_dim_of<GridTile, GridTile>(
+                idx_range,
+                IdxRange<GridTile>(idx_range_tiled.front(), IdxStep<GridTile>(tile_size)));
+    }
+
+    static std::optional<BuilderType> get_last_tile_builder(
+            IdxRange<Grid1D...> const idx_range,
+            std::size_t const max_tile_size)
+    {
+        IdxRange<GridTile> const idx_range_tiled(idx_range);
+        std::size_t const last_tile_size = idx_range_tiled.size() % max_tile_size;
+        if (idx_range_tiled.size() <= max_tile_size || last_tile_size == 0) {
+            return std::nullopt;
+        }
+        return BuilderType(ddc::replace_dim_of<GridTile, GridTile>(
+                idx_range,
+                IdxRange<GridTile>(idx_range_tiled.front(), IdxStep<GridTile>(last_tile_size))));
+    }
+};
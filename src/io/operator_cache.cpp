@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: MIT
+#include <pdi.h>
+
+#include "operator_cache.hpp"
+#include "paraconfpp.hpp"
+
+OperatorCache OperatorCache::init_from_input(PC_tree_t const& yaml_input_file)
+{
+    bool active = false;
+    if (PCpp_get(yaml_input_file, ".PoissonSolver.operator_cache").status == PC_OK) {
+        active = PCpp_bool(yaml_input_file, ".PoissonSolver.operator_cache");
+    }
+    return OperatorCache(active);
+}
+
+std::uint64_t OperatorCache::hash(void const* data, std::size_t n_bytes, std::uint64_t seed)
+{
+    constexpr std::uint64_t fnv_prime = 1099511628211ULL;
+    unsigned char const* bytes = static_cast<unsigned char const*>(data);
+    for (std::size_t i(0); i < n_bytes; ++i) {
+        seed ^= bytes[i];
+        seed *= fnv_prime;
+    }
+    return seed;
+}
+
+bool OperatorCache::load(
+        std::uint64_t const key,
+        ValuesView const values,
+        IndexView const col_idx,
+        IndexView const row_ptr) const
+{
+    if (!m_active) {
+        return false;
+    }
+    std::int64_t key_data = key;
+    int size = row_ptr.extent(0) - 1;
+    int nnz = col_idx.extent(0);
+    // The stored key is only modified if the file is read
+    std::int64_t stored_key = ~key_data;
+
+    // A missing file is not an error, the operator must simply be assembled
+    PDI_errhandler_t const previous_handler = PDI_errhandler(PDI_NULL_HANDLER);
+    PDI_status_t const status = PDI_multi_expose(
+            "operator_cache_read",
+            "operator_cache_key",
+            &key_data,
+            PDI_OUT,
+            "operator_cache_size",
+            &size,
+            PDI_OUT,
+            "operator_cache_nnz",
+            &nnz,
+            PDI_OUT,
+            "operator_cache_values",
+            values.data(),
+            PDI_INOUT,
+            "operator_cache_col_idx",
+            col_idx.data(),
+            PDI_INOUT,
+            "operator_cache_row_ptr",
+            row_ptr.data(),
+            PDI_INOUT,
+            "operator_cache_stored_key",
+            &stored_key,
+            PDI_INOUT,
+            NULL);
+    PDI_errhandler(previous_handler);
+
+    return status == PDI_OK && stored_key == key_data;
+}
+
+void OperatorCache::save(
+        std::uint64_t const key,
+        ValuesView const values,
+        IndexView const col_idx,
+        IndexView const row_ptr) const
+{
+    if (!m_active) {
+        return;
+    }
+    std::int64_t key_data = key;
+    int size = row_ptr.extent(0) - 1;
+    int nnz = col_idx.extent(0);
+
+    PDI_multi_expose(
+            "operator_cache_write",
+            "operator_cache_key",
+            &key_data,
+            PDI_OUT,
+            "operator_cache_size",
+            &size,
+            PDI_OUT,
+            "operator_cache_nnz",
+            &nnz,
+            PDI_OUT,
+            "operator_cache_values",
+            values.data(),
+            PDI_OUT,
+            "operator_cache_col_idx",
+            col_idx.data(),
+            PDI_OUT,
+            "operator_cache_row_ptr",
+            row_ptr.data(),
+            PDI_OUT,
+            "operator_cache_stored_key",
+            &key_data,
+            PDI_OUT,
+            NULL);
+}
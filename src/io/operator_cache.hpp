@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include <Kokkos_Core.hpp>
+#include <paraconf.h>
+
+/**
+ * @brief A class which saves an assembled sparse operator to a file and reloads it in a later run.
+ *
+ * The operator is stored in CSR format. It is identified by a key which should be a hash of all
+ * the data used to assemble it (see OperatorCache::hash). The file is read and written through
+ * PDI so the PDI configuration must describe what is done on the following events:
+ * - operator_cache_read : the data operator_cache_stored_key, operator_cache_values,
+ *   operator_cache_col_idx and operator_cache_row_ptr should be read from the file (if it exists).
+ *   operator_cache_stored_key should be read last so that it is only set if all the data was read.
+ * - operator_cache_write : the same data should be written to the file.
+ *
+ * The following data is also exposed with the events to build the name of the file and to
+ * describe the size of the arrays:
+ * - operator_cache_key : the key identifying the operator (int64),
+ * - operator_cache_size : the number of rows of the matrix (int),
+ * - operator_cache_nnz : the number of non-zero elements of the matrix (int).
+ *
+ * If the file cannot be read (e.g. because it does not exist yet), the operator is not
+ * loaded and the calling code should assemble it.
+ */
+class OperatorCache
+{
+public:
+    /// @brief The type of the views containing the values of the non-zero elements.
+    using ValuesView = Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::HostSpace>;
+    /// @brief The type of the views containing the column indices and the row pointers.
+    using IndexView = Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::HostSpace>;
+
+    /// @brief The initial value of a hash.
+    static constexpr std::uint64_t hash_seed = 14695981039346656037ULL;
+
+private:
+    bool m_active;
+
+public:
+    /**
+     * @brief Create an operator cache.
+     *
+     * @param[in] active True if the operators should be read from and written to files, false
+     *              if the cache should do nothing (so that the calling code does not depend on
+     *              the choice).
+     */
+    explicit OperatorCache(bool active) : m_active(active) {}
+
+    /**
+     * @brief Create an operator cache using the information in the input file.
+     *
+     * The cache is activated by the optional boolean key .PoissonSolver.operator_cache (false
+     * by default).
+     *
+     * @param[in] yaml_input_file The paraconf configuration describing the simulation.
+     *
+     * @returns The operator cache.
+     */
+    static OperatorCache init_from_input(PC_tree_t const& yaml_input_file);
+
+    /**
+     * @brief Indicate whether the operators are read from and written to files.
+     * @returns True if the cache is used, false otherwise.
+     */
+    bool is_active() const
+    {
+        return m_active;
+    }
+
+    /**
+     * @brief Update a hash with the bytes of an array.
+     *
+     * The 64-bit FNV-1a hash is used. It is not a cryptographic hash but it is sufficient to
+     * detect that the data used to assemble an operator has changed.
+     *
+     * @param[in] data A pointer to the start of the array.
+     * @param[in] n_bytes The size of the array in bytes.
+     * @param[in] seed The hash of the data which was already treated.
+     *
+     * @returns The updated hash.
+     */
+    static std::uint64_t hash(
+            void const* data,
+            std::size_t n_bytes,
+            std::uint64_t seed = hash_seed);
+
+    /**
+     * @brief Try to read an operator from a file.
+     *
+     * The views must be allocated with the size of the operator.
+     *
+     * @param[in] key The key identifying the operator.
+     * @param[out] values The values of the non-zero elements.
+     * @param[out] col_idx The column index of each non-zero element.
+     * @param[out] row_ptr The index of the first non-zero element of each row.
+     *
+     * @returns True if the operator was read, false otherwise.
+     */
+    bool load(std::uint64_t key, ValuesView values, IndexView col_idx, IndexView row_ptr) const;
+
+    /**
+     * @brief Write an operator to a file.
+     *
+     * @param[in] key The key identifying the operator.
+     * @param[in] values The values of the non-zero elements.
+     * @param[in] col_idx The column index of each non-zero element.
+     * @param[in] row_ptr The index of the first non-zero element of each row.
+     */
+    void save(std::uint64_t key, ValuesView values, IndexView col_idx, IndexView row_ptr) const;
+};
@@ -0,0 +1,333 @@
+// SPDX-License-Identifier: MIT
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+#include <pdi.h>
+
+#include "paraconfpp.hpp"
+#include "profiling_collector.hpp"
+
+namespace {
+
+using RegionStatistics = ProfilingCollector::RegionStatistics;
+
+struct OpenRegion
+{
+    std::string name;
+    std::chrono::steady_clock::time_point start;
+};
+
+/*
+ * The Kokkos tool callbacks are plain function pointers so the collected data must be global.
+ */
+bool s_collecting = false;
+std::map<std::string, RegionStatistics> s_statistics;
+std::vector<OpenRegion> s_open_regions;
+std::size_t s_current_allocated_bytes = 0;
+std::size_t s_peak_allocated_bytes = 0;
+
+std::string const s_outside_regions = "(outside regions)";
+
+void push_region(char const* name)
+{
+    Kokkos::fence("ProfilingCollector");
+    s_open_regions.push_back({name, std::chrono::steady_clock::now()});
+}
+
+void pop_region()
+{
+    Kokkos::fence("ProfilingCollector");
+    if (s_open_regions.empty()) {
+        // The region was opened before the collector was activated.
+        return;
+    }
+    OpenRegion const& region = s_open_regions.back();
+    RegionStatistics& stats = s_statistics[region.name];
+    stats.time += std::chrono::duration<double>(std::chrono::steady_clock::now() - region.start)
+                          .count();
+    stats.nb_calls += 1;
+    s_open_regions.pop_back();
+}
+
+void allocate_data(
+        Kokkos::Profiling::SpaceHandle const,
+        char const* const,
+        void const* const,
+        std::uint64_t const size)
+{
+    std::string const& region
+            = s_open_regions.empty() ? s_outside_regions : s_open_regions.back().name;
+    s_statistics[region].allocated_bytes += size;
+    s_current_allocated_bytes += size;
+    s_peak_allocated_bytes = std::max(s_peak_allocated_bytes, s_current_allocated_bytes);
+}
+
+void deallocate_data(
+        Kokkos::Profiling::SpaceHandle const,
+        char const* const,
+        void const* const,
+        std::uint64_t const size)
+{
+    // Memory allocated before the collector was activated may be released.
+    s_current_allocated_bytes -= std::min<std::size_t>(size, s_current_allocated_bytes);
+}
+
+/**
+ * Gather a vector of variable length from all ranks onto rank 0.
+ */
+template <class T>
+std::vector<T> gather_vector(
+        std::vector<T> const& local,
+        MPI_Datatype const type,
+        std::vector<int>& counts,
+        MPI_Comm const comm)
+{
+    int rank;
+    int size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    int const local_count = local.size();
+    counts.resize(size);
+    MPI_Gather(&local_count, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, comm);
+    std::vector<int> displacements(size, 0);
+    std::partial_sum(counts.begin(), counts.end() - 1, displacements.begin() + 1);
+    std::vector<T> global(rank == 0 ? displacements.back() + counts.back() : 0);
+    MPI_Gatherv(
+            local.data(),
+            local_count,
+            type,
+            global.data(),
+            counts.data(),
+            displacements.data(),
+            type,
+            0,
+            comm);
+    return global;
+}
+
+} // namespace
+
+ProfilingCollector::ProfilingCollector(bool const active) : m_active(active)
+{
+    if (!m_active) {
+        return;
+    }
+    if (s_collecting) {
+        throw std::runtime_error("Only one ProfilingCollector can be active at a time.");
+    }
+    if (Kokkos::Tools::profileLibraryLoaded()) {
+        throw std::runtime_error(
+                "The ProfilingCollector cannot be used together with a kokkos-tools library.");
+    }
+    s_collecting = true;
+    s_statistics.clear();
+    s_open_regions.clear();
+    s_current_allocated_bytes = 0;
+    s_peak_allocated_bytes = 0;
+    Kokkos::Tools::Experimental::set_push_region_callback(push_region);
+    Kokkos::Tools::Experimental::set_pop_region_callback(pop_region);
+    Kokkos::Tools::Experimental::set_allocate_data_callback(allocate_data);
+    Kokkos::Tools::Experimental::set_deallocate_data_callback(deallocate_data);
+}
+
+ProfilingCollector::~ProfilingCollector()
+{
+    if (m_active) {
+        Kokkos::Tools::Experimental::set_push_region_callback(nullptr);
+        Kokkos::Tools::Experimental::set_pop_region_callback(nullptr);
+        Kokkos::Tools::Experimental::set_allocate_data_callback(nullptr);
+        Kokkos::Tools::Experimental::set_deallocate_data_callback(nullptr);
+        s_collecting = false;
+    }
+}
+
+ProfilingCollector ProfilingCollector::init_from_input(PC_tree_t const& yaml_input_file)
+{
+    bool active = false;
+    if (PCpp_get(yaml_input_file, ".Output.profiling").status == PC_OK) {
+        active = PCpp_bool(yaml_input_file, ".Output.profiling");
+    }
+    return ProfilingCollector(active);
+}
+
+std::map<std::string, RegionStatistics> ProfilingCollector::get_statistics() const
+{
+    if (!m_active) {
+        return {};
+    }
+    return s_statistics;
+}
+
+std::size_t ProfilingCollector::get_peak_allocated_bytes() const
+{
+    return m_active ? s_peak_allocated_bytes : 0;
+}
+
+void ProfilingCollector::report(std::ostream& out, MPI_Comm const comm) const
+{
+    if (!m_active) {
+        return;
+    }
+
+    std::map<std::string, RegionStatistics> const local_statistics = get_statistics();
+    std::string local_names;
+    std::vector<double> local_times;
+    std::vector<unsigned long long> local_calls;
+    std::vector<unsigned long long> local_bytes;
+    for (auto const& [name, stats] : local_statistics) {
+        local_names += name + '\n';
+        local_times.push_back(stats.time);
+        local_calls.push_back(stats.nb_calls);
+        local_bytes.push_back(stats.allocated_bytes);
+    }
+    unsigned long long peak_bytes = get_peak_allocated_bytes();
+
+    int mpi_initialised;
+    MPI_Initialized(&mpi_initialised);
+    int rank = 0;
+    int nranks = 1;
+    std::string names = local_names;
+    std::vector<int> nregions(1, local_times.size());
+    std::vector<double> times = local_times;
+    std::vector<unsigned long long> calls = local_calls;
+    std::vector<unsigned long long> bytes = local_bytes;
+    if (mpi_initialised) {
+        MPI_Comm_rank(comm, &rank);
+        MPI_Comm_size(comm, &nranks);
+        std::vector<int> name_lengths;
+        std::vector<char> const local_name_chars(local_names.begin(), local_names.end());
+        std::vector<char> const name_chars
+                = gather_vector(local_name_chars, MPI_CHAR, name_lengths, comm);
+        names = std::string(name_chars.begin(), name_chars.end());
+        times = gather_vector(local_times, MPI_DOUBLE, nregions, comm);
+        calls = gather_vector(local_calls, MPI_UNSIGNED_LONG_LONG, nregions, comm);
+        bytes = gather_vector(local_bytes, MPI_UNSIGNED_LONG_LONG, nregions, comm);
+        MPI_Reduce(
+                rank == 0 ? MPI_IN_PLACE : &peak_bytes,
+                &peak_bytes,
+                1,
+                MPI_UNSIGNED_LONG_LONG,
+                MPI_MAX,
+                0,
+                comm);
+    }
+    if (rank != 0) {
+        return;
+    }
+
+    struct GlobalStatistics
+    {
+        double min_time = std::numeric_limits<double>::max();
+        double max_time = 0.0;
+        double sum_time = 0.0;
+        int nranks = 0;
+        unsigned long long nb_calls = 0;
+        unsigned long long max_bytes = 0;
+    };
+    std::map<std::string, GlobalStatistics> global_statistics;
+    std::istringstream name_stream(names);
+    for (int r(0), i(0); r < nranks; ++r) {
+        for (int j(0); j < nregions[r]; ++j, ++i) {
+            std::string name;
+            std::getline(name_stream, name);
+            GlobalStatistics& stats = global_statistics[name];
+            stats.min_time = std::min(stats.min_time, times[i]);
+            stats.max_time = std::max(stats.max_time, times[i]);
+            stats.sum_time += times[i];
+            stats.nranks += 1;
+            stats.nb_calls = std::max(stats.nb_calls, calls[i]);
+            stats.max_bytes = std::max(stats.max_bytes, bytes[i]);
+        }
+    }
+
+    std::vector<std::pair<std::string, GlobalStatistics>>
+            sorted_statistics(global_statistics.begin(), global_statistics.end());
+    std::sort(sorted_statistics.begin(), sorted_statistics.end(), [](auto const& a, auto const& b) {
+        return a.second.max_time > b.second.max_time;
+    });
+
+    std::size_t name_width = 6;
+    for (auto const& [name, stats] : sorted_statistics) {
+        name_width = std::max(name_width, name.size());
+    }
+    double const mib = 1024.0 * 1024.0;
+    out << "Profiling report (" << nranks << " MPI rank" << (nranks > 1 ? "s" : "") << ")\n";
+    out << std::left << std::setw(name_width) << "Region" << std::right << std::setw(12)
+        << "Calls" << std::setw(14) << "Min time (s)" << std::setw(14) << "Mean time (s)"
+        << std::setw(14) << "Max time (s)" << std::setw(16) << "Allocated (MiB)" << "\n";
+    for (auto const& [name, stats] : sorted_statistics) {
+        out << std::left << std::setw(name_width) << name << std::right << std::setw(12)
+            << stats.nb_calls << std::scientific << std::setprecision(3) << std::setw(14)
+            << (stats.nranks == nranks ? stats.min_time : 0.0) << std::setw(14)
+            << stats.sum_time / nranks << std::setw(14) << stats.max_time << std::fixed
+            << std::setprecision(1) << std::setw(16) << stats.max_bytes / mib << "\n";
+    }
+    out << "Peak memory allocated through Kokkos (max over ranks): " << peak_bytes / mib
+        << " MiB" << std::defaultfloat << std::endl;
+}
+
+void ProfilingCollector::write_to_pdi(std::string const& event_name) const
+{
+    if (!m_active) {
+        return;
+    }
+
+    int rank = 0;
+    int mpi_initialised;
+    MPI_Initialized(&mpi_initialised);
+    if (mpi_initialised) {
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    }
+
+    std::map<std::string, RegionStatistics> const statistics = get_statistics();
+    std::int64_t nregions = statistics.size();
+    std::vector<char> names(nregions * max_region_name_length, '\0');
+    std::vector<double> times;
+    std::vector<std::int64_t> nb_calls;
+    std::vector<std::int64_t> allocated_bytes;
+    std::size_t i = 0;
+    for (auto const& [name, stats] : statistics) {
+        std::copy_n(
+                name.begin(),
+                std::min(name.size(), max_region_name_length - 1),
+                names.begin() + i * max_region_name_length);
+        times.push_back(stats.time);
+        nb_calls.push_back(stats.nb_calls);
+        allocated_bytes.push_back(stats.allocated_bytes);
+        ++i;
+    }
+    std::int64_t peak_allocated_bytes = get_peak_allocated_bytes();
+
+    PDI_multi_expose(
+            event_name.c_str(),
+            "profiling_rank",
+            &rank,
+            PDI_OUT,
+            "profiling_nregions",
+            &nregions,
+            PDI_OUT,
+            "profiling_region_names",
+            names.data(),
+            PDI_OUT,
+            "profiling_time",
+            times.data(),
+            PDI_OUT,
+            "profiling_nb_calls",
+            nb_calls.data(),
+            PDI_OUT,
+            "profiling_allocated_bytes",
+            allocated_bytes.data(),
+            PDI_OUT,
+            "profiling_peak_allocated_bytes",
+            &peak_allocated_bytes,
+            PDI_OUT,
+            NULL);
+}
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include <mpi.h>
+#include <paraconf.h>
+
+/**
+ * @brief A class which collects a performance breakdown of the code without an external tool.
+ *
+ * The code is broken into regions by calls to Kokkos::Profiling::pushRegion and
+ * Kokkos::Profiling::popRegion. While an instance of this class is active it is registered as
+ * the Kokkos tool and it accumulates, for each region, the time spent in the region, the number
+ * of times the region was entered and the number of bytes allocated through Kokkos while the
+ * region was the innermost open region.
+ *
+ * In order for the time of a region to include the kernels launched asynchronously inside it,
+ * the execution spaces are fenced when a region is entered or left. The collector should
+ * therefore only be activated when a performance breakdown is required.
+ *
+ * Only one collector can be active at a time and it cannot be used at the same time as an
+ * external kokkos-tools connector (e.g. loaded via KOKKOS_TOOLS_LIBS).
+ */
+class ProfilingCollector
+{
+public:
+    /// @brief The statistics collected for one region.
+    struct RegionStatistics
+    {
+        /// The total time spent in the region (including in the nested regions) in seconds.
+        double time = 0.0;
+        /// The number of times the region was entered.
+        std::size_t nb_calls = 0;
+        /// The number of bytes allocated while this was the innermost open region.
+        std::size_t allocated_bytes = 0;
+    };
+
+    /// @brief The maximum length of the region names written through PDI.
+    static constexpr std::size_t max_region_name_length = 64;
+
+private:
+    bool m_active;
+
+public:
+    /**
+     * @brief Create a profiling collector.
+     *
+     * @param[in] active True if the statistics should be collected, false if the collector
+     *              should do nothing (so that the calling code does not depend on the choice).
+     */
+    explicit ProfilingCollector(bool active);
+
+    ProfilingCollector(ProfilingCollector const&) = delete;
+
+    ProfilingCollector(ProfilingCollector&&) = delete;
+
+    ProfilingCollector& operator=(ProfilingCollector const&) = delete;
+
+    ProfilingCollector& operator=(ProfilingCollector&&) = delete;
+
+    /**
+     * @brief Stop the collection. This must be called before Kokkos is finalised.
+     */
+    ~ProfilingCollector();
+
+    /**
+     * @brief Create a profiling collector using the information in the input file.
+     *
+     * The collector is activated by the optional boolean key .Output.profiling (false
+     * by default).
+     *
+     * @param[in] yaml_input_file The paraconf configuration describing the simulation.
+     *
+     * @returns The profiling collector.
+     */
+    static ProfilingCollector init_from_input(PC_tree_t const& yaml_input_file);
+
+    /**
+     * @brief Indicate whether the statistics are collected.
+     * @returns True if the statistics are collected, false otherwise.
+     */
+    bool is_active() const
+    {
+        return m_active;
+    }
+
+    /**
+     * @brief Get the statistics collected on this MPI rank so far.
+     * @returns A map from the name of each region to its statistics.
+     */
+    std::map<std::string, RegionStatistics> get_statistics() const;
+
+    /**
+     * @brief Get the maximum number of bytes allocated through Kokkos at any point since the
+     * collection started on this MPI rank.
+     * @returns The number of bytes.
+     */
+    std::size_t get_peak_allocated_bytes() const;
+
+    /**
+     * @brief Print a table summarising the statistics of all the MPI ranks.
+     *
+     * The regions are sorted by decreasing maximum time over the ranks. This is a collective
+     * operation on the communicator (if MPI is initialised) and the table is only printed by
+     * rank 0.
+     *
+     * @param[in] out The stream on which the table is printed.
+     * @param[in] comm The communicator containing the ranks whose statistics are reported.
+     */
+    void report(std::ostream& out = std::cout, MPI_Comm comm = MPI_COMM_WORLD) const;
+
+    /**
+     * @brief Expose the statistics of this MPI rank to PDI.
+     *
+     * The following data is exposed with the event:
+     * - profiling_rank : the MPI rank (int),
+     * - profiling_nregions : the number of regions (int64),
+     * - profiling_region_names : a [profiling_nregions, max_region_name_length] char array
+     *   containing the null-padded names of the regions,
+     * - profiling_time : the time spent in each region (double array),
+     * - profiling_nb_calls : the number of calls to each region (int64 array),
+     * - profiling_allocated_bytes : the bytes allocated in each region (int64 array),
+     * - profiling_peak_allocated_bytes : see get_peak_allocated_bytes (int64).
+     *
+     * @param[in] event_name The name of the PDI event.
+     */
+    void write_to_pdi(std::string const& event_name = "profiling") const;
+};
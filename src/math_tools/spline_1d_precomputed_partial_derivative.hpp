@@ -0,0 +1,356 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/splines.hpp>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "ipartial_derivative.hpp"
+#include "view.hpp"
+
+
+/**
+ * @brief A class which implements a partial derivative operator
+ * using a precomputed 1d spline differentiation operator.
+ *
+ * Building a spline from the values of a field and evaluating its derivative at the
+ * interpolation points is a linear operation which only depends on the grid. This
+ * operator is computed once by the Spline1DPrecomputedPartialDerivativeCreator and
+ * stored as a stencil (one per interpolation point). The derivative is then computed
+ * with a single stencil pass without building any spline coefficients.
+ *
+ * @tparam IdxRangeFull The index range of the field on which the operator acts
+ * (with all dimensions, batched and dimension of interest).
+ * @tparam DerivativeDimension The dimension on which the partial derivative is calculated.
+ */
+template <class IdxRangeFull, class DerivativeDimension>
+class Spline1DPrecomputedPartialDerivative
+    : public IPartialDerivative<IdxRangeFull, DerivativeDimension>
+{
+private:
+    using base_type = IPartialDerivative<IdxRangeFull, DerivativeDimension>;
+
+    /// The type of the field to be differentiated.
+    using DFieldMemType = DFieldMem<IdxRangeFull>;
+
+    using typename base_type::DConstFieldType;
+    using typename base_type::DFieldType;
+    using typename base_type::IdxRangeBatch;
+    using typename base_type::IdxRangeDeriv;
+
+public:
+    /// The type of the view containing the coefficients of the stencils.
+    using StencilView = Kokkos::View<
+            double**,
+            Kokkos::LayoutRight,
+            Kokkos::DefaultExecutionSpace::memory_space>;
+
+    /// The type of the view containing the first point of each stencil.
+    using StencilStartView
+            = Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace::memory_space>;
+
+private:
+    /// The field to be differentiated
+    DFieldMemType m_field;
+
+    StencilView m_stencil;
+
+    StencilStartView m_stencil_start;
+
+public:
+    /**
+     * @brief Construct an instance of the class Spline1DPrecomputedPartialDerivative.
+     *
+     * @param field_ref The field to be differentiated.
+     * @param stencil The coefficients of the stencil of each interpolation point.
+     * @param stencil_start The index (relative to the front of the grid) of the first point
+     *              of the stencil of each interpolation point.
+     */
+    Spline1DPrecomputedPartialDerivative(
+            DConstFieldType const field_ref,
+            StencilView stencil,
+            StencilStartView stencil_start)
+        : m_field(get_idx_range(field_ref))
+        , m_stencil(stencil)
+        , m_stencil_start(stencil_start)
+    {
+        assert(m_stencil.extent(0) == IdxRangeDeriv(get_idx_range(field_ref)).size());
+        ddc::parallel_deepcopy(get_field(m_field), field_ref);
+    }
+
+    /**
+     * @brief Compute the partial derivative of a field in the direction
+     * where the field is represented using 1d splines.
+     *
+     * @param[out] differentiated_field Contains on output the value of the differentiated field.
+     */
+    void operator()(DFieldType differentiated_field) const final
+    {
+        using IdxFull = typename IdxRangeFull::discrete_element_type;
+        using IdxDeriv = typename IdxRangeDeriv::discrete_element_type;
+        using IdxBatch = typename IdxRangeBatch::discrete_element_type;
+        using IdxStepDeriv = typename IdxRangeDeriv::discrete_vector_type;
+
+        IdxRangeFull idxrange_full = get_idx_range(m_field);
+        IdxRangeDeriv idxrange_deriv(idxrange_full);
+        IdxDeriv const ideriv_front = idxrange_deriv.front();
+        int const npoints = idxrange_deriv.size();
+        int const stencil_width = m_stencil.extent(1);
+
+        DConstFieldType const field_proxy = get_const_field(m_field);
+        StencilView const stencil = m_stencil;
+        StencilStartView const stencil_start = m_stencil_start;
+
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                idxrange_full,
+                KOKKOS_LAMBDA(IdxFull ibx) {
+                    IdxBatch ib(ibx);
+                    int const i = (IdxDeriv(ibx) - ideriv_front).value();
+                    double deriv = 0.0;
+                    for (int k = 0; k < stencil_width; ++k) {
+                        int j = stencil_start(i) + k;
+                        // Stencils are wrapped around the grid for periodic splines
+                        if (j >= npoints) {
+                            j -= npoints;
+                        }
+                        deriv += stencil(i, k) * field_proxy(ib, ideriv_front + IdxStepDeriv(j));
+                    }
+                    differentiated_field(ibx) = deriv;
+                });
+    }
+};
+
+
+/**
+ * @brief A class which computes the 1d spline differentiation operator and creates pointers to
+ * instances of the Spline1DPrecomputedPartialDerivative class.
+ *
+ * The differentiation operator @f$ D = B' B^{-1} @f$ is computed at construction, where
+ * @f$ B_{ij} = b_j(x_i) @f$ is the collocation matrix of the B-splines at the interpolation
+ * points and @f$ B'_{ij} = b_j'(x_i) @f$ contains the derivatives of the B-splines at these
+ * points. The elements of this matrix decay exponentially away from the diagonal so it is
+ * stored as a band (wrapped around the grid for periodic splines) containing all the elements
+ * larger than a given tolerance. For a uniform periodic grid all the stencils are identical
+ * (the operator is circulant).
+ *
+ * Only interpolations without boundary derivatives (periodic or Greville boundary conditions)
+ * are supported as the operator would otherwise also depend on the derivatives at the boundary.
+ *
+ * @tparam Spline1DBuilder A 1D spline builder.
+ */
+template <class Spline1DBuilder>
+class Spline1DPrecomputedPartialDerivativeCreator
+    : public IPartialDerivativeCreator<
+              typename Spline1DBuilder::batched_interpolation_domain_type,
+              typename Spline1DBuilder::continuous_dimension_type>
+{
+    static_assert(
+            Spline1DBuilder::s_bc_xmin != ddc::BoundCond::HERMITE
+                    && Spline1DBuilder::s_bc_xmax != ddc::BoundCond::HERMITE,
+            "The precomputed spline derivative does not support Hermite boundary conditions");
+
+private:
+    using IdxRangeFull = typename Spline1DBuilder::batched_interpolation_domain_type;
+    using DerivativeDimension = typename Spline1DBuilder::continuous_dimension_type;
+    using BSplines = typename Spline1DBuilder::bsplines_type;
+    using GridDeriv = typename Spline1DBuilder::interpolation_discrete_dimension_type;
+
+    using DConstFieldType = DConstField<IdxRangeFull>;
+
+    using PartialDerivativeType
+            = Spline1DPrecomputedPartialDerivative<IdxRangeFull, DerivativeDimension>;
+    using StencilView = typename PartialDerivativeType::StencilView;
+    using StencilStartView = typename PartialDerivativeType::StencilStartView;
+
+    StencilView m_stencil;
+    StencilStartView m_stencil_start;
+
+public:
+    /**
+     * @brief Construct an instance of the Spline1DPrecomputedPartialDerivativeCreator class.
+     *
+     * @param[in] builder A 1d spline builder.
+     * @param[in] tolerance The relative tolerance below which the elements of the
+     *              differentiation operator are neglected.
+     */
+    explicit Spline1DPrecomputedPartialDerivativeCreator(
+            Spline1DBuilder const& builder,
+            double tolerance = 1e-15)
+    {
+        IdxRange<GridDeriv> const idxrange_deriv = builder.interpolation_domain();
+        int const npoints = idxrange_deriv.size();
+        assert(npoints == int(ddc::discrete_space<BSplines>().nbasis()));
+
+        std::vector<double> const diff_op = compute_differentiation_operator(builder);
+
+        // Find the half-width of the band containing the significant elements
+        int half_width = 0;
+        for (int i = 0; i < npoints; ++i) {
+            double max_elem = 0.0;
+            for (int j = 0; j < npoints; ++j) {
+                max_elem = std::max(max_elem, std::abs(diff_op[i * npoints + j]));
+            }
+            for (int j = 0; j < npoints; ++j) {
+                if (std::abs(diff_op[i * npoints + j]) > tolerance * max_elem) {
+                    int dist = std::abs(i - j);
+                    if constexpr (BSplines::is_periodic()) {
+                        dist = std::min(dist, npoints - dist);
+                    }
+                    half_width = std::max(half_width, dist);
+                }
+            }
+        }
+        int const stencil_width = std::min(2 * half_width + 1, npoints);
+
+        m_stencil = StencilView("precomputed_deriv_stencil", npoints, stencil_width);
+        m_stencil_start = StencilStartView("precomputed_deriv_stencil_start", npoints);
+        auto stencil_host = Kokkos::create_mirror_view(m_stencil);
+        auto stencil_start_host = Kokkos::create_mirror_view(m_stencil_start);
+        for (int i = 0; i < npoints; ++i) {
+            int start;
+            if constexpr (BSplines::is_periodic()) {
+                start = ((i - half_width) % npoints + npoints) % npoints;
+            } else {
+                start = std::clamp(i - half_width, 0, npoints - stencil_width);
+            }
+            stencil_start_host(i) = start;
+            for (int k = 0; k < stencil_width; ++k) {
+                stencil_host(i, k) = diff_op[i * npoints + (start + k) % npoints];
+            }
+        }
+        Kokkos::deep_copy(m_stencil, stencil_host);
+        Kokkos::deep_copy(m_stencil_start, stencil_start_host);
+    }
+
+    /**
+     * Create a pointer to an instance of the abstract class IPartialDerivative.
+     * The type of the returned object will be determined when the pointer is
+     * dereferenced.
+     *
+     * @param[in] field A field to be differentiated.
+     *
+     * @return A pointer to an instance of the IPartialDerivative class.
+     */
+    std::unique_ptr<IPartialDerivative<IdxRangeFull, DerivativeDimension>> create_instance(
+            DConstFieldType field) const final
+    {
+        return std::make_unique<PartialDerivativeType>(field, m_stencil, m_stencil_start);
+    }
+
+    /**
+     * @brief Get the number of points in the stencil used to compute the derivative
+     * at each interpolation point.
+     *
+     * @return The width of the stencil.
+     */
+    int stencil_width() const
+    {
+        return m_stencil.extent(1);
+    }
+
+private:
+    /**
+     * @brief Get an index range containing only the first element of a batch index range.
+     *
+     * @param[in] idx_range The batch index range.
+     *
+     * @return The index range of the first element.
+     */
+    template <class... Grid>
+    static IdxRange<Grid...> get_first_element(IdxRange<Grid...> const idx_range)
+    {
+        if constexpr (sizeof...(Grid) == 0) {
+            return idx_range;
+        } else {
+            return IdxRange<Grid...>(idx_range.front(), IdxStep<Grid...>(IdxStep<Grid>(1)...));
+        }
+    }
+
+    /**
+     * @brief Compute the dense differentiation operator D = B' B^{-1}.
+     *
+     * The j-th column of B^{-1} contains the spline coefficients interpolating the j-th
+     * vector of the canonical basis. It is computed with the banded solver of a copy of the
+     * builder restricted to a single element of the batch. The j-th column of D is then
+     * obtained by evaluating the derivative of this spline at the interpolation points. The
+     * construction costs O(N^2 * degree) operations and the dense operator requires
+     * N^2 doubles of temporary host memory, where N is the number of interpolation points.
+     *
+     * @param[in] builder The 1d spline builder.
+     *
+     * @return The operator stored in row-major order.
+     */
+    static std::vector<double> compute_differentiation_operator(Spline1DBuilder const& builder)
+    {
+        using IdxRangeBatch = ddc::remove_dims_of_t<IdxRangeFull, GridDeriv>;
+        using IdxRangeSpline = typename Spline1DBuilder::batched_spline_domain_type;
+        using IdxFull = typename IdxRangeFull::discrete_element_type;
+        using IdxSpline = typename IdxRangeSpline::discrete_element_type;
+
+        IdxRange<GridDeriv> const idxrange_deriv = builder.interpolation_domain();
+        int const npoints = idxrange_deriv.size();
+        std::size_t constexpr ncoefs = BSplines::degree() + 1;
+        Idx<BSplines> const first_bspline = ddc::discrete_space<BSplines>().full_domain().front();
+
+        // Derivatives of the B-splines at the interpolation points (B')
+        std::vector<int> deriv_jmin(npoints);
+        std::vector<double> deriv_vals(npoints * ncoefs);
+        int i = 0;
+        for (Idx<GridDeriv> const ix : idxrange_deriv) {
+            DSpan1D const vals(deriv_vals.data() + i * ncoefs, ncoefs);
+            deriv_jmin[i]
+                    = (ddc::discrete_space<BSplines>().eval_deriv(vals, ddc::coordinate(ix))
+                       - first_bspline)
+                              .value();
+            ++i;
+        }
+
+        // A builder acting on a single element of the batch
+        IdxRangeFull const column_idx_range(
+                idxrange_deriv,
+                get_first_element(IdxRangeBatch(builder.batched_interpolation_domain())));
+        Spline1DBuilder const column_builder(column_idx_range);
+
+        host_t<DFieldMem<IdxRangeFull>> column_values_host(column_idx_range);
+        DFieldMem<IdxRangeFull> column_values(column_idx_range);
+        DFieldMem<IdxRangeSpline> column_coefs(column_builder.batched_spline_domain());
+        // The coefficients are stored on the full B-spline index range so that the
+        // periodic coefficients can be accessed without wrapping the indices
+        std::vector<double> coefs(ddc::discrete_space<BSplines>().full_domain().size());
+
+        std::vector<double> diff_op(npoints * npoints, 0.0);
+        for (int j = 0; j < npoints; ++j) {
+            for (IdxFull const idx : column_idx_range) {
+                int const i_point = (Idx<GridDeriv>(idx) - idxrange_deriv.front()).value();
+                column_values_host(idx) = (i_point == j) ? 1.0 : 0.0;
+            }
+            ddc::parallel_deepcopy(get_field(column_values), get_const_field(column_values_host));
+            column_builder(get_field(column_coefs), get_const_field(column_values));
+            auto column_coefs_host = ddc::create_mirror_view_and_copy(get_field(column_coefs));
+            for (IdxSpline const idx : get_idx_range(column_coefs_host)) {
+                coefs[(Idx<BSplines>(idx) - first_bspline).value()] = column_coefs_host(idx);
+            }
+            if constexpr (BSplines::is_periodic()) {
+                for (std::size_t k = npoints; k < coefs.size(); ++k) {
+                    coefs[k] = coefs[k - npoints];
+                }
+            }
+            for (int row = 0; row < npoints; ++row) {
+                double d = 0.0;
+                for (std::size_t k = 0; k < ncoefs; ++k) {
+                    d += deriv_vals[row * ncoefs + k] * coefs[deriv_jmin[row] + k];
+                }
+                diff_op[row * npoints + j] = d;
+            }
+        }
+        return diff_op;
+    }
+};
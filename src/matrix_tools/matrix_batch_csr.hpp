@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: MIT
 #pragma once
+#include <algorithm>
 
 #include <ginkgo/extensions/kokkos.hpp>
 #include <ginkgo/ginkgo.hpp>
@@ -63,6 +64,7 @@ private:
     double m_tol;
     bool m_with_logger;
     unsigned int m_preconditionner_max_block_size; // Maximum size of Jacobi-block preconditionner
+    mutable int m_last_n_iterations = 0;
 
 public:
     /**
@@ -268,6 +270,7 @@ public:
     {
         if constexpr (
                 Solver == MatrixBatchCsrSolver::CG || Solver == MatrixBatchCsrSolver::BICGSTAB) {
+            m_last_n_iterations = 0;
             for (size_t i = 0; i < batch_size(); i++) {
                 std::shared_ptr const gko_exec = m_solver[i]->get_executor();
 
@@ -280,6 +283,9 @@ public:
                         ->apply(to_gko_multivector(gko_exec, b)->create_const_view_for_item(i),
                                 to_gko_multivector(gko_exec, x)->create_view_for_item(i));
                 m_solver[i]->remove_logger(logger);
+                m_last_n_iterations = std::max<int>(
+                        m_last_n_iterations,
+                        logger->get_num_iterations());
                 // save logger data
                 if (m_with_logger) {
                     std::fstream log_file("csr_log.txt", std::ios::out | std::ios::app);
@@ -308,6 +314,12 @@ public:
             m_solver->add_logger(logger);
             m_solver->apply(to_gko_multivector(gko_exec, b), to_gko_multivector(gko_exec, x));
             m_solver->remove_logger(logger);
+            auto logger_iterations_host = gko::make_temporary_clone(
+                    gko_exec->get_master(),
+                    &logger->get_num_iterations());
+            m_last_n_iterations = *std::max_element(
+                    logger_iterations_host->get_const_data(),
+                    logger_iterations_host->get_const_data() + batch_size());
 
             // Save logger data
             if (m_with_logger) {
@@ -320,6 +332,16 @@ public:
         }
     }
 
+    /**
+     * @brief Get the number of iterations needed by the solver during the last call to solve.
+     *
+     * @return The maximum number of iterations over the systems of the batch.
+     */
+    int get_last_n_iterations() const
+    {
+        return m_last_n_iterations;
+    }
+
     /**
      * @brief A function returning the norm of a matrix located at batch_idx.
      * @param[in] batch_idx The index of the matrix in the batch. 
@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <stdexcept>
+
+#include <Kokkos_Core.hpp>
+
+#include "matrix_batch.hpp"
+
+/**
+ * @brief A structure for solving a set of independent symmetric positive definite banded systems
+ * using a direct method.
+ * The parallelism operates on the whole collection by dispatching to threads.
+ * Each problem is treated sequentially by a banded Cholesky factorisation @f$ A = L L^T @f$.
+ * The factorisation is computed once in setup_solver so that each call to solve only requires
+ * a forward and a backward substitution.
+ * @tparam ExecSpace The execution space related to Kokkos.
+ */
+template <class ExecSpace>
+class MatrixBatchPdsBanded : public MatrixBatch<ExecSpace>
+{
+public:
+    using typename MatrixBatch<ExecSpace>::BatchedRHS;
+    using MatrixBatch<ExecSpace>::size;
+    using MatrixBatch<ExecSpace>::batch_size;
+
+    /**
+     * @brief Alias for the 3D double Kokkos views storing the bands, LayoutRight is specified.
+    */
+    using DKokkosView3D
+            = Kokkos::View<double***, Kokkos::LayoutRight, typename ExecSpace::memory_space>;
+
+private:
+    int m_n_bands;
+    DKokkosView3D m_bands;
+
+public:
+    /**
+     * @brief Creates an instance of the MatrixBatchPdsBanded class.
+     * The first dimension of the bands is the batch, the second one refers to the line of the
+     * matrix and the third one to the subdiagonal: bands(batch_idx, i, k) = A(i, i-k) for
+     * 0 <= k <= n_bands. The elements such that i-k < 0 are not used.
+     * The view is overwritten with the Cholesky factor in setup_solver.
+     *
+     * @param[in] batch_size The size of the set of linear problems.
+     * @param[in] mat_size The common size of each individual matrix.
+     * @param[in] n_bands The number of subdiagonals (and superdiagonals) of each matrix.
+     * @param[in] bands 3D Kokkos View which stores the diagonal and the subdiagonals of all matrices.
+     */
+    explicit MatrixBatchPdsBanded(
+            const int batch_size,
+            const int mat_size,
+            const int n_bands,
+            DKokkosView3D const bands)
+        : MatrixBatch<ExecSpace>(batch_size, mat_size)
+        , m_n_bands(n_bands)
+        , m_bands(bands)
+    {
+        assert(bands.extent(0) == std::size_t(batch_size));
+        assert(bands.extent(1) == std::size_t(mat_size));
+        assert(bands.extent(2) == std::size_t(n_bands + 1));
+    }
+
+    /**
+     * @brief Perform a pre-process operation on the solver. Must be called after filling the matrix.
+     *
+     * It computes the Cholesky factorisation of each matrix in place.
+     * An exception is raised if one of the matrices is not positive definite.
+     */
+    void setup_solver() final
+    {
+        int const tmp_mat_size = size();
+        int const n_bands = m_n_bands;
+        DKokkosView3D bands_proxy = m_bands;
+
+        bool is_positive_definite = true;
+        Kokkos::parallel_reduce(
+                "Banded Cholesky factorisation",
+                Kokkos::RangePolicy<ExecSpace>(0, batch_size()),
+                KOKKOS_LAMBDA(const int batch_idx, bool& check_positive) {
+                    for (int j = 0; j < tmp_mat_size; j++) {
+                        int const first_col = Kokkos::max(0, j - n_bands);
+                        double diag = bands_proxy(batch_idx, j, 0);
+                        for (int k = first_col; k < j; k++) {
+                            diag -= bands_proxy(batch_idx, j, j - k)
+                                    * bands_proxy(batch_idx, j, j - k);
+                        }
+                        check_positive = check_positive && (diag > 0);
+                        double const l_jj = Kokkos::sqrt(Kokkos::abs(diag));
+                        bands_proxy(batch_idx, j, 0) = l_jj;
+                        int const last_row = Kokkos::min(tmp_mat_size - 1, j + n_bands);
+                        for (int i = j + 1; i <= last_row; i++) {
+                            double l_ij = bands_proxy(batch_idx, i, i - j);
+                            for (int k = Kokkos::max(0, i - n_bands); k < j; k++) {
+                                l_ij -= bands_proxy(batch_idx, i, i - k)
+                                        * bands_proxy(batch_idx, j, j - k);
+                            }
+                            bands_proxy(batch_idx, i, i - j) = l_ij / l_jj;
+                        }
+                    }
+                },
+                Kokkos::LAnd<bool>(is_positive_definite));
+        if (!is_positive_definite) {
+            throw std::runtime_error("The matrix is not positive definite in MatrixBatchPdsBanded");
+        }
+    }
+
+    /**
+     * @brief Solve the batched linear problem Ax=b.
+     *
+     * @param[in, out] b A 2D Kokkos::View storing the batched right-hand sides of the problem and receiving the corresponding solutions.
+     */
+    void solve(BatchedRHS const b) const final
+    {
+        assert(batch_size() == b.extent(0));
+        assert(size() == b.extent(1));
+
+        int const tmp_mat_size = size();
+        int const n_bands = m_n_bands;
+        DKokkosView3D bands_proxy = m_bands;
+
+        Kokkos::parallel_for(
+                "Banded Cholesky solver",
+                Kokkos::RangePolicy<ExecSpace>(0, batch_size()),
+                KOKKOS_LAMBDA(const int batch_idx) {
+                    //ForwardStep: L y = b
+                    for (int i = 0; i < tmp_mat_size; i++) {
+                        double y_i = b(batch_idx, i);
+                        for (int k = Kokkos::max(0, i - n_bands); k < i; k++) {
+                            y_i -= bands_proxy(batch_idx, i, i - k) * b(batch_idx, k);
+                        }
+                        b(batch_idx, i) = y_i / bands_proxy(batch_idx, i, 0);
+                    }
+                    //BackwardStep: L^T x = y
+                    for (int i = tmp_mat_size - 1; i >= 0; i--) {
+                        double x_i = b(batch_idx, i);
+                        int const last_row = Kokkos::min(tmp_mat_size - 1, i + n_bands);
+                        for (int k = i + 1; k <= last_row; k++) {
+                            x_i -= bands_proxy(batch_idx, k, k - i) * b(batch_idx, k);
+                        }
+                        b(batch_idx, i) = x_i / bands_proxy(batch_idx, i, 0);
+                    }
+                });
+    }
+};
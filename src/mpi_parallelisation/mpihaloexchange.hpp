@@ -0,0 +1,235 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+#include <cassert>
+#include <stdexcept>
+
+#include <ddc/ddc.hpp>
+
+#include <mpi.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "mpitools.hpp"
+
+/**
+ * @brief A class which exchanges ghost layers with the neighbouring MPI processes along one
+ * of the distributed dimensions of a layout.
+ *
+ * The data is distributed following the layout Layout. Along the periodic dimension GridHalo,
+ * the process on the left holds the points just before the first local point and the process
+ * on the right holds the points just after the last local point. The ghost layers are the
+ * n_ghosts points of these neighbours which are closest to the local index range. They are
+ * described with their global indices and are received in separate fields so no index outside
+ * the global index range is ever required.
+ *
+ * The exchange uses point-to-point communications (MPI_Sendrecv) with the two neighbours
+ * only. If the data is not split along GridHalo then a process is its own neighbour.
+ *
+ * @tparam Layout The layout describing how the data is distributed across MPI processes.
+ * @tparam GridHalo The distributed dimension along which the ghost layers are exchanged.
+ */
+template <class Layout, class GridHalo>
+class MPIHaloExchange
+{
+public:
+    /// The type of the index range of the data.
+    using idx_range_type = typename Layout::discrete_domain_type;
+
+private:
+    using IdxRangeHalo = IdxRange<GridHalo>;
+    using IdxHalo = Idx<GridHalo>;
+    using IdxStepHalo = IdxStep<GridHalo>;
+    using IdxRangeOther = ddc::remove_dims_of_t<idx_range_type, IdxRangeHalo>;
+
+    static_assert(
+            ddc::in_tags_v<GridHalo, typename Layout::distributed_type_seq>,
+            "The ghost layers can only be exchanged along a distributed dimension.");
+
+private:
+    MPI_Comm m_comm;
+    int m_n_ghosts;
+    int m_left_rank;
+    int m_right_rank;
+    idx_range_type m_local_idx_range;
+    idx_range_type m_left_ghosts_idx_range;
+    idx_range_type m_right_ghosts_idx_range;
+
+public:
+    /**
+     * @brief A constructor for the halo exchange operator.
+     *
+     * @param[in] global_idx_range The global index range of the data across processes.
+     * @param[in] n_ghosts The number of ghost points on each side of the local index range.
+     * @param[in] comm The MPI communicator.
+     */
+    MPIHaloExchange(idx_range_type global_idx_range, int n_ghosts, MPI_Comm comm)
+        : m_comm(comm)
+        , m_n_ghosts(n_ghosts)
+    {
+        int comm_size;
+        int rank;
+        MPI_Comm_size(comm, &comm_size);
+        MPI_Comm_rank(comm, &rank);
+        m_local_idx_range = Layout::distribute_idx_range(global_idx_range, comm_size, rank);
+
+        IdxRangeHalo const global_idx_range_halo(global_idx_range);
+        IdxRangeHalo const local_idx_range_halo(m_local_idx_range);
+        std::ptrdiff_t const n_global = global_idx_range_halo.size();
+        std::ptrdiff_t const n_local = local_idx_range_halo.size();
+        if (n_ghosts < 0 || n_ghosts > n_local) {
+            throw std::runtime_error("The number of ghost points must be positive and cannot "
+                                     "exceed the number of local points along the dimension.");
+        }
+
+        // The first index of the index ranges of the neighbours along GridHalo
+        std::ptrdiff_t const local_offset
+                = (local_idx_range_halo.front() - global_idx_range_halo.front()).value();
+        IdxHalo const left_front = global_idx_range_halo.front()
+                                   + IdxStepHalo((local_offset - n_local + n_global) % n_global);
+        IdxHalo const right_front = global_idx_range_halo.front()
+                                    + IdxStepHalo((local_offset + n_local) % n_global);
+
+        IdxRangeOther const local_idx_range_other(m_local_idx_range);
+        m_left_rank = -1;
+        m_right_rank = -1;
+        for (int r(0); r < comm_size; ++r) {
+            idx_range_type const rank_idx_range
+                    = Layout::distribute_idx_range(global_idx_range, comm_size, r);
+            if (IdxRangeOther(rank_idx_range) == local_idx_range_other) {
+                IdxHalo const rank_front = IdxRangeHalo(rank_idx_range).front();
+                if (rank_front == left_front) {
+                    m_left_rank = r;
+                }
+                if (rank_front == right_front) {
+                    m_right_rank = r;
+                }
+            }
+        }
+        assert(m_left_rank >= 0 && m_right_rank >= 0);
+
+        m_left_ghosts_idx_range = ddc::replace_dim_of<GridHalo, GridHalo>(
+                m_local_idx_range,
+                IdxRangeHalo(left_front + IdxStepHalo(n_local - n_ghosts), IdxStepHalo(n_ghosts)));
+        m_right_ghosts_idx_range = ddc::replace_dim_of<GridHalo, GridHalo>(
+                m_local_idx_range,
+                IdxRangeHalo(right_front, IdxStepHalo(n_ghosts)));
+    }
+
+    /**
+     * @brief Getter for the local index range.
+     *
+     * @returns The index range of the data stored on the current process.
+     */
+    idx_range_type get_local_idx_range() const
+    {
+        return m_local_idx_range;
+    }
+
+    /**
+     * @brief Getter for the index range of the ghost points on the left of the local index range.
+     *
+     * @returns The index range (expressed with global indices) of the left ghost layer.
+     */
+    idx_range_type get_left_ghosts_idx_range() const
+    {
+        return m_left_ghosts_idx_range;
+    }
+
+    /**
+     * @brief Getter for the index range of the ghost points on the right of the local index range.
+     *
+     * @returns The index range (expressed with global indices) of the right ghost layer.
+     */
+    idx_range_type get_right_ghosts_idx_range() const
+    {
+        return m_right_ghosts_idx_range;
+    }
+
+    /**
+     * @brief Getter for the number of ghost points on each side of the local index range.
+     *
+     * @returns The number of ghost points.
+     */
+    int get_n_ghosts() const
+    {
+        return m_n_ghosts;
+    }
+
+    /**
+     * @brief Fill the ghost layers with the values stored on the neighbouring processes.
+     *
+     * @param[in] execution_space The execution space (Host/Device) where the code will run.
+     * @param[out] left_ghosts The values on the left ghost layer.
+     * @param[out] right_ghosts The values on the right ghost layer.
+     * @param[in] local_field The values on the local index range.
+     */
+    template <class ElementType, class MemSpace, class ExecSpace>
+    void operator()(
+            ExecSpace const& execution_space,
+            Field<ElementType, idx_range_type, MemSpace> left_ghosts,
+            Field<ElementType, idx_range_type, MemSpace> right_ghosts,
+            ConstField<ElementType, idx_range_type, MemSpace> local_field) const
+    {
+        assert(get_idx_range(local_field) == m_local_idx_range);
+        assert(get_idx_range(left_ghosts) == m_left_ghosts_idx_range);
+        assert(get_idx_range(right_ghosts) == m_right_ghosts_idx_range);
+
+        IdxRangeHalo const local_idx_range_halo(m_local_idx_range);
+        idx_range_type const first_points = ddc::replace_dim_of<GridHalo, GridHalo>(
+                m_local_idx_range,
+                local_idx_range_halo.take_first(IdxStepHalo(m_n_ghosts)));
+        idx_range_type const last_points = ddc::replace_dim_of<GridHalo, GridHalo>(
+                m_local_idx_range,
+                local_idx_range_halo.take_last(IdxStepHalo(m_n_ghosts)));
+
+        // The last local points are the left ghosts of the right neighbour
+        send_recv(
+                execution_space,
+                left_ghosts,
+                local_field[last_points],
+                m_right_rank,
+                m_left_rank);
+        // The first local points are the right ghosts of the left neighbour
+        send_recv(
+                execution_space,
+                right_ghosts,
+                local_field[first_points],
+                m_left_rank,
+                m_right_rank);
+    }
+
+private:
+    /// Function handling the MPI call
+    template <class ElementType, class MemSpace, class SendLayout, class ExecSpace>
+    void send_recv(
+            ExecSpace const& execution_space,
+            Field<ElementType, idx_range_type, MemSpace> recv_field,
+            Field<ElementType const, idx_range_type, MemSpace, SendLayout> send_field,
+            int dest,
+            int source) const
+    {
+        // Gather the sent points in a contiguous buffer
+        FieldMem<ElementType, idx_range_type, MemSpace> send_alloc(get_idx_range(send_field));
+        ddc::parallel_deepcopy(execution_space, get_field(send_alloc), send_field);
+        execution_space.fence();
+        // No Cuda-aware MPI yet
+        auto send_buffer = ddc::create_mirror_view_and_copy(get_const_field(send_alloc));
+        auto recv_buffer = ddc::create_mirror_view(recv_field);
+        MPI_Sendrecv(
+                send_buffer.data_handle(),
+                send_buffer.size(),
+                MPI_type_descriptor_t<ElementType>,
+                dest,
+                0,
+                recv_buffer.data_handle(),
+                recv_buffer.size(),
+                MPI_type_descriptor_t<ElementType>,
+                source,
+                0,
+                m_comm,
+                MPI_STATUS_IGNORE);
+        if constexpr (!ddc::is_borrowed_chunk_v<decltype(recv_buffer)>) {
+            ddc::parallel_deepcopy(execution_space, recv_field, recv_buffer);
+        }
+    }
+};
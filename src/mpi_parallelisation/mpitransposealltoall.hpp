@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 #pragma once
 #include <numeric>
+#include <type_traits>
 
 #include <ddc/ddc.hpp>
 
@@ -161,6 +162,11 @@ public:
      * transpose_to function must be used to disambiguate.
      *
      * @tparam OutLayout The layout that the data should be transposed to.
+     * @tparam CommElementType The type in which the values are communicated (e.g. float to
+     *                      halve the volume of data exchanged when sending doubles). The
+     *                      values are converted while they are packed into the send buffer
+     *                      and while they are unpacked from the receive buffer. By default
+     *                      (void) the values are communicated in their own type.
      *
      * @param[in] execution_space The execution space (Host/Device) where the code will run.
      * @param[out] recv_field The chunk which will describe the data in the new layout. This
@@ -168,7 +174,13 @@ public:
      * @param[in] send_field The chunk describing the data in the current layout. This data
      *                      will be scattered to other MPI processes.
      */
-    template <class OutLayout, class ElementType, class MemSpace, class ExecSpace, class InIdxRange>
+    template <
+            class OutLayout,
+            class CommElementType = void,
+            class ElementType,
+            class MemSpace,
+            class ExecSpace,
+            class InIdxRange>
     void transpose_to(
             ExecSpace const& execution_space,
             Field<ElementType, typename OutLayout::discrete_domain_type, MemSpace> recv_field,
@@ -291,22 +303,45 @@ public:
         /*****************************************************************
          * Transpose data (both on the rank and between ranks)
          *****************************************************************/
-        // Create views or copies of the function inputs such that they are laid out on the
-        // index range used during the alltoall call
-        auto alltoall_send_buffer = ddcHelper::create_transpose_mirror_view_and_copy<
-                input_alltoall_idx_range_type>(execution_space, send_mpi_field);
-        auto alltoall_recv_buffer = ddcHelper::create_transpose_mirror<
-                output_alltoall_idx_range_type>(execution_space, recv_mpi_field);
+        if constexpr (
+                std::is_void_v<CommElementType> || std::is_same_v<CommElementType, ElementType>) {
+            // Create views or copies of the function inputs such that they are laid out on the
+            // index range used during the alltoall call
+            auto alltoall_send_buffer = ddcHelper::create_transpose_mirror_view_and_copy<
+                    input_alltoall_idx_range_type>(execution_space, send_mpi_field);
+            auto alltoall_recv_buffer = ddcHelper::create_transpose_mirror<
+                    output_alltoall_idx_range_type>(execution_space, recv_mpi_field);
+
+            // Call the MPI AlltoAll routine
+            call_all_to_all(
+                    execution_space,
+                    get_field(alltoall_recv_buffer),
+                    get_const_field(alltoall_send_buffer));
+
+            // If alltoall_recv_buffer owns its data (not a view) then copy the results back to
+            // recv_mpi_field which is a view on recv_field, the function output
+            if constexpr (!ddc::is_borrowed_chunk_v<decltype(alltoall_recv_buffer)>) {
+                transpose_layout(
+                        execution_space,
+                        recv_mpi_field,
+                        get_const_field(alltoall_recv_buffer));
+            }
+        } else {
+            // The values are converted while they are laid out on the index range used during
+            // the alltoall call so the buffers are only allocated in the communication type
+            FieldMem<CommElementType, input_alltoall_idx_range_type, MemSpace>
+                    alltoall_send_buffer(input_alltoall_idx_range);
+            FieldMem<CommElementType, output_alltoall_idx_range_type, MemSpace>
+                    alltoall_recv_buffer(output_alltoall_idx_range);
+            transpose_layout(execution_space, get_field(alltoall_send_buffer), send_mpi_field);
 
-        // Call the MPI AlltoAll routine
-        call_all_to_all(
-                execution_space,
-                get_field(alltoall_recv_buffer),
-                get_const_field(alltoall_send_buffer));
+            // Call the MPI AlltoAll routine
+            call_all_to_all(
+                    execution_space,
+                    get_field(alltoall_recv_buffer),
+                    get_const_field(alltoall_send_buffer));
 
-        // If alltoall_recv_buffer owns its data (not a view) then copy the results back to
-        // recv_mpi_field which is a view on recv_field, the function output
-        if constexpr (!ddc::is_borrowed_chunk_v<decltype(alltoall_recv_buffer)>) {
+            // Convert the results back into recv_mpi_field which is a view on recv_field
             transpose_layout(
                     execution_space,
                     recv_mpi_field,
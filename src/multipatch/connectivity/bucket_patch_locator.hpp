@@ -0,0 +1,532 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_aliases.hpp"
+#include "ddc_helper.hpp"
+#include "multipatch_type.hpp"
+#include "types.hpp"
+
+/**
+ * @brief Patch locator for general multipatch geometries.
+ *
+ * Unlike the OnionPatchLocator, no assumption is made on the layout of the patches.
+ * Each patch is only required to have a mapping from its logical domain to the physical
+ * domain and the inverse mapping.
+ *
+ * At construction, the physical domain is covered by a uniform grid of buckets. The logical
+ * domain of each patch is sampled and the image of each sample cell is used to compute the
+ * list of the patches which may contain a point of each bucket (the bounding boxes are
+ * enlarged to take the curvature of the mappings into account).
+ *
+ * To locate a physical coordinate, the bucket containing it is computed with direct index
+ * arithmetic. The inverse mapping of each candidate patch is then applied and the first
+ * patch whose logical domain contains the logical coordinate is returned. The expected
+ * cost of a location is therefore independent of the number of patches.
+ *
+ * Along a periodic logical dimension the patch is assumed to cover the whole period,
+ * so only the non-periodic logical dimensions are checked.
+ *
+ * @warning The operator can works on GPU or CPU according to the given
+ * execution space ExecSpace. The ExecSpace by default is device.
+ * The constructor will still need to be called from CPU, but the operator()
+ * needs to be called from the given ExecSpace.
+ *
+ * @anchor BucketPatchLocatorImplementation
+ *
+ * @tparam MultipatchIdxRanges A MultipatchType type containing the 2D index ranges
+ *          on each patch.
+ * @tparam LogicalToPhysicalMappingOnPatch A mapping type from the logical domain of the
+ *          patch to the physical domain, template on the Patch.
+ * @tparam PhysicalToLogicalMappingOnPatch A mapping type from the physical domain to the
+ *          logical domain of the patch, template on the Patch.
+ * @tparam ExecSpace The space (CPU/GPU) where the calculations are carried out.
+ *          By default it is on device.
+ */
+template <
+        class MultipatchIdxRanges,
+        template <typename P>
+        typename LogicalToPhysicalMappingOnPatch,
+        template <typename P>
+        typename PhysicalToLogicalMappingOnPatch,
+        class ExecSpace = Kokkos::DefaultExecutionSpace>
+class BucketPatchLocator;
+
+
+/**
+ * @brief Patch locator for general multipatch geometries.
+ *
+ * See @ref BucketPatchLocatorImplementation
+ *
+ * @tparam Patches Patch types. If several patches contain a coordinate (e.g. on an
+ *          interface), the first one in this list is returned.
+ * @tparam LogicalToPhysicalMappingOnPatch A mapping type from the logical domain of the
+ *          patch to the physical domain, template on the Patch.
+ * @tparam PhysicalToLogicalMappingOnPatch A mapping type from the physical domain to the
+ *          logical domain of the patch, template on the Patch.
+ * @tparam ExecSpace The space (CPU/GPU) where the calculations are carried out.
+ */
+template <
+        class... Patches,
+        template <typename P>
+        typename LogicalToPhysicalMappingOnPatch,
+        template <typename P>
+        typename PhysicalToLogicalMappingOnPatch,
+        class ExecSpace>
+class BucketPatchLocator<
+        MultipatchType<IdxRangeOnPatch, Patches...>,
+        LogicalToPhysicalMappingOnPatch,
+        PhysicalToLogicalMappingOnPatch,
+        ExecSpace>
+{
+public:
+    /// @brief MultipatchType storing the index range.
+    using MultipatchIdxRanges = MultipatchType<IdxRangeOnPatch, Patches...>;
+
+    /// @brief MultipatchType storing the mappings from the logical domains to the physical one.
+    using MultipatchToPhysicalMappings
+            = MultipatchType<LogicalToPhysicalMappingOnPatch, Patches...>;
+
+    /// @brief MultipatchType storing the mappings from the physical domain to the logical domains.
+    using MultipatchToLogicalMappings
+            = MultipatchType<PhysicalToLogicalMappingOnPatch, Patches...>;
+
+    /// @brief Sequence ddc::detail::TypeSeq of patch tags.
+    using PatchOrdering = ddc::detail::TypeSeq<Patches...>;
+
+    /// @brief The space (CPU/GPU) where the calculations are carried out.
+    using exec_space = ExecSpace;
+
+    /// @brief Default value to define outside domain (not a patch).
+    static constexpr int outside_domain = -1;
+
+private:
+    static constexpr std::size_t n_patches = ddc::type_seq_size_v<PatchOrdering>;
+
+    using FirstPatch = ddc::type_seq_element_t<0, PatchOrdering>;
+    using PhysicalDims = ddc::to_type_seq_t<
+            typename LogicalToPhysicalMappingOnPatch<FirstPatch>::CoordResult>;
+    using X = ddc::type_seq_element_t<0, PhysicalDims>;
+    using Y = ddc::type_seq_element_t<1, PhysicalDims>;
+
+    static_assert(
+            (std::is_invocable_r_v<
+                     Coord<X, Y>,
+                     LogicalToPhysicalMappingOnPatch<Patches>,
+                     typename Patches::Coord12> && ...),
+            "The mappings have to contain an operator from the logical domain of their patch "
+            "to the physical domain.");
+    static_assert(
+            (std::is_invocable_r_v<
+                     typename Patches::Coord12,
+                     PhysicalToLogicalMappingOnPatch<Patches>,
+                     Coord<X, Y>> && ...),
+            "The mappings have to contain an operator from the physical domain to the logical "
+            "domain of their patch.");
+
+    // Bounding box stored as {x_min, x_max, y_min, y_max}
+    using BoundingBox = std::array<double, 4>;
+
+    using IntView = Kokkos::View<int*, typename ExecSpace::memory_space>;
+
+    // Number of sample cells per grid cell along each logical dimension used to estimate
+    // the physical extent of the patches.
+    static constexpr int s_n_sub_samples = 4;
+
+    MultipatchToPhysicalMappings const m_to_physical_mappings;
+    MultipatchToLogicalMappings const m_to_logical_mappings;
+    MultipatchIdxRanges const m_all_idx_ranges;
+
+    double m_x_min;
+    double m_y_min;
+    double m_inv_bucket_width_x;
+    double m_inv_bucket_width_y;
+    int m_n_buckets_x;
+    int m_n_buckets_y;
+
+    // Compressed storage of the candidate patches of each bucket. The candidates of the
+    // bucket b are stored in m_bucket_patches(m_bucket_offsets(b) : m_bucket_offsets(b+1)).
+    IntView m_bucket_offsets;
+    IntView m_bucket_patches;
+
+public:
+    /**
+     * @brief Instantiate the operator with MultipatchType of index ranges and
+     * MultipatchType of mappings.
+     *
+     * @param all_idx_ranges A MultipatchType of index ranges defined on the logical domain of
+     *          each patch.
+     * @param to_physical_mappings Mappings from the logical domain of each patch to the physical
+     *          domain.
+     * @param to_logical_mappings Mappings from the physical domain to the logical domain of each
+     *          patch.
+     * @param n_buckets The approximate number of buckets covering the physical domain. By default
+     *          there are about as many buckets as grid cells in the patches.
+     */
+    BucketPatchLocator(
+            MultipatchIdxRanges const& all_idx_ranges,
+            MultipatchToPhysicalMappings const& to_physical_mappings,
+            MultipatchToLogicalMappings const& to_logical_mappings,
+            std::size_t n_buckets = 0)
+        : m_to_physical_mappings(to_physical_mappings)
+        , m_to_logical_mappings(to_logical_mappings)
+        , m_all_idx_ranges(all_idx_ranges)
+    {
+        if (n_buckets == 0) {
+            n_buckets = (all_idx_ranges.template get<Patches>().size() + ...);
+        }
+        build_buckets(n_buckets);
+    }
+
+    ~BucketPatchLocator() = default;
+
+    /**
+     * @brief Get the patch where the given physical coordinate is.
+     *
+     * The candidate patches of the bucket containing the coordinate are tested in the
+     * order of the patches with their inverse mapping.
+     *
+     * @param coord [in] The given physical coordinate.
+     * @return [int] The patch index where the physical coordinate. If the coordinate
+     *              is outside of the domain, it returns a negative value.
+     */
+    KOKKOS_INLINE_FUNCTION int operator()(Coord<X, Y> const coord) const
+    {
+        double const x = ddc::get<X>(coord);
+        double const y = ddc::get<Y>(coord);
+        KOKKOS_ASSERT(!Kokkos::isnan(x) && !Kokkos::isnan(y));
+
+        int const bucket_x = int(Kokkos::floor((x - m_x_min) * m_inv_bucket_width_x));
+        int const bucket_y = int(Kokkos::floor((y - m_y_min) * m_inv_bucket_width_y));
+        if (bucket_x < 0 || bucket_x >= m_n_buckets_x || bucket_y < 0
+            || bucket_y >= m_n_buckets_y) {
+            return outside_domain;
+        }
+
+        int const bucket = bucket_x * m_n_buckets_y + bucket_y;
+        for (int i = m_bucket_offsets(bucket); i < m_bucket_offsets(bucket + 1); ++i) {
+            int const patch_idx = m_bucket_patches(i);
+            if (is_on_patch(coord, patch_idx)) {
+                return patch_idx;
+            }
+        }
+        return outside_domain;
+    }
+
+    /**
+     * @brief Get the mapping on the given Patch.
+     * The function can run on device and host.
+     * @tparam Patch Patch type.
+     * @return The mapping on the given Patch.
+     */
+    template <class Patch>
+    KOKKOS_FUNCTION LogicalToPhysicalMappingOnPatch<Patch> get_mapping_on_patch() const
+    {
+        return m_to_physical_mappings.template get<Patch>();
+    }
+
+private:
+    /// @brief Get the rank of the first patch defined on the given logical continuous dimensions.
+    template <class Dim1, class Dim2>
+    static constexpr std::size_t patch_rank_on_logical_dim()
+    {
+        std::array<bool, n_patches> const is_on_dims {
+                (std::is_same_v<typename Patches::Dim1, Dim1>
+                 && std::is_same_v<typename Patches::Dim2, Dim2>)...};
+        std::size_t rank = 0;
+        while (rank < n_patches && !is_on_dims[rank]) {
+            ++rank;
+        }
+        return rank;
+    }
+
+public:
+    /// @brief Get the type of the mapping on the given Patch.
+    template <class Patch>
+    using get_mapping_on_patch_t = LogicalToPhysicalMappingOnPatch<Patch>;
+
+    /// @brief Get the type of the mapping from given logical continuous dimensions.
+    /// If several patches are defined on these dimensions, the mapping of the first one is used.
+    template <class Dim1, class Dim2>
+    using get_mapping_on_logical_dim_t = LogicalToPhysicalMappingOnPatch<
+            ddc::type_seq_element_t<patch_rank_on_logical_dim<Dim1, Dim2>(), PatchOrdering>>;
+
+    /**
+     * @brief Get the mapping from given logical continuous dimensions.
+     * If several patches are defined on these dimensions, the mapping of the first one is returned.
+     * The function can run on device and host.
+     * @tparam Dim1 First logical continuous dimension.
+     * @tparam Dim2 Second logical continuous dimension.
+     * @return The mapping on the patch defined on the given dimensions.
+     */
+    template <class Dim1, class Dim2>
+    KOKKOS_FUNCTION get_mapping_on_logical_dim_t<Dim1, Dim2> get_mapping_on_logical_dim() const
+    {
+        static_assert(
+                patch_rank_on_logical_dim<Dim1, Dim2>() < n_patches,
+                "Wrong continuous dimensions.");
+        using Patch = ddc::
+                type_seq_element_t<patch_rank_on_logical_dim<Dim1, Dim2>(), PatchOrdering>;
+        return m_to_physical_mappings.template get<Patch>();
+    }
+
+    /// @brief Get the type of the inverse mapping from given logical continuous dimensions.
+    /// If several patches are defined on these dimensions, the mapping of the first one is used.
+    template <class Dim1, class Dim2>
+    using get_inverse_mapping_on_logical_dim_t = PhysicalToLogicalMappingOnPatch<
+            ddc::type_seq_element_t<patch_rank_on_logical_dim<Dim1, Dim2>(), PatchOrdering>>;
+
+    /**
+     * @brief Get the mapping from the physical domain to given logical continuous dimensions.
+     * If several patches are defined on these dimensions, the mapping of the first one is returned.
+     * The function can run on device and host.
+     * @tparam Dim1 First logical continuous dimension.
+     * @tparam Dim2 Second logical continuous dimension.
+     * @return The inverse mapping on the patch defined on the given dimensions.
+     */
+    template <class Dim1, class Dim2>
+    KOKKOS_FUNCTION get_inverse_mapping_on_logical_dim_t<Dim1, Dim2>
+    get_inverse_mapping_on_logical_dim() const
+    {
+        static_assert(
+                patch_rank_on_logical_dim<Dim1, Dim2>() < n_patches,
+                "Wrong continuous dimensions.");
+        using Patch = ddc::
+                type_seq_element_t<patch_rank_on_logical_dim<Dim1, Dim2>(), PatchOrdering>;
+        return m_to_logical_mappings.template get<Patch>();
+    }
+
+private:
+    /// @brief Check if the physical coordinate is on the patch with the given index.
+    KOKKOS_INLINE_FUNCTION bool is_on_patch(Coord<X, Y> const coord, int const patch_idx) const
+    {
+        return ((patch_idx == ddc::type_seq_rank_v<Patches, PatchOrdering>
+                 && is_on_patch<Patches>(coord))
+                || ...);
+    }
+
+    /// @brief Check if the physical coordinate is on the given Patch.
+    template <class Patch>
+    KOKKOS_INLINE_FUNCTION bool is_on_patch(Coord<X, Y> const coord) const
+    {
+        PhysicalToLogicalMappingOnPatch<Patch> const to_logical_mapping
+                = m_to_logical_mappings.template get<Patch>();
+        typename Patch::Coord12 const logical_coord(to_logical_mapping(coord));
+        typename Patch::IdxRange12 const idx_range = m_all_idx_ranges.template get<Patch>();
+        return is_in_idx_range(
+                       ddc::select<typename Patch::Dim1>(logical_coord),
+                       typename Patch::IdxRange1(idx_range))
+               && is_in_idx_range(
+                       ddc::select<typename Patch::Dim2>(logical_coord),
+                       typename Patch::IdxRange2(idx_range));
+    }
+
+    /// @brief Check if the logical coordinate is inside the index range along one dimension.
+    template <class Grid1D>
+    KOKKOS_INLINE_FUNCTION static bool is_in_idx_range(
+            Coord<typename Grid1D::continuous_dimension_type> const coord,
+            IdxRange<Grid1D> const idx_range)
+    {
+        if constexpr (Grid1D::continuous_dimension_type::PERIODIC) {
+            return !Kokkos::isnan(double(coord));
+        } else {
+            return ddc::coordinate(idx_range.front()) <= coord
+                   && coord <= ddc::coordinate(idx_range.back());
+        }
+    }
+
+    /// @brief Get the start and the length of the logical domain covered by the index range.
+    template <class Grid1D>
+    static std::array<double, 2> get_logical_extent(IdxRange<Grid1D> const idx_range)
+    {
+        double const start = ddc::coordinate(idx_range.front());
+        if constexpr (Grid1D::continuous_dimension_type::PERIODIC) {
+            return {start, ddcHelper::total_interval_length(idx_range)};
+        } else {
+            return {start, ddc::coordinate(idx_range.back()) - start};
+        }
+    }
+
+    /**
+     * @brief Call the function on the physical bounding box of each sample cell of the Patch.
+     *
+     * The logical domain is split uniformly into s_n_sub_samples cells per grid cell along
+     * each dimension. The bounding box of the images of the corners of each cell is enlarged
+     * by half its size to contain the curved images of the edges.
+     */
+    template <class Patch, class Function>
+    void for_each_sample_cell(Function&& function) const
+    {
+        using Coord12 = typename Patch::Coord12;
+        typename Patch::IdxRange12 const idx_range = m_all_idx_ranges.template get<Patch>();
+        typename Patch::IdxRange1 const idx_range_1(idx_range);
+        typename Patch::IdxRange2 const idx_range_2(idx_range);
+
+        std::array<double, 2> const extent_1 = get_logical_extent(idx_range_1);
+        std::array<double, 2> const extent_2 = get_logical_extent(idx_range_2);
+        int const n_cells_1 = s_n_sub_samples * std::max<int>(idx_range_1.size() - 1, 1);
+        int const n_cells_2 = s_n_sub_samples * std::max<int>(idx_range_2.size() - 1, 1);
+
+        LogicalToPhysicalMappingOnPatch<Patch> const to_physical_mapping
+                = m_to_physical_mappings.template get<Patch>();
+        std::vector<Coord<X, Y>> corners((n_cells_1 + 1) * (n_cells_2 + 1));
+        for (int i = 0; i <= n_cells_1; ++i) {
+            for (int j = 0; j <= n_cells_2; ++j) {
+                Coord12 const logical_coord(
+                        extent_1[0] + extent_1[1] * i / n_cells_1,
+                        extent_2[0] + extent_2[1] * j / n_cells_2);
+                corners[i * (n_cells_2 + 1) + j] = to_physical_mapping(logical_coord);
+            }
+        }
+
+        for (int i = 0; i < n_cells_1; ++i) {
+            for (int j = 0; j < n_cells_2; ++j) {
+                BoundingBox box {
+                        std::numeric_limits<double>::max(),
+                        std::numeric_limits<double>::lowest(),
+                        std::numeric_limits<double>::max(),
+                        std::numeric_limits<double>::lowest()};
+                for (int corner_i = i; corner_i <= i + 1; ++corner_i) {
+                    for (int corner_j = j; corner_j <= j + 1; ++corner_j) {
+                        Coord<X, Y> const corner = corners[corner_i * (n_cells_2 + 1) + corner_j];
+                        box[0] = std::min(box[0], double(ddc::get<X>(corner)));
+                        box[1] = std::max(box[1], double(ddc::get<X>(corner)));
+                        box[2] = std::min(box[2], double(ddc::get<Y>(corner)));
+                        box[3] = std::max(box[3], double(ddc::get<Y>(corner)));
+                    }
+                }
+                double const margin = 0.5 * std::max(box[1] - box[0], box[3] - box[2]);
+                function(BoundingBox {
+                        box[0] - margin,
+                        box[1] + margin,
+                        box[2] - margin,
+                        box[3] + margin});
+            }
+        }
+    }
+
+    /// @brief Extend the global bounding box with the bounding boxes of the Patch.
+    template <class Patch>
+    void extend_bounding_box(BoundingBox& global_box) const
+    {
+        for_each_sample_cell<Patch>([&](BoundingBox const& box) {
+            global_box[0] = std::min(global_box[0], box[0]);
+            global_box[1] = std::max(global_box[1], box[1]);
+            global_box[2] = std::min(global_box[2], box[2]);
+            global_box[3] = std::max(global_box[3], box[3]);
+        });
+    }
+
+    /// @brief Mark the buckets overlapping the bounding boxes of the Patch as candidates.
+    template <class Patch>
+    void mark_candidate_buckets(std::vector<bool>& is_candidate) const
+    {
+        std::size_t const patch_idx = ddc::type_seq_rank_v<Patch, PatchOrdering>;
+        for_each_sample_cell<Patch>([&](BoundingBox const& box) {
+            int const bucket_x_min
+                    = get_bucket_1d(box[0], m_x_min, m_inv_bucket_width_x, m_n_buckets_x);
+            int const bucket_x_max
+                    = get_bucket_1d(box[1], m_x_min, m_inv_bucket_width_x, m_n_buckets_x);
+            int const bucket_y_min
+                    = get_bucket_1d(box[2], m_y_min, m_inv_bucket_width_y, m_n_buckets_y);
+            int const bucket_y_max
+                    = get_bucket_1d(box[3], m_y_min, m_inv_bucket_width_y, m_n_buckets_y);
+            for (int bucket_x = bucket_x_min; bucket_x <= bucket_x_max; ++bucket_x) {
+                for (int bucket_y = bucket_y_min; bucket_y <= bucket_y_max; ++bucket_y) {
+                    int const bucket = bucket_x * m_n_buckets_y + bucket_y;
+                    is_candidate[bucket * n_patches + patch_idx] = true;
+                }
+            }
+        });
+    }
+
+    /// @brief Get the index of the bucket containing the coordinate along one dimension.
+    static int get_bucket_1d(double coord, double min, double inv_bucket_width, int n_buckets)
+    {
+        int const bucket = int(std::floor((coord - min) * inv_bucket_width));
+        return std::clamp(bucket, 0, n_buckets - 1);
+    }
+
+    /// @brief Build the uniform grid of buckets and the lists of candidate patches.
+    void build_buckets(std::size_t const n_buckets)
+    {
+        BoundingBox global_box {
+                std::numeric_limits<double>::max(),
+                std::numeric_limits<double>::lowest(),
+                std::numeric_limits<double>::max(),
+                std::numeric_limits<double>::lowest()};
+        (extend_bounding_box<Patches>(global_box), ...);
+
+        double const length_x = global_box[1] - global_box[0];
+        double const length_y = global_box[3] - global_box[2];
+        if (!(length_x > 0) || !(length_y > 0)) {
+            throw std::invalid_argument(
+                    "The patches must cover a 2D region of the physical domain.");
+        }
+
+        // Choose the number of buckets along each dimension so the buckets are roughly square.
+        m_n_buckets_x = std::max(1, int(std::ceil(std::sqrt(n_buckets * length_x / length_y))));
+        m_n_buckets_y = std::max(1, int(std::ceil(double(n_buckets) / m_n_buckets_x)));
+        m_x_min = global_box[0];
+        m_y_min = global_box[2];
+        m_inv_bucket_width_x = m_n_buckets_x / length_x;
+        m_inv_bucket_width_y = m_n_buckets_y / length_y;
+
+        int const n_buckets_total = m_n_buckets_x * m_n_buckets_y;
+        std::vector<bool> is_candidate(n_buckets_total * n_patches, false);
+        (mark_candidate_buckets<Patches>(is_candidate), ...);
+
+        m_bucket_offsets = IntView("m_bucket_offsets", n_buckets_total + 1);
+        auto bucket_offsets_host = Kokkos::create_mirror_view(m_bucket_offsets);
+        bucket_offsets_host(0) = 0;
+        for (int bucket = 0; bucket < n_buckets_total; ++bucket) {
+            bucket_offsets_host(bucket + 1) = bucket_offsets_host(bucket);
+            for (std::size_t patch_idx = 0; patch_idx < n_patches; ++patch_idx) {
+                if (is_candidate[bucket * n_patches + patch_idx]) {
+                    bucket_offsets_host(bucket + 1) += 1;
+                }
+            }
+        }
+
+        m_bucket_patches = IntView("m_bucket_patches", bucket_offsets_host(n_buckets_total));
+        auto bucket_patches_host = Kokkos::create_mirror_view(m_bucket_patches);
+        int candidate = 0;
+        for (int bucket = 0; bucket < n_buckets_total; ++bucket) {
+            for (std::size_t patch_idx = 0; patch_idx < n_patches; ++patch_idx) {
+                if (is_candidate[bucket * n_patches + patch_idx]) {
+                    bucket_patches_host(candidate++) = patch_idx;
+                }
+            }
+        }
+
+        Kokkos::deep_copy(m_bucket_offsets, bucket_offsets_host);
+        Kokkos::deep_copy(m_bucket_patches, bucket_patches_host);
+    }
+};
+
+
+// To help the template deduction.
+template <
+        class... Patches,
+        template <typename P>
+        typename LogicalToPhysicalMappingOnPatch,
+        template <typename P>
+        typename PhysicalToLogicalMappingOnPatch>
+BucketPatchLocator(
+        MultipatchType<IdxRangeOnPatch, Patches...> const& all_idx_ranges,
+        MultipatchType<LogicalToPhysicalMappingOnPatch, Patches...> const& to_physical_mappings,
+        MultipatchType<PhysicalToLogicalMappingOnPatch, Patches...> const& to_logical_mappings,
+        std::size_t n_buckets = 0)
+        -> BucketPatchLocator<
+                MultipatchType<IdxRangeOnPatch, Patches...>,
+                LogicalToPhysicalMappingOnPatch,
+                PhysicalToLogicalMappingOnPatch,
+                Kokkos::DefaultExecutionSpace>;
@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+#include <array>
+#include <cassert>
+
+#include <ddc/ddc.hpp>
+
+#include "ddc_aliases.hpp"
+#include "ddc_helper.hpp"
+#include "multipatch_type.hpp"
+
+template <class MultipatchIdxRange>
+class MultipatchFlatIdxRange;
+
+/**
+ * @brief A class which numbers all the indices of the index ranges of several patches
+ * with a single integer.
+ *
+ * The indices of the first patch are numbered first (starting from 0), followed by the
+ * indices of the second patch, etc. This allows a loop over all the points of a multipatch
+ * geometry to be carried out in a single kernel (e.g. with a Kokkos::RangePolicy) instead of
+ * launching one kernel per patch. When the patches are small this avoids leaving most of the
+ * threads idle.
+ *
+ * Inside the kernel the patch on which an integer lies is found with `contains` and the
+ * associated index is obtained with `to_discrete_element`. These operations are usually
+ * called in a fold expression over the patches:
+ * @code
+ * ((flat_idx_range.template contains<Patches>(i)
+ *           ? f(flat_idx_range.template to_discrete_element<Patches>(i))
+ *           : void()),
+ *  ...);
+ * @endcode
+ *
+ * @tparam IdxRangeOnPatch A type alias which provides the index range type on a patch.
+ * @tparam Patches The patches on which the index ranges are defined.
+ */
+template <template <typename P> typename IdxRangeOnPatch, class... Patches>
+class MultipatchFlatIdxRange<MultipatchType<IdxRangeOnPatch, Patches...>>
+{
+public:
+    /// @brief The type of the index ranges on each patch.
+    using MultipatchIdxRange = MultipatchType<IdxRangeOnPatch, Patches...>;
+
+    /// @brief The number of patches.
+    static constexpr std::size_t n_patches = sizeof...(Patches);
+
+private:
+    using PatchOrdering = ddc::detail::TypeSeq<Patches...>;
+
+    MultipatchIdxRange m_idx_ranges;
+
+    // m_offsets[i] is the flat index of the first element of the i-th patch.
+    std::array<int, n_patches + 1> m_offsets;
+
+public:
+    /**
+     * @brief Instantiate a MultipatchFlatIdxRange.
+     *
+     * @param[in] idx_ranges The index ranges on each patch.
+     */
+    explicit MultipatchFlatIdxRange(MultipatchIdxRange const& idx_ranges)
+        : m_idx_ranges(idx_ranges)
+    {
+        std::array<int, n_patches> const sizes {
+                int(idx_ranges.template get<Patches>().size())...};
+        m_offsets[0] = 0;
+        for (std::size_t i(0); i < n_patches; ++i) {
+            m_offsets[i + 1] = m_offsets[i] + sizes[i];
+        }
+    }
+
+    /**
+     * @brief Get the total number of indices on all the patches.
+     *
+     * @return The number of indices.
+     */
+    KOKKOS_FUNCTION int size() const
+    {
+        return m_offsets[n_patches];
+    }
+
+    /**
+     * @brief Get the index range on a given patch.
+     *
+     * @tparam Patch The patch of interest.
+     * @return The index range on the patch.
+     */
+    template <class Patch>
+    KOKKOS_FUNCTION IdxRangeOnPatch<Patch> get() const
+    {
+        return m_idx_ranges.template get<Patch>();
+    }
+
+    /**
+     * @brief Check if an integer describes an index on a given patch.
+     *
+     * @tparam Patch The patch of interest.
+     * @param[in] flat_idx An integer in [0, size()).
+     *
+     * @return True if the integer describes an index on the patch, false otherwise.
+     */
+    template <class Patch>
+    KOKKOS_FUNCTION bool contains(int flat_idx) const
+    {
+        std::size_t constexpr patch_idx = ddc::type_seq_rank_v<Patch, PatchOrdering>;
+        return (m_offsets[patch_idx] <= flat_idx) && (flat_idx < m_offsets[patch_idx + 1]);
+    }
+
+    /**
+     * @brief Convert an integer into the index on a given patch that it describes.
+     *
+     * @tparam Patch The patch of interest.
+     * @param[in] flat_idx An integer for which contains<Patch>(flat_idx) is true.
+     *
+     * @return The index on the patch.
+     */
+    template <class Patch>
+    KOKKOS_FUNCTION typename IdxRangeOnPatch<Patch>::discrete_element_type to_discrete_element(
+            int flat_idx) const
+    {
+        assert(contains<Patch>(flat_idx));
+        std::size_t constexpr patch_idx = ddc::type_seq_rank_v<Patch, PatchOrdering>;
+        return ddcHelper::to_discrete_element(
+                flat_idx - m_offsets[patch_idx],
+                m_idx_ranges.template get<Patch>());
+    }
+};
+
+template <template <typename P> typename IdxRangeOnPatch, class... Patches>
+MultipatchFlatIdxRange(MultipatchType<IdxRangeOnPatch, Patches...> const&)
+        -> MultipatchFlatIdxRange<MultipatchType<IdxRangeOnPatch, Patches...>>;
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+#include <array>
 #include <cassert>
 #include <utility>
 
@@ -8,11 +9,31 @@
 
 #include "ddc_aliases.hpp"
 #include "ddc_helper.hpp"
+#include "multipatch_flat_idx_range.hpp"
 #include "multipatch_type.hpp"
 #include "types.hpp"
 #include "utils_patch_locators.hpp"
 #include "view.hpp"
 
+namespace detail {
+/**
+ * @brief Get the spline coefficients of one batch element.
+ * @param spline_coef The (batched) spline coefficients.
+ * @param ib The index of the batch element.
+ * @return The spline coefficients of the batch element.
+ */
+template <class SplineCoeffField, class... BatchGrid>
+KOKKOS_INLINE_FUNCTION auto get_batch_element(
+        SplineCoeffField const& spline_coef,
+        Idx<BatchGrid...> const& ib)
+{
+    if constexpr (sizeof...(BatchGrid) == 0) {
+        return spline_coef;
+    } else {
+        return spline_coef[ib];
+    }
+}
+} // namespace detail
 
 /**
  * @brief A class to evaluate all the splines of all the patches at once.
@@ -32,7 +53,16 @@
  * Additionally, methods to compute the first derivatives and cross-derivatives 
  * are implemented. 
  * 
- * @warning This operator does not work on batched domain. 
+ * The fields of values can be defined on batched index ranges (e.g. with a species
+ * dimension). In this case the coordinates are only defined on the two dimensions of the
+ * patch and the spline coefficients are batched in the same way as the values. The patch
+ * where a coordinate is located and the equivalent coordinate on this patch are computed
+ * once and are then used for every batch element.
+ *
+ * The patches can be defined on different logical continuous dimensions (e.g. the strips or
+ * figure-of-eight geometries with a BucketPatchLocator). The equivalent coordinate on the
+ * patch where a coordinate is located is then computed with the inverse mappings of the
+ * patch locator.
  * 
  * @tparam ExecSpace The space (CPU/GPU) where the calculations are carried out.
  * @tparam MemorySpace The space (CPU/GPU) where the coefficients and values are stored.
@@ -154,6 +184,27 @@ public:
     template <class Patch>
     using spline_idx_range_type = IdxRange<bsplines_type1<Patch>, bsplines_type2<Patch>>;
 
+    /// @brief The type of the batch domain (obtained by removing the dimensions of interest
+    /// from the whole domain).
+    /// @tparam Patch Patch type.
+    template <class Patch>
+    using batch_idx_range_type = ddc::remove_dims_of_t<
+            batched_evaluation_idx_range_type<Patch>,
+            evaluation_discrete_dimension_type1<Patch>,
+            evaluation_discrete_dimension_type2<Patch>>;
+
+    /// @brief The type of the whole spline domain (cartesian product of 2D spline domain
+    /// and batch domain) preserving the order of dimensions.
+    /// @tparam Patch Patch type.
+    template <class Patch>
+    using batched_spline_idx_range_type = ddc::replace_dim_of_t<
+            ddc::replace_dim_of_t<
+                    batched_evaluation_idx_range_type<Patch>,
+                    evaluation_discrete_dimension_type1<Patch>,
+                    bsplines_type1<Patch>>,
+            evaluation_discrete_dimension_type2<Patch>,
+            bsplines_type2<Patch>>;
+
 
 private:
     template <class Patch>
@@ -175,38 +226,65 @@ public:
     template <class Patch>
     using SplineCoeffOnPatch = DConstField<spline_idx_range_type<Patch>, MemorySpace>;
 
+    /**
+     * @brief Type for MultipatchType: A field of 2D spline coefficients batched in the same
+     * way as the values (see ValuesOnPatch). This is the same type as SplineCoeffOnPatch if
+     * the values are not batched.
+     * Needed public for functions on GPU. 
+     */
+    template <class Patch>
+    using BatchedSplineCoeffOnPatch
+            = DConstField<batched_spline_idx_range_type<Patch>, MemorySpace>;
+
+    /**
+     * @brief Type for MultipatchType: The field of 2D spline coefficients of one batch element.
+     * Needed public for functions on GPU. 
+     */
+    template <class Patch>
+    using SplineCoeffOfBatchElementOnPatch = decltype(detail::get_batch_element(
+            std::declval<BatchedSplineCoeffOnPatch<Patch>>(),
+            std::declval<typename batch_idx_range_type<Patch>::discrete_element_type>()));
+
 private:
     // MultipatchTypes
     using MultipatchValues = MultipatchField<ValuesOnPatch, Patches...>;
     using MultipatchCoordField = MultipatchField<CoordConstFieldOnPatch, Patches...>;
     using MultipatchSplineCoeff = MultipatchField<SplineCoeffOnPatch, Patches...>;
+    using MultipatchBatchedSplineCoeff = MultipatchField<BatchedSplineCoeffOnPatch, Patches...>;
 
     // Patches
     using PatchOrdering = ddc::detail::TypeSeq<Patches...>;
 
+    /// @brief Get the rank of the first patch defined on the given logical continuous dimensions.
+    template <class Dim1, class Dim2>
+    static constexpr std::size_t patch_rank_on_logical_dim()
+    {
+        std::array<bool, sizeof...(Patches)> const is_on_dims {
+                (std::is_same_v<typename Patches::Dim1, Dim1>
+                 && std::is_same_v<typename Patches::Dim2, Dim2>)...};
+        std::size_t rank = 0;
+        while (rank < sizeof...(Patches) && !is_on_dims[rank]) {
+            ++rank;
+        }
+        return rank;
+    }
+
+    /// @brief The first patch defined on the given logical continuous dimensions.
+    template <class Dim1, class Dim2>
+    using PatchOnLogicalDim = ddc::
+            type_seq_element_t<patch_rank_on_logical_dim<Dim1, Dim2>(), PatchOrdering>;
+
 public:
     /// @brief The number of patches.
     static constexpr std::size_t n_patches = ddc::type_seq_size_v<PatchOrdering>;
 
 private:
     // Asserts -----------------------------------------------------------------------------------
-    template <class Patch>
-    static bool constexpr same_evaluation_idx_range_types = std::
-            is_same_v<evaluation_idx_range_type<Patch>, batched_evaluation_idx_range_type<Patch>>;
-
-    static_assert(
-            (same_evaluation_idx_range_types<Patches> && ...),
-            "Operator not yet implemented for batched domains.");
-
     static_assert(
             ((std::is_same_v<typename ValuesOnPatch<Patches>::memory_space, memory_space>)&&...),
             "Template ValuesOnPatch<Patch> need to be defined on the memory space than the"
             "MultipatchSplineEvaluator2D class.");
 
-    static_assert(
-            is_onion_patch_locator_v<PatchLocator>,
-            "Operator currently works only on analytical mappings and patches on the same logical "
-            "continuous dimension. E.g. OnionPatchLocator.");
 
 
     // Members -----------------------------------------------------------------------------------
@@ -268,18 +346,15 @@ public:
      * @param[out] patches_values A MultipatchType of DField to store the values of the splines 
      *          at the given coordinates. 
      * @param[in] patches_coords A MultipatchType of Field of Coordinate storing the coordinates of the meshes.
-     * @param[in] patches_splines A MultipatchType of DField storing the 2D spline coefficients.
+     * @param[in] patches_splines A MultipatchType of DField storing the 2D spline coefficients
+     *          (batched in the same way as the values).
      */
     void operator()(
             MultipatchValues const& patches_values,
             MultipatchCoordField const& patches_coords,
-            MultipatchSplineCoeff const& patches_splines) const
+            MultipatchBatchedSplineCoeff const& patches_splines) const
     {
-        (apply_evaluator<eval_type, eval_type, Patches>(
-                 patches_values.template get<Patches>(),
-                 patches_coords.template get<Patches>(),
-                 patches_splines),
-         ...);
+        apply_evaluator<eval_type, eval_type>(patches_values, patches_coords, patches_splines);
     }
 
 
@@ -416,18 +491,17 @@ public:
      * @param[out] patches_deriv_1 A MultipatchType of DField to store the derivatives of the splines 
      *          at the given coordinates. 
      * @param[in] patches_coords A MultipatchType of Field of Coordinate storing the coordinates of the meshes.
-     * @param[in] patches_splines A MultipatchType of DField storing the 2D spline coefficients.
+     * @param[in] patches_splines A MultipatchType of DField storing the 2D spline coefficients
+     *          (batched in the same way as the values).
      */
     void deriv_dim_1(
             MultipatchValues const& patches_deriv_1,
             MultipatchCoordField const& patches_coords,
-            MultipatchSplineCoeff const& patches_splines) const
+            MultipatchBatchedSplineCoeff const& patches_splines) const
     {
-        (apply_evaluator<eval_deriv_type, eval_type, Patches>(
-                 patches_deriv_1.template get<Patches>(),
-                 patches_coords.template get<Patches>(),
-                 patches_splines),
-         ...);
+        apply_evaluator<
+                eval_deriv_type,
+                eval_type>(patches_deriv_1, patches_coords, patches_splines);
     }
 
     /**
@@ -441,18 +515,17 @@ public:
      * @param[out] patches_deriv_2 A MultipatchType of DField to store the derivatives of the splines 
      *          at the given coordinates. 
      * @param[in] patches_coords A MultipatchType of Field of Coordinate storing the coordinates of the meshes.
-     * @param[in] patches_splines A MultipatchType of DField storing the 2D spline coefficients.
+     * @param[in] patches_splines A MultipatchType of DField storing the 2D spline coefficients
+     *          (batched in the same way as the values).
      */
     void deriv_dim_2(
             MultipatchValues const& patches_deriv_2,
             MultipatchCoordField const& patches_coords,
-            MultipatchSplineCoeff const& patches_splines) const
+            MultipatchBatchedSplineCoeff const& patches_splines) const
     {
-        (apply_evaluator<eval_type, eval_deriv_type, Patches>(
-                 patches_deriv_2.template get<Patches>(),
-                 patches_coords.template get<Patches>(),
-                 patches_splines),
-         ...);
+        apply_evaluator<
+                eval_type,
+                eval_deriv_type>(patches_deriv_2, patches_coords, patches_splines);
     }
 
     /** @brief Cross-differentiate 2D splines (described by their spline coefficients) on a meshes.
@@ -464,18 +537,17 @@ public:
      * @param[out] patches_deriv_12 A MultipatchType of DField to store the cross-derivatives of the splines 
      *          at the given coordinates. 
      * @param[in] patches_coords A MultipatchType of Field of Coordinate storing the coordinates of the meshes.
-     * @param[in] patches_splines A MultipatchType of DField storing the 2D spline coefficients.
+     * @param[in] patches_splines A MultipatchType of DField storing the 2D spline coefficients
+     *          (batched in the same way as the values).
      */
     void deriv_1_and_2(
             MultipatchValues const& patches_deriv_12,
             MultipatchCoordField const& patches_coords,
-            MultipatchSplineCoeff const& patches_splines) const
+            MultipatchBatchedSplineCoeff const& patches_splines) const
     {
-        (apply_evaluator<eval_deriv_type, eval_deriv_type, Patches>(
-                 patches_deriv_12.template get<Patches>(),
-                 patches_coords.template get<Patches>(),
-                 patches_splines),
-         ...);
+        apply_evaluator<
+                eval_deriv_type,
+                eval_deriv_type>(patches_deriv_12, patches_coords, patches_splines);
     }
 
 
@@ -501,49 +573,98 @@ public:
 public:
     // Apply functions to manage the values on each patch. ---------------------------------------
 
-    /** @brief Compute the values or the derivatives of a given patch at the coordinates
-     * defined on the given patch.
+    /** @brief Compute the values or the derivatives at the coordinates defined on every patch.
+     * All the patches are treated in a single kernel using a flat index over the index ranges
+     * of all the patches. This avoids launching one small kernel per patch.
      * Needed public for functions on GPU. 
      * @tparam EvalType1 Evaluation type: either eval_type or eval_deriv_type.
      * @tparam EvalType2 Evaluation type: either eval_type or eval_deriv_type.
-     * @tparam StoringPatch Patch type where the given coordinates are stored. 
-     *      They are not especially physically located on this patch.
-     * @param[out] patch_values Field of values of the function or derivative. 
-     * @param[in] patch_coords ConstField of coordinates defined on the StoringPatch and 
-     *          where we want to evaluate the function or derivative. 
+     * @param[out] patches_values MultipatchType of fields of values of the function or derivative. 
+     * @param[in] patches_coords MultipatchType of ConstField of coordinates where we want to
+     *          evaluate the function or derivative. 
      * @param[in] patches_splines MultipatchType of spline coefficients of the splines 
      *          on every patches. 
      */
-    template <class EvalType1, class EvalType2, class StoringPatch>
+    template <class EvalType1, class EvalType2>
     void apply_evaluator(
-            ValuesOnPatch<StoringPatch> const& patch_values,
-            CoordConstFieldOnPatch<StoringPatch> const& patch_coords,
-            MultipatchSplineCoeff const patches_splines) const
+            MultipatchValues const& patches_values,
+            MultipatchCoordField const& patches_coords,
+            MultipatchBatchedSplineCoeff const& patches_splines) const
     {
-        assert(get_idx_range(patch_values) == get_idx_range(patch_coords));
-
-        using Index =
-                typename batched_evaluation_idx_range_type<StoringPatch>::discrete_element_type;
-        batched_evaluation_idx_range_type<StoringPatch> idx_range = get_idx_range(patch_values);
+        ((assert(evaluation_idx_range_type<Patches>(
+                         get_idx_range(patches_values.template get<Patches>()))
+                 == get_idx_range(patches_coords.template get<Patches>()))),
+         ...);
+        ((assert(batch_idx_range_type<Patches>(
+                         get_idx_range(patches_values.template get<Patches>()))
+                 == batch_idx_range_type<Patches>(
+                         get_idx_range(patches_splines.template get<Patches>())))),
+         ...);
 
-        ddc::parallel_for_each(
-                exec_space(),
-                idx_range,
-                KOKKOS_CLASS_LAMBDA(Index const& idx) {
-                    CoordOnPatch<StoringPatch> const coord = patch_coords(idx);
-                    int const patch_idx = get_patch_idx(coord);
-                    if (patch_idx < 0
-                        && !((std::is_same_v<EvalType1, eval_type>)&&(
-                                std::is_same_v<EvalType2, eval_type>))) {
-                        Kokkos::abort("The evaluation coordinate has to be on a patch."
-                                      "No extrapolation rule for derivatives. \n");
-                    }
-                    patch_values(idx) = recursive_dispatch_patch_function<
-                            EvalType1,
-                            EvalType2>(coord, patches_splines, patch_idx);
+        // The kernel is parallelised over the coordinates. The batch dimensions are treated
+        // sequentially so the patch of each coordinate is only located once.
+        MultipatchFlatIdxRange flat_idx_range(patches_coords.idx_range());
+
+        Kokkos::parallel_for(
+                "MultipatchSplineEvaluator2D",
+                Kokkos::RangePolicy<exec_space>(exec_space(), 0, flat_idx_range.size()),
+                KOKKOS_CLASS_LAMBDA(int const flat_idx) {
+                    ((apply_evaluator_on_patch<EvalType1, EvalType2, Patches>(
+                             flat_idx_range,
+                             flat_idx,
+                             patches_values,
+                             patches_coords,
+                             patches_splines)),
+                     ...);
                 });
     }
 
+    /** @brief Compute the values or the derivatives at one coordinate (for every batch element)
+     * if this coordinate is stored on the given patch.
+     * Needed public for functions on GPU. 
+     * @tparam EvalType1 Evaluation type: either eval_type or eval_deriv_type.
+     * @tparam EvalType2 Evaluation type: either eval_type or eval_deriv_type.
+     * @tparam StoringPatch Patch type where the given coordinates are stored. 
+     *      They are not especially physically located on this patch.
+     * @param[in] flat_idx_range The object describing the flat indexing of all the patches.
+     * @param[in] flat_idx The flat index of the coordinate.
+     * @param[out] patches_values MultipatchType of fields of values of the function or derivative. 
+     * @param[in] patches_coords MultipatchType of ConstField of coordinates where we want to
+     *          evaluate the function or derivative. 
+     * @param[in] patches_splines MultipatchType of spline coefficients of the splines 
+     *          on every patches. 
+     */
+    template <class EvalType1, class EvalType2, class StoringPatch, class FlatIdxRange>
+    KOKKOS_FUNCTION void apply_evaluator_on_patch(
+            FlatIdxRange const& flat_idx_range,
+            int const flat_idx,
+            MultipatchValues const& patches_values,
+            MultipatchCoordField const& patches_coords,
+            MultipatchBatchedSplineCoeff const& patches_splines) const
+    {
+        if (flat_idx_range.template contains<StoringPatch>(flat_idx)) {
+            using IdxEval = typename evaluation_idx_range_type<StoringPatch>::discrete_element_type;
+            IdxEval const idx = flat_idx_range.template to_discrete_element<StoringPatch>(flat_idx);
+            CoordOnPatch<StoringPatch> const coord
+                    = patches_coords.template get<StoringPatch>()(idx);
+            int const patch_idx = get_patch_idx(coord);
+            if (patch_idx < 0
+                && !((std::is_same_v<EvalType1, eval_type>)&&(
+                        std::is_same_v<EvalType2, eval_type>))) {
+                Kokkos::abort("The evaluation coordinate has to be on a patch."
+                              "No extrapolation rule for derivatives. \n");
+            }
+            ValuesOnPatch<StoringPatch> const patch_values
+                    = patches_values.template get<StoringPatch>();
+            recursive_dispatch_patch_function_batched<EvalType1, EvalType2, StoringPatch>(
+                    coord,
+                    patches_splines,
+                    patch_idx,
+                    patch_values,
+                    idx);
+        }
+    }
+
     /** @brief Integrate the spline defined on the given patch.
      * @tparam Patch Patch type where the integration of the spline is computed. 
      * @param[out] integral Double, value of the integral of the spline on the given Patch.
@@ -603,14 +724,7 @@ private:
             // Coord not on patch. Stop recursing.
             if constexpr (
                     std::is_same_v<EvalType1, eval_type> && std::is_same_v<EvalType2, eval_type>) {
-                /* The operator currently works only for the case where the continuous 
-                   dimensions of all the patches are the same. So the equivalent coordinates
-                   are the same on any patches. 
-                   Add a method to determine the patch from continuous dimensions, once 
-                   we would like to deal with other cases. 
-                */
-                using AnyPatch = ddc::type_seq_element_t<0, PatchOrdering>;
-                replace_periodic_coord_inside<AnyPatch>(coord);
+                replace_periodic_coord_inside<PatchOnLogicalDim<Dim1, Dim2>>(coord);
                 return m_extrapolation_rule(coord, patches_splines, patch_idx);
             } else {
                 Kokkos::abort("The spline derivatives cannot be evaluated at coordinates "
@@ -641,6 +755,83 @@ private:
     }
 
 
+    /// @brief Dispatch the given coordinate on the right patch to evaluate the right spline
+    /// for every batch element. The equivalent coordinate on this patch is only computed once.
+    template <
+            class EvalType1,
+            class EvalType2,
+            class StoringPatch,
+            class Dim1,
+            class Dim2,
+            int TestPatchIdx = 0>
+    KOKKOS_INLINE_FUNCTION void recursive_dispatch_patch_function_batched(
+            Coord<Dim1, Dim2> coord,
+            MultipatchBatchedSplineCoeff const& patches_splines,
+            int const patch_idx,
+            ValuesOnPatch<StoringPatch> const& patch_values,
+            typename evaluation_idx_range_type<StoringPatch>::discrete_element_type const& idx)
+            const
+    {
+        using IdxRangeBatch = batch_idx_range_type<StoringPatch>;
+        using IdxBatch = typename IdxRangeBatch::discrete_element_type;
+        using IdxBatched =
+                typename batched_evaluation_idx_range_type<StoringPatch>::discrete_element_type;
+        IdxRangeBatch const batch_idx_range(get_idx_range(patch_values));
+        int const n_batch = batch_idx_range.size();
+
+        if constexpr (TestPatchIdx == ddc::type_seq_size_v<PatchOrdering>) {
+            if (patch_idx >= 0) {
+                Kokkos::abort("The recursion has reached the end without finding where "
+                              "the coordinate is physically located.");
+            }
+            // Coord not on patch. Stop recursing.
+            if constexpr (
+                    std::is_same_v<EvalType1, eval_type> && std::is_same_v<EvalType2, eval_type>) {
+                replace_periodic_coord_inside<PatchOnLogicalDim<Dim1, Dim2>>(coord);
+                for (int i = 0; i < n_batch; ++i) {
+                    IdxBatch const ib = ddcHelper::to_discrete_element(i, batch_idx_range);
+                    MultipatchField<SplineCoeffOfBatchElementOnPatch, Patches...> const
+                            batch_element_splines(detail::get_batch_element(
+                                    patches_splines.template get<Patches>(),
+                                    ib)...);
+                    patch_values(IdxBatched(idx, ib))
+                            = m_extrapolation_rule(coord, batch_element_splines, patch_idx);
+                }
+            } else {
+                Kokkos::abort("The spline derivatives cannot be evaluated at coordinates "
+                              "outside of the domain.");
+            }
+        } else {
+            if (patch_idx == TestPatchIdx) {
+                using TestPatch = ddc::type_seq_element_t<TestPatchIdx, PatchOrdering>;
+                CoordOnPatch<TestPatch> test_coord = get_equivalent_coord<
+                        typename TestPatch::Dim1,
+                        typename TestPatch::Dim2,
+                        Dim1,
+                        Dim2>(coord);
+                replace_periodic_coord_inside<TestPatch>(test_coord);
+
+                BatchedSplineCoeffOnPatch<TestPatch> const test_spline
+                        = patches_splines.template get<TestPatch>();
+                for (int i = 0; i < n_batch; ++i) {
+                    IdxBatch const ib = ddcHelper::to_discrete_element(i, batch_idx_range);
+                    patch_values(IdxBatched(idx, ib)) = eval_no_bc<EvalType1, EvalType2, TestPatch>(
+                            test_coord,
+                            detail::get_batch_element(test_spline, ib));
+                }
+            } else {
+                recursive_dispatch_patch_function_batched<
+                        EvalType1,
+                        EvalType2,
+                        StoringPatch,
+                        Dim1,
+                        Dim2,
+                        TestPatchIdx + 1>(coord, patches_splines, patch_idx, patch_values, idx);
+            }
+        }
+    }
+
+
     // Useful functions --------------------------------------------------------------------------
 
     /// @brief Call the patch locator to get the index of the patch where the given coordinate
@@ -655,6 +846,8 @@ private:
 
     /// @brief Call mappings to get the equivalent coordinate defined on a current patch
     /// on the target patch. Pass by the physical domain.
+    /// On onion geometries the same curvilinear mapping is used on every patch and it provides
+    /// its own inverse. Otherwise the patch locator has to provide the inverse mappings.
     template <class TargetDim1, class TargetDim2, class CurrentDim1, class CurrentDim2>
     KOKKOS_INLINE_FUNCTION Coord<TargetDim1, TargetDim2> get_equivalent_coord(
             Coord<CurrentDim1, CurrentDim2> const& current_coord) const
@@ -663,7 +856,7 @@ private:
                               Coord<TargetDim1, TargetDim2>,
                               Coord<CurrentDim1, CurrentDim2>>) {
             return current_coord;
-        } else {
+        } else if constexpr (is_onion_patch_locator_v<PatchLocator>) {
             using CurrentMapping = typename PatchLocator::
                     template get_mapping_on_logical_dim_t<CurrentDim1, CurrentDim2>;
             using TargetMapping = typename PatchLocator::
@@ -687,6 +880,29 @@ private:
                     m_patch_locator.template get_mapping_on_logical_dim<TargetDim1, TargetDim2>());
 
             return target_mapping(current_mapping(current_coord));
+        } else {
+            using CurrentMapping = typename PatchLocator::
+                    template get_mapping_on_logical_dim_t<CurrentDim1, CurrentDim2>;
+            using TargetInverseMapping = typename PatchLocator::
+                    template get_inverse_mapping_on_logical_dim_t<TargetDim1, TargetDim2>;
+
+            static_assert(
+                    std::is_invocable_r_v<
+                            Coord<TargetDim1, TargetDim2>,
+                            TargetInverseMapping,
+                            std::invoke_result_t<CurrentMapping, Coord<CurrentDim1, CurrentDim2>>>,
+                    "The inverse mapping has to map the physical domain to the logical domain "
+                    "of the target patch.");
+
+            CurrentMapping const current_mapping(
+                    m_patch_locator
+                            .template get_mapping_on_logical_dim<CurrentDim1, CurrentDim2>());
+            TargetInverseMapping const target_inverse_mapping(
+                    m_patch_locator.template get_inverse_mapping_on_logical_dim<
+                            TargetDim1,
+                            TargetDim2>());
+
+            return target_inverse_mapping(current_mapping(current_coord));
         }
     }
 
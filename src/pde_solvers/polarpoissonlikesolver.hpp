@@ -1,5 +1,10 @@
 // SPDX-License-Identifier: MIT
 #pragma once
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
 
 #include <ddc/ddc.hpp>
 
@@ -9,7 +14,9 @@
 #include "mapping_tools.hpp"
 #include "math_tools.hpp"
 #include "matrix_batch_csr.hpp"
+#include "matrix_batch_pds_banded.hpp"
 #include "metric_tensor_evaluator.hpp"
+#include "operator_cache.hpp"
 #include "polar_spline.hpp"
 #include "polar_spline_evaluator.hpp"
 #include "quadrature_coeffs_nd.hpp"
@@ -194,6 +201,56 @@ public:
         DVector<R_cov, Theta_cov> derivative;
     };
 
+    /**
+    * @brief Object storing the coefficients of the weak formulation at a
+    * quadrature point, multiplied by the quadrature weight @f$ w @f$.
+    */
+    struct WeakFormCoefficients
+    {
+        /// The product @f$ w \alpha G^{-1} @f$ where @f$ G^{-1} @f$ is the inverse metric tensor.
+        DTensor<VectorIndexSet<R, Theta>, VectorIndexSet<R, Theta>> alpha_inv_metric;
+        /// The product @f$ w \beta @f$.
+        double beta;
+    };
+
+    /**
+    * @brief Object storing the terms of the weak formulation at a quadrature point which
+    * are tested against the basis functions when the operator is applied to a function
+    * @f$ u @f$ without assembling the matrix.
+    */
+    struct WeakFormIntegrand
+    {
+        /// The product @f$ w \beta u @f$.
+        double value;
+        /// The product @f$ w \alpha G^{-1} \nabla u @f$.
+        DVector<R, Theta> flux;
+    };
+
+    /**
+     * @brief The way in which the operator of the linear system is stored.
+     */
+    enum class OperatorStorage {
+        /// The matrix is assembled in CSR format and the system is solved with Ginkgo.
+        Assembled,
+        /// The matrix is never assembled. The operator is applied from the coefficients of the
+        /// weak formulation at the quadrature points at each iteration of the solver.
+        MatrixFree
+    };
+
+    /**
+     * @brief The preconditioner used to solve the linear system.
+     */
+    enum class Preconditioner {
+        /// The Jacobi preconditioner. With an assembled matrix the block Jacobi preconditioner
+        /// of Ginkgo is used, otherwise the diagonal of the matrix is used.
+        Jacobi,
+        /// A block Jacobi preconditioner whose blocks couple all the B-splines with the same
+        /// poloidal index (radial lines). Each block is a symmetric positive definite banded
+        /// matrix which is factorised once. The B-splines covering the singular point form
+        /// an additional dense block.
+        RadialLineBlock
+    };
+
     /**
      * @brief Tag an index of cell.
      */
@@ -219,6 +276,13 @@ private:
     static constexpr IdxRange<ThetaBasisSubset> m_non_zero_bases_theta
             = IdxRange<ThetaBasisSubset>(Idx<ThetaBasisSubset> {0}, m_n_non_zero_bases_theta);
 
+    const OperatorStorage m_operator_storage;
+    const Preconditioner m_preconditioner;
+
+    // Parameters of the conjugate gradient
+    const int m_cg_max_iter;
+    const double m_cg_tol;
+
     const int m_nbasis_r;
     const int m_nbasis_theta;
 
@@ -245,8 +309,26 @@ private:
     host_t<FieldMem<EvalDeriv1DType, IdxRange<ThetaBasisSubset, QDimThetaMesh>>>
             m_theta_basis_vals_and_derivs;
 
+    // Copies of the basis spline values and derivatives on the device
+    FieldMem<EvalDeriv2DType, IdxRange<PolarBSplinesRTheta, QDimRMesh, QDimThetaMesh>>
+            m_singular_basis_vals_and_derivs_device;
+    FieldMem<EvalDeriv1DType, IdxRange<RBasisSubset, QDimRMesh>> m_r_basis_vals_and_derivs_device;
+    FieldMem<EvalDeriv1DType, IdxRange<ThetaBasisSubset, QDimThetaMesh>>
+            m_theta_basis_vals_and_derivs_device;
+
     FieldMem<double, IdxRangeQuadratureRTheta> m_int_volume;
 
+    // Coefficients of the weak formulation and diagonal of the matrix (matrix-free operator only)
+    FieldMem<WeakFormCoefficients, IdxRangeQuadratureRTheta> m_weak_form_coeffs;
+    Kokkos::View<double*, Kokkos::LayoutRight> m_diagonal;
+
+    // Factorised blocks of the radial-line block preconditioner
+    std::unique_ptr<MatrixBatchPdsBanded<Kokkos::DefaultExecutionSpace>> m_radial_line_blocks;
+    std::unique_ptr<MatrixBatchPdsBanded<Kokkos::DefaultExecutionSpace>> m_singular_block;
+
+    // Number of iterations of the iterative solver during the last solve
+    mutable int m_n_iterations = 0;
+
     PolarSplineEvaluator<PolarBSplinesRTheta, ddc::NullExtrapolationRule> m_polar_spline_evaluator;
     std::unique_ptr<MatrixBatchCsr<Kokkos::DefaultExecutionSpace, MatrixBatchCsrSolver::CG>>
             m_gko_matrix;
@@ -275,6 +357,21 @@ public:
      *      the equation is defined.
      * @param[in] spline_evaluator
      *      An evaluator for evaluating 2D splines on @f$(r,\theta)@f$.
+     * @param[in] operator_cache
+     *      The cache from which the assembled matrix is read if it was saved by a previous run
+     *      with the same B-splines, mapping and coefficients. Otherwise the matrix is assembled
+     *      and saved in the cache. The cache is not used with a matrix-free operator.
+     * @param[in] operator_storage
+     *      Indicates whether the matrix is assembled or whether the operator is applied
+     *      without assembling the matrix. The matrix-free operator should be preferred when
+     *      the coefficients are updated often (see update_coefficients).
+     * @param[in] preconditioner
+     *      The preconditioner of the conjugate gradient. The radial-line block preconditioner
+     *      requires fewer iterations than the Jacobi preconditioner on fine radial grids.
+     * @param[in] max_iter
+     *      The maximal number of iterations of the conjugate gradient, default 1000.
+     * @param[in] res_tol
+     *      The relative residual tolerance of the conjugate gradient, default 1e-15.
      *
      * @tparam Mapping A class describing a mapping from curvilinear coordinates to Cartesian coordinates.
      */
@@ -283,8 +380,17 @@ public:
             ConstSpline2D coeff_alpha,
             ConstSpline2D coeff_beta,
             Mapping const& mapping,
-            SplineRThetaEvaluatorNullBound const& spline_evaluator)
-        : m_nbasis_r(ddc::discrete_space<BSplinesR>().nbasis() - m_n_overlap_cells - 1)
+            SplineRThetaEvaluatorNullBound const& spline_evaluator,
+            OperatorCache const& operator_cache = OperatorCache(false),
+            OperatorStorage operator_storage = OperatorStorage::Assembled,
+            Preconditioner preconditioner = Preconditioner::Jacobi,
+            std::optional<int> max_iter = std::nullopt,
+            std::optional<double> res_tol = std::nullopt)
+        : m_operator_storage(operator_storage)
+        , m_preconditioner(preconditioner)
+        , m_cg_max_iter(max_iter.value_or(1000))
+        , m_cg_tol(res_tol.value_or(1e-15))
+        , m_nbasis_r(ddc::discrete_space<BSplinesR>().nbasis() - m_n_overlap_cells - 1)
         , m_nbasis_theta(ddc::discrete_space<BSplinesTheta>().nbasis())
         , m_matrix_size(ddc::discrete_space<PolarBSplinesRTheta>().nbasis() - m_nbasis_theta)
         , m_idxrange_fem_non_singular(
@@ -421,79 +527,104 @@ public:
             }
         });
 
-        // Number of elements in the matrix that correspond to the splines
-        // that cover the singular point
-        constexpr int n_elements_singular
-                = PolarBSplinesRTheta::n_singular_basis() * PolarBSplinesRTheta::n_singular_basis();
-        // Number of non-zero elements in the matrix corresponding to the inner product of
-        // polar splines at the singular point and the other splines
-        const int n_elements_overlap = 2
-                                       * (PolarBSplinesRTheta::n_singular_basis()
-                                          * BSplinesR::degree() * m_nbasis_theta);
-        const int n_stencil_theta
-                = m_nbasis_theta * min(int(1 + 2 * BSplinesTheta::degree()), m_nbasis_theta);
-        const int n_stencil_r = m_nbasis_r * (1 + 2 * BSplinesR::degree())
-                                - (1 + BSplinesR::degree()) * BSplinesR::degree();
-        // Number of non-zero elements in the matrix corresponding to the inner product of
-        // non-central splines. These have a tensor product structure
-        const int n_elements_stencil = n_stencil_r * n_stencil_theta;
+        m_singular_basis_vals_and_derivs_device = ddc::create_mirror_view_and_copy(
+                Kokkos::DefaultExecutionSpace(),
+                get_field(m_singular_basis_vals_and_derivs));
+        m_r_basis_vals_and_derivs_device = ddc::create_mirror_view_and_copy(
+                Kokkos::DefaultExecutionSpace(),
+                get_field(m_r_basis_vals_and_derivs));
+        m_theta_basis_vals_and_derivs_device = ddc::create_mirror_view_and_copy(
+                Kokkos::DefaultExecutionSpace(),
+                get_field(m_theta_basis_vals_and_derivs));
+
+        FieldMem<WeakFormCoefficients, IdxRangeQuadratureRTheta> weak_form_coeffs
+                = compute_weak_form_coefficients(
+                        coeff_alpha,
+                        coeff_beta,
+                        mapping,
+                        spline_evaluator);
+
+        if (m_preconditioner == Preconditioner::RadialLineBlock) {
+            setup_radial_line_blocks(get_const_field(weak_form_coeffs));
+        }
+
+        if (m_operator_storage == OperatorStorage::MatrixFree) {
+            m_weak_form_coeffs = std::move(weak_form_coeffs);
+            if (m_preconditioner == Preconditioner::Jacobi) {
+                m_diagonal = Kokkos::View<double*, Kokkos::LayoutRight>("diagonal", m_matrix_size);
+                compute_diagonal(get_const_field(m_weak_form_coeffs), m_diagonal);
+            }
+            return;
+        }
 
         const int batch_size = 1;
 
-        const int n_matrix_elements = n_elements_singular + n_elements_overlap + n_elements_stencil;
+        const int n_matrix_elements = get_n_matrix_elements();
 
         //CSR data storage
         Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::HostSpace>
                 values_csr_host("values_csr", batch_size, n_matrix_elements);
         Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::HostSpace>
                 col_idx_csr_host("idx_csr", n_matrix_elements);
-        Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace>
-                nnz_per_row_csr("nnz_per_row_csr", m_matrix_size + 1);
         Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::HostSpace>
                 nnz_per_row_csr_host("nnz_per_row_csr", m_matrix_size + 1);
 
-        m_gko_matrix = std::make_unique<MatrixBatchCsr<
-                Kokkos::DefaultExecutionSpace,
-                MatrixBatchCsrSolver::CG>>(1, m_matrix_size, n_matrix_elements);
+        m_gko_matrix = std::make_unique<
+                MatrixBatchCsr<Kokkos::DefaultExecutionSpace, MatrixBatchCsrSolver::CG>>(
+                batch_size,
+                m_matrix_size,
+                n_matrix_elements,
+                m_cg_max_iter,
+                m_cg_tol);
         auto [values, col_idx, nnz_per_row] = m_gko_matrix->get_batch_csr();
-        init_nnz_per_line(nnz_per_row);
-        Kokkos::deep_copy(nnz_per_row_csr_host, nnz_per_row);
 
-        compute_singular_elements(
-                coeff_alpha,
-                coeff_beta,
-                mapping,
-                spline_evaluator,
-                values_csr_host,
-                col_idx_csr_host,
-                nnz_per_row_csr_host);
-        compute_overlapping_singular_elements(
-                coeff_alpha,
-                coeff_beta,
-                mapping,
-                spline_evaluator,
-                values_csr_host,
-                col_idx_csr_host,
-                nnz_per_row_csr_host);
-        compute_stencil_elements(
-                coeff_alpha,
-                coeff_beta,
-                mapping,
-                spline_evaluator,
-                values_csr_host,
-                col_idx_csr_host,
-                nnz_per_row_csr_host);
+        std::uint64_t operator_key = 0;
+        bool operator_loaded = false;
+        if (operator_cache.is_active()) {
+            operator_key = get_operator_key(
+                    get_const_field(breaks_r),
+                    get_const_field(breaks_theta),
+                    get_const_field(weak_form_coeffs),
+                    n_matrix_elements);
+            operator_loaded = operator_cache.load(
+                    operator_key,
+                    values_csr_host,
+                    col_idx_csr_host,
+                    nnz_per_row_csr_host);
+        }
 
-        assert(nnz_per_row_csr_host(m_matrix_size) == n_matrix_elements);
-        Kokkos::deep_copy(values, values_csr_host);
-        Kokkos::deep_copy(col_idx, col_idx_csr_host);
-        Kokkos::deep_copy(nnz_per_row, nnz_per_row_csr_host);
-        m_gko_matrix->setup_solver();
+        if (operator_loaded) {
+            Kokkos::deep_copy(values, values_csr_host);
+            Kokkos::deep_copy(col_idx, col_idx_csr_host);
+            Kokkos::deep_copy(nnz_per_row, nnz_per_row_csr_host);
+        } else {
+            assemble_matrix(
+                    get_const_field(weak_form_coeffs),
+                    col_idx_csr_host,
+                    nnz_per_row_csr_host);
+
+            if (operator_cache.is_active()) {
+                Kokkos::deep_copy(values_csr_host, values);
+                operator_cache
+                        .save(operator_key,
+                              values_csr_host,
+                              col_idx_csr_host,
+                              nnz_per_row_csr_host);
+            }
+        }
+        // With the radial-line block preconditioner the matrix is only used to apply
+        // the operator in solve_preconditioned_cg
+        if (m_preconditioner == Preconditioner::Jacobi) {
+            m_gko_matrix->setup_solver();
+        }
     }
 
     /**
-     * @brief Computes the matrix element corresponding to the singular area.
-     *        ie: the region enclosing the O-point.
+     * @brief Update the coefficients @f$ \alpha @f$ and @f$ \beta @f$ of the equation.
+     *
+     * With a matrix-free operator only the coefficients of the weak formulation at the
+     * quadrature points and the preconditioner are recomputed. Otherwise the matrix is
+     * assembled again and the operator cache is not used.
      *
      * @param[in] coeff_alpha
      *      The spline representation of the @f$ \alpha @f$ function in the
@@ -502,291 +633,245 @@ public:
      *      The spline representation of the  @f$ \beta @f$ function in the
      *      definition of the Poisson-like equation.
      * @param[in] mapping
-     *      The mapping from the logical index range to the physical index range where
-     *      the equation is defined.
+     *      The mapping which was used to construct the solver.
      * @param[in] spline_evaluator
      *      An evaluator for evaluating 2D splines on @f$(r,\theta)@f$.
-     * @param[out] values_csr_host
-     *             A 2D Kokkos view which stores the values of non-zero elements for the whole batch.
-     * @param[out] col_idx_csr_host
-     *             A 1D Kokkos view which stores the column indices for each non-zero component.(only for one matrix).
-     * @param[inout] nnz_per_row_csr_host
-     *               A 1D Kokkos view of length matrix_size+1 which stores the count of the non-zeros along the lines of the matrix.
      */
     template <class Mapping>
-    void compute_singular_elements(
+    void update_coefficients(
             ConstSpline2D coeff_alpha,
             ConstSpline2D coeff_beta,
             Mapping const& mapping,
-            SplineRThetaEvaluatorNullBound const& spline_evaluator,
-            Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::HostSpace> const values_csr_host,
+            SplineRThetaEvaluatorNullBound const& spline_evaluator)
+    {
+        Kokkos::Profiling::pushRegion("PolarPoissonUpdateCoefficients");
+        FieldMem<WeakFormCoefficients, IdxRangeQuadratureRTheta> weak_form_coeffs
+                = compute_weak_form_coefficients(
+                        coeff_alpha,
+                        coeff_beta,
+                        mapping,
+                        spline_evaluator);
+        if (m_preconditioner == Preconditioner::RadialLineBlock) {
+            setup_radial_line_blocks(get_const_field(weak_form_coeffs));
+        }
+        if (m_operator_storage == OperatorStorage::MatrixFree) {
+            m_weak_form_coeffs = std::move(weak_form_coeffs);
+            if (m_preconditioner == Preconditioner::Jacobi) {
+                compute_diagonal(get_const_field(m_weak_form_coeffs), m_diagonal);
+            }
+        } else {
+            const int n_matrix_elements = get_n_matrix_elements();
+            Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::HostSpace>
+                    col_idx_csr_host("idx_csr", n_matrix_elements);
+            Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::HostSpace>
+                    nnz_per_row_csr_host("nnz_per_row_csr", m_matrix_size + 1);
+            // A new matrix is created as the solver cannot be set up twice
+            m_gko_matrix = std::make_unique<
+                    MatrixBatchCsr<Kokkos::DefaultExecutionSpace, MatrixBatchCsrSolver::CG>>(
+                    1,
+                    m_matrix_size,
+                    n_matrix_elements,
+                    m_cg_max_iter,
+                    m_cg_tol);
+            assemble_matrix(
+                    get_const_field(weak_form_coeffs),
+                    col_idx_csr_host,
+                    nnz_per_row_csr_host);
+            if (m_preconditioner == Preconditioner::Jacobi) {
+                m_gko_matrix->setup_solver();
+            }
+        }
+        Kokkos::Profiling::popRegion();
+    }
+
+    /**
+     * @brief Get the number of iterations needed by the conjugate gradient during the last solve.
+     *
+     * @return The number of iterations.
+     */
+    int get_n_iterations() const
+    {
+        return m_n_iterations;
+    }
+
+    /**
+     * @brief Computes the number of non-zero elements in the matrix.
+     *
+     * @return The number of non-zero elements.
+     */
+    int get_n_matrix_elements() const
+    {
+        // Number of elements in the matrix that correspond to the splines
+        // that cover the singular point
+        constexpr int n_elements_singular
+                = PolarBSplinesRTheta::n_singular_basis() * PolarBSplinesRTheta::n_singular_basis();
+        // Number of non-zero elements in the matrix corresponding to the inner product of
+        // polar splines at the singular point and the other splines
+        const int n_elements_overlap = 2
+                                       * (PolarBSplinesRTheta::n_singular_basis()
+                                          * BSplinesR::degree() * m_nbasis_theta);
+        const int n_stencil_theta
+                = m_nbasis_theta * min(int(1 + 2 * BSplinesTheta::degree()), m_nbasis_theta);
+        const int n_stencil_r = m_nbasis_r * (1 + 2 * BSplinesR::degree())
+                                - (1 + BSplinesR::degree()) * BSplinesR::degree();
+        // Number of non-zero elements in the matrix corresponding to the inner product of
+        // non-central splines. These have a tensor product structure
+        const int n_elements_stencil = n_stencil_r * n_stencil_theta;
+
+        return n_elements_singular + n_elements_overlap + n_elements_stencil;
+    }
+
+    /**
+     * @brief Fill the sparsity pattern and the values of the matrix stored in m_gko_matrix.
+     *
+     * @param[in] weak_form_coeffs
+     *      The coefficients of the weak formulation at each quadrature point.
+     * @param[out] col_idx_csr_host
+     *             A 1D Kokkos view which stores the column indices for each non-zero component.(only for one matrix)
+     * @param[out] nnz_per_row_csr_host
+     *               A 1D Kokkos view of length matrix_size+1 which stores the count of the non-zeros along the lines of the matrix.
+     */
+    void assemble_matrix(
+            ConstField<WeakFormCoefficients, IdxRangeQuadratureRTheta> weak_form_coeffs,
             Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::HostSpace> const col_idx_csr_host,
             Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::HostSpace> const nnz_per_row_csr_host)
     {
-        IdxRangeBSPolar idxrange_singular
-                = PolarBSplinesRTheta::template singular_idx_range<PolarBSplinesRTheta>();
-        IdxRangeQuadratureRTheta idxrange_quadrature_singular = m_idxrange_quadrature_singular;
+        auto [values, col_idx, nnz_per_row] = m_gko_matrix->get_batch_csr();
 
-        auto singular_basis_vals_and_derivs_alloc = ddc::create_mirror_view_and_copy(
-                Kokkos::DefaultExecutionSpace(),
-                get_field(m_singular_basis_vals_and_derivs));
-        auto r_basis_vals_and_derivs_alloc = ddc::create_mirror_view_and_copy(
-                Kokkos::DefaultExecutionSpace(),
-                get_field(m_r_basis_vals_and_derivs));
-        Field<EvalDeriv2DType, IdxRange<PolarBSplinesRTheta, QDimRMesh, QDimThetaMesh>>
-                singular_basis_vals_and_derivs = get_field(singular_basis_vals_and_derivs_alloc);
-        DField<IdxRangeQuadratureRTheta> int_volume_proxy = get_field(m_int_volume);
+        init_nnz_per_line(nnz_per_row);
+        Kokkos::deep_copy(nnz_per_row_csr_host, nnz_per_row);
 
-        Kokkos::Profiling::pushRegion("PolarPoissonFillFemMatrix");
-        // Calculate the matrix elements corresponding to the B-splines which cover the singular point
-        ddc::for_each(idxrange_singular, [&](IdxBSPolar const idx_test) {
-            ddc::for_each(idxrange_singular, [&](IdxBSPolar const idx_trial) {
-                // Calculate the weak integral
-                double const element = ddc::parallel_transform_reduce(
-                        Kokkos::DefaultExecutionSpace(),
-                        idxrange_quadrature_singular,
-                        0.0,
-                        ddc::reducer::sum<double>(),
-                        KOKKOS_LAMBDA(Idx<QDimRMesh, QDimThetaMesh> const& idx_quad) {
-                            Idx<QDimRMesh> const idx_r(idx_quad);
-                            Idx<QDimThetaMesh> const idx_theta(idx_quad);
-                            return weak_integral_element(
-                                    idx_r,
-                                    idx_theta,
-                                    singular_basis_vals_and_derivs(idx_test, idx_r, idx_theta),
-                                    singular_basis_vals_and_derivs(idx_trial, idx_r, idx_theta),
-                                    coeff_alpha,
-                                    coeff_beta,
-                                    spline_evaluator,
-                                    mapping,
-                                    int_volume_proxy);
-                        });
-                const int row_idx = idx_test - idxrange_singular.front();
-                const int col_idx = idx_trial - idxrange_singular.front();
-                const int csr_idx_singular_area = nnz_per_row_csr_host(row_idx + 1);
-                //Fill the C matrix corresponding to the splines on the singular point
-                col_idx_csr_host(csr_idx_singular_area) = col_idx;
-                values_csr_host(m_batch_idx, csr_idx_singular_area) = element;
-                nnz_per_row_csr_host(row_idx + 1)++;
-            });
-        });
+        init_sparsity_pattern(col_idx_csr_host, nnz_per_row_csr_host);
+
+        assert(std::size_t(nnz_per_row_csr_host(m_matrix_size)) == col_idx_csr_host.extent(0));
+        Kokkos::deep_copy(col_idx, col_idx_csr_host);
+        Kokkos::deep_copy(nnz_per_row, nnz_per_row_csr_host);
+
+        compute_matrix_elements(weak_form_coeffs, values, col_idx, nnz_per_row);
     }
 
     /**
-     * @brief Computes the matrix element corresponding to singular elements overlapping
-     *        with regular grid.
+     * @brief Computes a key identifying the matrix for the operator cache.
+     *
+     * The matrix is fully determined by the B-splines and by the coefficients of the weak
+     * formulation at the quadrature points. The latter depend on the mapping and on the
+     * coefficients @f$ \alpha @f$ and @f$ \beta @f$.
+     *
+     * @param[in] breaks_r The break points of the radial B-splines.
+     * @param[in] breaks_theta The break points of the poloidal B-splines.
+     * @param[in] weak_form_coeffs The coefficients of the weak formulation at each quadrature point.
+     * @param[in] n_matrix_elements The number of non-zero elements in the matrix.
+     *
+     * @return The key.
+     */
+    std::uint64_t get_operator_key(
+            host_t<ConstField<Coord<R>, IdxRange<KnotsR>>> breaks_r,
+            host_t<ConstField<Coord<Theta>, IdxRange<KnotsTheta>>> breaks_theta,
+            ConstField<WeakFormCoefficients, IdxRangeQuadratureRTheta> weak_form_coeffs,
+            int const n_matrix_elements) const
+    {
+        std::array<int, 5> const sizes {
+                int(BSplinesR::degree()),
+                int(BSplinesTheta::degree()),
+                PolarBSplinesRTheta::continuity,
+                m_matrix_size,
+                n_matrix_elements};
+        auto weak_form_coeffs_host = ddc::create_mirror_view_and_copy(weak_form_coeffs);
+
+        std::uint64_t key = OperatorCache::hash(sizes.data(), sizes.size() * sizeof(int));
+        key = OperatorCache::hash(
+                breaks_r.data_handle(),
+                breaks_r.size() * sizeof(Coord<R>),
+                key);
+        key = OperatorCache::hash(
+                breaks_theta.data_handle(),
+                breaks_theta.size() * sizeof(Coord<Theta>),
+                key);
+        key = OperatorCache::hash(
+                weak_form_coeffs_host.data_handle(),
+                weak_form_coeffs_host.size() * sizeof(WeakFormCoefficients),
+                key);
+        return key;
+    }
+
+    /**
+     * @brief Fill the column indices of the non-zero elements of the matrix.
+     *
+     * The non-zero elements of each row are the products of the test function with the
+     * trial functions whose support overlaps its support. They are stored in the following
+     * order: the B-splines which cover the singular point, then the B-splines which overlap
+     * with them, then the tensor product B-splines following a stencil.
      *
-     * @param[in] coeff_alpha
-     *      The spline representation of the @f$ \alpha @f$ function in the
-     *      definition of the Poisson-like equation.
-     * @param[in] coeff_beta
-     *      The spline representation of the  @f$ \beta @f$ function in the
-     *      definition of the Poisson-like equation.
-     * @param[in] mapping
-     *      The mapping from the logical index range to the physical index range where
-     *      the equation is defined.
-     * @param[in] spline_evaluator
-     *      An evaluator for evaluating 2D splines on @f$(r,\theta)@f$.
-     * @param[out] values_csr_host
-     *             A 2D Kokkos view which stores the values of non-zero elements for the whole batch.
      * @param[out] col_idx_csr_host
      *             A 1D Kokkos view which stores the column indices for each non-zero component.(only for one matrix)
      * @param[inout] nnz_per_row_csr_host
      *               A 1D Kokkos view of length matrix_size+1 which stores the count of the non-zeros along the lines of the matrix.
+     *               On input it must be initialised as described in init_nnz_per_line.
      */
-    template <class Mapping>
-    void compute_overlapping_singular_elements(
-            ConstSpline2D coeff_alpha,
-            ConstSpline2D coeff_beta,
-            Mapping const& mapping,
-            SplineRThetaEvaluatorNullBound const& spline_evaluator,
-            Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::HostSpace> const values_csr_host,
+    void init_sparsity_pattern(
             Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::HostSpace> const col_idx_csr_host,
             Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::HostSpace> const nnz_per_row_csr_host)
+            const
     {
-        // Create index ranges associated with the 2D splines
         IdxRangeBSPolar idxrange_singular
                 = PolarBSplinesRTheta::template singular_idx_range<PolarBSplinesRTheta>();
         IdxRangeBSR central_radial_bspline_idx_range(
                 m_idxrange_bsplines_r.take_first(IdxStep<BSplinesR> {BSplinesR::degree()}));
-
         IdxRangeBSRTheta idxrange_non_singular_near_centre(
                 central_radial_bspline_idx_range,
                 m_idxrange_bsplines_theta);
 
-        auto singular_basis_vals_and_derivs_alloc = ddc::create_mirror_view_and_copy(
-                Kokkos::DefaultExecutionSpace(),
-                get_field(m_singular_basis_vals_and_derivs));
-        auto r_basis_vals_and_derivs_alloc = ddc::create_mirror_view_and_copy(
-                Kokkos::DefaultExecutionSpace(),
-                get_field(m_r_basis_vals_and_derivs));
-        auto theta_basis_vals_and_derivs_alloc = ddc::create_mirror_view_and_copy(
-                Kokkos::DefaultExecutionSpace(),
-                get_field(m_theta_basis_vals_and_derivs));
-        DField<IdxRangeQuadratureRTheta> int_volume_proxy = get_field(m_int_volume);
-        Field<EvalDeriv2DType, IdxRange<PolarBSplinesRTheta, QDimRMesh, QDimThetaMesh>>
-                singular_basis_vals_and_derivs = get_field(singular_basis_vals_and_derivs_alloc);
-        Field<EvalDeriv1DType, IdxRange<RBasisSubset, QDimRMesh>> r_basis_vals_and_derivs
-                = get_field(r_basis_vals_and_derivs_alloc);
-        Field<EvalDeriv1DType, IdxRange<ThetaBasisSubset, QDimThetaMesh>>
-                theta_basis_vals_and_derivs = get_field(theta_basis_vals_and_derivs_alloc);
-        // Calculate the matrix elements where bspline products overlap the B-splines which cover the singular point
+        // nnz_per_row_csr_host(row_idx + 1) is the position of the next element of the row
+        auto add_element = [&](int const row_idx, int const col_idx) {
+            col_idx_csr_host(nnz_per_row_csr_host(row_idx + 1)) = col_idx;
+            nnz_per_row_csr_host(row_idx + 1)++;
+        };
+        auto add_symmetric_elements = [&](int const row_idx, int const col_idx) {
+            add_element(row_idx, col_idx);
+            if (row_idx != col_idx) {
+                add_element(col_idx, row_idx);
+            }
+        };
+
+        // The B-splines which cover the singular point
+        ddc::for_each(idxrange_singular, [&](IdxBSPolar const idx_test) {
+            ddc::for_each(idxrange_singular, [&](IdxBSPolar const idx_trial) {
+                add_element(
+                        idx_test - idxrange_singular.front(),
+                        idx_trial - idxrange_singular.front());
+            });
+        });
+
+        // The tensor product B-splines which overlap the B-splines which cover the singular point
         ddc::for_each(idxrange_singular, [&](IdxBSPolar const idx_test) {
             ddc::for_each(idxrange_non_singular_near_centre, [&](IdxBSRTheta const idx_trial) {
                 const IdxBSPolar idx_trial_polar(
                         PolarBSplinesRTheta::template get_polar_index<PolarBSplinesRTheta>(
                                 idx_trial));
-                const Idx<BSplinesR> idx_trial_r(ddc::select<BSplinesR>(idx_trial));
-                const Idx<BSplinesTheta> idx_trial_theta(ddc::select<BSplinesTheta>(idx_trial));
-
-                // Find the index range covering the cells where both the test and trial functions are non-zero
-                const Idx<RCellDim> first_overlap_element_r(
-                        idx_trial_r.uid() < BSplinesR::degree()
-                                ? 0
-                                : idx_trial_r.uid() - BSplinesR::degree());
-                const Idx<ThetaCellDim> first_overlap_element_theta(
-                        theta_mod(idx_trial_theta.uid() - BSplinesTheta::degree()));
-
-                const IdxStep<RCellDim> n_overlap_r(
-                        m_n_overlap_cells - first_overlap_element_r.uid());
-                const IdxStep<ThetaCellDim> n_overlap_theta(BSplinesTheta::degree() + 1);
-
-                const IdxRange<RCellDim> r_cells(first_overlap_element_r, n_overlap_r);
-                const IdxRange<ThetaCellDim>
-                        theta_cells(first_overlap_element_theta, n_overlap_theta);
-                const IdxRange<RCellDim, ThetaCellDim> non_zero_cells(r_cells, theta_cells);
-
-                if (n_overlap_r > 0) {
-                    double element = 0.0;
-
-                    ddc::for_each(non_zero_cells, [&](IdxCell const cell_idx) {
-                        const int cell_idx_r(ddc::select<RCellDim>(cell_idx).uid());
-                        const int cell_idx_theta(
-                                theta_mod(ddc::select<ThetaCellDim>(cell_idx).uid()));
-
-                        const IdxRangeQuadratureRTheta cell_quad_points(
-                                get_quadrature_points_in_cell(cell_idx_r, cell_idx_theta));
-                        // Find the column where the non-zero data is stored
-                        Idx<RBasisSubset> ib_trial_r(idx_trial_r.uid() - cell_idx_r);
-                        Idx<ThetaBasisSubset> ib_trial_theta(
-                                theta_mod(idx_trial_theta.uid() - cell_idx_theta));
-                        // Calculate the weak integral
-                        element += ddc::parallel_transform_reduce(
-                                Kokkos::DefaultExecutionSpace(),
-                                cell_quad_points,
-                                0.0,
-                                ddc::reducer::sum<double>(),
-                                KOKKOS_LAMBDA(IdxQuadratureRTheta const idx_quad) {
-                                    IdxQuadratureR const idx_r(idx_quad);
-                                    IdxQuadratureTheta const idx_theta(idx_quad);
-                                    return weak_integral_element<Mapping>(
-                                            idx_r,
-                                            idx_theta,
-                                            singular_basis_vals_and_derivs(
-                                                    idx_test,
-                                                    idx_r,
-                                                    idx_theta),
-                                            r_basis_vals_and_derivs(ib_trial_r, idx_r),
-                                            theta_basis_vals_and_derivs(ib_trial_theta, idx_theta),
-                                            coeff_alpha,
-                                            coeff_beta,
-                                            spline_evaluator,
-                                            mapping,
-                                            int_volume_proxy);
-                                });
-                    });
-
-                    int const row_idx = idx_test - idxrange_singular.front();
-                    int const col_idx = idx_trial_polar - idxrange_singular.front();
-                    //a_ij
-                    col_idx_csr_host(nnz_per_row_csr_host(row_idx + 1)) = col_idx;
-                    values_csr_host(m_batch_idx, nnz_per_row_csr_host(row_idx + 1)) = element;
-                    nnz_per_row_csr_host(row_idx + 1)++;
-                    //a_ji
-                    col_idx_csr_host(nnz_per_row_csr_host(col_idx + 1)) = row_idx;
-                    values_csr_host(m_batch_idx, nnz_per_row_csr_host(col_idx + 1)) = element;
-                    nnz_per_row_csr_host(col_idx + 1)++;
-                }
+                add_symmetric_elements(
+                        idx_test - idxrange_singular.front(),
+                        idx_trial_polar - idxrange_singular.front());
             });
         });
-    }
-
-    /**
-     * @brief Computes the matrix element corresponding to the regular stencil
-     *        ie: out to singular or overlapping areas.
-     *
-     * @param[in] coeff_alpha
-     *      The spline representation of the @f$ \alpha @f$ function in the
-     *      definition of the Poisson-like equation.
-     * @param[in] coeff_beta
-     *      The spline representation of the  @f$ \beta @f$ function in the
-     *      definition of the Poisson-like equation.
-     * @param[in] mapping
-     *      The mapping from the logical index range to the physical index range where
-     *      the equation is defined.
-     * @param[in] spline_evaluator
-     *      An evaluator for evaluating 2D splines on @f$(r,\theta)@f$.
-     * @param[out] values_csr_host
-     *             A 2D Kokkos view which stores the values of non-zero elements for the whole batch.
-     * @param[out] col_idx_csr_host
-     *             A 1D Kokkos view which stores the column indices for each non-zero component.(only for one matrix)
-     * @param[inout] nnz_per_row_csr_host
-     *               A 1D Kokkos view of length matrix_size+1 which stores the count of the non-zeros along the lines of the matrix.
-     */
-    template <class Mapping>
-    void compute_stencil_elements(
-            ConstSpline2D coeff_alpha,
-            ConstSpline2D coeff_beta,
-            Mapping const& mapping,
-            SplineRThetaEvaluatorNullBound const& spline_evaluator,
-            Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::HostSpace> const values_csr_host,
-            Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::HostSpace> const col_idx_csr_host,
-            Kokkos::View<int*, Kokkos::LayoutRight, Kokkos::HostSpace> const nnz_per_row_csr_host)
-    {
-        IdxRangeBSPolar idxrange_singular
-                = PolarBSplinesRTheta::template singular_idx_range<PolarBSplinesRTheta>();
 
-        // Calculate the matrix elements following a stencil
+        // The tensor product B-splines following a stencil
         ddc::for_each(m_idxrange_fem_non_singular, [&](IdxBSPolar const idx_test_polar) {
             const IdxBSRTheta idx_test(PolarBSplinesRTheta::get_2d_index(idx_test_polar));
             const std::size_t idx_test_r(ddc::select<BSplinesR>(idx_test).uid());
             const std::size_t idx_test_theta(ddc::select<BSplinesTheta>(idx_test).uid());
+            int const int_polar_idx_test = idx_test_polar - idxrange_singular.front();
 
             // Calculate the index of the elements that are already filled
             IdxRangeBSTheta remaining_theta(
                     Idx<BSplinesTheta> {idx_test_theta},
                     IdxStep<BSplinesTheta> {BSplinesTheta::degree() + 1});
             ddc::for_each(remaining_theta, [&](Idx<BSplinesTheta> const idx_trial_theta) {
-                IdxBSRTheta idx_trial(Idx<BSplinesR>(idx_test_r), idx_trial_theta);
                 IdxBSPolar idx_trial_polar(
                         PolarBSplinesRTheta::template get_polar_index<PolarBSplinesRTheta>(
                                 IdxBSRTheta(idx_test_r, theta_mod(idx_trial_theta.uid()))));
-                double element = get_matrix_stencil_element(
-                        idx_test,
-                        idx_trial,
-                        coeff_alpha,
-                        coeff_beta,
-                        spline_evaluator,
-                        mapping);
-                int const int_polar_idx_test = idx_test_polar - idxrange_singular.front();
-                if (idx_test_polar == idx_trial_polar) {
-                    const int idx = nnz_per_row_csr_host(int_polar_idx_test + 1);
-                    col_idx_csr_host(idx) = int_polar_idx_test;
-                    values_csr_host(m_batch_idx, idx) = element;
-                    nnz_per_row_csr_host(int_polar_idx_test + 1)++;
-                } else {
-                    int const int_polar_idx_trial = idx_trial_polar - idxrange_singular.front();
-
-                    const int aij_idx = nnz_per_row_csr_host(int_polar_idx_test + 1);
-                    col_idx_csr_host(aij_idx) = int_polar_idx_trial;
-                    values_csr_host(m_batch_idx, aij_idx) = element;
-                    nnz_per_row_csr_host(int_polar_idx_test + 1)++;
-
-                    const int aji_idx = nnz_per_row_csr_host(int_polar_idx_trial + 1);
-                    col_idx_csr_host(aji_idx) = int_polar_idx_test;
-                    values_csr_host(m_batch_idx, aji_idx) = element;
-                    nnz_per_row_csr_host(int_polar_idx_trial + 1)++;
-                }
+                add_symmetric_elements(
+                        int_polar_idx_test,
+                        idx_trial_polar - idxrange_singular.front());
             });
             IdxRangeBSR remaining_r(
                     ddc::select<BSplinesR>(idx_test) + 1,
@@ -807,36 +892,696 @@ public:
                 IdxBSPolar idx_trial_polar(
                         PolarBSplinesRTheta::template get_polar_index<PolarBSplinesRTheta>(
                                 IdxBSRTheta(idx_trial_r, theta_mod(idx_trial_theta))));
-                double element = get_matrix_stencil_element(
-                        idx_test,
-                        idx_trial,
-                        coeff_alpha,
-                        coeff_beta,
-                        spline_evaluator,
-                        mapping);
-                int const int_polar_idx_test = idx_test_polar - idxrange_singular.front();
-                if (idx_test_polar == idx_trial_polar) {
-                    const int idx = nnz_per_row_csr_host(int_polar_idx_test + 1);
-                    col_idx_csr_host(idx) = int_polar_idx_test;
-                    values_csr_host(m_batch_idx, idx) = element;
-                    nnz_per_row_csr_host(int_polar_idx_test + 1)++;
-                } else {
-                    int const int_polar_idx_trial = idx_trial_polar - idxrange_singular.front();
-                    const int aij_idx = nnz_per_row_csr_host(int_polar_idx_test + 1);
-                    col_idx_csr_host(aij_idx) = int_polar_idx_trial;
-                    values_csr_host(m_batch_idx, aij_idx) = element;
-                    nnz_per_row_csr_host(int_polar_idx_test + 1)++;
-
-                    const int aji_idx = nnz_per_row_csr_host(int_polar_idx_trial + 1);
-                    col_idx_csr_host(aji_idx) = int_polar_idx_test;
-                    values_csr_host(m_batch_idx, aji_idx) = element;
-                    nnz_per_row_csr_host(int_polar_idx_trial + 1)++;
-                }
+                add_symmetric_elements(
+                        int_polar_idx_test,
+                        idx_trial_polar - idxrange_singular.front());
             });
         });
+    }
+
+    /**
+     * @brief Computes the coefficients of the weak formulation at each quadrature point.
+     *
+     * @param[in] coeff_alpha
+     *      The spline representation of the @f$ \alpha @f$ function in the
+     *      definition of the Poisson-like equation.
+     * @param[in] coeff_beta
+     *      The spline representation of the  @f$ \beta @f$ function in the
+     *      definition of the Poisson-like equation.
+     * @param[in] mapping
+     *      The mapping from the logical index range to the physical index range where
+     *      the equation is defined.
+     * @param[in] spline_evaluator
+     *      An evaluator for evaluating 2D splines on @f$(r,\theta)@f$.
+     * @return
+     *      The coefficients of the weak formulation multiplied by the quadrature weights.
+     */
+    template <class Mapping>
+    FieldMem<WeakFormCoefficients, IdxRangeQuadratureRTheta> compute_weak_form_coefficients(
+            ConstSpline2D coeff_alpha,
+            ConstSpline2D coeff_beta,
+            Mapping const& mapping,
+            SplineRThetaEvaluatorNullBound const& spline_evaluator) const
+    {
+        IdxRangeQuadratureRTheta const
+                idxrange_quadrature(m_idxrange_quadrature_r, m_idxrange_quadrature_theta);
+        FieldMem<WeakFormCoefficients, IdxRangeQuadratureRTheta> weak_form_coeffs_alloc(
+                idxrange_quadrature);
+        Field<WeakFormCoefficients, IdxRangeQuadratureRTheta> weak_form_coeffs
+                = get_field(weak_form_coeffs_alloc);
+        DConstField<IdxRangeQuadratureRTheta> int_volume = get_const_field(m_int_volume);
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                idxrange_quadrature,
+                KOKKOS_LAMBDA(IdxQuadratureRTheta const idx_quad) {
+                    const CoordRTheta coord(ddc::coordinate(idx_quad));
+                    MetricTensorEvaluator<Mapping, CoordRTheta> get_metric_tensor(mapping);
+                    double const alpha = spline_evaluator(coord, coeff_alpha);
+                    double const beta = spline_evaluator(coord, coeff_beta);
+                    weak_form_coeffs(idx_quad).alpha_inv_metric
+                            = get_metric_tensor.inverse(coord) * (alpha * int_volume(idx_quad));
+                    weak_form_coeffs(idx_quad).beta = beta * int_volume(idx_quad);
+                });
+        return weak_form_coeffs_alloc;
+    }
 
+    /**
+     * @brief Computes the values of the non-zero elements of the matrix.
+     *
+     * Each row of the matrix is assembled by a team of threads. Each non-zero element of the
+     * row is computed independently by gathering the contributions of the cells where the
+     * supports of the test and trial functions overlap. No synchronisation is therefore
+     * required between the threads.
+     *
+     * @param[in] weak_form_coeffs
+     *      The coefficients of the weak formulation at each quadrature point.
+     * @param[out] values_csr
+     *             A 2D Kokkos view which stores the values of non-zero elements for the whole batch.
+     * @param[in] col_idx_csr
+     *             A 1D Kokkos view which stores the column indices for each non-zero component.(only for one matrix)
+     * @param[in] nnz_per_row_csr
+     *               A 1D Kokkos view of length matrix_size+1 which stores the count of the non-zeros along the lines of the matrix.
+     */
+    void compute_matrix_elements(
+            ConstField<WeakFormCoefficients, IdxRangeQuadratureRTheta> weak_form_coeffs,
+            Kokkos::View<double**, Kokkos::LayoutRight> const values_csr,
+            Kokkos::View<int*, Kokkos::LayoutRight> const col_idx_csr,
+            Kokkos::View<int*, Kokkos::LayoutRight> const nnz_per_row_csr) const
+    {
+        Kokkos::Profiling::pushRegion("PolarPoissonFillFemMatrix");
+        ConstField<EvalDeriv2DType, IdxRange<PolarBSplinesRTheta, QDimRMesh, QDimThetaMesh>>
+                singular_basis_vals_and_derivs
+                = get_const_field(m_singular_basis_vals_and_derivs_device);
+        ConstField<EvalDeriv1DType, IdxRange<RBasisSubset, QDimRMesh>> r_basis_vals_and_derivs
+                = get_const_field(m_r_basis_vals_and_derivs_device);
+        ConstField<EvalDeriv1DType, IdxRange<ThetaBasisSubset, QDimThetaMesh>>
+                theta_basis_vals_and_derivs = get_const_field(m_theta_basis_vals_and_derivs_device);
+
+        IdxRangeBSPolar const idxrange_singular
+                = PolarBSplinesRTheta::template singular_idx_range<PolarBSplinesRTheta>();
+        IdxRangeQuadratureRTheta const idxrange_quadrature_singular
+                = m_idxrange_quadrature_singular;
+        int const batch_idx = m_batch_idx;
+
+        Kokkos::parallel_for(
+                "PolarPoissonAssembleRows",
+                Kokkos::TeamPolicy<>(m_matrix_size, Kokkos::AUTO),
+                KOKKOS_LAMBDA(const Kokkos::TeamPolicy<>::member_type& team) {
+                    const int row_idx = team.league_rank();
+                    Kokkos::parallel_for(
+                            Kokkos::TeamThreadRange(
+                                    team,
+                                    nnz_per_row_csr(row_idx),
+                                    nnz_per_row_csr(row_idx + 1)),
+                            [&](int const csr_idx) {
+                                values_csr(batch_idx, csr_idx) = get_matrix_element(
+                                        idxrange_singular.front() + row_idx,
+                                        idxrange_singular.front() + col_idx_csr(csr_idx),
+                                        idxrange_singular,
+                                        idxrange_quadrature_singular,
+                                        singular_basis_vals_and_derivs,
+                                        r_basis_vals_and_derivs,
+                                        theta_basis_vals_and_derivs,
+                                        weak_form_coeffs);
+                            });
+                });
         Kokkos::Profiling::popRegion();
     }
+
+    /**
+     * @brief Computes the diagonal of the matrix.
+     *
+     * The diagonal is used as a Jacobi preconditioner when the operator is matrix-free.
+     *
+     * @param[in] weak_form_coeffs
+     *      The coefficients of the weak formulation at each quadrature point.
+     * @param[out] diagonal
+     *      The diagonal elements of the matrix.
+     */
+    void compute_diagonal(
+            ConstField<WeakFormCoefficients, IdxRangeQuadratureRTheta> weak_form_coeffs,
+            Kokkos::View<double*, Kokkos::LayoutRight> const diagonal) const
+    {
+        ConstField<EvalDeriv2DType, IdxRange<PolarBSplinesRTheta, QDimRMesh, QDimThetaMesh>>
+                singular_basis_vals_and_derivs
+                = get_const_field(m_singular_basis_vals_and_derivs_device);
+        ConstField<EvalDeriv1DType, IdxRange<RBasisSubset, QDimRMesh>> r_basis_vals_and_derivs
+                = get_const_field(m_r_basis_vals_and_derivs_device);
+        ConstField<EvalDeriv1DType, IdxRange<ThetaBasisSubset, QDimThetaMesh>>
+                theta_basis_vals_and_derivs = get_const_field(m_theta_basis_vals_and_derivs_device);
+
+        IdxRangeBSPolar const idxrange_singular
+                = PolarBSplinesRTheta::template singular_idx_range<PolarBSplinesRTheta>();
+        IdxRangeQuadratureRTheta const idxrange_quadrature_singular
+                = m_idxrange_quadrature_singular;
+
+        Kokkos::parallel_for(
+                "PolarPoissonDiagonal",
+                Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, m_matrix_size),
+                KOKKOS_LAMBDA(const int row_idx) {
+                    IdxBSPolar const idx = idxrange_singular.front() + row_idx;
+                    diagonal(row_idx) = get_matrix_element(
+                            idx,
+                            idx,
+                            idxrange_singular,
+                            idxrange_quadrature_singular,
+                            singular_basis_vals_and_derivs,
+                            r_basis_vals_and_derivs,
+                            theta_basis_vals_and_derivs,
+                            weak_form_coeffs);
+                });
+    }
+
+    /**
+     * @brief Computes and factorises the blocks of the radial-line block preconditioner.
+     *
+     * The unknowns which do not cover the singular point are ordered radial line by radial
+     * line. The block associated with a poloidal index j contains the elements of the matrix
+     * coupling the B-splines @f$ b_{i,r} b_{j,\theta} @f$ and @f$ b_{i',r} b_{j,\theta} @f$. It is
+     * banded as these B-splines do not overlap if @f$ |i-i'| > d_r @f$. The elements coupling
+     * the B-splines covering the singular point form a dense block.
+     *
+     * @param[in] weak_form_coeffs
+     *      The coefficients of the weak formulation at each quadrature point.
+     */
+    void setup_radial_line_blocks(
+            ConstField<WeakFormCoefficients, IdxRangeQuadratureRTheta> weak_form_coeffs)
+    {
+        using BandsView = MatrixBatchPdsBanded<Kokkos::DefaultExecutionSpace>::DKokkosView3D;
+
+        ConstField<EvalDeriv2DType, IdxRange<PolarBSplinesRTheta, QDimRMesh, QDimThetaMesh>>
+                singular_basis_vals_and_derivs
+                = get_const_field(m_singular_basis_vals_and_derivs_device);
+        ConstField<EvalDeriv1DType, IdxRange<RBasisSubset, QDimRMesh>> r_basis_vals_and_derivs
+                = get_const_field(m_r_basis_vals_and_derivs_device);
+        ConstField<EvalDeriv1DType, IdxRange<ThetaBasisSubset, QDimThetaMesh>>
+                theta_basis_vals_and_derivs = get_const_field(m_theta_basis_vals_and_derivs_device);
+
+        IdxRangeBSPolar const idxrange_singular
+                = PolarBSplinesRTheta::template singular_idx_range<PolarBSplinesRTheta>();
+        IdxRangeQuadratureRTheta const idxrange_quadrature_singular
+                = m_idxrange_quadrature_singular;
+        int const n_singular = idxrange_singular.size();
+        int const nbasis_theta = m_nbasis_theta;
+        int const n_bands = BSplinesR::degree();
+
+        BandsView line_bands("radial_line_bands", m_nbasis_theta, m_nbasis_r, n_bands + 1);
+        Kokkos::parallel_for(
+                "PolarPoissonRadialLineBlocks",
+                Kokkos::MDRangePolicy<Kokkos::DefaultExecutionSpace, Kokkos::Rank<3>>(
+                        {0, 0, 0},
+                        {m_nbasis_theta, m_nbasis_r, n_bands + 1}),
+                KOKKOS_LAMBDA(const int idx_theta, const int idx_r, const int band) {
+                    if (idx_r < band) {
+                        line_bands(idx_theta, idx_r, band) = 0.0;
+                        return;
+                    }
+                    IdxBSPolar const idx_test = idxrange_singular.front() + n_singular
+                                                + idx_r * nbasis_theta + idx_theta;
+                    IdxBSPolar const idx_trial = idx_test - band * nbasis_theta;
+                    line_bands(idx_theta, idx_r, band) = get_matrix_element(
+                            idx_test,
+                            idx_trial,
+                            idxrange_singular,
+                            idxrange_quadrature_singular,
+                            singular_basis_vals_and_derivs,
+                            r_basis_vals_and_derivs,
+                            theta_basis_vals_and_derivs,
+                            weak_form_coeffs);
+                });
+
+        BandsView singular_bands("singular_bands", 1, n_singular, n_singular);
+        Kokkos::parallel_for(
+                "PolarPoissonSingularBlock",
+                Kokkos::MDRangePolicy<Kokkos::DefaultExecutionSpace, Kokkos::Rank<2>>(
+                        {0, 0},
+                        {n_singular, n_singular}),
+                KOKKOS_LAMBDA(const int row_idx, const int band) {
+                    if (row_idx < band) {
+                        singular_bands(0, row_idx, band) = 0.0;
+                        return;
+                    }
+                    IdxBSPolar const idx_test = idxrange_singular.front() + row_idx;
+                    singular_bands(0, row_idx, band) = get_matrix_element(
+                            idx_test,
+                            idx_test - band,
+                            idxrange_singular,
+                            idxrange_quadrature_singular,
+                            singular_basis_vals_and_derivs,
+                            r_basis_vals_and_derivs,
+                            theta_basis_vals_and_derivs,
+                            weak_form_coeffs);
+                });
+
+        m_radial_line_blocks = std::make_unique<MatrixBatchPdsBanded<
+                Kokkos::DefaultExecutionSpace>>(m_nbasis_theta, m_nbasis_r, n_bands, line_bands);
+        m_radial_line_blocks->setup_solver();
+        m_singular_block = std::make_unique<MatrixBatchPdsBanded<
+                Kokkos::DefaultExecutionSpace>>(1, n_singular, n_singular - 1, singular_bands);
+        m_singular_block->setup_solver();
+    }
+
+    /**
+     * @brief Applies the preconditioner of the conjugate gradient.
+     *
+     * @param[out] z The preconditioned residual.
+     * @param[in] residual The residual.
+     * @param[out] line_rhs A work array of size (number of poloidal B-splines, number of radial
+     *              B-splines) used by the radial-line block preconditioner.
+     * @param[out] singular_rhs A work array of size (1, number of B-splines covering the singular
+     *              point) used by the radial-line block preconditioner.
+     */
+    void apply_preconditioner(
+            Kokkos::View<double*, Kokkos::LayoutRight> const z,
+            Kokkos::View<double*, Kokkos::LayoutRight> const residual,
+            Kokkos::View<double**, Kokkos::LayoutRight> const line_rhs,
+            Kokkos::View<double**, Kokkos::LayoutRight> const singular_rhs) const
+    {
+        Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace> const policy(0, m_matrix_size);
+        if (m_preconditioner == Preconditioner::Jacobi) {
+            Kokkos::View<double*, Kokkos::LayoutRight> const diagonal = m_diagonal;
+            Kokkos::parallel_for(
+                    "PolarPoissonJacobiPreconditioner",
+                    policy,
+                    KOKKOS_LAMBDA(const int i) { z(i) = residual(i) / diagonal(i); });
+            return;
+        }
+
+        int const n_singular = PolarBSplinesRTheta::n_singular_basis();
+        int const nbasis_theta = m_nbasis_theta;
+        Kokkos::parallel_for(
+                "PolarPoissonGatherRadialLines",
+                policy,
+                KOKKOS_LAMBDA(const int i) {
+                    if (i < n_singular) {
+                        singular_rhs(0, i) = residual(i);
+                    } else {
+                        const int line_idx = i - n_singular;
+                        line_rhs(line_idx % nbasis_theta, line_idx / nbasis_theta) = residual(i);
+                    }
+                });
+        m_singular_block->solve(singular_rhs);
+        m_radial_line_blocks->solve(line_rhs);
+        Kokkos::parallel_for(
+                "PolarPoissonScatterRadialLines",
+                policy,
+                KOKKOS_LAMBDA(const int i) {
+                    if (i < n_singular) {
+                        z(i) = singular_rhs(0, i);
+                    } else {
+                        const int line_idx = i - n_singular;
+                        z(i) = line_rhs(line_idx % nbasis_theta, line_idx / nbasis_theta);
+                    }
+                });
+    }
+
+    /**
+     * @brief Multiplies a vector by the assembled matrix.
+     *
+     * @param[out] y The product of the matrix with x.
+     * @param[in] x The coefficients of the polar B-splines.
+     */
+    void apply_assembled_operator(
+            Kokkos::View<double*, Kokkos::LayoutRight> const y,
+            Kokkos::View<double*, Kokkos::LayoutRight> const x) const
+    {
+        Kokkos::View<double**, Kokkos::LayoutRight> values;
+        Kokkos::View<int*, Kokkos::LayoutRight> col_idx;
+        Kokkos::View<int*, Kokkos::LayoutRight> nnz_per_row;
+        std::tie(values, col_idx, nnz_per_row) = m_gko_matrix->get_batch_csr();
+        int const batch_idx = m_batch_idx;
+        Kokkos::parallel_for(
+                "PolarPoissonApplyAssembledOperator",
+                Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, m_matrix_size),
+                KOKKOS_LAMBDA(const int row_idx) {
+                    double result = 0.0;
+                    for (int k = nnz_per_row(row_idx); k < nnz_per_row(row_idx + 1); ++k) {
+                        result += values(batch_idx, k) * x(col_idx(k));
+                    }
+                    y(row_idx) = result;
+                });
+    }
+
+    /**
+     * @brief Applies the operator of the linear system to a vector without assembling the matrix.
+     *
+     * The operator is applied in two steps:
+     * 1. The function represented by the coefficients and its gradient are evaluated at the
+     *    quadrature points of each cell. The tensor product structure of the B-splines is used
+     *    to contract the coefficients in the poloidal direction then in the radial direction
+     *    (sum factorisation). The few B-splines covering the singular point are treated
+     *    separately using their values at the quadrature points of the central cells. The
+     *    results are multiplied by the coefficients of the weak formulation.
+     * 2. The result of the first step is tested against each basis function by gathering the
+     *    contributions of the quadrature points in its support. Each element of the output is
+     *    computed independently by a team of threads so no synchronisation is required.
+     *
+     * @param[out] y The product of the matrix with x.
+     * @param[in] x The coefficients of the polar B-splines.
+     * @param[out] integrand A work array used to store the result of the first step.
+     */
+    void apply_operator(
+            Kokkos::View<double*, Kokkos::LayoutRight> const y,
+            Kokkos::View<double*, Kokkos::LayoutRight> const x,
+            Field<WeakFormIntegrand, IdxRangeQuadratureRTheta> integrand) const
+    {
+        ConstField<EvalDeriv2DType, IdxRange<PolarBSplinesRTheta, QDimRMesh, QDimThetaMesh>>
+                singular_basis_vals_and_derivs
+                = get_const_field(m_singular_basis_vals_and_derivs_device);
+        ConstField<EvalDeriv1DType, IdxRange<RBasisSubset, QDimRMesh>> r_basis_vals_and_derivs
+                = get_const_field(m_r_basis_vals_and_derivs_device);
+        ConstField<EvalDeriv1DType, IdxRange<ThetaBasisSubset, QDimThetaMesh>>
+                theta_basis_vals_and_derivs = get_const_field(m_theta_basis_vals_and_derivs_device);
+        ConstField<WeakFormCoefficients, IdxRangeQuadratureRTheta> weak_form_coeffs
+                = get_const_field(m_weak_form_coeffs);
+
+        IdxRangeBSPolar const idxrange_singular
+                = PolarBSplinesRTheta::template singular_idx_range<PolarBSplinesRTheta>();
+        IdxRangeQuadratureRTheta const idxrange_quadrature_singular
+                = m_idxrange_quadrature_singular;
+        int const nbasis_r = m_nbasis_r;
+        int const ncells_r = ddc::discrete_space<BSplinesR>().ncells();
+        int const ncells_theta = ddc::discrete_space<BSplinesTheta>().ncells();
+        constexpr int n_bases_r = BSplinesR::degree() + 1;
+        constexpr int n_bases_theta = BSplinesTheta::degree() + 1;
+
+        // Evaluate the weak formulation at the quadrature points of each cell
+        IdxRange<RCellDim, ThetaCellDim> const cells(
+                IdxCell(0, 0),
+                IdxStep<RCellDim, ThetaCellDim>(ncells_r, ncells_theta));
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                cells,
+                KOKKOS_LAMBDA(IdxCell const cell_idx) {
+                    const int cell_idx_r(ddc::select<RCellDim>(cell_idx).uid());
+                    const int cell_idx_theta(ddc::select<ThetaCellDim>(cell_idx).uid());
+                    const IdxRangeQuadratureRTheta cell_quad_points(
+                            get_quadrature_points_in_cell(cell_idx_r, cell_idx_theta));
+                    const IdxRangeQuadratureR quad_points_r(
+                            ddc::select<QDimRMesh>(cell_quad_points));
+                    const IdxRangeQuadratureTheta quad_points_theta(
+                            ddc::select<QDimThetaMesh>(cell_quad_points));
+
+                    // The coefficients of the tensor product B-splines which are non-zero on
+                    // the cell. The B-splines replaced by the B-splines covering the singular
+                    // point and the B-splines on the Dirichlet boundary are not unknowns.
+                    double coeffs[n_bases_r][n_bases_theta];
+                    for (int ib_r = 0; ib_r < n_bases_r; ++ib_r) {
+                        const int idx_r = cell_idx_r + ib_r;
+                        const int idx_unknown_r = idx_r - m_n_overlap_cells;
+                        const bool is_unknown = idx_unknown_r >= 0 && idx_unknown_r < nbasis_r;
+                        for (int ib_theta = 0; ib_theta < n_bases_theta; ++ib_theta) {
+                            coeffs[ib_r][ib_theta] = 0.0;
+                            if (is_unknown) {
+                                const IdxBSPolar idx_polar(
+                                        PolarBSplinesRTheta::template get_polar_index<
+                                                PolarBSplinesRTheta>(IdxBSRTheta(
+                                                idx_r,
+                                                theta_mod(cell_idx_theta + ib_theta))));
+                                const int row_idx = idx_polar - idxrange_singular.front();
+                                coeffs[ib_r][ib_theta] = x(row_idx);
+                            }
+                        }
+                    }
+
+                    // Contract the coefficients in the poloidal direction
+                    double coeffs_theta[n_bases_r][s_n_gauss_legendre_theta];
+                    double coeffs_dtheta[n_bases_r][s_n_gauss_legendre_theta];
+                    for (int ib_r = 0; ib_r < n_bases_r; ++ib_r) {
+                        for (IdxQuadratureTheta const idx_theta : quad_points_theta) {
+                            const int iq_theta = idx_theta - quad_points_theta.front();
+                            coeffs_theta[ib_r][iq_theta] = 0.0;
+                            coeffs_dtheta[ib_r][iq_theta] = 0.0;
+                            for (int ib_theta = 0; ib_theta < n_bases_theta; ++ib_theta) {
+                                EvalDeriv1DType const& theta_basis = theta_basis_vals_and_derivs(
+                                        Idx<ThetaBasisSubset>(ib_theta),
+                                        idx_theta);
+                                coeffs_theta[ib_r][iq_theta]
+                                        += coeffs[ib_r][ib_theta] * theta_basis.value;
+                                coeffs_dtheta[ib_r][iq_theta]
+                                        += coeffs[ib_r][ib_theta] * theta_basis.derivative;
+                            }
+                        }
+                    }
+
+                    // Contract the coefficients in the radial direction
+                    for (IdxQuadratureR const idx_r : quad_points_r) {
+                        for (IdxQuadratureTheta const idx_theta : quad_points_theta) {
+                            const int iq_theta = idx_theta - quad_points_theta.front();
+                            double value = 0.0;
+                            double deriv_r = 0.0;
+                            double deriv_theta = 0.0;
+                            for (int ib_r = 0; ib_r < n_bases_r; ++ib_r) {
+                                EvalDeriv1DType const& r_basis
+                                        = r_basis_vals_and_derivs(Idx<RBasisSubset>(ib_r), idx_r);
+                                value += r_basis.value * coeffs_theta[ib_r][iq_theta];
+                                deriv_r += r_basis.derivative * coeffs_theta[ib_r][iq_theta];
+                                deriv_theta += r_basis.value * coeffs_dtheta[ib_r][iq_theta];
+                            }
+                            if (cell_idx_r < m_n_overlap_cells) {
+                                for (IdxBSPolar const idx_singular : idxrange_singular) {
+                                    EvalDeriv2DType const& basis = singular_basis_vals_and_derivs(
+                                            idx_singular,
+                                            idx_r,
+                                            idx_theta);
+                                    const int row_idx = idx_singular - idxrange_singular.front();
+                                    value += x(row_idx) * basis.value;
+                                    deriv_r += x(row_idx)
+                                               * ddcHelper::get<R_cov>(basis.derivative);
+                                    deriv_theta += x(row_idx)
+                                                   * ddcHelper::get<Theta_cov>(basis.derivative);
+                                }
+                            }
+                            DVector<R_cov, Theta_cov> const gradient(deriv_r, deriv_theta);
+                            WeakFormCoefficients const& coeffs_quad
+                                    = weak_form_coeffs(idx_r, idx_theta);
+                            integrand(idx_r, idx_theta).value = coeffs_quad.beta * value;
+                            integrand(idx_r, idx_theta).flux = tensor_mul(
+                                    index<'i', 'j'>(coeffs_quad.alpha_inv_metric),
+                                    index<'j'>(gradient));
+                        }
+                    }
+                });
+
+        // Test against each basis function
+        int const n_quad_theta = ddc::select<QDimThetaMesh>(idxrange_quadrature_singular).size();
+        int const n_quad_singular = idxrange_quadrature_singular.size();
+        Kokkos::parallel_for(
+                "PolarPoissonApplyOperator",
+                Kokkos::TeamPolicy<>(m_matrix_size, Kokkos::AUTO),
+                KOKKOS_LAMBDA(const Kokkos::TeamPolicy<>::member_type& team) {
+                    const int row_idx = team.league_rank();
+                    const IdxBSPolar idx_test = idxrange_singular.front() + row_idx;
+                    double result = 0.0;
+                    if (idx_test <= idxrange_singular.back()) {
+                        Kokkos::parallel_reduce(
+                                Kokkos::TeamThreadRange(team, n_quad_singular),
+                                [&](int const iq, double& sum) {
+                                    const IdxQuadratureRTheta idx_quad(
+                                            idxrange_quadrature_singular.front()
+                                            + IdxStep<QDimRMesh, QDimThetaMesh>(
+                                                    iq / n_quad_theta,
+                                                    iq % n_quad_theta));
+                                    EvalDeriv2DType const& test
+                                            = singular_basis_vals_and_derivs(idx_test, idx_quad);
+                                    WeakFormIntegrand const& terms = integrand(idx_quad);
+                                    sum += test.value * terms.value
+                                           + tensor_mul(
+                                                   index<'i'>(test.derivative),
+                                                   index<'i'>(terms.flux));
+                                },
+                                result);
+                    } else {
+                        const IdxBSRTheta idx_test_2d(PolarBSplinesRTheta::get_2d_index(idx_test));
+                        const int idx_test_r(ddc::select<BSplinesR>(idx_test_2d).uid());
+                        const int idx_test_theta(ddc::select<BSplinesTheta>(idx_test_2d).uid());
+                        // Each thread treats one of the cells where the test function is non-zero
+                        Kokkos::parallel_reduce(
+                                Kokkos::TeamThreadRange(team, n_bases_r * n_bases_theta),
+                                [&](int const cell_offset, double& sum) {
+                                    const int ib_r = cell_offset / n_bases_theta;
+                                    const int ib_theta = cell_offset % n_bases_theta;
+                                    const int cell_idx_r = idx_test_r - ib_r;
+                                    if (cell_idx_r < 0 || cell_idx_r >= ncells_r) {
+                                        return;
+                                    }
+                                    const IdxRangeQuadratureRTheta cell_quad_points(
+                                            get_quadrature_points_in_cell(
+                                                    cell_idx_r,
+                                                    theta_mod(idx_test_theta - ib_theta)));
+                                    for (IdxQuadratureR const idx_r :
+                                         ddc::select<QDimRMesh>(cell_quad_points)) {
+                                        // Contract in the poloidal direction
+                                        double value = 0.0;
+                                        double flux_r = 0.0;
+                                        double flux_theta = 0.0;
+                                        for (IdxQuadratureTheta const idx_theta :
+                                             ddc::select<QDimThetaMesh>(cell_quad_points)) {
+                                            EvalDeriv1DType const& theta_basis
+                                                    = theta_basis_vals_and_derivs(
+                                                            Idx<ThetaBasisSubset>(ib_theta),
+                                                            idx_theta);
+                                            WeakFormIntegrand const& terms
+                                                    = integrand(idx_r, idx_theta);
+                                            value += theta_basis.value * terms.value;
+                                            flux_r += theta_basis.value
+                                                      * ddcHelper::get<R>(terms.flux);
+                                            flux_theta += theta_basis.derivative
+                                                          * ddcHelper::get<Theta>(terms.flux);
+                                        }
+                                        // Contract in the radial direction
+                                        EvalDeriv1DType const& r_basis = r_basis_vals_and_derivs(
+                                                Idx<RBasisSubset>(ib_r),
+                                                idx_r);
+                                        sum += r_basis.value * (value + flux_theta)
+                                               + r_basis.derivative * flux_r;
+                                    }
+                                },
+                                result);
+                    }
+                    Kokkos::single(Kokkos::PerTeam(team), [&]() { y(row_idx) = result; });
+                });
+    }
+
+    /**
+     * @brief Solve the linear system with a preconditioned conjugate gradient method.
+     *
+     * This method is used with the matrix-free operator or with the radial-line block
+     * preconditioner. Otherwise the conjugate gradient of Ginkgo is used.
+     * The stopping criterion is the same as the one used by MatrixBatchCsr:
+     * @f$ ||Ax-b|| < tol ||b|| @f$ where the residual is computed by recurrence.
+     *
+     * @param[inout] x A 2D Kokkos::View storing the initial guess and receiving the solution.
+     * @param[in] b A 2D Kokkos::View storing the right-hand side.
+     */
+    void solve_preconditioned_cg(
+            Kokkos::View<double**, Kokkos::LayoutRight> const x,
+            Kokkos::View<double**, Kokkos::LayoutRight> const b) const
+    {
+        Kokkos::View<double*, Kokkos::LayoutRight> solution("solution", m_matrix_size);
+        Kokkos::View<double*, Kokkos::LayoutRight> residual("residual", m_matrix_size);
+        Kokkos::View<double*, Kokkos::LayoutRight> precond_residual("z", m_matrix_size);
+        Kokkos::View<double*, Kokkos::LayoutRight> direction("p", m_matrix_size);
+        Kokkos::View<double*, Kokkos::LayoutRight> operator_direction("Ap", m_matrix_size);
+        // The integrand is only needed to apply the matrix-free operator
+        FieldMem<WeakFormIntegrand, IdxRangeQuadratureRTheta> integrand_alloc(
+                m_operator_storage == OperatorStorage::MatrixFree
+                        ? get_idx_range(m_weak_form_coeffs)
+                        : IdxRangeQuadratureRTheta());
+        Field<WeakFormIntegrand, IdxRangeQuadratureRTheta> integrand = get_field(integrand_alloc);
+        Kokkos::View<double**, Kokkos::LayoutRight> line_rhs;
+        Kokkos::View<double**, Kokkos::LayoutRight> singular_rhs;
+        if (m_preconditioner == Preconditioner::RadialLineBlock) {
+            int const n_singular = PolarBSplinesRTheta::n_singular_basis();
+            line_rhs = Kokkos::View<double**, Kokkos::LayoutRight>(
+                    "line_rhs",
+                    m_nbasis_theta,
+                    m_nbasis_r);
+            singular_rhs = Kokkos::View<double**, Kokkos::LayoutRight>("singular_rhs", 1, n_singular);
+        }
+        int const batch_idx = m_batch_idx;
+        Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace> const policy(0, m_matrix_size);
+
+        auto apply = [&](Kokkos::View<double*, Kokkos::LayoutRight> const y,
+                         Kokkos::View<double*, Kokkos::LayoutRight> const vec) {
+            if (m_operator_storage == OperatorStorage::MatrixFree) {
+                apply_operator(y, vec, integrand);
+            } else {
+                apply_assembled_operator(y, vec);
+            }
+        };
+
+        Kokkos::deep_copy(solution, Kokkos::subview(x, batch_idx, Kokkos::ALL));
+
+        m_n_iterations = 0;
+        double norm_b_squared = 0.0;
+        Kokkos::parallel_reduce(
+                "PolarPoissonCGNormRHS",
+                policy,
+                KOKKOS_LAMBDA(const int i, double& sum) {
+                    sum += b(batch_idx, i) * b(batch_idx, i);
+                },
+                norm_b_squared);
+        if (norm_b_squared == 0.0) {
+            Kokkos::deep_copy(Kokkos::subview(x, batch_idx, Kokkos::ALL), 0.0);
+            return;
+        }
+        double const tol_squared = m_cg_tol * m_cg_tol * norm_b_squared;
+
+        // r = b - Ax, z = P^{-1} r, p = z
+        apply(operator_direction, solution);
+        double residual_norm_squared = 0.0;
+        Kokkos::parallel_reduce(
+                "PolarPoissonCGInit",
+                policy,
+                KOKKOS_LAMBDA(const int i, double& rr) {
+                    residual(i) = b(batch_idx, i) - operator_direction(i);
+                    rr += residual(i) * residual(i);
+                },
+                residual_norm_squared);
+        apply_preconditioner(precond_residual, residual, line_rhs, singular_rhs);
+        double residual_dot_precond = 0.0;
+        Kokkos::parallel_reduce(
+                "PolarPoissonCGInitDirection",
+                policy,
+                KOKKOS_LAMBDA(const int i, double& rz) {
+                    direction(i) = precond_residual(i);
+                    rz += residual(i) * precond_residual(i);
+                },
+                residual_dot_precond);
+
+        int iter = 0;
+        while (residual_norm_squared > tol_squared && iter < m_cg_max_iter) {
+            apply(operator_direction, direction);
+            double direction_norm_operator = 0.0;
+            Kokkos::parallel_reduce(
+                    "PolarPoissonCGCurvature",
+                    policy,
+                    KOKKOS_LAMBDA(const int i, double& sum) {
+                        sum += direction(i) * operator_direction(i);
+                    },
+                    direction_norm_operator);
+            double const alpha = residual_dot_precond / direction_norm_operator;
+
+            Kokkos::parallel_reduce(
+                    "PolarPoissonCGUpdate",
+                    policy,
+                    KOKKOS_LAMBDA(const int i, double& rr) {
+                        solution(i) += alpha * direction(i);
+                        residual(i) -= alpha * operator_direction(i);
+                        rr += residual(i) * residual(i);
+                    },
+                    residual_norm_squared);
+            apply_preconditioner(precond_residual, residual, line_rhs, singular_rhs);
+            double new_residual_dot_precond = 0.0;
+            Kokkos::parallel_reduce(
+                    "PolarPoissonCGPreconditionedNorm",
+                    policy,
+                    KOKKOS_LAMBDA(const int i, double& rz) {
+                        rz += residual(i) * precond_residual(i);
+                    },
+                    new_residual_dot_precond);
+
+            double const beta = new_residual_dot_precond / residual_dot_precond;
+            residual_dot_precond = new_residual_dot_precond;
+            Kokkos::parallel_for(
+                    "PolarPoissonCGDirection",
+                    policy,
+                    KOKKOS_LAMBDA(const int i) {
+                        direction(i) = precond_residual(i) + beta * direction(i);
+                    });
+            ++iter;
+        }
+        m_n_iterations = iter;
+
+        if (residual_norm_squared > tol_squared) {
+            throw std::runtime_error(
+                    "The preconditioned conjugate gradient did not converge in "
+                    "PolarSplineFEMPoissonLikeSolver");
+        }
+        Kokkos::deep_copy(Kokkos::subview(x, batch_idx, Kokkos::ALL), solution);
+    }
+
     /**
      * @brief Solve the Poisson-like equation.
      *
@@ -954,7 +1699,13 @@ public:
         Kokkos::deep_copy(m_x_init, x_init_host);
         // Solve the matrix equation
         Kokkos::Profiling::pushRegion("PolarPoissonSolve");
-        m_gko_matrix->solve(m_x_init, b);
+        if (m_operator_storage == OperatorStorage::MatrixFree
+            || m_preconditioner == Preconditioner::RadialLineBlock) {
+            solve_preconditioned_cg(m_x_init, b);
+        } else {
+            m_gko_matrix->solve(m_x_init, b);
+            m_n_iterations = m_gko_matrix->get_last_n_iterations();
+        }
         Kokkos::deep_copy(x_init_host, m_x_init);
         //-----------------
         IdxRangeBSRTheta dirichlet_boundary_idx_range(
@@ -1055,142 +1806,38 @@ public:
     }
 
     /**
-     * @brief compute the weak integral value.
+     * @brief Computes a quadrature summand corresponding to the
+     *        inner product.
      *
-     * @param[in] idx_r
-     *      The index for radial direction.
-     * @param[in] idx_theta
-     *      The index for poloidal direction
-     * @param[in] test_bspline_val_and_deriv
-     *      The data structure containing the derivatives over radial and poloidal directions for test space.
-     * @param[in] trial_bspline_val_and_deriv
-     *      The data structure containing the derivatives over radial and poloidal directions for trial space.
-     * @param[in] coeff_alpha
-     *      The spline representation of the @f$ \alpha @f$ function in the
-     *      definition of the Poisson-like equation.
-     * @param[in] coeff_beta
-     *      The spline representation of the  @f$ \beta @f$ function in the
-     *      definition of the Poisson-like equation.
-     * @param[in] mapping
-     *      The mapping from the logical index range to the physical index range where
-     *      the equation is defined.
-     * @param[in] evaluator
-     *      An evaluator for evaluating 2D splines on @f$(r,\theta)@f$.
-     * @param[in] int_volume
-     *      The integral volume associated with each point used in the quadrature scheme.
-     * @return 
-     *      The value of the weak integral.
+     * @param[in] test_value
+     *      The value of the test function at the quadrature point.
+     * @param[in] test_gradient
+     *      The gradient of the test function at the quadrature point.
+     * @param[in] trial_value
+     *      The value of the trial function at the quadrature point.
+     * @param[in] trial_gradient
+     *      The gradient of the trial function at the quadrature point.
+     * @param[in] weak_form_coeffs
+     *      The coefficients of the weak formulation at the quadrature point.
+     * @return
+     *      The inner product of the test and trial spline is computed using a
+     *      quadrature. This function returns one summand of the quadrature for
+     *      the quadrature point.
      */
-    template <class Mapping>
-    static KOKKOS_FUNCTION double weak_integral_element(
-            IdxQuadratureR idx_r,
-            IdxQuadratureTheta idx_theta,
-            EvalDeriv2DType const& test_bspline_val_and_deriv,
-            EvalDeriv2DType const& trial_bspline_val_and_deriv,
-            ConstSpline2D coeff_alpha,
-            ConstSpline2D coeff_beta,
-            SplineRThetaEvaluatorNullBound const& evaluator,
-            Mapping const& mapping,
-            DField<IdxRangeQuadratureRTheta> int_volume)
-    {
-        return templated_weak_integral_element(
-                idx_r,
-                idx_theta,
-                test_bspline_val_and_deriv,
-                trial_bspline_val_and_deriv,
-                test_bspline_val_and_deriv,
-                trial_bspline_val_and_deriv,
-                coeff_alpha,
-                coeff_beta,
-                evaluator,
-                mapping,
-                int_volume);
-    }
-
-    ///@cond
-    template <class Mapping>
-    static KOKKOS_FUNCTION double weak_integral_element(
-            IdxQuadratureR idx_r,
-            IdxQuadratureTheta idx_theta,
-            EvalDeriv2DType const& test_bspline_val_and_deriv,
-            EvalDeriv1DType const& trial_bspline_val_and_deriv_r,
-            EvalDeriv1DType const& trial_bspline_val_and_deriv_theta,
-            ConstSpline2D coeff_alpha,
-            ConstSpline2D coeff_beta,
-            SplineRThetaEvaluatorNullBound const& evaluator,
-            Mapping const& mapping,
-            DField<IdxRangeQuadratureRTheta> int_volume)
-    {
-        return templated_weak_integral_element(
-                idx_r,
-                idx_theta,
-                test_bspline_val_and_deriv,
-                trial_bspline_val_and_deriv_r,
-                test_bspline_val_and_deriv,
-                trial_bspline_val_and_deriv_theta,
-                coeff_alpha,
-                coeff_beta,
-                evaluator,
-                mapping,
-                int_volume);
-    }
-
-    template <class Mapping>
-    static KOKKOS_FUNCTION double weak_integral_element(
-            IdxQuadratureR idx_r,
-            IdxQuadratureTheta idx_theta,
-            EvalDeriv1DType const& test_bspline_val_and_deriv_r,
-            EvalDeriv2DType const& trial_bspline_val_and_deriv,
-            EvalDeriv1DType const& test_bspline_val_and_deriv_theta,
-            ConstSpline2D coeff_alpha,
-            ConstSpline2D coeff_beta,
-            SplineRThetaEvaluatorNullBound const& evaluator,
-            Mapping const& mapping,
-            DField<IdxRangeQuadratureRTheta> int_volume)
+    static KOKKOS_INLINE_FUNCTION double weak_integral_element(
+            double const test_value,
+            DVector<R_cov, Theta_cov> const& test_gradient,
+            double const trial_value,
+            DVector<R_cov, Theta_cov> const& trial_gradient,
+            WeakFormCoefficients const& weak_form_coeffs)
     {
-        return templated_weak_integral_element(
-                idx_r,
-                idx_theta,
-                test_bspline_val_and_deriv_r,
-                trial_bspline_val_and_deriv,
-                test_bspline_val_and_deriv_theta,
-                trial_bspline_val_and_deriv,
-                coeff_alpha,
-                coeff_beta,
-                evaluator,
-                mapping,
-                int_volume);
+        return tensor_mul(
+                       index<'i'>(test_gradient),
+                       index<'i', 'j'>(weak_form_coeffs.alpha_inv_metric),
+                       index<'j'>(trial_gradient))
+               + weak_form_coeffs.beta * test_value * trial_value;
     }
 
-    template <class Mapping>
-    static KOKKOS_FUNCTION double weak_integral_element(
-            IdxQuadratureR idx_r,
-            IdxQuadratureTheta idx_theta,
-            EvalDeriv1DType const& test_bspline_val_and_deriv_r,
-            EvalDeriv1DType const& trial_bspline_val_and_deriv_r,
-            EvalDeriv1DType const& test_bspline_val_and_deriv_theta,
-            EvalDeriv1DType const& trial_bspline_val_and_deriv_theta,
-            ConstSpline2D coeff_alpha,
-            ConstSpline2D coeff_beta,
-            SplineRThetaEvaluatorNullBound const& evaluator,
-            Mapping const& mapping,
-            DField<IdxRangeQuadratureRTheta> int_volume)
-    {
-        return templated_weak_integral_element(
-                idx_r,
-                idx_theta,
-                test_bspline_val_and_deriv_r,
-                trial_bspline_val_and_deriv_r,
-                test_bspline_val_and_deriv_theta,
-                trial_bspline_val_and_deriv_theta,
-                coeff_alpha,
-                coeff_beta,
-                evaluator,
-                mapping,
-                int_volume);
-    }
-    ///@endcond
-
     /**
      * @brief Computes the value and gradient from r_basis and theta_basis inputs.
      * 
@@ -1234,246 +1881,150 @@ public:
     }
 
     /**
-     * @brief Computes a quadrature summand corresponding to the 
-     *        inner product.
+     * @brief Computes the matrix element corresponding to the polar splines
+     *        with index idx_test and idx_trial.
      *
-     * @param[in] idx_r
-     *      The index for radial direction.
-     * @param[in] idx_theta
-     *      The index for poloidal direction
-     * @param[in] test_bspline_val_and_deriv
-     *      The data structure containing the derivatives over radial and poloidal directions for test space.
-     * @param[in] trial_bspline_val_and_deriv
-     *      The data structure containing the derivatives over radial and poloidal directions for trial space.
-     * @param[in] test_bspline_val_and_deriv_theta
-     *       The data structure containing the value and derivative along poloidal direction for test space.
-     * @param[in] trial_bspline_val_and_deriv_theta
-     *       The data structure containing the value and derivative along poloidal direction for trial space.
-     * @param[in] coeff_alpha
-     *      The spline representation of the @f$ \alpha @f$ function in the
-     *      definition of the Poisson-like equation.
-     * @param[in] coeff_beta
-     *      The spline representation of the  @f$ \beta @f$ function in the
-     *      definition of the Poisson-like equation.
-     * @param[in] spline_evaluator
-     *      An evaluator for evaluating 2D splines on @f$(r,\theta)@f$.
-     * @param[in] mapping
-     *      The mapping from the logical index range to the physical index range where
-     *      the equation is defined.
-     * @param[in] int_volume
-     *      The integral volume associated with each point used in the quadrature scheme.
-     * @return
-      inner product of the test and trial spline is computed using a 
-     * quadrature. This function returns one summand of the quadrature for 
-     * the quadrature point given by the indices.
-     */
-    template <class Mapping, class TestValDerivType, class TrialValDerivType>
-    static KOKKOS_FUNCTION double templated_weak_integral_element(
-            IdxQuadratureR idx_r,
-            IdxQuadratureTheta idx_theta,
-            TestValDerivType const& test_bspline_val_and_deriv,
-            TrialValDerivType const& trial_bspline_val_and_deriv,
-            TestValDerivType const& test_bspline_val_and_deriv_theta,
-            TrialValDerivType const& trial_bspline_val_and_deriv_theta,
-            ConstSpline2D coeff_alpha,
-            ConstSpline2D coeff_beta,
-            SplineRThetaEvaluatorNullBound const& spline_evaluator,
-            Mapping const& mapping,
-            DField<IdxRangeQuadratureRTheta> int_volume)
-    {
-        static_assert(
-                std::is_same_v<
-                        TestValDerivType,
-                        EvalDeriv1DType> || std::is_same_v<TestValDerivType, EvalDeriv2DType>);
-        static_assert(
-                std::is_same_v<
-                        TrialValDerivType,
-                        EvalDeriv1DType> || std::is_same_v<TrialValDerivType, EvalDeriv2DType>);
-
-        // Calculate coefficients at quadrature point
-        CoordRTheta coord(ddc::coordinate(idx_r), ddc::coordinate(idx_theta));
-        const double alpha = spline_evaluator(coord, coeff_alpha);
-        const double beta = spline_evaluator(coord, coeff_beta);
-
-        // Define the value and gradient of the test and trial basis functions
-        double basis_val_test_space;
-        double basis_val_trial_space;
-        DVector<R_cov, Theta_cov> basis_derivs_test_space;
-        DVector<R_cov, Theta_cov> basis_derivs_trial_space;
-        get_value_and_gradient(
-                basis_val_test_space,
-                basis_derivs_test_space,
-                test_bspline_val_and_deriv,
-                test_bspline_val_and_deriv_theta);
-        get_value_and_gradient(
-                basis_val_trial_space,
-                basis_derivs_trial_space,
-                trial_bspline_val_and_deriv,
-                trial_bspline_val_and_deriv_theta);
-
-        MetricTensorEvaluator<Mapping, CoordRTheta> get_metric_tensor(mapping);
-
-        Tensor inv_metric_tensor = get_metric_tensor.inverse(coord);
-
-        // Assemble the weak integral element
-        return int_volume(idx_r, idx_theta)
-               * (alpha
-                          * tensor_mul(
-                                  index<'i'>(basis_derivs_test_space),
-                                  index<'i', 'j'>(inv_metric_tensor),
-                                  index<'j'>(basis_derivs_trial_space))
-                  + beta * basis_val_test_space * basis_val_trial_space);
-    }
-
-    /**
-     * @brief Computes the matrix element corresponding to two tensor product splines
-     *        with index idx_test and idx_trial
+     * The element is computed by summing the contributions of the cells where both
+     * functions are non-zero.
      *
      * @param[in] idx_test
      *      The index for polar B-spline in the test space.
      * @param[in] idx_trial
      *      The index for polar B-spline in the trial space.
-     * @param[in] coeff_alpha
-     *      The spline representation of the @f$ \alpha @f$ function in the
-     *      definition of the Poisson-like equation.
-     * @param[in] coeff_beta
-     *      The spline representation of the  @f$ \beta @f$ function in the
-     *      definition of the Poisson-like equation.
-     * @param[in] evaluator
-     *      An evaluator for evaluating 2D splines on @f$ (r, \theta) @f$.
-     * @param[in] mapping
-     *      The mapping from the logical index range to the physical index range where
-     *      the equation is defined.
-     * @return 
+     * @param[in] idxrange_singular
+     *      The index range of the polar B-splines which cover the singular point.
+     * @param[in] idxrange_quadrature_singular
+     *      The quadrature points in the cells where the B-splines covering the singular point are non-zero.
+     * @param[in] singular_basis_vals_and_derivs
+     *      The values and derivatives of the B-splines covering the singular point at the quadrature points.
+     * @param[in] r_basis_vals_and_derivs
+     *      The values and derivatives of the radial B-splines which are non-zero at each quadrature point.
+     * @param[in] theta_basis_vals_and_derivs
+     *      The values and derivatives of the poloidal B-splines which are non-zero at each quadrature point.
+     * @param[in] weak_form_coeffs
+     *      The coefficients of the weak formulation at each quadrature point.
+     * @return
      *      The value of the matrix element.
      */
-    template <class Mapping>
-    double get_matrix_stencil_element(
-            IdxBSRTheta idx_test,
-            IdxBSRTheta idx_trial,
-            ConstSpline2D coeff_alpha,
-            ConstSpline2D coeff_beta,
-            SplineRThetaEvaluatorNullBound const& evaluator,
-            Mapping const& mapping)
+    static KOKKOS_FUNCTION double get_matrix_element(
+            IdxBSPolar idx_test,
+            IdxBSPolar idx_trial,
+            IdxRangeBSPolar const idxrange_singular,
+            IdxRangeQuadratureRTheta const idxrange_quadrature_singular,
+            ConstField<EvalDeriv2DType, IdxRange<PolarBSplinesRTheta, QDimRMesh, QDimThetaMesh>>
+                    singular_basis_vals_and_derivs,
+            ConstField<EvalDeriv1DType, IdxRange<RBasisSubset, QDimRMesh>> r_basis_vals_and_derivs,
+            ConstField<EvalDeriv1DType, IdxRange<ThetaBasisSubset, QDimThetaMesh>>
+                    theta_basis_vals_and_derivs,
+            ConstField<WeakFormCoefficients, IdxRangeQuadratureRTheta> weak_form_coeffs)
     {
-        // 0 <= idx_test_r < 8
-        // 0 <= idx_trial_r < 8
-        // idx_test_r < idx_trial_r
-        const int idx_test_r(ddc::select<BSplinesR>(idx_test).uid());
-        const int idx_trial_r(ddc::select<BSplinesR>(idx_trial).uid());
-        // 0 <= idx_test_theta < 8
-        // 0 <= idx_trial_theta < 8
-        int idx_test_theta(theta_mod(ddc::select<BSplinesTheta>(idx_test).uid()));
-        int idx_trial_theta(theta_mod(ddc::select<BSplinesTheta>(idx_trial).uid()));
+        bool const is_singular_test = idx_test <= idxrange_singular.back();
+        bool const is_singular_trial = idx_trial <= idxrange_singular.back();
 
-        const std::size_t ncells_r = ddc::discrete_space<BSplinesR>().ncells();
+        if (is_singular_test && is_singular_trial) {
+            double element = 0.0;
+            for (IdxQuadratureR const idx_r :
+                 ddc::select<QDimRMesh>(idxrange_quadrature_singular)) {
+                for (IdxQuadratureTheta const idx_theta :
+                     ddc::select<QDimThetaMesh>(idxrange_quadrature_singular)) {
+                    EvalDeriv2DType const& test
+                            = singular_basis_vals_and_derivs(idx_test, idx_r, idx_theta);
+                    EvalDeriv2DType const& trial
+                            = singular_basis_vals_and_derivs(idx_trial, idx_r, idx_theta);
+                    element += weak_integral_element(
+                            test.value,
+                            test.derivative,
+                            trial.value,
+                            trial.derivative,
+                            weak_form_coeffs(idx_r, idx_theta));
+                }
+            }
+            return element;
+        }
 
-        // 0<= r_offset <= degree_r
-        // -degree_theta <= theta_offset <= degree_theta
-        const int r_offset = idx_trial_r - idx_test_r;
-        int theta_offset = theta_mod(idx_trial_theta - idx_test_theta);
-        if (theta_offset >= int(m_nbasis_theta - BSplinesTheta::degree())) {
-            theta_offset -= m_nbasis_theta;
+        // The weak form is symmetric so the B-spline covering the singular point (if any)
+        // can always be used as the test function.
+        if (is_singular_trial) {
+            IdxBSPolar const idx_singular = idx_trial;
+            idx_trial = idx_test;
+            idx_test = idx_singular;
         }
-        assert(r_offset >= 0);
-        assert(r_offset <= int(BSplinesR::degree()));
-        assert(theta_offset >= -int(BSplinesTheta::degree()));
-        assert(theta_offset <= int(BSplinesTheta::degree()));
-
-        // Find the index range covering the cells where both the test and trial functions are non-zero
-        int n_overlap_stencil_r(BSplinesR::degree() + 1 - r_offset);
-        int first_overlap_r(idx_trial_r - BSplinesR::degree());
-
-        int first_overlap_theta;
-        int n_overlap_stencil_theta;
-        if (theta_offset > 0) {
-            n_overlap_stencil_theta = BSplinesTheta::degree() + 1 - theta_offset;
-            first_overlap_theta = theta_mod(idx_trial_theta - BSplinesTheta::degree());
+        bool const is_overlap = is_singular_test || is_singular_trial;
+
+        const IdxBSRTheta idx_trial_2d(PolarBSplinesRTheta::get_2d_index(idx_trial));
+        const int idx_trial_r(ddc::select<BSplinesR>(idx_trial_2d).uid());
+        const int idx_trial_theta(ddc::select<BSplinesTheta>(idx_trial_2d).uid());
+        const int ncells_r(ddc::discrete_space<BSplinesR>().ncells());
+
+        // Find the radial cells where both the test and trial functions are non-zero
+        int first_cell_r = idx_trial_r - int(BSplinesR::degree());
+        int last_cell_r = idx_trial_r;
+        int idx_test_r = 0;
+        int idx_test_theta = 0;
+        if (is_overlap) {
+            last_cell_r = Kokkos::min(last_cell_r, m_n_overlap_cells - 1);
         } else {
-            n_overlap_stencil_theta = BSplinesTheta::degree() + 1 + theta_offset;
-            first_overlap_theta = theta_mod(idx_test_theta - BSplinesTheta::degree());
-        }
-
-        if (first_overlap_r < 0) {
-            const int n_compact = first_overlap_r;
-            first_overlap_r = 0;
-            n_overlap_stencil_r += n_compact;
+            const IdxBSRTheta idx_test_2d(PolarBSplinesRTheta::get_2d_index(idx_test));
+            idx_test_r = ddc::select<BSplinesR>(idx_test_2d).uid();
+            idx_test_theta = ddc::select<BSplinesTheta>(idx_test_2d).uid();
+            first_cell_r = Kokkos::max(first_cell_r, idx_test_r - int(BSplinesR::degree()));
+            last_cell_r = Kokkos::min(last_cell_r, idx_test_r);
         }
+        first_cell_r = Kokkos::max(first_cell_r, 0);
+        last_cell_r = Kokkos::min(last_cell_r, ncells_r - 1);
+
+        double element = 0.0;
+        for (int cell_idx_r = first_cell_r; cell_idx_r <= last_cell_r; ++cell_idx_r) {
+            for (int ib_trial_theta_idx = 0; ib_trial_theta_idx < int(BSplinesTheta::degree()) + 1;
+                 ++ib_trial_theta_idx) {
+                const int cell_idx_theta(theta_mod(idx_trial_theta - ib_trial_theta_idx));
+                const int ib_test_theta_idx(theta_mod(idx_test_theta - cell_idx_theta));
+                if (!is_overlap && ib_test_theta_idx > int(BSplinesTheta::degree())) {
+                    continue;
+                }
 
-        const int n_to_edge_r(ncells_r - first_overlap_r);
-
-        const IdxStep<RCellDim> n_overlap_r(min(n_overlap_stencil_r, n_to_edge_r));
-        const IdxStep<ThetaCellDim> n_overlap_theta(n_overlap_stencil_theta);
-
-        const Idx<RCellDim> first_overlap_element_r(first_overlap_r);
-        const Idx<ThetaCellDim> first_overlap_element_theta(first_overlap_theta);
-
-        const IdxRange<RCellDim> r_cells(first_overlap_element_r, n_overlap_r);
-        const IdxRange<ThetaCellDim> theta_cells(first_overlap_element_theta, n_overlap_theta);
-        const IdxRange<RCellDim, ThetaCellDim> non_zero_cells(r_cells, theta_cells);
-
-        auto r_basis_vals_and_derivs_alloc = ddc::create_mirror_view_and_copy(
-                Kokkos::DefaultExecutionSpace(),
-                get_field(m_r_basis_vals_and_derivs));
-        auto theta_basis_vals_and_derivs_alloc = ddc::create_mirror_view_and_copy(
-                Kokkos::DefaultExecutionSpace(),
-                get_field(m_theta_basis_vals_and_derivs));
-
-        Field<EvalDeriv1DType, IdxRange<RBasisSubset, QDimRMesh>> r_basis_vals_and_derivs
-                = get_field(r_basis_vals_and_derivs_alloc);
-        Field<EvalDeriv1DType, IdxRange<ThetaBasisSubset, QDimThetaMesh>>
-                theta_basis_vals_and_derivs = get_field(theta_basis_vals_and_derivs_alloc);
-        DField<IdxRangeQuadratureRTheta> int_volume_proxy = get_field(m_int_volume);
-
-        assert(n_overlap_r * n_overlap_theta > 0);
-        return ddc::transform_reduce(
-                non_zero_cells,
-                0.0,
-                ddc::reducer::sum<double>(),
-                [&](IdxCell const cell_idx) {
-                    const int cell_idx_r(ddc::select<RCellDim>(cell_idx).uid());
-                    const int cell_idx_theta(theta_mod(ddc::select<ThetaCellDim>(cell_idx).uid()));
-
-                    const IdxRangeQuadratureRTheta cell_quad_points(
-                            get_quadrature_points_in_cell(cell_idx_r, cell_idx_theta));
-
-                    int ib_test_theta_idx = idx_test_theta - cell_idx_theta;
-                    int ib_trial_theta_idx = idx_trial_theta - cell_idx_theta;
-
-                    // Find the column where the non-zero data is stored
-                    Idx<RBasisSubset> ib_test_r(idx_test_r - cell_idx_r);
-                    Idx<ThetaBasisSubset> ib_test_theta(theta_mod(ib_test_theta_idx));
-                    Idx<RBasisSubset> ib_trial_r(idx_trial_r - cell_idx_r);
-                    Idx<ThetaBasisSubset> ib_trial_theta(theta_mod(ib_trial_theta_idx));
-
-                    assert(ib_test_r.uid() < BSplinesR::degree() + 1);
-                    assert(ib_test_theta.uid() < BSplinesTheta::degree() + 1);
-                    assert(ib_trial_r.uid() < BSplinesR::degree() + 1);
-                    assert(ib_trial_theta.uid() < BSplinesTheta::degree() + 1);
+                // Find the column where the non-zero data is stored
+                const Idx<RBasisSubset> ib_trial_r(idx_trial_r - cell_idx_r);
+                const Idx<ThetaBasisSubset> ib_trial_theta(ib_trial_theta_idx);
+                const Idx<RBasisSubset> ib_test_r(is_overlap ? 0 : idx_test_r - cell_idx_r);
+                const Idx<ThetaBasisSubset> ib_test_theta(is_overlap ? 0 : ib_test_theta_idx);
 
-                    // Calculate the weak integral
-                    return ddc::parallel_transform_reduce(
-                            Kokkos::DefaultExecutionSpace(),
-                            cell_quad_points,
-                            0.0,
-                            ddc::reducer::sum<double>(),
-                            KOKKOS_LAMBDA(IdxQuadratureRTheta const idx_quad) {
-                                IdxQuadratureR const idx_r(idx_quad);
-                                IdxQuadratureTheta const idx_theta(idx_quad);
-                                return weak_integral_element(
-                                        idx_r,
-                                        idx_theta,
-                                        r_basis_vals_and_derivs(ib_test_r, idx_r),
-                                        r_basis_vals_and_derivs(ib_trial_r, idx_r),
-                                        theta_basis_vals_and_derivs(ib_test_theta, idx_theta),
-                                        theta_basis_vals_and_derivs(ib_trial_theta, idx_theta),
-                                        coeff_alpha,
-                                        coeff_beta,
-                                        evaluator,
-                                        mapping,
-                                        int_volume_proxy);
-                            });
-                });
+                const IdxRangeQuadratureRTheta cell_quad_points(
+                        get_quadrature_points_in_cell(cell_idx_r, cell_idx_theta));
+                for (IdxQuadratureR const idx_r : ddc::select<QDimRMesh>(cell_quad_points)) {
+                    for (IdxQuadratureTheta const idx_theta :
+                         ddc::select<QDimThetaMesh>(cell_quad_points)) {
+                        double test_value;
+                        double trial_value;
+                        DVector<R_cov, Theta_cov> test_gradient;
+                        DVector<R_cov, Theta_cov> trial_gradient;
+                        if (is_overlap) {
+                            EvalDeriv2DType const& test
+                                    = singular_basis_vals_and_derivs(idx_test, idx_r, idx_theta);
+                            get_value_and_gradient(test_value, test_gradient, test, test);
+                        } else {
+                            get_value_and_gradient(
+                                    test_value,
+                                    test_gradient,
+                                    r_basis_vals_and_derivs(ib_test_r, idx_r),
+                                    theta_basis_vals_and_derivs(ib_test_theta, idx_theta));
+                        }
+                        get_value_and_gradient(
+                                trial_value,
+                                trial_gradient,
+                                r_basis_vals_and_derivs(ib_trial_r, idx_r),
+                                theta_basis_vals_and_derivs(ib_trial_theta, idx_theta));
+                        element += weak_integral_element(
+                                test_value,
+                                test_gradient,
+                                trial_value,
+                                trial_gradient,
+                                weak_form_coeffs(idx_r, idx_theta));
+                    }
+                }
+            }
+        }
+        return element;
     }
 
     /**
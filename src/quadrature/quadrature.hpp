@@ -148,15 +148,15 @@ public:
                 Kokkos::TeamPolicy<>(exec_space, batch_idx_range.size(), Kokkos::AUTO),
                 KOKKOS_LAMBDA(const Kokkos::TeamPolicy<>::member_type& team) {
                     const int idx = team.league_rank();
-                    IdxBatch ib = to_discrete_element(idx, batch_idx_range);
+                    IdxBatch ib = ddcHelper::to_discrete_element(idx, batch_idx_range);
 
                     // Sum over quadrature dimensions
                     double teamSum = 0;
                     Kokkos::parallel_reduce(
                             Kokkos::TeamThreadRange(team, quad_idx_range.size()),
                             [&](int const& thread_index, double& sum) {
-                                IdxQuadrature iq
-                                        = to_discrete_element(thread_index, quad_idx_range);
+                                IdxQuadrature iq = ddcHelper::
+                                        to_discrete_element(thread_index, quad_idx_range);
                                 IdxTotal it(ib, iq);
                                 sum += coeff_proxy(iq) * integrated_function(it);
                             },
@@ -165,31 +165,6 @@ public:
                 });
     }
 
-private:
-    /**
-     * A function which converts an integer into an index found in an index range
-     * starting from the front. This is useful for iterating over an index range using Kokkos
-     * loops.
-     *
-     * @param[in] idx The index of the requested element.
-     * @param[in] idx_range The index range being iterated over.
-     *
-     * @return The vector displacement from the front of the index range
-     */
-    template <class HeadDim, class... Grid1D>
-    KOKKOS_FUNCTION static Idx<HeadDim, Grid1D...> to_discrete_element(
-            int idx,
-            IdxRange<HeadDim, Grid1D...> idx_range)
-    {
-        IdxRange<Grid1D...> subidx_range(idx_range);
-        Idx<HeadDim> head_idx(ddc::select<HeadDim>(idx_range).front() + idx / subidx_range.size());
-        if constexpr (sizeof...(Grid1D) == 0) {
-            return head_idx;
-        } else {
-            Idx<Grid1D...> tail_idx = to_discrete_element(idx % subidx_range.size(), subidx_range);
-            return Idx<HeadDim, Grid1D...>(head_idx, tail_idx);
-        }
-    }
 };
 
 namespace detail {
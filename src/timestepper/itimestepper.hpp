@@ -7,6 +7,7 @@
 
 #include "multipatch_field.hpp"
 #include "multipatch_field_mem.hpp"
+#include "multipatch_flat_idx_range.hpp"
 
 /**
  * @brief The superclass from which all timestepping methods inherit.
@@ -262,9 +263,11 @@ public:
                 });
     }
 
-private:
     /**
-     * Calculate func(k_arr[0], k_arr[1], ...) on one patch of a MultipatchField.
+     * Calculate func(k_arr[0], k_arr[1], ...) when FieldType is a MultipatchField.
+     * All the patches are treated in a single kernel using a flat index over the index ranges
+     * of all the patches. This avoids launching one small kernel per patch.
+     * This function should be private but is public due to Cuda restrictions.
      *
      * @param[in] exec_space The space (CPU/GPU) where the calculation should be executed.
      * @param[out] k_total The field to be filled with the combined derivative fields.
@@ -272,53 +275,70 @@ private:
      * @param[in] k_arr The derivative fields being combined.
      */
     template <
-            class Patch,
             template <typename P>
             typename T,
             class... Patches,
             class FuncType,
             std::size_t n_args>
-    void assemble_multipatch_field_k_total_on_patch(
+    void assemble_multipatch_field_k_total(
             ExecSpace const& exec_space,
             MultipatchField<T, Patches...> k_total,
             FuncType func,
             std::array<MultipatchField<T, Patches...>, n_args> k_arr) const
     {
-        using FieldType = T<Patch>;
-        static_assert((ddc::is_chunk_v<FieldType>) or (is_vector_field_v<FieldType>));
-        std::array<FieldType, n_args> k_arr_on_patch;
-        FieldType k_total_on_patch = k_total.template get<Patch>();
-        for (std::size_t i(0); i < n_args; ++i) {
-            k_arr_on_patch[i] = k_arr[i].template get<Patch>();
-        }
-        if constexpr (is_vector_field_v<FieldType>) {
-            assemble_vector_field_k_total(exec_space, k_total_on_patch, func, k_arr_on_patch);
-        } else {
-            assemble_field_k_total(exec_space, k_total_on_patch, func, k_arr_on_patch);
-        }
+        static_assert(
+                ((ddc::is_chunk_v<T<Patches>>) && ...)
+                || ((is_vector_field_v<T<Patches>>) && ...));
+        MultipatchFlatIdxRange flat_idx_range(k_total.idx_range());
+        Kokkos::parallel_for(
+                "assemble_multipatch_field_k_total",
+                Kokkos::RangePolicy<ExecSpace>(exec_space, 0, flat_idx_range.size()),
+                KOKKOS_LAMBDA(int const flat_idx) {
+                    ((assemble_multipatch_field_k_total_on_patch<
+                             Patches>(flat_idx_range, flat_idx, k_total, func, k_arr)),
+                     ...);
+                });
     }
 
     /**
-     * Calculate func(k_arr[0], k_arr[1], ...) when FieldType is a MultipatchField.
+     * Calculate func(k_arr[0], k_arr[1], ...) at one point of a MultipatchField if this point
+     * is found on the specified patch.
+     * This function should be private but is public due to Cuda restrictions.
      *
-     * @param[in] exec_space The space (CPU/GPU) where the calculation should be executed.
+     * @param[in] flat_idx_range The object describing the flat indexing of all the patches.
+     * @param[in] flat_idx The flat index of the point.
      * @param[out] k_total The field to be filled with the combined derivative fields.
      * @param[in] func A function which combines an element from each of the derivative fields.
      * @param[in] k_arr The derivative fields being combined.
      */
     template <
+            class Patch,
+            class FlatIdxRange,
             template <typename P>
             typename T,
             class... Patches,
             class FuncType,
             std::size_t n_args>
-    void assemble_multipatch_field_k_total(
-            ExecSpace const& exec_space,
-            MultipatchField<T, Patches...> k_total,
-            FuncType func,
-            std::array<MultipatchField<T, Patches...>, n_args> k_arr) const
+    KOKKOS_FUNCTION static void assemble_multipatch_field_k_total_on_patch(
+            FlatIdxRange const& flat_idx_range,
+            int const flat_idx,
+            MultipatchField<T, Patches...> const& k_total,
+            FuncType const& func,
+            std::array<MultipatchField<T, Patches...>, n_args> const& k_arr)
     {
-        ((assemble_multipatch_field_k_total_on_patch<Patches>(exec_space, k_total, func, k_arr)),
-         ...);
+        if (flat_idx_range.template contains<Patch>(flat_idx)) {
+            using FieldType = T<Patch>;
+            using element_type = typename FieldType::element_type;
+            auto const i = flat_idx_range.template to_discrete_element<Patch>(flat_idx);
+            std::array<element_type, n_args> k_elems;
+            for (int j(0); j < n_args; ++j) {
+                k_elems[j] = k_arr[j].template get<Patch>()(i);
+            }
+            if constexpr (is_vector_field_v<FieldType>) {
+                fill_k_total(k_total.template get<Patch>(), i, func(k_elems));
+            } else {
+                k_total.template get<Patch>()(i) = func(k_elems);
+            }
+        }
     }
 };
@@ -7,6 +7,7 @@
 
 #include <ddc/ddc.hpp>
 
+#include "ddc_alias_inline_functions.hpp"
 #include "ddc_aliases.hpp"
 
 
@@ -176,6 +177,74 @@ inline void dump_coordinates(
             KOKKOS_LAMBDA(Idx<Grid1D> i) { dump_coord(i) = ddc::coordinate(i); });
 }
 
+/**
+ * @brief Copy the values of a field into a field with a different element type.
+ *
+ * This is used to change the precision in which the values are stored (e.g. to
+ * send a field of doubles as floats).
+ *
+ * @param[in] exec_space The execution space on which the code will run.
+ * @param[out] out The field into which the converted values are written.
+ * @param[in] in The field containing the values to be converted.
+ */
+template <
+        class ExecSpace,
+        class OutElementType,
+        class InElementType,
+        class IdxRangeType,
+        class MemorySpace,
+        class LayoutOut,
+        class LayoutIn>
+inline void parallel_convert(
+        ExecSpace exec_space,
+        Field<OutElementType, IdxRangeType, MemorySpace, LayoutOut> out,
+        ConstField<InElementType, IdxRangeType, MemorySpace, LayoutIn> in)
+{
+    using IdxType = typename IdxRangeType::discrete_element_type;
+    assert(get_idx_range(out) == get_idx_range(in));
+    ddc::parallel_for_each(
+            exec_space,
+            get_idx_range(out),
+            KOKKOS_LAMBDA(IdxType const idx) { out(idx) = OutElementType(in(idx)); });
+}
+
+/**
+ * @brief Convert an integer into an index found in an index range with no dimensions.
+ *
+ * @return The (empty) multi-dimensional index.
+ */
+KOKKOS_INLINE_FUNCTION Idx<> to_discrete_element(std::size_t, IdxRange<>)
+{
+    return Idx<>();
+}
+
+/**
+ * @brief Convert an integer into an index found in an index range starting from the front.
+ *
+ * The elements are numbered in layout right order (the last dimension varies fastest).
+ * This is useful for iterating over a multi-dimensional index range using Kokkos loops
+ * indexed by integers (e.g. a team policy).
+ *
+ * @param[in] idx The number of the requested element.
+ * @param[in] idx_range The index range being iterated over.
+ *
+ * @return The multi-dimensional index.
+ */
+template <class HeadGrid, class... Grid1D>
+KOKKOS_FUNCTION Idx<HeadGrid, Grid1D...> to_discrete_element(
+        std::size_t idx,
+        IdxRange<HeadGrid, Grid1D...> idx_range)
+{
+    IdxRange<Grid1D...> subidx_range(idx_range);
+    Idx<HeadGrid> head_idx(ddc::select<HeadGrid>(idx_range).front() + idx / subidx_range.size());
+    if constexpr (sizeof...(Grid1D) == 0) {
+        return head_idx;
+    } else {
+        Idx<Grid1D...> tail_idx = to_discrete_element(idx % subidx_range.size(), subidx_range);
+        return Idx<HeadGrid, Grid1D...>(head_idx, tail_idx);
+    }
+}
+
 /**
  * @brief Computes the maximum distance between two adjacent points 
  * within an IdxRange.
@@ -1,9 +1,154 @@
 // SPDX-License-Identifier: MIT
 #pragma once
+#include <type_traits>
+
 #include "ddc_alias_inline_functions.hpp"
 #include "ddc_aliases.hpp"
+#include "ddc_helper.hpp"
 #include "type_seq_tools.hpp"
 
+namespace detail {
+
+/// The size of the square tiles used to transpose the two fastest varying dimensions.
+constexpr int transpose_tile_size = 32;
+
+/**
+ * @brief Copy data from a layout_right field into a layout_right field whose fastest
+ * varying dimension is different. The values are converted to the element type of the
+ * destination if necessary.
+ *
+ * The two fastest varying dimensions (one for each layout) are split into square tiles.
+ * Each tile is read along the fastest dimension of the source and written along the
+ * fastest dimension of the destination so that both the reads and the writes access
+ * memory contiguously. On the host the tiles are small enough to remain in cache.
+ * On a device the tile is staged in team scratch memory.
+ *
+ * @param execution_space The execution space (Host/Device) where the code will run.
+ * @param transposed_field The field which the data will be copied into.
+ * @param field_to_transpose The constant field where the original data is found.
+ */
+template <
+        class ExecSpace,
+        class ElementType,
+        class IdxRangeDst,
+        class IdxRangeSrc,
+        class MemorySpace,
+        class ElementTypeSrc>
+void tiled_transpose_layout(
+        ExecSpace const& execution_space,
+        Field<ElementType, IdxRangeDst, MemorySpace> transposed_field,
+        ConstField<ElementTypeSrc, IdxRangeSrc, MemorySpace> field_to_transpose)
+{
+    using ElemType = std::remove_const_t<ElementType>;
+    constexpr std::size_t n_dims(ddc::type_seq_size_v<ddc::to_type_seq_t<IdxRangeSrc>>);
+    using GridSrcFast = ddc::type_seq_element_t<n_dims - 1, ddc::to_type_seq_t<IdxRangeSrc>>;
+    using GridDstFast = ddc::type_seq_element_t<n_dims - 1, ddc::to_type_seq_t<IdxRangeDst>>;
+    using IdxRangeBatch = ddc::remove_dims_of_t<IdxRangeSrc, GridSrcFast, GridDstFast>;
+    using IdxSrc = typename IdxRangeSrc::discrete_element_type;
+    using IdxBatch = typename IdxRangeBatch::discrete_element_type;
+    using IdxStepSrcFast = IdxStep<GridSrcFast>;
+    using IdxStepDstFast = IdxStep<GridDstFast>;
+
+    constexpr int tile_size = transpose_tile_size;
+
+    IdxRangeSrc idx_range(get_idx_range(field_to_transpose));
+    IdxRangeBatch batch_idx_range(idx_range);
+    IdxRange<GridSrcFast> idx_range_src_fast(idx_range);
+    IdxRange<GridDstFast> idx_range_dst_fast(idx_range);
+
+    int const n_src_fast = idx_range_src_fast.size();
+    int const n_dst_fast = idx_range_dst_fast.size();
+    int const n_tiles_src = (n_src_fast + tile_size - 1) / tile_size;
+    int const n_tiles_dst = (n_dst_fast + tile_size - 1) / tile_size;
+    int const n_tiles = batch_idx_range.size() * n_tiles_src * n_tiles_dst;
+
+    if constexpr (std::is_same_v<typename ExecSpace::memory_space, Kokkos::HostSpace>) {
+        Kokkos::parallel_for(
+                "transpose_layout",
+                Kokkos::RangePolicy<ExecSpace>(execution_space, 0, n_tiles),
+                KOKKOS_LAMBDA(int const tile_idx) {
+                    int const tile_dst = tile_idx % n_tiles_dst;
+                    int const tile_src = (tile_idx / n_tiles_dst) % n_tiles_src;
+                    int const batch_idx = tile_idx / (n_tiles_dst * n_tiles_src);
+                    IdxBatch const ib = ddcHelper::to_discrete_element(batch_idx, batch_idx_range);
+                    IdxRange<GridSrcFast> const tile_src_range(
+                            idx_range_src_fast.front() + IdxStepSrcFast(tile_src * tile_size),
+                            IdxStepSrcFast(
+                                    Kokkos::min(tile_size, n_src_fast - tile_src * tile_size)));
+                    IdxRange<GridDstFast> const tile_dst_range(
+                            idx_range_dst_fast.front() + IdxStepDstFast(tile_dst * tile_size),
+                            IdxStepDstFast(
+                                    Kokkos::min(tile_size, n_dst_fast - tile_dst * tile_size)));
+                    for (Idx<GridSrcFast> const i_src : tile_src_range) {
+                        for (Idx<GridDstFast> const i_dst : tile_dst_range) {
+                            IdxSrc const idx(ib, i_src, i_dst);
+                            transposed_field(idx) = ElemType(field_to_transpose(idx));
+                        }
+                    }
+                });
+    } else {
+        using TeamPolicy = Kokkos::TeamPolicy<ExecSpace>;
+        // The padding of the tile is only effective on its last (contiguous) dimension
+        using ScratchView = Kokkos::View<
+                ElemType**,
+                Kokkos::LayoutRight,
+                typename ExecSpace::scratch_memory_space,
+                Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+        // The tile is padded to avoid bank conflicts when it is read column-wise
+        std::size_t const scratch_size = ScratchView::shmem_size(tile_size, tile_size + 1);
+        Kokkos::parallel_for(
+                "transpose_layout",
+                TeamPolicy(execution_space, n_tiles, Kokkos::AUTO)
+                        .set_scratch_size(0, Kokkos::PerTeam(scratch_size)),
+                KOKKOS_LAMBDA(typename TeamPolicy::member_type const& team) {
+                    int const tile_idx = team.league_rank();
+                    int const tile_dst = tile_idx % n_tiles_dst;
+                    int const tile_src = (tile_idx / n_tiles_dst) % n_tiles_src;
+                    int const batch_idx = tile_idx / (n_tiles_dst * n_tiles_src);
+                    IdxBatch const ib = ddcHelper::to_discrete_element(batch_idx, batch_idx_range);
+                    Idx<GridSrcFast> const src_start
+                            = idx_range_src_fast.front() + IdxStepSrcFast(tile_src * tile_size);
+                    Idx<GridDstFast> const dst_start
+                            = idx_range_dst_fast.front() + IdxStepDstFast(tile_dst * tile_size);
+                    int const tile_n_src
+                            = Kokkos::min(tile_size, n_src_fast - tile_src * tile_size);
+                    int const tile_n_dst
+                            = Kokkos::min(tile_size, n_dst_fast - tile_dst * tile_size);
+
+                    ScratchView tile(team.team_scratch(0), tile_size, tile_size + 1);
+
+                    // Read the tile contiguously along the fastest dimension of the source
+                    Kokkos::parallel_for(
+                            Kokkos::TeamThreadRange(team, tile_n_src * tile_n_dst),
+                            [&](int const k) {
+                                int const i_dst = k / tile_n_src;
+                                int const i_src = k % tile_n_src;
+                                IdxSrc const idx(
+                                        ib,
+                                        src_start + IdxStepSrcFast(i_src),
+                                        dst_start + IdxStepDstFast(i_dst));
+                                tile(i_dst, i_src) = ElemType(field_to_transpose(idx));
+                            });
+                    team.team_barrier();
+
+                    // Write the tile contiguously along the fastest dimension of the destination
+                    Kokkos::parallel_for(
+                            Kokkos::TeamThreadRange(team, tile_n_src * tile_n_dst),
+                            [&](int const k) {
+                                int const i_src = k / tile_n_dst;
+                                int const i_dst = k % tile_n_dst;
+                                IdxSrc const idx(
+                                        ib,
+                                        src_start + IdxStepSrcFast(i_src),
+                                        dst_start + IdxStepDstFast(i_dst));
+                                transposed_field(idx) = tile(i_dst, i_src);
+                            });
+                });
+    }
+}
+
+} // namespace detail
+
 /**
  * @brief Copy data from a view in one layout into a span in a transposed layout.
  *
@@ -11,6 +156,13 @@
  * to be a transposition of one another if both domains describe data on the same
  * physical dimensions.
  *
+ * If both fields use a layout_right and their fastest varying dimensions differ, a tiled
+ * algorithm is used so that both reads and writes are contiguous (see
+ * detail::tiled_transpose_layout). Otherwise an element-wise copy is carried out.
+ *
+ * If the element types of the two fields differ (e.g. double and float), the values are
+ * converted while they are copied so no intermediate buffer is needed.
+ *
  * @param execution_space The execution space (Host/Device) where the code will run.
  * @param transposed_field The span describing the data object which the data will be copied into.
  * @param field_to_transpose The constant span describing the data object where the original
@@ -26,11 +178,13 @@ template <
         class MemorySpace,
         class IdxRangeIn,
         class LayoutStridedPolicyIn,
-        class LayoutStridedPolicyOut>
+        class LayoutStridedPolicyOut,
+        class ElementTypeIn>
 Field<ElementType, IdxRangeIn, MemorySpace, LayoutStridedPolicyOut> transpose_layout(
         ExecSpace const& execution_space,
         Field<ElementType, IdxRangeIn, MemorySpace, LayoutStridedPolicyOut> transposed_field,
-        ConstField<ElementType, IdxRangeOut, MemorySpace, LayoutStridedPolicyIn> field_to_transpose)
+        ConstField<ElementTypeIn, IdxRangeOut, MemorySpace, LayoutStridedPolicyIn>
+                field_to_transpose)
 {
     static_assert(
             Kokkos::SpaceAccessibility<ExecSpace, MemorySpace>::accessible,
@@ -52,13 +206,21 @@ Field<ElementType, IdxRangeIn, MemorySpace, LayoutStridedPolicyOut> transpose_la
 
     constexpr std::size_t n_dims(ddc::type_seq_size_v<ddc::to_type_seq_t<IdxRangeOut>>);
 
-    if constexpr (n_dims < 7) {
+    using GridInFast = ddc::type_seq_element_t<n_dims - 1, ddc::to_type_seq_t<IdxRangeOut>>;
+    using GridOutFast = ddc::type_seq_element_t<n_dims - 1, ddc::to_type_seq_t<IdxRangeIn>>;
+    constexpr bool both_layout_right
+            = std::is_same_v<LayoutStridedPolicyIn, Kokkos::layout_right>
+              && std::is_same_v<LayoutStridedPolicyOut, Kokkos::layout_right>;
+
+    if constexpr (both_layout_right && !std::is_same_v<GridInFast, GridOutFast>) {
+        detail::tiled_transpose_layout(execution_space, transposed_field, field_to_transpose);
+    } else if constexpr (n_dims < 7) {
         using ToTransposeIndex = typename IdxRangeOut::discrete_element_type;
         ddc::parallel_for_each(
                 execution_space,
                 idx_range,
                 KOKKOS_LAMBDA(ToTransposeIndex idx) {
-                    transposed_field(idx) = field_to_transpose(idx);
+                    transposed_field(idx) = ElementType(field_to_transpose(idx));
                 });
     } else {
         using IdxRangeParallel = ddc::detail::convert_type_seq_to_discrete_domain_t<
@@ -74,7 +236,8 @@ Field<ElementType, IdxRangeIn, MemorySpace, LayoutStridedPolicyOut> transpose_la
                 parallel_idx_range,
                 KOKKOS_LAMBDA(IdxParallel p_idx) {
                     for (IdxSerial s_idx : serial_idx_range) {
-                        transposed_field(p_idx, s_idx) = field_to_transpose(p_idx, s_idx);
+                        transposed_field(p_idx, s_idx)
+                                = ElementType(field_to_transpose(p_idx, s_idx));
                     }
                 });
     }
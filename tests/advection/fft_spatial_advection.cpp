@@ -0,0 +1,272 @@
+// SPDX-License-Identifier: MIT
+/*
+    Advection along X on (Sp, Vx, X) and on (Sp, Vx, Vy, X, Y) with the FFTAdvectionSpatial
+    operator. The advection is an exact shift so the error should be at the level of the
+    round-off.
+*/
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "fft_advection_x.hpp"
+#include "species_info.hpp"
+
+
+namespace {
+/// @brief A class which describes the real space in the first spatial direction X.
+struct X
+{
+    /// @brief A boolean indicating if the dimension is periodic.
+    static bool constexpr PERIODIC = true;
+};
+/// @brief A class which describes the real space in the second spatial direction Y.
+struct Y
+{
+    /// @brief A boolean indicating if the dimension is periodic.
+    static bool constexpr PERIODIC = true;
+};
+/// @brief A class which describes the real space in the first velocity direction Vx.
+struct Vx
+{
+    /// @brief A boolean indicating if the dimension is periodic.
+    static bool constexpr PERIODIC = false;
+};
+/// @brief A class which describes the real space in the second velocity direction Vy.
+struct Vy
+{
+    /// @brief A boolean indicating if the dimension is periodic.
+    static bool constexpr PERIODIC = false;
+};
+
+using CoordX = Coord<X>;
+using CoordY = Coord<Y>;
+using CoordVx = Coord<Vx>;
+using CoordVy = Coord<Vy>;
+
+struct GridX : UniformGridBase<X>
+{
+};
+struct GridY : UniformGridBase<Y>
+{
+};
+struct GridVx : UniformGridBase<Vx>
+{
+};
+struct GridVy : UniformGridBase<Vy>
+{
+};
+
+using IdxX = Idx<GridX>;
+using IdxStepX = IdxStep<GridX>;
+using IdxRangeX = IdxRange<GridX>;
+
+using IdxY = Idx<GridY>;
+using IdxStepY = IdxStep<GridY>;
+using IdxRangeY = IdxRange<GridY>;
+
+using IdxVx = Idx<GridVx>;
+using IdxStepVx = IdxStep<GridVx>;
+using IdxRangeVx = IdxRange<GridVx>;
+
+using IdxVy = Idx<GridVy>;
+using IdxStepVy = IdxStep<GridVy>;
+using IdxRangeVy = IdxRange<GridVy>;
+
+using IdxSp = Idx<Species>;
+using IdxStepSp = IdxStep<Species>;
+using IdxRangeSp = IdxRange<Species>;
+
+using IdxSpVxX = Idx<Species, GridVx, GridX>;
+using IdxRangeSpVxX = IdxRange<Species, GridVx, GridX>;
+
+using IdxSpVxVyXY = Idx<Species, GridVx, GridVy, GridX, GridY>;
+using IdxRangeSpVxVyXY = IdxRange<Species, GridVx, GridVy, GridX, GridY>;
+
+using DFieldMemSp = DFieldMem<IdxRangeSp>;
+using DFieldMemSpVxX = DFieldMem<IdxRangeSpVxX>;
+using DFieldSpVxX = DField<IdxRangeSpVxX>;
+using DFieldMemSpVxVyXY = DFieldMem<IdxRangeSpVxVyXY>;
+using DFieldSpVxVyXY = DField<IdxRangeSpVxVyXY>;
+
+/// A geometry where the spatial dimension is the last dimension of the distribution function.
+class GeometryVxX
+{
+public:
+    template <class T>
+    using velocity_dim_for = std::conditional_t<std::is_same_v<T, GridX>, GridVx, void>;
+
+    using IdxRangeSpatial = IdxRangeX;
+
+    using IdxRangeVelocity = IdxRangeVx;
+
+    using IdxRangeFdistribu = IdxRangeSpVxX;
+};
+
+/**
+ * A 4D geometry where the advected dimension X is not the last dimension of the distribution
+ * function so only the lines along X must be transformed.
+ */
+class GeometryVxVyXY
+{
+public:
+    template <class T>
+    using velocity_dim_for = std::conditional_t<
+            std::is_same_v<T, GridX>,
+            GridVx,
+            std::conditional_t<std::is_same_v<T, GridY>, GridVy, void>>;
+
+    using IdxRangeSpatial = IdxRange<GridX, GridY>;
+
+    using IdxRangeVelocity = IdxRange<GridVx, GridVy>;
+
+    using IdxRangeFdistribu = IdxRangeSpVxVyXY;
+};
+
+class FFTSpatialAdvectionTest : public ::testing::Test
+{
+protected:
+    static constexpr IdxStepX x_size = IdxStepX(64);
+    static constexpr IdxStepVx vx_size = IdxStepVx(21);
+    static constexpr IdxStepY y_size = IdxStepY(16);
+    static constexpr IdxStepVy vy_size = IdxStepVy(7);
+
+    IdxRangeX const idx_range_x;
+    IdxRangeVx const idx_range_vx;
+    IdxRangeY const idx_range_y;
+    IdxRangeVy const idx_range_vy;
+    IdxRangeSp const idx_range_allsp;
+
+public:
+    FFTSpatialAdvectionTest()
+        : idx_range_x(IdxX(0), x_size)
+        , idx_range_vx(IdxVx(0), vx_size)
+        , idx_range_y(IdxY(0), y_size)
+        , idx_range_vy(IdxVy(0), vy_size)
+        , idx_range_allsp(IdxSp(0), IdxStepSp(2))
+    {
+    }
+
+    static void SetUpTestSuite()
+    {
+        // The periodic point x_max is not included in the index range
+        ddc::init_discrete_space<GridX>(
+                GridX::init<GridX>(CoordX(-M_PI), CoordX(M_PI), x_size + 1));
+        ddc::init_discrete_space<GridVx>(
+                GridVx::init<GridVx>(CoordVx(-6.), CoordVx(6.), vx_size));
+        ddc::init_discrete_space<GridY>(
+                GridY::init<GridY>(CoordY(0.), CoordY(2 * M_PI), y_size + 1));
+        ddc::init_discrete_space<GridVy>(
+                GridVy::init<GridVy>(CoordVy(-6.), CoordVy(6.), vy_size));
+
+        // Electrons and ions with a mass ratio of 4
+        IdxRangeSp const idx_range_allsp(IdxSp(0), IdxStepSp(2));
+        host_t<DFieldMemSp> masses_host(idx_range_allsp);
+        host_t<DFieldMemSp> charges_host(idx_range_allsp);
+        masses_host(idx_range_allsp.front()) = 1.;
+        masses_host(idx_range_allsp.back()) = 4.;
+        charges_host(idx_range_allsp.front()) = -1.;
+        charges_host(idx_range_allsp.back()) = 1.;
+        ddc::init_discrete_space<Species>(std::move(charges_host), std::move(masses_host));
+    }
+};
+
+double fft_spatial_advection_error(
+        IAdvectionSpatial<GeometryVxX, GridX> const& advection_x,
+        IdxRangeSpVxX const mesh,
+        double const timestep)
+{
+    DFieldMemSpVxX allfdistribu_alloc(mesh);
+    DFieldSpVxX allfdistribu = get_field(allfdistribu_alloc);
+
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            mesh,
+            KOKKOS_LAMBDA(IdxSpVxX const ispvxx) {
+                double const x = ddc::coordinate(ddc::select<GridX>(ispvxx));
+                allfdistribu(ispvxx) = Kokkos::cos(x) + 0.5 * Kokkos::sin(3 * x);
+            });
+
+    advection_x(allfdistribu, timestep);
+
+    return ddc::parallel_transform_reduce(
+            Kokkos::DefaultExecutionSpace(),
+            mesh,
+            0.0,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(IdxSpVxX const ispvxx) {
+                IdxSp const isp(ispvxx);
+                double const x = ddc::coordinate(ddc::select<GridX>(ispvxx));
+                double const vx = ddc::coordinate(ddc::select<GridVx>(ispvxx));
+                double const dx = Kokkos::sqrt(mass(ielec()) / mass(isp)) * vx * timestep;
+                return Kokkos::abs(
+                        allfdistribu(ispvxx)
+                        - (Kokkos::cos(x - dx) + 0.5 * Kokkos::sin(3 * (x - dx))));
+            });
+}
+
+double fft_spatial_advection_error_4d(
+        IAdvectionSpatial<GeometryVxVyXY, GridX> const& advection_x,
+        IdxRangeSpVxVyXY const mesh,
+        double const timestep)
+{
+    DFieldMemSpVxVyXY allfdistribu_alloc(mesh);
+    DFieldSpVxVyXY allfdistribu = get_field(allfdistribu_alloc);
+
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            mesh,
+            KOKKOS_LAMBDA(IdxSpVxVyXY const ispvxvyxy) {
+                double const x = ddc::coordinate(ddc::select<GridX>(ispvxvyxy));
+                double const y = ddc::coordinate(ddc::select<GridY>(ispvxvyxy));
+                double const vy = ddc::coordinate(ddc::select<GridVy>(ispvxvyxy));
+                allfdistribu(ispvxvyxy) = (Kokkos::cos(x) + 0.5 * Kokkos::sin(3 * x))
+                                          * (1.0 + 0.5 * Kokkos::sin(2 * y) + 0.1 * vy);
+            });
+
+    advection_x(allfdistribu, timestep);
+
+    // The function is only shifted along x, its dependency on y and vy is unchanged
+    return ddc::parallel_transform_reduce(
+            Kokkos::DefaultExecutionSpace(),
+            mesh,
+            0.0,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(IdxSpVxVyXY const ispvxvyxy) {
+                IdxSp const isp(ispvxvyxy);
+                double const x = ddc::coordinate(ddc::select<GridX>(ispvxvyxy));
+                double const y = ddc::coordinate(ddc::select<GridY>(ispvxvyxy));
+                double const vx = ddc::coordinate(ddc::select<GridVx>(ispvxvyxy));
+                double const vy = ddc::coordinate(ddc::select<GridVy>(ispvxvyxy));
+                double const dx = Kokkos::sqrt(mass(ielec()) / mass(isp)) * vx * timestep;
+                return Kokkos::abs(
+                        allfdistribu(ispvxvyxy)
+                        - (Kokkos::cos(x - dx) + 0.5 * Kokkos::sin(3 * (x - dx)))
+                                  * (1.0 + 0.5 * Kokkos::sin(2 * y) + 0.1 * vy));
+            });
+}
+
+} // namespace
+
+
+TEST_F(FFTSpatialAdvectionTest, ExactShift)
+{
+    IdxRangeSpVxX const mesh(idx_range_allsp, idx_range_vx, idx_range_x);
+
+    FFTAdvectionSpatial<GeometryVxX, GridX> const fft_advection_x(mesh);
+
+    double const err = fft_spatial_advection_error(fft_advection_x, mesh, 0.1);
+    EXPECT_LE(err, 1.e-12);
+}
+
+TEST_F(FFTSpatialAdvectionTest, ExactShift4D)
+{
+    IdxRangeSpVxVyXY const
+            mesh(idx_range_allsp, idx_range_vx, idx_range_vy, idx_range_x, idx_range_y);
+
+    FFTAdvectionSpatial<GeometryVxVyXY, GridX> const fft_advection_x(mesh);
+
+    double const err = fft_spatial_advection_error_4d(fft_advection_x, mesh, 0.1);
+    EXPECT_LE(err, 1.e-12);
+}
@@ -0,0 +1,282 @@
+// SPDX-License-Identifier: MIT
+#include <stdexcept>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+#include <paraconf.h>
+
+#include "collision_common_configuration.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "species_info.hpp"
+
+namespace {
+
+struct R
+{
+};
+struct Theta
+{
+};
+struct Vpar
+{
+};
+struct Mu
+{
+};
+
+struct GridR : UniformGridBase<R>
+{
+};
+struct GridTheta : UniformGridBase<Theta>
+{
+};
+struct GridVpar : UniformGridBase<Vpar>
+{
+};
+struct GridMu : UniformGridBase<Mu>
+{
+};
+
+using IdxR = Idx<GridR>;
+using IdxTheta = Idx<GridTheta>;
+using IdxVpar = Idx<GridVpar>;
+using IdxMu = Idx<GridMu>;
+
+using IdxStepR = IdxStep<GridR>;
+using IdxStepTheta = IdxStep<GridTheta>;
+using IdxStepVpar = IdxStep<GridVpar>;
+using IdxStepMu = IdxStep<GridMu>;
+
+using IdxRangeR = IdxRange<GridR>;
+using IdxRangeTheta = IdxRange<GridTheta>;
+using IdxRangeVpar = IdxRange<GridVpar>;
+using IdxRangeMu = IdxRange<GridMu>;
+using IdxRangeSpVpar = IdxRange<Species, GridVpar>;
+using IdxRangeSpRThetaVparMu = IdxRange<Species, GridR, GridTheta, GridVpar, GridMu>;
+
+using ConfigurationData = detail::CollisionConfigurationData<
+        IdxRangeSpRThetaVparMu,
+        Species,
+        detail::InternalSpoofGridPhi,
+        GridR,
+        GridTheta,
+        GridVpar,
+        GridMu>;
+
+template <class IdxRangeLocal, class IdxRangeGlobal>
+bool is_restriction_of(
+        DConstField<IdxRangeLocal> const local_field,
+        DConstField<IdxRangeGlobal> const global_field)
+{
+    auto local_field_host = ddc::create_mirror_view_and_copy(local_field);
+    auto global_field_host = ddc::create_mirror_view_and_copy(global_field);
+    bool success = true;
+    ddc::for_each(get_idx_range(local_field_host), [&](auto idx) {
+        success = success && (local_field_host(idx) == global_field_host(idx));
+    });
+    return success;
+}
+
+void fill_bstar(DField<IdxRangeSpVpar> const bstar_s)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(bstar_s),
+            KOKKOS_LAMBDA(Idx<Species, GridVpar> const isp_vpar) {
+                bstar_s(isp_vpar) = 1.0 + (IdxSp(isp_vpar) - IdxSp(0)).value()
+                                    + 0.1 * ddc::coordinate(IdxVpar(isp_vpar));
+            });
+}
+
+class CollisionConfigurationDistributed : public ::testing::Test
+{
+protected:
+    static constexpr IdxStepR r_size = IdxStepR(8);
+    static constexpr IdxStepTheta theta_size = IdxStepTheta(4);
+    static constexpr IdxStepVpar vpar_size = IdxStepVpar(6);
+    static constexpr IdxStepMu mu_size = IdxStepMu(5);
+    static constexpr IdxStepSp nb_species = IdxStepSp(2);
+
+    IdxRangeSpRThetaVparMu const global_idx_range;
+
+    DFieldMem<IdxRangeMu> coeff_intdmu;
+    DFieldMem<IdxRangeVpar> coeff_intdvpar;
+
+    PC_tree_t conf_collisions;
+
+public:
+    CollisionConfigurationDistributed()
+        : global_idx_range(
+                IdxRangeSp(IdxSp(0), nb_species),
+                IdxRangeR(IdxR(0), r_size),
+                IdxRangeTheta(IdxTheta(0), theta_size),
+                IdxRangeVpar(IdxVpar(0), vpar_size),
+                IdxRangeMu(IdxMu(0), mu_size))
+        , coeff_intdmu(IdxRangeMu(IdxMu(0), mu_size))
+        , coeff_intdvpar(IdxRangeVpar(IdxVpar(0), vpar_size))
+        , conf_collisions(PC_parse_string("Collisions:\n  interspecies: true\n"))
+    {
+        ddc::parallel_fill(get_field(coeff_intdmu), 1.0);
+        ddc::parallel_fill(get_field(coeff_intdvpar), 1.0);
+    }
+
+    ~CollisionConfigurationDistributed() override
+    {
+        PC_tree_destroy(&conf_collisions);
+    }
+
+    static void SetUpTestSuite()
+    {
+        ddc::init_discrete_space<GridR>(GridR::init<GridR>(Coord<R>(0.), Coord<R>(1.), r_size));
+        ddc::init_discrete_space<GridTheta>(
+                GridTheta::init<GridTheta>(Coord<Theta>(0.), Coord<Theta>(1.), theta_size));
+        ddc::init_discrete_space<GridVpar>(
+                GridVpar::init<GridVpar>(Coord<Vpar>(-3.), Coord<Vpar>(3.), vpar_size));
+        ddc::init_discrete_space<GridMu>(
+                GridMu::init<GridMu>(Coord<Mu>(0.), Coord<Mu>(6.), mu_size));
+
+        IdxRangeSp const idx_range_sp(IdxSp(0), nb_species);
+        host_t<DFieldMemSp> charges(idx_range_sp);
+        host_t<DFieldMemSp> masses(idx_range_sp);
+        charges(idx_range_sp.front()) = 1.;
+        charges(idx_range_sp.back()) = -1.;
+        masses(idx_range_sp.front()) = 1.;
+        masses(idx_range_sp.back()) = 0.01;
+        ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+    }
+};
+
+} // namespace
+
+TEST_F(CollisionConfigurationDistributed, LocalMatchesSerial)
+{
+    ConfigurationData const serial_configuration(
+            conf_collisions,
+            global_idx_range,
+            get_const_field(coeff_intdmu),
+            get_const_field(coeff_intdvpar));
+
+    // Split the r dimension in 2 and the theta dimension in 2 as an MPILayout would
+    IdxRangeR const global_idx_range_r(global_idx_range);
+    IdxRangeTheta const global_idx_range_theta(global_idx_range);
+    for (int rank_r(0); rank_r < 2; ++rank_r) {
+        for (int rank_theta(0); rank_theta < 2; ++rank_theta) {
+            IdxRangeR const local_idx_range_r(
+                    IdxR(rank_r * r_size.value() / 2),
+                    IdxStepR(r_size.value() / 2));
+            IdxRangeTheta const local_idx_range_theta(
+                    IdxTheta(rank_theta * theta_size.value() / 2),
+                    IdxStepTheta(theta_size.value() / 2));
+            IdxRangeSpRThetaVparMu const local_idx_range(
+                    IdxRangeSp(global_idx_range),
+                    local_idx_range_r,
+                    local_idx_range_theta,
+                    IdxRangeVpar(global_idx_range),
+                    IdxRangeMu(global_idx_range));
+
+            ConfigurationData const local_configuration(
+                    conf_collisions,
+                    global_idx_range,
+                    local_idx_range,
+                    get_const_field(coeff_intdmu),
+                    get_const_field(coeff_intdvpar));
+
+            // The extents passed to Koliop are the global ones
+            EXPECT_EQ(local_configuration.m_r_extent, serial_configuration.m_r_extent);
+            EXPECT_EQ(local_configuration.m_theta_extent, serial_configuration.m_theta_extent);
+            EXPECT_EQ(local_configuration.m_phi_extent, serial_configuration.m_phi_extent);
+            EXPECT_EQ(local_configuration.m_sp_extent, serial_configuration.m_sp_extent);
+            EXPECT_EQ(local_configuration.m_vpar_extent, serial_configuration.m_vpar_extent);
+            EXPECT_EQ(local_configuration.m_mu_extent, serial_configuration.m_mu_extent);
+            EXPECT_EQ(local_configuration.m_local_r_extent, local_idx_range_r.size());
+            EXPECT_EQ(local_configuration.m_local_theta_extent, local_idx_range_theta.size());
+            EXPECT_EQ(
+                    local_configuration.m_local_r_offset,
+                    std::size_t((local_idx_range_r.front() - global_idx_range_r.front()).value()));
+            EXPECT_EQ(
+                    local_configuration.m_local_theta_offset,
+                    std::size_t((local_idx_range_theta.front() - global_idx_range_theta.front())
+                                        .value()));
+
+            // The local fields are the serial fields restricted to the local index range
+            EXPECT_EQ(
+                    get_idx_range(local_configuration.m_mask_LIM_allocation),
+                    IdxRange<GridTheta, GridR>(local_idx_range_theta, local_idx_range_r));
+            EXPECT_TRUE(is_restriction_of(
+                    get_const_field(local_configuration.m_hat_As_allocation),
+                    get_const_field(serial_configuration.m_hat_As_allocation)));
+            EXPECT_TRUE(is_restriction_of(
+                    get_const_field(local_configuration.m_hat_Zs_allocation),
+                    get_const_field(serial_configuration.m_hat_Zs_allocation)));
+            EXPECT_TRUE(is_restriction_of(
+                    get_const_field(local_configuration.m_mask_buffer_r_allocation),
+                    get_const_field(serial_configuration.m_mask_buffer_r_allocation)));
+            EXPECT_TRUE(is_restriction_of(
+                    get_const_field(local_configuration.m_mask_LIM_allocation),
+                    get_const_field(serial_configuration.m_mask_LIM_allocation)));
+            EXPECT_TRUE(is_restriction_of(
+                    get_const_field(local_configuration.m_mug_allocation),
+                    get_const_field(serial_configuration.m_mug_allocation)));
+            EXPECT_TRUE(is_restriction_of(
+                    get_const_field(local_configuration.m_vparg_allocation),
+                    get_const_field(serial_configuration.m_vparg_allocation)));
+        }
+    }
+}
+
+TEST_F(CollisionConfigurationDistributed, ReplicatedBstar)
+{
+    IdxRangeSpVpar const idx_range_spvpar(global_idx_range);
+    DFieldMem<IdxRangeSpVpar> bstar_s_alloc(idx_range_spvpar);
+    fill_bstar(get_field(bstar_s_alloc));
+
+    IdxRangeSpRThetaVparMu const local_idx_range(
+            IdxRangeSp(global_idx_range),
+            IdxRangeR(IdxR(r_size.value() / 2), IdxStepR(r_size.value() / 2)),
+            IdxRangeTheta(global_idx_range),
+            IdxRangeVpar(global_idx_range),
+            IdxRangeMu(global_idx_range));
+
+    ConfigurationData serial_configuration(
+            conf_collisions,
+            global_idx_range,
+            get_const_field(coeff_intdmu),
+            get_const_field(coeff_intdvpar));
+    ConfigurationData local_configuration(
+            conf_collisions,
+            global_idx_range,
+            local_idx_range,
+            get_const_field(coeff_intdmu),
+            get_const_field(coeff_intdvpar));
+
+    ConfigurationData::transpose_replicate_deep_copy(
+            get_field(serial_configuration.m_Bstar_s_allocation),
+            get_const_field(bstar_s_alloc));
+    ConfigurationData::transpose_replicate_deep_copy(
+            get_field(local_configuration.m_Bstar_s_allocation),
+            get_const_field(bstar_s_alloc));
+
+    EXPECT_TRUE(is_restriction_of(
+            get_const_field(local_configuration.m_Bstar_s_allocation),
+            get_const_field(serial_configuration.m_Bstar_s_allocation)));
+}
+
+TEST_F(CollisionConfigurationDistributed, VelocityDistributionThrows)
+{
+    IdxRangeSpRThetaVparMu const local_idx_range(
+            IdxRangeSp(global_idx_range),
+            IdxRangeR(global_idx_range),
+            IdxRangeTheta(global_idx_range),
+            IdxRangeVpar(IdxVpar(0), IdxStepVpar(vpar_size.value() / 2)),
+            IdxRangeMu(global_idx_range));
+    EXPECT_THROW(
+            ConfigurationData(
+                    conf_collisions,
+                    global_idx_range,
+                    local_idx_range,
+                    get_const_field(coeff_intdmu),
+                    get_const_field(coeff_intdvpar)),
+            std::invalid_argument);
+}
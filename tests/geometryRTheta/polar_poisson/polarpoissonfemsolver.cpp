@@ -28,6 +28,21 @@ using PoissonSolver = PolarSplineFEMPoissonLikeSolver<
         PolarBSplinesRTheta,
         SplineRThetaEvaluatorNullBound>;
 
+#if defined(MATRIX_FREE)
+constexpr PoissonSolver::OperatorStorage operator_storage
+        = PoissonSolver::OperatorStorage::MatrixFree;
+#else
+constexpr PoissonSolver::OperatorStorage operator_storage
+        = PoissonSolver::OperatorStorage::Assembled;
+#endif
+
+#if defined(RADIAL_LINE_BLOCK)
+constexpr PoissonSolver::Preconditioner preconditioner
+        = PoissonSolver::Preconditioner::RadialLineBlock;
+#else
+constexpr PoissonSolver::Preconditioner preconditioner = PoissonSolver::Preconditioner::Jacobi;
+#endif
+
 #if defined(CIRCULAR_MAPPING)
 using Mapping = CircularToCartesian<R, Theta, X, Y>;
 #elif defined(CZARNY_MAPPING)
@@ -185,13 +200,30 @@ int main(int argc, char** argv)
             solver(get_const_field(coeff_alpha_spline),
                    get_const_field(coeff_beta_spline),
                    discrete_mapping,
-                   evaluator);
+                   evaluator,
+                   OperatorCache(false),
+                   operator_storage,
+                   preconditioner);
 
     end_time = std::chrono::system_clock::now();
     std::cout << "Poisson initialisation time : "
               << std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time)
                          .count()
               << "ms" << std::endl;
+    start_time = std::chrono::system_clock::now();
+
+    // The solution must not depend on the coefficients having been updated
+    solver.update_coefficients(
+            get_const_field(coeff_alpha_spline),
+            get_const_field(coeff_beta_spline),
+            discrete_mapping,
+            evaluator);
+
+    end_time = std::chrono::system_clock::now();
+    std::cout << "Poisson coefficient update time : "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time)
+                         .count()
+              << "ms" << std::endl;
 
     LHSFunction lhs(mapping);
     RHSFunction rhs(mapping);
@@ -236,6 +268,7 @@ int main(int argc, char** argv)
               << std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time)
                          .count()
               << "ms" << std::endl;
+    std::cout << "Solver iterations : " << solver.get_n_iterations() << std::endl;
 
     double max_err = 0.0;
     ddc::for_each(grid, [&](IdxRTheta const irtheta) {
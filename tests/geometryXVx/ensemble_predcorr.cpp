@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/fft.hpp>
+
+#include <gtest/gtest.h>
+
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "bsl_advection_vx.hpp"
+#include "bsl_advection_x.hpp"
+#include "chargedensitycalculator.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "ensemble_predcorr.hpp"
+#include "ensembleqnsolver.hpp"
+#include "fft_poisson_solver.hpp"
+#include "geometry.hpp"
+#include "maxwellianequilibrium.hpp"
+#include "neumann_spline_quadrature.hpp"
+#include "predcorr.hpp"
+#include "qnsolver.hpp"
+#include "singlemodeperturbinitialisation.hpp"
+#include "species_info.hpp"
+#include "spline_interpolator.hpp"
+#include "splitvlasovsolver.hpp"
+
+namespace {
+
+/// Run a Landau damping simulation of a single member of the ensemble.
+host_t<DFieldMemSpXVx> run_single_member(
+        IdxRangeSpXVx const meshSpXVx,
+        DConstFieldSpVx const allfequilibrium,
+        int const perturb_mode,
+        double const perturb_amplitude,
+        double const dt,
+        int const nbiter)
+{
+    IdxRangeSp const idx_range_sp = ddc::select<Species>(meshSpXVx);
+    IdxRangeX const mesh_x = ddc::select<GridX>(meshSpXVx);
+    IdxRangeVx const mesh_vx = ddc::select<GridVx>(meshSpXVx);
+    IdxRangeXVx const meshXVx(mesh_x, mesh_vx);
+
+    host_t<IFieldMemSp> init_perturb_mode(idx_range_sp);
+    host_t<DFieldMemSp> init_perturb_amplitude(idx_range_sp);
+    ddc::parallel_fill(init_perturb_mode, perturb_mode);
+    ddc::parallel_fill(init_perturb_amplitude, perturb_amplitude);
+    SingleModePerturbInitialisation const
+            init(allfequilibrium, std::move(init_perturb_mode), std::move(init_perturb_amplitude));
+    DFieldMemSpXVx allfdistribu(meshSpXVx);
+    init(get_field(allfdistribu));
+
+    SplineXBuilder const builder_x(meshXVx);
+    SplineVxBuilder const builder_vx(meshXVx);
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+    ddc::ConstantExtrapolationRule<Vx> bv_v_min(ddc::coordinate(mesh_vx.front()));
+    ddc::ConstantExtrapolationRule<Vx> bv_v_max(ddc::coordinate(mesh_vx.back()));
+    SplineVxEvaluator const spline_vx_evaluator(bv_v_min, bv_v_max);
+    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+
+    BslAdvectionSpatial<GeometryXVx, GridX> const advection_x(spline_x_interpolator);
+    BslAdvectionVelocity<GeometryXVx, GridVx> const advection_vx(spline_vx_interpolator);
+    SplitVlasovSolver const vlasov(advection_x, advection_vx);
+
+    DFieldMemVx const quadrature_coeffs(neumann_spline_quadrature_coefficients<
+                                        Kokkos::DefaultExecutionSpace>(mesh_vx, builder_vx));
+    ChargeDensityCalculator const rhs(get_const_field(quadrature_coeffs));
+    FFTPoissonSolver<IdxRangeX> const fft_poisson_solver(mesh_x);
+    QNSolver const poisson(fft_poisson_solver, rhs);
+
+    PredCorr const predcorr(vlasov, poisson);
+    predcorr(get_field(allfdistribu), 0., dt, nbiter);
+
+    return ddc::create_mirror_view_and_copy(get_field(allfdistribu));
+}
+
+/// Run all the members of the ensemble as a single batched simulation.
+host_t<DFieldMemSpEnsXVx> run_ensemble(
+        IdxRangeSpEnsXVx const meshSpEnsXVx,
+        DConstFieldSpVx const allfequilibrium,
+        host_t<FieldMemEnsemble<int>> perturb_mode,
+        host_t<DFieldMemEnsemble> perturb_amplitude,
+        double const dt,
+        int const nbiter)
+{
+    IdxRangeX const mesh_x = ddc::select<GridX>(meshSpEnsXVx);
+    IdxRangeVx const mesh_vx = ddc::select<GridVx>(meshSpEnsXVx);
+    IdxRangeEnsXVx const meshEnsXVx(meshSpEnsXVx);
+
+    SingleModePerturbEnsembleInitialisation const
+            init(allfequilibrium, std::move(perturb_mode), std::move(perturb_amplitude));
+    DFieldMemSpEnsXVx allfdistribu(meshSpEnsXVx);
+    init(get_field(allfdistribu));
+
+    SplineXBuilder_EnsXVx const builder_x(meshEnsXVx);
+    SplineVxBuilder_EnsXVx const builder_vx(meshEnsXVx);
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator_EnsXVx const spline_x_evaluator(bv_x_min, bv_x_max);
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+    ddc::ConstantExtrapolationRule<Vx> bv_v_min(ddc::coordinate(mesh_vx.front()));
+    ddc::ConstantExtrapolationRule<Vx> bv_v_max(ddc::coordinate(mesh_vx.back()));
+    SplineVxEvaluator_EnsXVx const spline_vx_evaluator(bv_v_min, bv_v_max);
+    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+
+    BslAdvectionSpatial<GeometryEnsXVx, GridX> const advection_x(spline_x_interpolator);
+    BslAdvectionVelocity<GeometryEnsXVx, GridVx> const advection_vx(spline_vx_interpolator);
+
+    DFieldMemVx const quadrature_coeffs(neumann_spline_quadrature_coefficients<
+                                        Kokkos::DefaultExecutionSpace>(mesh_vx, builder_vx));
+    FFTPoissonSolver<IdxRangeX, IdxRangeEnsX> const fft_poisson_solver(mesh_x);
+    EnsembleQNSolver const poisson(fft_poisson_solver, get_const_field(quadrature_coeffs));
+
+    EnsemblePredCorr const predcorr(advection_x, advection_vx, poisson);
+    predcorr(get_field(allfdistribu), 0., dt, nbiter);
+
+    return ddc::create_mirror_view_and_copy(get_field(allfdistribu));
+}
+
+} // namespace
+
+TEST(EnsemblePredCorr, MatchesIndependentRuns)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    CoordX const x_min(0.0);
+    CoordX const x_max(4 * M_PI);
+    IdxStepX const x_ncells(32);
+    CoordVx const vx_min(-6.0);
+    CoordVx const vx_max(6.0);
+    IdxStepVx const vx_ncells(31);
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_ncells);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_ncells);
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+    IdxRangeX const mesh_x(SplineInterpPointsX::get_domain<GridX>());
+    IdxRangeVx const mesh_vx(SplineInterpPointsVx::get_domain<GridVx>());
+
+    // A single kinetic species of electrons with a uniform neutralising background
+    IdxRangeSp const idx_range_sp(IdxSp(0), IdxStepSp(1));
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    ddc::parallel_fill(charges, -1.);
+    ddc::parallel_fill(masses, 1.);
+    ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+    IdxRangeSpVx const meshSpVx(idx_range_sp, mesh_vx);
+    host_t<DFieldMemSp> density_eq(idx_range_sp);
+    host_t<DFieldMemSp> temperature_eq(idx_range_sp);
+    host_t<DFieldMemSp> mean_velocity_eq(idx_range_sp);
+    ddc::parallel_fill(density_eq, 1.);
+    ddc::parallel_fill(temperature_eq, 1.);
+    ddc::parallel_fill(mean_velocity_eq, 0.);
+    MaxwellianEquilibrium const init_fequilibrium(
+            std::move(density_eq),
+            std::move(temperature_eq),
+            std::move(mean_velocity_eq));
+    DFieldMemSpVx allfequilibrium(meshSpVx);
+    init_fequilibrium(get_field(allfequilibrium));
+
+    // The members of the ensemble differ by their perturbation mode and amplitude
+    IdxRangeEnsemble const idx_range_ensemble(IdxEnsemble(0), IdxStepEnsemble(3));
+    host_t<FieldMemEnsemble<int>> perturb_mode(idx_range_ensemble);
+    host_t<DFieldMemEnsemble> perturb_amplitude(idx_range_ensemble);
+    IdxEnsemble const ie0 = idx_range_ensemble.front();
+    perturb_mode(ie0) = 1;
+    perturb_mode(ie0 + 1) = 2;
+    perturb_mode(ie0 + 2) = 1;
+    perturb_amplitude(ie0) = 0.01;
+    perturb_amplitude(ie0 + 1) = 0.01;
+    perturb_amplitude(ie0 + 2) = 0.1;
+
+    double const dt = 0.1;
+    int const nbiter = 10;
+
+    IdxRangeSpEnsXVx const meshSpEnsXVx(idx_range_sp, idx_range_ensemble, mesh_x, mesh_vx);
+    host_t<DFieldMemSpEnsXVx> allfdistribu_ensemble = run_ensemble(
+            meshSpEnsXVx,
+            get_const_field(allfequilibrium),
+            ddc::create_mirror_and_copy(get_const_field(perturb_mode)),
+            ddc::create_mirror_and_copy(get_const_field(perturb_amplitude)),
+            dt,
+            nbiter);
+
+    IdxRangeSpXVx const meshSpXVx(idx_range_sp, mesh_x, mesh_vx);
+    for (IdxEnsemble const ie : idx_range_ensemble) {
+        host_t<DFieldMemSpXVx> allfdistribu_single = run_single_member(
+                meshSpXVx,
+                get_const_field(allfequilibrium),
+                perturb_mode(ie),
+                perturb_amplitude(ie),
+                dt,
+                nbiter);
+        double max_error = 0.;
+        ddc::for_each(meshSpXVx, [&](IdxSpXVx const ispxvx) {
+            IdxSp const isp(ispxvx);
+            IdxX const ix(ispxvx);
+            IdxVx const ivx(ispxvx);
+            max_error = std::max(
+                    max_error,
+                    std::abs(
+                            allfdistribu_ensemble(isp, ie, ix, ivx)
+                            - allfdistribu_single(ispxvx)));
+        });
+        EXPECT_LE(max_error, 1e-12);
+    }
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: MIT
+
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "field_extrapolation_time_solver.hpp"
+#include "geometry.hpp"
+#include "iboltzmannsolver.hpp"
+#include "iqnsolver.hpp"
+
+namespace {
+
+/**
+ * A Boltzmann solver which adds dt to the (constant) distribution function so that f(t) = t.
+ * The arguments of each call are recorded.
+ */
+class LinearBoltzmannSolver : public IBoltzmannSolver
+{
+public:
+    mutable std::vector<double> m_dt;
+    mutable std::vector<double> m_efield;
+    mutable std::vector<double> m_fdistribu;
+
+    DFieldSpXVx operator()(
+            DFieldSpXVx const allfdistribu,
+            DConstFieldX const efield,
+            double const dt) const override
+    {
+        auto efield_host = ddc::create_mirror_view_and_copy(efield);
+        auto allfdistribu_host = ddc::create_mirror_view_and_copy(allfdistribu);
+        double const fdistribu = get_field(allfdistribu_host)(get_idx_range(allfdistribu).front());
+        m_dt.push_back(dt);
+        m_efield.push_back(get_field(efield_host)(get_idx_range(efield).front()));
+        m_fdistribu.push_back(fdistribu);
+        ddc::parallel_fill(allfdistribu, fdistribu + dt);
+        return allfdistribu;
+    }
+};
+
+/**
+ * A Quasi-Neutrality solver which sets the electric field to the value of the (constant)
+ * distribution function so that E(t) = t.
+ */
+class IdentityQNSolver : public IQNSolver
+{
+public:
+    void operator()(
+            DFieldX const electrostatic_potential,
+            DFieldX const electric_field,
+            DConstFieldSpXVx const allfdistribu) const override
+    {
+        auto allfdistribu_host = ddc::create_mirror_view_and_copy(allfdistribu);
+        double const fdistribu = get_field(allfdistribu_host)(get_idx_range(allfdistribu).front());
+        ddc::parallel_fill(electrostatic_potential, 0.);
+        ddc::parallel_fill(electric_field, fdistribu);
+    }
+};
+
+} // namespace
+
+TEST(FieldExtrapolationTimeSolver, ExtrapolatedField)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    IdxRangeSpXVx const idx_range(IdxSpXVx(0, 0, 0), IdxStepSpXVx(1, 2, 2));
+    DFieldMemSpXVx fdistribu(idx_range);
+    DFieldSpXVx const fdistribu_s(get_field(fdistribu));
+    ddc::parallel_fill(fdistribu_s, 0.);
+
+    LinearBoltzmannSolver const boltzmann_solver;
+    IdentityQNSolver const qn_solver;
+    FieldExtrapolationTimeSolver const time_solver(boltzmann_solver, qn_solver);
+
+    double const dt = 0.5;
+    int const steps = 4;
+    time_solver(fdistribu_s, 0., dt, steps);
+
+    // One predictor step at the start then a single Boltzmann solve per timestep
+    ASSERT_EQ(boltzmann_solver.m_dt.size(), std::size_t(steps + 1));
+    EXPECT_DOUBLE_EQ(boltzmann_solver.m_dt[0], dt / 2);
+    EXPECT_DOUBLE_EQ(boltzmann_solver.m_efield[0], 0.);
+    EXPECT_DOUBLE_EQ(boltzmann_solver.m_fdistribu[0], 0.);
+    for (int iter = 0; iter < steps; ++iter) {
+        // E(t) = t is linear so the field at the half timestep is exact
+        EXPECT_DOUBLE_EQ(boltzmann_solver.m_dt[iter + 1], dt);
+        EXPECT_DOUBLE_EQ(boltzmann_solver.m_efield[iter + 1], (iter + 0.5) * dt);
+        EXPECT_DOUBLE_EQ(boltzmann_solver.m_fdistribu[iter + 1], iter * dt);
+    }
+
+    auto fdistribu_host = ddc::create_mirror_view_and_copy(fdistribu_s);
+    EXPECT_DOUBLE_EQ(get_field(fdistribu_host)(idx_range.front()), steps * dt);
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
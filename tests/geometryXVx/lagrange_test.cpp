@@ -1,4 +1,5 @@
 #include <fstream>
+#include <optional>
 #include <random>
 #include <string>
 
@@ -167,3 +168,84 @@ TEST_P(LagrangeTestFixture, InterpolationError)
 }
 
 INSTANTIATE_TEST_SUITE_P(DegMesh, LagrangeTestFixture, ::testing::Values(3, 4, 5, 6, 7, 8, 9));
+
+// Here P stands for a periodic ad hoc geometry
+struct P
+{
+    static bool constexpr PERIODIC = true;
+};
+
+struct GridPUniform : UniformGridBase<P>
+{
+};
+
+struct GridPNonUniform : NonUniformGridBase<P>
+{
+};
+
+/**
+ * Interpolate a periodic function at points shifted by a constant displacement which moves
+ * some of them outside the domain and return the maximum error.
+ */
+template <class GridP>
+double periodic_lagrange_error(IdxRange<GridP> idx_range, int deg, bool precompute)
+{
+    double const shift = 0.7;
+    std::optional<LagrangeInterpolator<GridP, BCond::PERIODIC, BCond::PERIODIC, GridP>> interpolator;
+    if (precompute) {
+        interpolator.emplace(deg, IdxStep<GridP>(0), idx_range);
+    } else {
+        interpolator.emplace(deg, IdxStep<GridP>(0));
+    }
+
+    DFieldMem<IdxRange<GridP>> values_alloc(idx_range);
+    FieldMem<Coord<P>, IdxRange<GridP>> feet_alloc(idx_range);
+    DField<IdxRange<GridP>> values = get_field(values_alloc);
+    Field<Coord<P>, IdxRange<GridP>> feet = get_field(feet_alloc);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range,
+            KOKKOS_LAMBDA(Idx<GridP> const ix) {
+                double const x = ddc::coordinate(ix);
+                values(ix) = Kokkos::sin(x);
+                feet(ix) = Coord<P>(x + shift);
+            });
+    (*interpolator)(values, get_const_field(feet));
+
+    return ddc::parallel_transform_reduce(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range,
+            0.0,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(Idx<GridP> const ix) {
+                return Kokkos::abs(values(ix) - Kokkos::sin(double(feet(ix))));
+            });
+}
+
+TEST(LagrangePeriodic, Uniform)
+{
+    int const deg = 5;
+    IdxStep<GridPUniform> const n_points(64);
+    ddc::init_discrete_space<GridPUniform>(
+            GridPUniform::init(Coord<P>(0.0), Coord<P>(2 * M_PI), n_points + 1));
+    IdxRange<GridPUniform> const idx_range(Idx<GridPUniform>(0), n_points);
+
+    EXPECT_LE(periodic_lagrange_error(idx_range, deg, false), 1e-6);
+    EXPECT_LE(periodic_lagrange_error(idx_range, deg, true), 1e-6);
+}
+
+TEST(LagrangePeriodic, NonUniform)
+{
+    int const deg = 5;
+    IdxStep<GridPNonUniform> const n_points(64);
+    // The last break point is the periodic copy of the first point
+    std::vector<Coord<P>> const point_sampling = build_random_non_uniform_break_points(
+            Coord<P>(0.0),
+            Coord<P>(2 * M_PI),
+            n_points,
+            0.2);
+    ddc::init_discrete_space<GridPNonUniform>(point_sampling);
+    IdxRange<GridPNonUniform> const idx_range(Idx<GridPNonUniform>(0), n_points);
+
+    EXPECT_LE(periodic_lagrange_error(idx_range, deg, true), 1e-5);
+}
@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: MIT
+#include <cmath>
+
+#include <mpi.h>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "bsl_advection_vx.hpp"
+#include "bsl_advection_x.hpp"
+#include "chargedensitycalculator.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "geometry.hpp"
+#include "mpichargedensitycalculator.hpp"
+#include "mpisplitvlasovsolver.hpp"
+#include "mpitransposealltoall.hpp"
+#include "neumann_spline_quadrature.hpp"
+#include "species_info.hpp"
+#include "spline_interpolator.hpp"
+#include "splitvlasovsolver.hpp"
+
+namespace {
+
+/**
+ * Initialise a small mesh and two species. Both dimensions have an even number of points
+ * so they can be distributed over 2 MPI ranks.
+ */
+IdxRangeSpXVx init_global_idx_range()
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(2 * M_PI);
+    IdxStepX const x_ncells(8);
+    CoordVx const vx_min(-6.0);
+    CoordVx const vx_max(6.0);
+    IdxStepVx const vx_ncells(11);
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_ncells);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_ncells);
+
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+
+    IdxRangeSp const idx_range_sp(IdxSp(0), IdxStepSp(2));
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    charges(idx_range_sp.front()) = -1.;
+    charges(idx_range_sp.back()) = 1.;
+    masses(idx_range_sp.front()) = 0.01;
+    masses(idx_range_sp.back()) = 1.;
+    ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+    return IdxRangeSpXVx(
+            idx_range_sp,
+            SplineInterpPointsX::get_domain<GridX>(),
+            SplineInterpPointsVx::get_domain<GridVx>());
+}
+
+/// Fill a distribution function which varies in x and vx.
+void fill_fdistribu(DFieldSpXVx const allfdistribu)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(allfdistribu),
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                double const x = ddc::coordinate(IdxX(ispxvx));
+                double const vx = ddc::coordinate(IdxVx(ispxvx));
+                double const species_factor = 1.0 + (IdxSp(ispxvx) - IdxSp(0)).value();
+                allfdistribu(ispxvx) = species_factor * Kokkos::exp(-0.5 * vx * vx)
+                                       * (1.0 + 0.1 * species_factor * Kokkos::cos(x));
+            });
+}
+
+/// Fill an electric field which varies in x.
+void fill_electric_field(DFieldX const electric_field)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(electric_field),
+            KOKKOS_LAMBDA(IdxX const ix) {
+                electric_field(ix) = 0.1 * Kokkos::sin(ddc::coordinate(ix));
+            });
+}
+
+/// Copy the part of the global distribution function owned by this rank.
+DFieldMemSpXVx get_local_fdistribu(
+        DConstFieldSpXVx const global_allfdistribu,
+        IdxRangeSpXVx const local_idx_range)
+{
+    DFieldMemSpXVx local_allfdistribu(local_idx_range);
+    ddc::parallel_deepcopy(get_field(local_allfdistribu), global_allfdistribu[local_idx_range]);
+    return local_allfdistribu;
+}
+
+/// Compare a field with the restriction of a reference field to the same index range.
+template <class FieldType, class FieldRefType>
+void expect_fields_near(FieldType const field, FieldRefType const field_ref, double tol)
+{
+    auto field_host = ddc::create_mirror_view_and_copy(field);
+    auto field_ref_host = ddc::create_mirror_view_and_copy(field_ref);
+    ddc::for_each(get_idx_range(field_host), [&](auto const idx) {
+        EXPECT_NEAR(field_host(idx), field_ref_host(idx), tol);
+    });
+}
+
+} // namespace
+
+TEST(MpiChargeDensityCalculatorXVx, MatchesSerial)
+{
+    IdxRangeSpXVx const global_idx_range = init_global_idx_range();
+    IdxRangeX const idx_range_x(global_idx_range);
+    IdxRangeVx const idx_range_vx(global_idx_range);
+
+    int rank;
+    int comm_size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    IdxRangeSpXVx const local_idx_range
+            = VxSplit::distribute_idx_range(global_idx_range, comm_size, rank);
+    IdxRangeVx const local_idx_range_vx(local_idx_range);
+
+    DFieldMemSpXVx global_allfdistribu(global_idx_range);
+    fill_fdistribu(get_field(global_allfdistribu));
+    DFieldMemSpXVx local_allfdistribu
+            = get_local_fdistribu(get_const_field(global_allfdistribu), local_idx_range);
+
+    // The quadrature coefficients are computed on the global velocity grid then restricted
+    SplineVxBuilder_1d const builder_vx(idx_range_vx);
+    DFieldMemVx const quadrature_coeffs(neumann_spline_quadrature_coefficients<
+                                        Kokkos::DefaultExecutionSpace>(idx_range_vx, builder_vx));
+    DFieldMemVx local_quadrature_coeffs(local_idx_range_vx);
+    ddc::parallel_deepcopy(
+            get_field(local_quadrature_coeffs),
+            quadrature_coeffs[local_idx_range_vx]);
+
+    ChargeDensityCalculator const serial_rhs(get_const_field(quadrature_coeffs));
+    DFieldMemX rho_ref(idx_range_x);
+    serial_rhs(get_field(rho_ref), get_const_field(global_allfdistribu));
+
+    ChargeDensityCalculator const local_rhs(get_const_field(local_quadrature_coeffs));
+    MpiChargeDensityCalculator const mpi_rhs(MPI_COMM_WORLD, local_rhs);
+    DFieldMemX rho(idx_range_x);
+    mpi_rhs(get_field(rho), get_const_field(local_allfdistribu));
+
+    expect_fields_near(get_const_field(rho), get_const_field(rho_ref), 1e-12);
+}
+
+TEST(MpiSplitVlasovSolver, MatchesSerial)
+{
+    IdxRangeSpXVx const global_idx_range = init_global_idx_range();
+    IdxRangeX const idx_range_x(global_idx_range);
+    IdxRangeVx const idx_range_vx(global_idx_range);
+    IdxRangeXVx const idx_range_xvx(global_idx_range);
+
+    MPITransposeAllToAll<XSplit, VxSplit> transpose(global_idx_range, MPI_COMM_WORLD);
+    IdxRangeSpXVx const idxrange_vxsplit(transpose.get_local_idx_range<VxSplit>());
+    IdxRangeSpXVx const idxrange_xsplit(transpose.get_local_idx_range<XSplit>());
+
+    DFieldMemSpXVx global_allfdistribu(global_idx_range);
+    fill_fdistribu(get_field(global_allfdistribu));
+    DFieldMemSpXVx local_allfdistribu
+            = get_local_fdistribu(get_const_field(global_allfdistribu), idxrange_vxsplit);
+
+    DFieldMemX electric_field(idx_range_x);
+    fill_electric_field(get_field(electric_field));
+
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator const spline_x_evaluator(bv_x_min, bv_x_max);
+    ddc::ConstantExtrapolationRule<Vx> bv_v_min(ddc::coordinate(idx_range_vx.front()));
+    ddc::ConstantExtrapolationRule<Vx> bv_v_max(ddc::coordinate(idx_range_vx.back()));
+    SplineVxEvaluator const spline_vx_evaluator(bv_v_min, bv_v_max);
+
+    double const dt = 0.1;
+
+    // Serial reference on the whole distribution function
+    SplineXBuilder const builder_x(idx_range_xvx);
+    SplineVxBuilder const builder_vx(idx_range_xvx);
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+    BslAdvectionSpatial<GeometryXVx, GridX> const advection_x(spline_x_interpolator);
+    BslAdvectionVelocity<GeometryXVx, GridVx> const advection_vx(spline_vx_interpolator);
+    SplitVlasovSolver const serial_vlasov(advection_x, advection_vx);
+    serial_vlasov(get_field(global_allfdistribu), get_const_field(electric_field), dt);
+
+    // Distributed solve, each advection works on the layout where its dimension is local
+    SplineXBuilder const builder_x_vxsplit((IdxRangeXVx(idxrange_vxsplit)));
+    SplineVxBuilder const builder_vx_xsplit((IdxRangeXVx(idxrange_xsplit)));
+    PreallocatableSplineInterpolator const
+            spline_x_interpolator_vxsplit(builder_x_vxsplit, spline_x_evaluator);
+    PreallocatableSplineInterpolator const
+            spline_vx_interpolator_xsplit(builder_vx_xsplit, spline_vx_evaluator);
+    BslAdvectionSpatial<GeometryXVx, GridX> const advection_x_vxsplit(
+            spline_x_interpolator_vxsplit);
+    BslAdvectionVelocity<GeometryXVx, GridVx> const advection_vx_xsplit(
+            spline_vx_interpolator_xsplit);
+    MpiSplitVlasovSolver const mpi_vlasov(advection_x_vxsplit, advection_vx_xsplit, transpose);
+    mpi_vlasov(get_field(local_allfdistribu), get_const_field(electric_field), dt);
+
+    expect_fields_near(
+            get_const_field(local_allfdistribu),
+            get_const_field(global_allfdistribu),
+            1e-12);
+}
@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: MIT
+#include <cmath>
+#include <functional>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_helper.hpp"
+#include "geometry.hpp"
+#include "neumann_spline_quadrature.hpp"
+#include "quadrature.hpp"
+#include "reduced_diagnostics.hpp"
+#include "species_info.hpp"
+#include "trapezoid_quadrature.hpp"
+
+namespace {
+
+double const density = 1.5;
+double const temperature = 0.8;
+double const mean_velocity = 0.5;
+double const perturb_amplitude = 0.1;
+
+// The trapezoid rule in x is only second order on the non-uniform non-periodic grid
+double const rel_tol = 1e-5;
+
+/// Quadrature in x and vx: trapezoid rule in x, spline quadrature in vx.
+DFieldMem<IdxRangeXVx> get_quadrature_coeffs_xvx(
+        IdxRangeXVx const idx_range_xvx,
+        SplineVxBuilder_1d const& builder_vx)
+{
+    std::function<DFieldMemVx(IdxRangeVx)> const neumann_coeffs_vx
+            = [&](IdxRangeVx const idx_range_vx) {
+                  return neumann_spline_quadrature_coefficients<
+                          Kokkos::DefaultExecutionSpace>(idx_range_vx, builder_vx);
+              };
+    return quadrature_coeffs_nd<Kokkos::DefaultExecutionSpace>(
+            idx_range_xvx,
+            std::function<DFieldMemX(IdxRangeX)>(
+                    trapezoid_quadrature_coefficients_1d<Kokkos::DefaultExecutionSpace, GridX>),
+            neumann_coeffs_vx);
+}
+
+/**
+ * Fill the distribution function with the Maxwellian
+ * f(x, v) = (1 + eps cos(2 pi x / L)) n / sqrt(2 pi T) exp(-(v - u)^2 / (2 T)).
+ */
+void fill_maxwellian(
+        DFieldSpXVx const allfdistribu,
+        double const length_x,
+        double const amplitude = perturb_amplitude)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(allfdistribu),
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                double const x = ddc::coordinate(ddc::select<GridX>(ispxvx));
+                double const v = ddc::coordinate(ddc::select<GridVx>(ispxvx));
+                double const perturbation
+                        = 1. + amplitude * Kokkos::cos(2 * M_PI * x / length_x);
+                allfdistribu(ispxvx) = perturbation * density
+                                       / Kokkos::sqrt(2 * M_PI * temperature)
+                                       * Kokkos::exp(-(v - mean_velocity) * (v - mean_velocity)
+                                                     / (2 * temperature));
+            });
+}
+
+/// Fill a field with A cos(2 pi n x / L) + B sin(2 pi n x / L).
+void fill_mode(
+        DFieldX const field,
+        double const cos_amplitude,
+        double const sin_amplitude,
+        int const mode,
+        double const length_x)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(field),
+            KOKKOS_LAMBDA(IdxX const ix) {
+                double const kx = 2 * M_PI * mode / length_x;
+                double const x = ddc::coordinate(ix);
+                field(ix) = cos_amplitude * Kokkos::cos(kx * x)
+                            + sin_amplitude * Kokkos::sin(kx * x);
+            });
+}
+
+class ReducedDiagnosticsTest : public ::testing::Test
+{
+protected:
+    IdxRangeSp const idx_range_sp;
+    IdxRangeX const idx_range_x;
+    IdxRangeVx const idx_range_vx;
+    IdxRangeXVx const idx_range_xvx;
+    IdxRangeSpXVx const idx_range_spxvx;
+
+    SplineVxBuilder_1d const builder_vx;
+
+    DFieldMem<IdxRangeXVx> const quadrature_coeffs_xvx;
+    DFieldMemX const quadrature_coeffs_x;
+    DFieldMemVx const quadrature_coeffs_vx;
+
+    ReducedDiagnostics const diagnostics;
+
+    double const length_x;
+
+public:
+    ReducedDiagnosticsTest()
+        : idx_range_sp(IdxSp(0), IdxStepSp(2))
+        , idx_range_x(SplineInterpPointsX::get_domain<GridX>())
+        , idx_range_vx(SplineInterpPointsVx::get_domain<GridVx>())
+        , idx_range_xvx(idx_range_x, idx_range_vx)
+        , idx_range_spxvx(idx_range_sp, idx_range_xvx)
+        , builder_vx(idx_range_vx)
+        , quadrature_coeffs_xvx(get_quadrature_coeffs_xvx(idx_range_xvx, builder_vx))
+        , quadrature_coeffs_x(
+                  trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(idx_range_x))
+        , quadrature_coeffs_vx(neumann_spline_quadrature_coefficients<
+                               Kokkos::DefaultExecutionSpace>(idx_range_vx, builder_vx))
+        , diagnostics(
+                  Quadrature<IdxRangeXVx, IdxRangeSpXVx>(get_const_field(quadrature_coeffs_xvx)),
+                  Quadrature<IdxRangeX, IdxRangeX>(get_const_field(quadrature_coeffs_x)),
+                  Quadrature<IdxRangeVx, IdxRangeSpXVx>(get_const_field(quadrature_coeffs_vx)),
+                  3,
+                  4)
+        , length_x(ddcHelper::total_interval_length(idx_range_x))
+    {
+    }
+
+    static void SetUpTestSuite()
+    {
+        ddc::init_discrete_space<BSplinesX>(CoordX(0.), CoordX(2 * M_PI), IdxStepX(64));
+        ddc::init_discrete_space<BSplinesVx>(CoordVx(-10.), CoordVx(10.), IdxStepVx(200));
+        ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+        ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+
+        IdxRangeSp const idx_range_sp(IdxSp(0), IdxStepSp(2));
+        host_t<DFieldMemSp> charges(idx_range_sp);
+        host_t<DFieldMemSp> masses(idx_range_sp);
+        charges(idx_range_sp.front()) = -1.;
+        charges(idx_range_sp.back()) = 1.;
+        masses(idx_range_sp.front()) = 1.;
+        masses(idx_range_sp.back()) = 4.;
+        ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+    }
+};
+
+} // namespace
+
+TEST_F(ReducedDiagnosticsTest, NbRecords)
+{
+    // Iterations 0, 4, 8 and the final state at iteration 10
+    EXPECT_EQ(diagnostics.nb_records(10), 4);
+    // Iterations 0, 4 and the final state at iteration 8
+    EXPECT_EQ(diagnostics.nb_records(8), 3);
+    EXPECT_EQ(diagnostics.nb_records(0), 1);
+}
+
+TEST_F(ReducedDiagnosticsTest, MaxwellianIntegrals)
+{
+    DFieldMemSpXVx allfdistribu(idx_range_spxvx);
+    fill_maxwellian(get_field(allfdistribu), length_x);
+
+    DFieldMemSp species_mass(idx_range_sp);
+    DFieldMemSp momentum(idx_range_sp);
+    DFieldMemSp kinetic_energy(idx_range_sp);
+    DFieldMemSp l2_norm(idx_range_sp);
+    DFieldMemSp entropy(idx_range_sp);
+    diagnostics.compute_species_integrals(
+            get_field(species_mass),
+            get_field(momentum),
+            get_field(kinetic_energy),
+            get_field(l2_norm),
+            get_field(entropy),
+            get_const_field(allfdistribu));
+
+    auto species_mass_host = ddc::create_mirror_view_and_copy(get_field(species_mass));
+    auto momentum_host = ddc::create_mirror_view_and_copy(get_field(momentum));
+    auto kinetic_energy_host = ddc::create_mirror_view_and_copy(get_field(kinetic_energy));
+    auto l2_norm_host = ddc::create_mirror_view_and_copy(get_field(l2_norm));
+
+    // The perturbation integrates to zero and its square to L/2
+    double const mass_ref = density * length_x;
+    double const l2_norm_ref = std::sqrt(
+            length_x * (1. + perturb_amplitude * perturb_amplitude / 2.) * density * density
+            / (2 * std::sqrt(M_PI * temperature)));
+    for (IdxSp const isp : idx_range_sp) {
+        double const species_mass_value = ddc::host_discrete_space<Species>().masses()(isp);
+        double const momentum_ref = species_mass_value * mass_ref * mean_velocity;
+        double const kinetic_energy_ref = 0.5 * species_mass_value * mass_ref
+                                          * (temperature + mean_velocity * mean_velocity);
+        EXPECT_NEAR(species_mass_host(isp), mass_ref, rel_tol * mass_ref);
+        EXPECT_NEAR(momentum_host(isp), momentum_ref, rel_tol * momentum_ref);
+        EXPECT_NEAR(kinetic_energy_host(isp), kinetic_energy_ref, rel_tol * kinetic_energy_ref);
+        EXPECT_NEAR(l2_norm_host(isp), l2_norm_ref, rel_tol * l2_norm_ref);
+    }
+}
+
+TEST_F(ReducedDiagnosticsTest, MaxwellianEntropy)
+{
+    DFieldMemSpXVx allfdistribu(idx_range_spxvx);
+    fill_maxwellian(get_field(allfdistribu), length_x, 0.);
+
+    DFieldMemSp species_mass(idx_range_sp);
+    DFieldMemSp momentum(idx_range_sp);
+    DFieldMemSp kinetic_energy(idx_range_sp);
+    DFieldMemSp l2_norm(idx_range_sp);
+    DFieldMemSp entropy(idx_range_sp);
+    diagnostics.compute_species_integrals(
+            get_field(species_mass),
+            get_field(momentum),
+            get_field(kinetic_energy),
+            get_field(l2_norm),
+            get_field(entropy),
+            get_const_field(allfdistribu));
+
+    auto entropy_host = ddc::create_mirror_view_and_copy(get_field(entropy));
+
+    // -int f ln(f) dv = n ln(sqrt(2 pi e T) / n) for a uniform Maxwellian
+    double const entropy_ref
+            = length_x * density * std::log(std::sqrt(2 * M_PI * M_E * temperature) / density);
+    for (IdxSp const isp : idx_range_sp) {
+        EXPECT_NEAR(entropy_host(isp), entropy_ref, rel_tol * std::abs(entropy_ref));
+    }
+}
+
+TEST_F(ReducedDiagnosticsTest, ModeAmplitudes)
+{
+    double const amplitude = 0.3;
+    DFieldMemX electrostatic_potential(idx_range_x);
+    fill_mode(get_field(electrostatic_potential), amplitude, 0., 1, length_x);
+
+    host_t<DFieldMem<ReducedDiagnostics::IdxRangeMode>> amplitudes(
+            ReducedDiagnostics::IdxRangeMode(
+                    Idx<ReducedDiagnostics::GridMode>(1),
+                    IdxStep<ReducedDiagnostics::GridMode>(3)));
+    diagnostics.compute_mode_amplitudes(
+            get_field(amplitudes),
+            get_const_field(electrostatic_potential));
+
+    // Only the mode n=1 is present
+    Idx<ReducedDiagnostics::GridMode> const first_mode(1);
+    EXPECT_NEAR(amplitudes(first_mode), amplitude, rel_tol);
+    EXPECT_NEAR(amplitudes(first_mode + 1), 0., rel_tol);
+    EXPECT_NEAR(amplitudes(first_mode + 2), 0., rel_tol);
+}
+
+TEST_F(ReducedDiagnosticsTest, ElectrostaticEnergy)
+{
+    double const amplitude = 0.2;
+    DFieldMemX electric_field(idx_range_x);
+    fill_mode(get_field(electric_field), 0., amplitude, 1, length_x);
+
+    // 1/2 int A^2 sin^2(2 pi x / L) dx = A^2 L / 4
+    double const energy_ref = amplitude * amplitude * length_x / 4.;
+    double const energy = diagnostics.compute_electrostatic_energy(get_const_field(electric_field));
+    EXPECT_NEAR(energy, energy_ref, rel_tol * energy_ref);
+}
@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: MIT
+
+#include <stdexcept>
+
+#include <ddc/ddc.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "geometry.hpp"
+#include "iboltzmannsolver.hpp"
+#include "iqnsolver.hpp"
+#include "irighthandside.hpp"
+#include "predcorr.hpp"
+#include "scheduled_rhs.hpp"
+
+class MockRightHandSide : public IRightHandSide
+{
+public:
+    MockRightHandSide() = default;
+
+    MOCK_METHOD(DFieldSpXVx, CallOp, (DFieldSpXVx allfdistribu, double dt), (const));
+
+    DFieldSpXVx operator()(DFieldSpXVx const allfdistribu, double const dt) const override
+    {
+        return this->CallOp(allfdistribu, dt);
+    }
+};
+
+class MockBoltzmannSolver : public IBoltzmannSolver
+{
+public:
+    MockBoltzmannSolver() = default;
+
+    MOCK_METHOD(
+            DFieldSpXVx,
+            CallOp,
+            // clang-format off
+            ((DFieldSpXVx) allfdistribu,
+             (DConstFieldX) efield,
+             (double) dt),
+            // clang-format on
+            (const));
+
+    DFieldSpXVx operator()(
+            DFieldSpXVx const allfdistribu,
+            DConstFieldX const efield,
+            double const dt) const override
+    {
+        return this->CallOp(allfdistribu, efield, dt);
+    }
+};
+
+class MockQNSolver : public IQNSolver
+{
+public:
+    MockQNSolver() = default;
+
+    MOCK_METHOD(
+            void,
+            CallOp,
+            // clang-format off
+            ((DFieldX) electrostatic_potential,
+             (DFieldX) electric_field,
+             (DConstFieldSpXVx) allfdistribu),
+            // clang-format on
+            (const));
+
+    void operator()(
+            DFieldX const electrostatic_potential,
+            DFieldX const electric_field,
+            DConstFieldSpXVx const allfdistribu) const override
+    {
+        this->CallOp(electrostatic_potential, electric_field, allfdistribu);
+    }
+};
+
+using namespace ::testing;
+
+TEST(ScheduledRightHandSide, SubCycling)
+{
+    IdxRangeSpXVx const idx_range(IdxSpXVx(0, 0, 0), IdxStepSpXVx(0, 0, 0));
+    DFieldMemSpXVx fdistribu(idx_range);
+    DFieldSpXVx const fdistribu_s(fdistribu);
+
+    MockRightHandSide const rhs;
+    ScheduledRightHandSide const scheduled_rhs(rhs, 1, 4);
+
+    EXPECT_CALL(rhs, CallOp(_, DoubleEq(0.25))).Times(4).WillRepeatedly(Return(fdistribu_s));
+
+    scheduled_rhs(fdistribu_s, 1.);
+}
+
+TEST(ScheduledRightHandSide, ApplicationPeriodOutsideTimeIntegrator)
+{
+    IdxRangeSpXVx const idx_range(IdxSpXVx(0, 0, 0), IdxStepSpXVx(0, 0, 0));
+    DFieldMemSpXVx fdistribu(idx_range);
+    DFieldSpXVx const fdistribu_s(fdistribu);
+
+    MockRightHandSide const rhs;
+    ScheduledRightHandSide const scheduled_rhs(rhs, 2);
+    IRightHandSide const& generic_rhs = scheduled_rhs;
+
+    // The application period would be silently ignored by a generic right-hand side solver
+    EXPECT_CALL(rhs, CallOp).Times(0);
+    EXPECT_THROW(generic_rhs(fdistribu_s, 1.), std::logic_error);
+}
+
+TEST(ScheduledRightHandSide, PredCorrApplicationPeriod)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    IdxRangeSpXVx const idx_range(IdxSpXVx(0, 0, 0), IdxStepSpXVx(1, 2, 2));
+    DFieldMemSpXVx fdistribu(idx_range);
+    DFieldSpXVx const fdistribu_s(fdistribu);
+    ddc::parallel_fill(fdistribu_s, 0.);
+
+    MockBoltzmannSolver const boltzmann_solver;
+    MockQNSolver const qn_solver;
+    MockRightHandSide const rhs;
+    PredCorr const predcorr(boltzmann_solver, qn_solver, {ScheduledRightHandSide(rhs, 2)});
+
+    EXPECT_CALL(qn_solver, CallOp).Times(AnyNumber());
+    EXPECT_CALL(boltzmann_solver, CallOp).WillRepeatedly(ReturnArg<0>());
+    {
+        // 3 timesteps with a period of 2: one full block of 2 steps then a block of 1 step
+        InSequence s;
+        EXPECT_CALL(rhs, CallOp(_, DoubleEq(1.))).WillOnce(ReturnArg<0>());
+        EXPECT_CALL(rhs, CallOp(_, DoubleEq(1.))).WillOnce(ReturnArg<0>());
+        EXPECT_CALL(rhs, CallOp(_, DoubleEq(0.5))).WillOnce(ReturnArg<0>());
+        EXPECT_CALL(rhs, CallOp(_, DoubleEq(0.5))).WillOnce(ReturnArg<0>());
+    }
+
+    predcorr(fdistribu_s, 0., 1., 3);
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
+
+TEST(ScheduledRightHandSide, PredCorrFieldAfterBlockStart)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    IdxRangeSpXVx const idx_range(IdxSpXVx(0, 0, 0), IdxStepSpXVx(1, 2, 2));
+    DFieldMemSpXVx fdistribu(idx_range);
+    DFieldSpXVx const fdistribu_s(fdistribu);
+    ddc::parallel_fill(fdistribu_s, 0.);
+
+    MockBoltzmannSolver const boltzmann_solver;
+    MockQNSolver const qn_solver;
+    MockRightHandSide const rhs;
+    PredCorr const predcorr(boltzmann_solver, qn_solver, {ScheduledRightHandSide(rhs, 1)});
+
+    // The value of the distribution function seen by the last quasi-neutrality solve
+    double qn_fdistribu_value = -1.;
+    EXPECT_CALL(qn_solver, CallOp)
+            .WillRepeatedly([&](DFieldX, DFieldX, DConstFieldSpXVx allfdistribu) {
+                auto allfdistribu_host = ddc::create_mirror_view_and_copy(allfdistribu);
+                qn_fdistribu_value = allfdistribu_host(idx_range.front());
+            });
+    // The scheduled operator modifies the charge density
+    EXPECT_CALL(rhs, CallOp).WillRepeatedly([](DFieldSpXVx allfdistribu, double) {
+        ddc::parallel_fill(allfdistribu, 1.);
+        return allfdistribu;
+    });
+    // The Boltzmann solver must use a field computed from the modified distribution function
+    EXPECT_CALL(boltzmann_solver, CallOp)
+            .WillRepeatedly([&](DFieldSpXVx allfdistribu, DConstFieldX, double) {
+                EXPECT_EQ(qn_fdistribu_value, 1.);
+                return allfdistribu;
+            });
+
+    predcorr(fdistribu_s, 0., 1., 2);
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
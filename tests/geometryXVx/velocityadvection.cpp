@@ -7,6 +7,7 @@
 #include "bsl_advection_vx.hpp"
 #include "geometry.hpp"
 #include "spline_interpolator.hpp"
+#include "tiled_spline_interpolator.hpp"
 
 
 CoordX const x_min(0);
@@ -96,6 +97,35 @@ double VelocityAdvection(
     return m_advection_error;
 }
 
+/**
+ * Advect a Gaussian along vx with the electric field E(x) = sin(x) and return the result on
+ * the host. The species must already be initialised.
+ */
+host_t<DFieldMemSpXVx> advect_gaussian(
+        IAdvectionVelocity<GeometryXVx, GridVx> const& advection_vx,
+        IdxRangeSpXVx const meshSpXVx)
+{
+    IdxRangeX const gridx(meshSpXVx);
+    host_t<DFieldMemSpXVx> allfdistribu_host(meshSpXVx);
+    ddc::for_each(meshSpXVx, [&](IdxSpXVx const ispxvx) {
+        double const vx = ddc::coordinate(ddc::select<GridVx>(ispxvx));
+        double const x = ddc::coordinate(ddc::select<GridX>(ispxvx));
+        allfdistribu_host(ispxvx) = exp(-0.5 * vx * vx) * (1.0 + 0.1 * cos(x));
+    });
+    host_t<DFieldMemX> electric_field_host(gridx);
+    ddc::for_each(gridx, [&](IdxX const ix) {
+        electric_field_host(ix) = sin(ddc::coordinate(ix));
+    });
+
+    DFieldMemSpXVx allfdistribu(meshSpXVx);
+    DFieldMemX electric_field(gridx);
+    ddc::parallel_deepcopy(allfdistribu, allfdistribu_host);
+    ddc::parallel_deepcopy(electric_field, electric_field_host);
+    advection_vx(get_field(allfdistribu), get_const_field(electric_field), 0.1);
+    ddc::parallel_deepcopy(allfdistribu_host, allfdistribu);
+    return allfdistribu_host;
+}
+
 TEST(VelocityAdvection, BatchedLagrange)
 {
     auto [idx_range_x, idx_range_vx] = Init_idx_range_velocity_adv();
@@ -130,3 +160,121 @@ TEST(VelocityAdvection, SplineBatched)
             GridVx>(spline_advection_vx, idx_range_x, idx_range_vx);
     EXPECT_LE(err, 1e-5);
 }
+
+TEST(VelocityAdvection, TiledSplineBatched)
+{
+    auto [idx_range_x, idx_range_vx] = Init_idx_range_velocity_adv();
+    IdxRangeXVx meshXVx(idx_range_x, idx_range_vx);
+
+    SplineVxBuilder const builder_vx(meshXVx);
+    ddc::ConstantExtrapolationRule<Vx> bv_v_min(vx_min);
+    ddc::ConstantExtrapolationRule<Vx> bv_v_max(vx_max);
+    SplineVxEvaluator const spline_vx_evaluator(bv_v_min, bv_v_max);
+    // The 50 x points are treated in 6 tiles of 8 lines and a last tile of 2 lines
+    PreallocatableTiledSplineInterpolator const
+            spline_vx_interpolator(builder_vx, spline_vx_evaluator, 8);
+    BslAdvectionVelocity<GeometryXVx, GridVx> const spline_advection_vx(spline_vx_interpolator);
+    double const err = VelocityAdvection<
+            GeometryXVx,
+            GridVx>(spline_advection_vx, idx_range_x, idx_range_vx);
+    EXPECT_LE(err, 1e-5);
+}
+
+TEST(VelocityAdvection, SpeciesBatchedLagrange)
+{
+    auto [idx_range_x, idx_range_vx] = Init_idx_range_velocity_adv();
+    IdxStepVx static constexpr n_ghosts_vx {0};
+    LagrangeInterpolator<GridVx, BCond::DIRICHLET, BCond::DIRICHLET, Species, GridX, GridVx> const
+            lagrange_vx_non_preallocatable_interpolator(3, n_ghosts_vx);
+    PreallocatableLagrangeInterpolator<
+            GridVx,
+            BCond::DIRICHLET,
+            BCond::DIRICHLET,
+            Species,
+            GridX,
+            GridVx> const lagrange_vx_interpolator(lagrange_vx_non_preallocatable_interpolator);
+    BslAdvectionVelocity<GeometryXVx, GridVx> const lag_advection_vx(lagrange_vx_interpolator);
+    double const err
+            = VelocityAdvection<GeometryXVx, GridVx>(lag_advection_vx, idx_range_x, idx_range_vx);
+    EXPECT_LE(err, 1e-3);
+}
+
+TEST(VelocityAdvection, SpeciesBatchedSpline)
+{
+    using SplineSpVxBuilder = ddc::SplineBuilder<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            BSplinesVx,
+            GridVx,
+            SplineVxBoundary,
+            SplineVxBoundary,
+            ddc::SplineSolver::LAPACK,
+            Species,
+            GridX,
+            GridVx>;
+    using SplineSpVxEvaluator = ddc::SplineEvaluator<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            BSplinesVx,
+            GridVx,
+            ddc::ConstantExtrapolationRule<Vx>,
+            ddc::ConstantExtrapolationRule<Vx>,
+            Species,
+            GridX,
+            GridVx>;
+
+    auto [idx_range_x, idx_range_vx] = Init_idx_range_velocity_adv();
+    IdxRangeSp const idx_range_allsp(IdxSp(0), IdxStepSp(2));
+    IdxRangeSpXVx meshSpXVx(idx_range_allsp, idx_range_x, idx_range_vx);
+
+    SplineSpVxBuilder const builder_vx(meshSpXVx);
+    ddc::ConstantExtrapolationRule<Vx> bv_v_min(vx_min);
+    ddc::ConstantExtrapolationRule<Vx> bv_v_max(vx_max);
+    SplineSpVxEvaluator const spline_vx_evaluator(bv_v_min, bv_v_max);
+    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+    BslAdvectionVelocity<GeometryXVx, GridVx> const spline_advection_vx(spline_vx_interpolator);
+    double const err = VelocityAdvection<
+            GeometryXVx,
+            GridVx>(spline_advection_vx, idx_range_x, idx_range_vx);
+    EXPECT_LE(err, 1e-5);
+}
+
+TEST(VelocityAdvection, TiledSplineMatchesUntiled)
+{
+    auto [idx_range_x, idx_range_vx] = Init_idx_range_velocity_adv();
+    IdxRangeXVx meshXVx(idx_range_x, idx_range_vx);
+    IdxRangeSp const idx_range_allsp(IdxSp(0), IdxStepSp(2));
+    IdxRangeSpXVx const meshSpXVx(idx_range_allsp, idx_range_x, idx_range_vx);
+
+    host_t<DFieldMemSp> masses_host(idx_range_allsp);
+    host_t<DFieldMemSp> charges_host(idx_range_allsp);
+    masses_host(idx_range_allsp.front()) = 1.;
+    charges_host(idx_range_allsp.front()) = -1.;
+    masses_host(idx_range_allsp.back()) = 1.;
+    charges_host(idx_range_allsp.back()) = 1.;
+    ddc::init_discrete_space<Species>(std::move(charges_host), std::move(masses_host));
+
+    SplineVxBuilder const builder_vx(meshXVx);
+    ddc::ConstantExtrapolationRule<Vx> bv_v_min(vx_min);
+    ddc::ConstantExtrapolationRule<Vx> bv_v_max(vx_max);
+    SplineVxEvaluator const spline_vx_evaluator(bv_v_min, bv_v_max);
+
+    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+    BslAdvectionVelocity<GeometryXVx, GridVx> const spline_advection_vx(spline_vx_interpolator);
+    host_t<DFieldMemSpXVx> const allfdistribu_ref
+            = advect_gaussian(spline_advection_vx, meshSpXVx);
+
+    // Tiles which divide the 50 x points, a prime tile size which leaves a shorter last tile,
+    // a tile of a single line and a tile larger than the whole field
+    for (std::size_t const max_tile_size : {1, 5, 7, 50, 64}) {
+        PreallocatableTiledSplineInterpolator const
+                tiled_vx_interpolator(builder_vx, spline_vx_evaluator, max_tile_size);
+        BslAdvectionVelocity<GeometryXVx, GridVx> const tiled_advection_vx(tiled_vx_interpolator);
+        host_t<DFieldMemSpXVx> const allfdistribu
+                = advect_gaussian(tiled_advection_vx, meshSpXVx);
+        ddc::for_each(meshSpXVx, [&](IdxSpXVx const ispxvx) {
+            EXPECT_NEAR(allfdistribu(ispxvx), allfdistribu_ref(ispxvx), 1e-13)
+                    << "max_tile_size = " << max_tile_size;
+        });
+    }
+}
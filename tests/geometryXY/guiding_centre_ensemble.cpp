@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: MIT
+#include <cmath>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "bsl_advection_1d.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "euler.hpp"
+#include "fft_poisson_solver.hpp"
+#include "geometry.hpp"
+#include "initialisation_Kelvin_Helmholtz.hpp"
+#include "predcorr_RK2.hpp"
+#include "spline_interpolator.hpp"
+
+namespace {
+
+IdxRangeXY init_idx_range_xy()
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(2 * M_PI);
+    IdxStepX const x_ncells(16);
+    CoordY const y_min(0.0);
+    CoordY const y_max(2 * M_PI);
+    IdxStepY const y_ncells(16);
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_ncells);
+    ddc::init_discrete_space<BSplinesY>(y_min, y_max, y_ncells);
+
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridY>(SplineInterpPointsY::get_sampling<GridY>());
+
+    return IdxRangeXY(
+            SplineInterpPointsX::get_domain<GridX>(),
+            SplineInterpPointsY::get_domain<GridY>());
+}
+
+/// Run a single guiding-centre simulation as in the guiding_centre_XY executable.
+void run_single(DFieldXY const allfdistribu, double epsilon, double mode_k, double dt, int nbiter)
+{
+    IdxRangeXY const meshXY = get_idx_range(allfdistribu);
+
+    SplineXBuilder_XY const builder_x(meshXY);
+    SplineYBuilder_XY const builder_y(meshXY);
+
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator_XY const spline_x_evaluator(bv_x_min, bv_x_max);
+    ddc::PeriodicExtrapolationRule<Y> bv_y_min;
+    ddc::PeriodicExtrapolationRule<Y> bv_y_max;
+    SplineYEvaluator_XY const spline_y_evaluator(bv_y_min, bv_y_max);
+
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+    PreallocatableSplineInterpolator const spline_y_interpolator(builder_y, spline_y_evaluator);
+
+    FFTPoissonSolver<IdxRangeXY> const poisson_solver(meshXY);
+
+    Euler<FieldMemXY<CoordX>, DFieldMemXY> euler_x(meshXY);
+    BslAdvection1D<
+            GridX,
+            IdxRangeXY,
+            IdxRangeXY,
+            SplineXBuilder_XY,
+            SplineXEvaluator_XY,
+            Euler<FieldMemXY<CoordX>, DFieldMemXY>>
+            advection_x(spline_x_interpolator, builder_x, spline_x_evaluator, euler_x);
+
+    Euler<FieldMemXY<CoordY>, DFieldMemXY> euler_y(meshXY);
+    BslAdvection1D<
+            GridY,
+            IdxRangeXY,
+            IdxRangeXY,
+            SplineYBuilder_XY,
+            SplineYEvaluator_XY,
+            Euler<FieldMemXY<CoordY>, DFieldMemXY>>
+            advection_y(spline_y_interpolator, builder_y, spline_y_evaluator, euler_y);
+
+    DFieldMemXY allfdistribu_equilibrium(meshXY);
+    KelvinHelmholtzInstabilityInitialisation initialise(epsilon, mode_k);
+    initialise(allfdistribu, get_field(allfdistribu_equilibrium));
+
+    PredCorrRK2XY predictor_corrector(poisson_solver, advection_x, advection_y);
+    predictor_corrector(allfdistribu, dt, nbiter);
+}
+
+/// Run an ensemble of guiding-centre simulations as in the guiding_centre_ensemble_XY executable.
+void run_ensemble(
+        DFieldEnsXY const allfdistribu,
+        host_t<DConstFieldEnsemble> const epsilon,
+        host_t<DConstFieldEnsemble> const mode_k,
+        double dt,
+        int nbiter)
+{
+    IdxRangeEnsXY const meshEnsXY = get_idx_range(allfdistribu);
+
+    SplineXBuilder_EnsXY const builder_x(meshEnsXY);
+    SplineYBuilder_EnsXY const builder_y(meshEnsXY);
+
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator_EnsXY const spline_x_evaluator(bv_x_min, bv_x_max);
+    ddc::PeriodicExtrapolationRule<Y> bv_y_min;
+    ddc::PeriodicExtrapolationRule<Y> bv_y_max;
+    SplineYEvaluator_EnsXY const spline_y_evaluator(bv_y_min, bv_y_max);
+
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+    PreallocatableSplineInterpolator const spline_y_interpolator(builder_y, spline_y_evaluator);
+
+    FFTPoissonSolver<IdxRangeXY, IdxRangeEnsXY> const poisson_solver((IdxRangeXY(meshEnsXY)));
+
+    Euler<FieldMemEnsXY<CoordX>, DFieldMemEnsXY> euler_x(meshEnsXY);
+    BslAdvection1D<
+            GridX,
+            IdxRangeEnsXY,
+            IdxRangeEnsXY,
+            SplineXBuilder_EnsXY,
+            SplineXEvaluator_EnsXY,
+            Euler<FieldMemEnsXY<CoordX>, DFieldMemEnsXY>>
+            advection_x(spline_x_interpolator, builder_x, spline_x_evaluator, euler_x);
+
+    Euler<FieldMemEnsXY<CoordY>, DFieldMemEnsXY> euler_y(meshEnsXY);
+    BslAdvection1D<
+            GridY,
+            IdxRangeEnsXY,
+            IdxRangeEnsXY,
+            SplineYBuilder_EnsXY,
+            SplineYEvaluator_EnsXY,
+            Euler<FieldMemEnsXY<CoordY>, DFieldMemEnsXY>>
+            advection_y(spline_y_interpolator, builder_y, spline_y_evaluator, euler_y);
+
+    DFieldMemEnsXY allfdistribu_equilibrium(meshEnsXY);
+    KelvinHelmholtzInstabilityEnsembleInitialisation initialise(epsilon, mode_k);
+    initialise(allfdistribu, get_field(allfdistribu_equilibrium));
+
+    PredCorrRK2XY predictor_corrector(poisson_solver, advection_x, advection_y);
+    predictor_corrector(allfdistribu, dt, nbiter);
+}
+
+} // namespace
+
+TEST(GuidingCentreEnsemble, MembersMatchSingleRuns)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    IdxRangeXY const meshXY = init_idx_range_xy();
+    IdxRangeEnsemble const idx_range_ensemble(IdxEnsemble(0), IdxStepEnsemble(3));
+    IdxRangeEnsXY const meshEnsXY(idx_range_ensemble, meshXY);
+
+    host_t<DFieldMemEnsemble> epsilon(idx_range_ensemble);
+    host_t<DFieldMemEnsemble> mode_k(idx_range_ensemble);
+    epsilon(IdxEnsemble(0)) = 0.01;
+    epsilon(IdxEnsemble(1)) = 0.05;
+    epsilon(IdxEnsemble(2)) = 0.1;
+    mode_k(IdxEnsemble(0)) = 1.;
+    mode_k(IdxEnsemble(1)) = 2.;
+    mode_k(IdxEnsemble(2)) = 1.;
+
+    double const dt = 0.1;
+    int const nbiter = 5;
+
+    DFieldMemEnsXY allfdistribu_ensemble(meshEnsXY);
+    run_ensemble(
+            get_field(allfdistribu_ensemble),
+            get_const_field(epsilon),
+            get_const_field(mode_k),
+            dt,
+            nbiter);
+    auto allfdistribu_ensemble_host
+            = ddc::create_mirror_view_and_copy(get_field(allfdistribu_ensemble));
+
+    for (IdxEnsemble const ie : idx_range_ensemble) {
+        DFieldMemXY allfdistribu_single(meshXY);
+        run_single(get_field(allfdistribu_single), epsilon(ie), mode_k(ie), dt, nbiter);
+        auto allfdistribu_single_host
+                = ddc::create_mirror_view_and_copy(get_field(allfdistribu_single));
+
+        ddc::for_each(meshXY, [&](IdxXY const ixy) {
+            EXPECT_NEAR(
+                    allfdistribu_ensemble_host(ie, ixy),
+                    allfdistribu_single_host(ixy),
+                    1e-12);
+        });
+    }
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: MIT
+
+#include <vector>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "field_extrapolation_time_solver.hpp"
+#include "geometry.hpp"
+#include "iqnsolver.hpp"
+#include "ivlasovsolver.hpp"
+
+namespace {
+
+/**
+ * A Vlasov solver which adds dt to the (constant) distribution function so that f(t) = t.
+ * The arguments of each call are recorded.
+ */
+class LinearVlasovSolver : public IVlasovSolver
+{
+public:
+    mutable std::vector<double> m_dt;
+    mutable std::vector<double> m_efield_x;
+    mutable std::vector<double> m_efield_y;
+    mutable std::vector<double> m_fdistribu;
+
+    DFieldSpVxVyXY operator()(
+            DFieldSpVxVyXY const allfdistribu,
+            DConstFieldXY const efield_x,
+            DConstFieldXY const efield_y,
+            double const dt) const override
+    {
+        auto efield_x_host = ddc::create_mirror_view_and_copy(efield_x);
+        auto efield_y_host = ddc::create_mirror_view_and_copy(efield_y);
+        auto allfdistribu_host = ddc::create_mirror_view_and_copy(allfdistribu);
+        double const fdistribu = get_field(allfdistribu_host)(get_idx_range(allfdistribu).front());
+        m_dt.push_back(dt);
+        m_efield_x.push_back(get_field(efield_x_host)(get_idx_range(efield_x).front()));
+        m_efield_y.push_back(get_field(efield_y_host)(get_idx_range(efield_y).front()));
+        m_fdistribu.push_back(fdistribu);
+        ddc::parallel_fill(allfdistribu, fdistribu + dt);
+        return allfdistribu;
+    }
+};
+
+/**
+ * A Quasi-Neutrality solver which sets the electric field to (f, -2f), where f is the value
+ * of the (constant) distribution function, so that E(t) = (t, -2t).
+ */
+class IdentityQNSolver : public IQNSolver
+{
+public:
+    void operator()(
+            DFieldXY const electrostatic_potential,
+            DFieldXY const electric_field_x,
+            DFieldXY const electric_field_y,
+            DConstFieldSpVxVyXY const allfdistribu) const override
+    {
+        auto allfdistribu_host = ddc::create_mirror_view_and_copy(allfdistribu);
+        double const fdistribu = get_field(allfdistribu_host)(get_idx_range(allfdistribu).front());
+        ddc::parallel_fill(electrostatic_potential, 0.);
+        ddc::parallel_fill(electric_field_x, fdistribu);
+        ddc::parallel_fill(electric_field_y, -2 * fdistribu);
+    }
+};
+
+} // namespace
+
+TEST(FieldExtrapolationTimeSolver, ExtrapolatedField)
+{
+    PC_tree_t conf_pdi = PC_parse_string("");
+    PDI_init(conf_pdi);
+
+    IdxRangeSpVxVyXY const idx_range(
+            IdxRangeSp(IdxSp(0), IdxStepSp(1)),
+            IdxRangeVx(IdxVx(0), IdxStepVx(2)),
+            IdxRangeVy(IdxVy(0), IdxStepVy(2)),
+            IdxRangeX(IdxX(0), IdxStepX(2)),
+            IdxRangeY(IdxY(0), IdxStepY(2)));
+    DFieldMemSpVxVyXY fdistribu(idx_range);
+    DFieldSpVxVyXY const fdistribu_s(get_field(fdistribu));
+    ddc::parallel_fill(fdistribu_s, 0.);
+
+    LinearVlasovSolver const vlasov_solver;
+    IdentityQNSolver const qn_solver;
+    FieldExtrapolationTimeSolver const time_solver(vlasov_solver, qn_solver);
+
+    double const dt = 0.5;
+    int const steps = 4;
+    time_solver(fdistribu_s, dt, steps);
+
+    // One predictor step at the start then a single Vlasov solve per timestep
+    ASSERT_EQ(vlasov_solver.m_dt.size(), std::size_t(steps + 1));
+    EXPECT_DOUBLE_EQ(vlasov_solver.m_dt[0], dt / 2);
+    EXPECT_DOUBLE_EQ(vlasov_solver.m_efield_x[0], 0.);
+    EXPECT_DOUBLE_EQ(vlasov_solver.m_efield_y[0], 0.);
+    EXPECT_DOUBLE_EQ(vlasov_solver.m_fdistribu[0], 0.);
+    for (int iter = 0; iter < steps; ++iter) {
+        // E(t) is linear so the field at the half timestep is exact
+        EXPECT_DOUBLE_EQ(vlasov_solver.m_dt[iter + 1], dt);
+        EXPECT_DOUBLE_EQ(vlasov_solver.m_efield_x[iter + 1], (iter + 0.5) * dt);
+        EXPECT_DOUBLE_EQ(vlasov_solver.m_efield_y[iter + 1], -2 * (iter + 0.5) * dt);
+        EXPECT_DOUBLE_EQ(vlasov_solver.m_fdistribu[iter + 1], iter * dt);
+    }
+
+    auto fdistribu_host = ddc::create_mirror_view_and_copy(fdistribu_s);
+    EXPECT_DOUBLE_EQ(get_field(fdistribu_host)(idx_range.front()), steps * dt);
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
@@ -0,0 +1,276 @@
+// SPDX-License-Identifier: MIT
+#include <cmath>
+
+#include <mpi.h>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "bsl_advection_vx.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "geometry.hpp"
+#include "ivlasovsolver.hpp"
+#include "mpi_lagrange_advection_x.hpp"
+#include "mpihalosplitvlasovsolver.hpp"
+#include "mpilayout.hpp"
+#include "species_info.hpp"
+#include "spline_interpolator.hpp"
+#include "splitvlasovsolver.hpp"
+
+namespace {
+
+using IdxSpVxVyXY = Idx<Species, GridVx, GridVy, GridX, GridY>;
+
+/// A layout of the (Sp, Vx, Vy, X, Y) index range distributed along the spatial dimensions.
+using XYSplitVxVyXY = MPILayout<IdxRangeSpVxVyXY, GridX, GridY>;
+
+/// The builders and evaluators of the velocity splines batched over the (Sp, Vx, Vy, X, Y) layout.
+using SplineVxBuilderVxVyXY = ddc::SplineBuilder<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesVx,
+        GridVx,
+        SplineVxBoundary,
+        SplineVxBoundary,
+        ddc::SplineSolver::LAPACK,
+        Species,
+        GridVx,
+        GridVy,
+        GridX,
+        GridY>;
+using SplineVxEvaluatorVxVyXY = ddc::SplineEvaluator<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesVx,
+        GridVx,
+        ddc::ConstantExtrapolationRule<Vx>,
+        ddc::ConstantExtrapolationRule<Vx>,
+        Species,
+        GridVx,
+        GridVy,
+        GridX,
+        GridY>;
+using SplineVyBuilderVxVyXY = ddc::SplineBuilder<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesVy,
+        GridVy,
+        SplineVyBoundary,
+        SplineVyBoundary,
+        ddc::SplineSolver::LAPACK,
+        Species,
+        GridVx,
+        GridVy,
+        GridX,
+        GridY>;
+using SplineVyEvaluatorVxVyXY = ddc::SplineEvaluator<
+        Kokkos::DefaultExecutionSpace,
+        Kokkos::DefaultExecutionSpace::memory_space,
+        BSplinesVy,
+        GridVy,
+        ddc::ConstantExtrapolationRule<Vy>,
+        ddc::ConstantExtrapolationRule<Vy>,
+        Species,
+        GridVx,
+        GridVy,
+        GridX,
+        GridY>;
+
+/**
+ * Initialise a small 4D mesh and two species. The spatial dimensions have enough points to be
+ * distributed over 2 MPI ranks while leaving room for the ghost layers.
+ */
+IdxRangeSpVxVyXY init_global_idx_range()
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(2 * M_PI);
+    IdxStepX const x_ncells(16);
+    CoordY const y_min(0.0);
+    CoordY const y_max(2 * M_PI);
+    IdxStepY const y_ncells(16);
+    CoordVx const vx_min(-6.0);
+    CoordVx const vx_max(6.0);
+    IdxStepVx const vx_ncells(9);
+    CoordVy const vy_min(-6.0);
+    CoordVy const vy_max(6.0);
+    IdxStepVy const vy_ncells(9);
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_ncells);
+    ddc::init_discrete_space<BSplinesY>(y_min, y_max, y_ncells);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_ncells);
+    ddc::init_discrete_space<BSplinesVy>(vy_min, vy_max, vy_ncells);
+
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridY>(SplineInterpPointsY::get_sampling<GridY>());
+    ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+    ddc::init_discrete_space<GridVy>(SplineInterpPointsVy::get_sampling<GridVy>());
+
+    IdxRangeSp const idx_range_sp(IdxSp(0), IdxStepSp(2));
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    charges(idx_range_sp.front()) = -1.;
+    charges(idx_range_sp.back()) = 1.;
+    masses(idx_range_sp.front()) = 0.01;
+    masses(idx_range_sp.back()) = 1.;
+    ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+    return IdxRangeSpVxVyXY(
+            idx_range_sp,
+            SplineInterpPointsVx::get_domain<GridVx>(),
+            SplineInterpPointsVy::get_domain<GridVy>(),
+            SplineInterpPointsX::get_domain<GridX>(),
+            SplineInterpPointsY::get_domain<GridY>());
+}
+
+/// Fill a perturbed Maxwellian distribution function in either layout.
+template <class IdxRangeFdistribu>
+void fill_fdistribu(DField<IdxRangeFdistribu> const allfdistribu)
+{
+    using IdxFdistribu = typename IdxRangeFdistribu::discrete_element_type;
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(allfdistribu),
+            KOKKOS_LAMBDA(IdxFdistribu const idx) {
+                double const x = ddc::coordinate(IdxX(idx));
+                double const y = ddc::coordinate(IdxY(idx));
+                double const vx = ddc::coordinate(IdxVx(idx));
+                double const vy = ddc::coordinate(IdxVy(idx));
+                allfdistribu(idx) = Kokkos::exp(-0.5 * (vx * vx + vy * vy))
+                                    * (1.0 + 0.1 * Kokkos::cos(x) + 0.05 * Kokkos::sin(y));
+            });
+}
+
+/// Fill an electric field which varies in x and y.
+void fill_electric_field(DFieldXY const electric_field_x, DFieldXY const electric_field_y)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(electric_field_x),
+            KOKKOS_LAMBDA(IdxXY const ixy) {
+                electric_field_x(ixy) = 0.1 * Kokkos::sin(ddc::coordinate(IdxX(ixy)));
+                electric_field_y(ixy) = 0.1 * Kokkos::cos(ddc::coordinate(IdxY(ixy)));
+            });
+}
+
+} // namespace
+
+TEST(MpiHaloSplitVlasovSolver, MatchesSerial)
+{
+    IdxRangeSpVxVyXY const global_idx_range = init_global_idx_range();
+    IdxRangeSpXYVxVy const global_idx_range_x2Dsplit(global_idx_range);
+    IdxRangeXY const idx_range_xy(global_idx_range);
+    IdxRangeVx const idx_range_vx(global_idx_range);
+    IdxRangeVy const idx_range_vy(global_idx_range);
+
+    int rank;
+    int comm_size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    IdxRangeSpXYVxVy const local_idx_range
+            = X2DSplit::distribute_idx_range(global_idx_range_x2Dsplit, comm_size, rank);
+    IdxRangeXY const local_idx_range_xy(local_idx_range);
+
+    double const dt = 0.1;
+    int const degree = 5;
+    int const nbiter = 2;
+
+    ddc::ConstantExtrapolationRule<Vx> bv_vx_min(ddc::coordinate(idx_range_vx.front()));
+    ddc::ConstantExtrapolationRule<Vx> bv_vx_max(ddc::coordinate(idx_range_vx.back()));
+    ddc::ConstantExtrapolationRule<Vy> bv_vy_min(ddc::coordinate(idx_range_vy.front()));
+    ddc::ConstantExtrapolationRule<Vy> bv_vy_max(ddc::coordinate(idx_range_vy.back()));
+
+    // Serial reference on the whole distribution function. The spatial advections use the
+    // same Lagrange interpolation on a communicator containing only this rank so the ghost
+    // layers are the periodic images of the points.
+    MpiLagrangeAdvectionSpatial<GeometryVxVyXY, GridX, XYSplitVxVyXY> const
+            advection_x(global_idx_range, degree, dt, MPI_COMM_SELF);
+    MpiLagrangeAdvectionSpatial<GeometryVxVyXY, GridY, XYSplitVxVyXY> const
+            advection_y(global_idx_range, degree, dt, MPI_COMM_SELF);
+    SplineVxBuilderVxVyXY const builder_vx(global_idx_range);
+    SplineVyBuilderVxVyXY const builder_vy(global_idx_range);
+    SplineVxEvaluatorVxVyXY const spline_vx_evaluator(bv_vx_min, bv_vx_max);
+    SplineVyEvaluatorVxVyXY const spline_vy_evaluator(bv_vy_min, bv_vy_max);
+    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+    PreallocatableSplineInterpolator const spline_vy_interpolator(builder_vy, spline_vy_evaluator);
+    BslAdvectionVelocity<GeometryVxVyXY, GridVx> const advection_vx(spline_vx_interpolator);
+    BslAdvectionVelocity<GeometryVxVyXY, GridVy> const advection_vy(spline_vy_interpolator);
+    SplitVlasovSolver const serial_vlasov(advection_x, advection_y, advection_vx, advection_vy);
+
+    DFieldMemSpVxVyXY global_allfdistribu(global_idx_range);
+    fill_fdistribu(get_field(global_allfdistribu));
+    DFieldMemXY electric_field_x(idx_range_xy);
+    DFieldMemXY electric_field_y(idx_range_xy);
+    fill_electric_field(get_field(electric_field_x), get_field(electric_field_y));
+
+    // Distributed solve, the distribution function remains in the X2DSplit layout
+    MpiLagrangeAdvectionSpatial<GeometryXYVxVy, GridX, X2DSplit> const
+            advection_x_x2Dsplit(global_idx_range_x2Dsplit, degree, dt, MPI_COMM_WORLD);
+    MpiLagrangeAdvectionSpatial<GeometryXYVxVy, GridY, X2DSplit> const
+            advection_y_x2Dsplit(global_idx_range_x2Dsplit, degree, dt, MPI_COMM_WORLD);
+    SplineVxBuilder const builder_vx_x2Dsplit(local_idx_range);
+    SplineVyBuilder const builder_vy_x2Dsplit(local_idx_range);
+    SplineVxEvaluator const spline_vx_evaluator_x2Dsplit(bv_vx_min, bv_vx_max);
+    SplineVyEvaluator const spline_vy_evaluator_x2Dsplit(bv_vy_min, bv_vy_max);
+    PreallocatableSplineInterpolator const
+            spline_vx_interpolator_x2Dsplit(builder_vx_x2Dsplit, spline_vx_evaluator_x2Dsplit);
+    PreallocatableSplineInterpolator const
+            spline_vy_interpolator_x2Dsplit(builder_vy_x2Dsplit, spline_vy_evaluator_x2Dsplit);
+    BslAdvectionVelocity<GeometryXYVxVy, GridVx> const advection_vx_x2Dsplit(
+            spline_vx_interpolator_x2Dsplit);
+    BslAdvectionVelocity<GeometryXYVxVy, GridVy> const advection_vy_x2Dsplit(
+            spline_vy_interpolator_x2Dsplit);
+    MpiHaloSplitVlasovSolver const mpi_vlasov(
+            advection_x_x2Dsplit,
+            advection_y_x2Dsplit,
+            advection_vx_x2Dsplit,
+            advection_vy_x2Dsplit);
+
+    DFieldMemSpXYVxVy local_allfdistribu(local_idx_range);
+    fill_fdistribu(get_field(local_allfdistribu));
+    DFieldMemXY local_electric_field_x(local_idx_range_xy);
+    DFieldMemXY local_electric_field_y(local_idx_range_xy);
+    fill_electric_field(get_field(local_electric_field_x), get_field(local_electric_field_y));
+
+    // The same distributed solve through the IVlasovSolver interface, the local block is
+    // stored in the (Sp, Vx, Vy, X, Y) order
+    IVlasovSolver const& mpi_vlasov_interface = mpi_vlasov;
+    DFieldMemSpVxVyXY local_allfdistribu_vxvyxy((IdxRangeSpVxVyXY(local_idx_range)));
+    fill_fdistribu(get_field(local_allfdistribu_vxvyxy));
+
+    for (int iter(0); iter < nbiter; ++iter) {
+        serial_vlasov(
+                get_field(global_allfdistribu),
+                get_const_field(electric_field_x),
+                get_const_field(electric_field_y),
+                dt);
+        mpi_vlasov(
+                get_field(local_allfdistribu),
+                get_const_field(local_electric_field_x),
+                get_const_field(local_electric_field_y),
+                dt);
+        mpi_vlasov_interface(
+                get_field(local_allfdistribu_vxvyxy),
+                get_const_field(local_electric_field_x),
+                get_const_field(local_electric_field_y),
+                dt);
+    }
+
+    // Each rank compares its part of the distribution function with the serial result
+    auto global_allfdistribu_host
+            = ddc::create_mirror_view_and_copy(get_field(global_allfdistribu));
+    auto local_allfdistribu_host = ddc::create_mirror_view_and_copy(get_field(local_allfdistribu));
+    auto local_allfdistribu_vxvyxy_host
+            = ddc::create_mirror_view_and_copy(get_field(local_allfdistribu_vxvyxy));
+    ddc::for_each(local_idx_range, [&](IdxSpXYVxVy const ispxyvxvy) {
+        EXPECT_NEAR(
+                local_allfdistribu_host(ispxyvxvy),
+                global_allfdistribu_host(IdxSpVxVyXY(ispxyvxvy)),
+                1e-12);
+        EXPECT_NEAR(
+                local_allfdistribu_vxvyxy_host(IdxSpVxVyXY(ispxyvxvy)),
+                global_allfdistribu_host(IdxSpVxVyXY(ispxyvxvy)),
+                1e-12);
+    });
+}
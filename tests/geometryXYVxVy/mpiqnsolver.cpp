@@ -0,0 +1,306 @@
+// SPDX-License-Identifier: MIT
+#include <cmath>
+
+#include <mpi.h>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "chargedensitycalculator.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "fft_poisson_solver.hpp"
+#include "geometry.hpp"
+#include "mpichargedensitycalculator.hpp"
+#include "mpigatherqnsolver.hpp"
+#include "mpinodeqnsolver.hpp"
+#include "qnsolver.hpp"
+#include "species_info.hpp"
+#include "trapezoid_quadrature.hpp"
+
+namespace {
+
+/**
+ * Initialise a small 4D mesh and two species. The velocity dimensions have an even number
+ * of points so they can be distributed over 2 MPI ranks.
+ */
+IdxRangeSpVxVyXY init_global_idx_range()
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(2 * M_PI);
+    IdxStepX const x_ncells(8);
+    CoordY const y_min(0.0);
+    CoordY const y_max(2 * M_PI);
+    IdxStepY const y_ncells(8);
+    CoordVx const vx_min(-6.0);
+    CoordVx const vx_max(6.0);
+    IdxStepVx const vx_ncells(9);
+    CoordVy const vy_min(-6.0);
+    CoordVy const vy_max(6.0);
+    IdxStepVy const vy_ncells(9);
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_ncells);
+    ddc::init_discrete_space<BSplinesY>(y_min, y_max, y_ncells);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_ncells);
+    ddc::init_discrete_space<BSplinesVy>(vy_min, vy_max, vy_ncells);
+
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridY>(SplineInterpPointsY::get_sampling<GridY>());
+    ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+    ddc::init_discrete_space<GridVy>(SplineInterpPointsVy::get_sampling<GridVy>());
+
+    IdxRangeSp const idx_range_sp(IdxSp(0), IdxStepSp(2));
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    charges(idx_range_sp.front()) = -1.;
+    charges(idx_range_sp.back()) = 1.;
+    masses(idx_range_sp.front()) = 0.01;
+    masses(idx_range_sp.back()) = 1.;
+    ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+    return IdxRangeSpVxVyXY(
+            idx_range_sp,
+            SplineInterpPointsVx::get_domain<GridVx>(),
+            SplineInterpPointsVy::get_domain<GridVy>(),
+            SplineInterpPointsX::get_domain<GridX>(),
+            SplineInterpPointsY::get_domain<GridY>());
+}
+
+/// Get the velocity index range treated by this rank when the velocities are distributed.
+IdxRangeSpVxVyXY get_local_idx_range(IdxRangeSpVxVyXY const global_idx_range)
+{
+    int rank;
+    int comm_size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    return V2DSplit::distribute_idx_range(global_idx_range, comm_size, rank);
+}
+
+/// Get the spatial index range treated by this rank when the spatial dimensions are distributed.
+IdxRangeSpVxVyXY get_local_idx_range_x2Dsplit(IdxRangeSpVxVyXY const global_idx_range)
+{
+    int rank;
+    int comm_size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    return IdxRangeSpVxVyXY(X2DSplit::distribute_idx_range(
+            IdxRangeSpXYVxVy(global_idx_range),
+            comm_size,
+            rank));
+}
+
+/// Fill a distribution function whose charge density varies in x and y.
+void fill_fdistribu(DFieldSpVxVyXY const allfdistribu)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(allfdistribu),
+            KOKKOS_LAMBDA(Idx<Species, GridVx, GridVy, GridX, GridY> const ispvxvyxy) {
+                double const x = ddc::coordinate(IdxX(ispvxvyxy));
+                double const y = ddc::coordinate(IdxY(ispvxvyxy));
+                double const vx = ddc::coordinate(IdxVx(ispvxvyxy));
+                double const vy = ddc::coordinate(IdxVy(ispvxvyxy));
+                double const species_factor = 1.0 + (IdxSp(ispvxvyxy) - IdxSp(0)).value();
+                allfdistribu(ispvxvyxy)
+                        = species_factor * Kokkos::exp(-0.5 * (vx * vx + vy * vy))
+                          * (1.0 + 0.1 * species_factor * Kokkos::cos(x)
+                             + 0.05 * Kokkos::sin(y));
+            });
+}
+
+/// Copy the part of the global distribution function owned by this rank.
+DFieldMemSpVxVyXY get_local_fdistribu(
+        DConstFieldSpVxVyXY const global_allfdistribu,
+        IdxRangeSpVxVyXY const local_idx_range)
+{
+    DFieldMemSpVxVyXY local_allfdistribu(local_idx_range);
+    ddc::parallel_deepcopy(get_field(local_allfdistribu), global_allfdistribu[local_idx_range]);
+    return local_allfdistribu;
+}
+
+/// Copy the block of a field defined on the global spatial index range owned by this rank.
+DFieldMemXY get_local_field(DConstFieldXY const global_field, IdxRangeXY const local_idx_range)
+{
+    DFieldMemXY local_field(local_idx_range);
+    ddc::parallel_deepcopy(get_field(local_field), global_field[local_idx_range]);
+    return local_field;
+}
+
+void expect_fields_near(DConstFieldXY const field, DConstFieldXY const field_ref, double tol)
+{
+    auto field_host = ddc::create_mirror_view_and_copy(field);
+    auto field_ref_host = ddc::create_mirror_view_and_copy(field_ref);
+    ddc::for_each(get_idx_range(field_host), [&](IdxXY const ixy) {
+        EXPECT_NEAR(field_host(ixy), field_ref_host(ixy), tol);
+    });
+}
+
+void test_charge_density(MpiChargeDensityCalculator::Reduction reduction)
+{
+    IdxRangeSpVxVyXY const global_idx_range = init_global_idx_range();
+    IdxRangeSpVxVyXY const local_idx_range = get_local_idx_range(global_idx_range);
+    IdxRangeXY const idx_range_xy(global_idx_range);
+
+    DFieldMemSpVxVyXY global_allfdistribu(global_idx_range);
+    fill_fdistribu(get_field(global_allfdistribu));
+    DFieldMemSpVxVyXY local_allfdistribu
+            = get_local_fdistribu(get_const_field(global_allfdistribu), local_idx_range);
+
+    DFieldMemVxVy const quadrature_coeffs(
+            trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(
+                    IdxRangeVxVy(global_idx_range)));
+    DFieldMemVxVy local_quadrature_coeffs(IdxRangeVxVy(local_idx_range));
+    ddc::parallel_deepcopy(
+            get_field(local_quadrature_coeffs),
+            quadrature_coeffs[IdxRangeVxVy(local_idx_range)]);
+
+    ChargeDensityCalculator const serial_rhs(get_const_field(quadrature_coeffs));
+    DFieldMemXY rho_ref(idx_range_xy);
+    serial_rhs(get_field(rho_ref), get_const_field(global_allfdistribu));
+
+    ChargeDensityCalculator const local_rhs(get_const_field(local_quadrature_coeffs));
+    MpiChargeDensityCalculator const mpi_rhs(MPI_COMM_WORLD, local_rhs, reduction);
+    DFieldMemXY rho(idx_range_xy);
+    mpi_rhs(get_field(rho), get_const_field(local_allfdistribu));
+
+    expect_fields_near(get_const_field(rho), get_const_field(rho_ref), 1e-12);
+}
+
+} // namespace
+
+TEST(MpiChargeDensityCalculatorXYVxVy, GlobalReduction)
+{
+    test_charge_density(MpiChargeDensityCalculator::Reduction::Global);
+}
+
+TEST(MpiChargeDensityCalculatorXYVxVy, NodeAwareReduction)
+{
+    test_charge_density(MpiChargeDensityCalculator::Reduction::NodeAware);
+}
+
+TEST(MpiNodeQNSolver, MatchesSerial)
+{
+    IdxRangeSpVxVyXY const global_idx_range = init_global_idx_range();
+    IdxRangeSpVxVyXY const local_idx_range = get_local_idx_range(global_idx_range);
+    IdxRangeXY const idx_range_xy(global_idx_range);
+
+    DFieldMemSpVxVyXY global_allfdistribu(global_idx_range);
+    fill_fdistribu(get_field(global_allfdistribu));
+    DFieldMemSpVxVyXY local_allfdistribu
+            = get_local_fdistribu(get_const_field(global_allfdistribu), local_idx_range);
+
+    DFieldMemVxVy const quadrature_coeffs(
+            trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(
+                    IdxRangeVxVy(global_idx_range)));
+    DFieldMemVxVy local_quadrature_coeffs(IdxRangeVxVy(local_idx_range));
+    ddc::parallel_deepcopy(
+            get_field(local_quadrature_coeffs),
+            quadrature_coeffs[IdxRangeVxVy(local_idx_range)]);
+
+    FFTPoissonSolver<IdxRangeXY> fft_poisson_solver(idx_range_xy);
+
+    // Serial reference
+    ChargeDensityCalculator const serial_rhs(get_const_field(quadrature_coeffs));
+    QNSolver const serial_poisson(fft_poisson_solver, serial_rhs);
+    DFieldMemXY electrostatic_potential_ref(idx_range_xy);
+    DFieldMemXY electric_field_x_ref(idx_range_xy);
+    DFieldMemXY electric_field_y_ref(idx_range_xy);
+    serial_poisson(
+            get_field(electrostatic_potential_ref),
+            get_field(electric_field_x_ref),
+            get_field(electric_field_y_ref),
+            get_const_field(global_allfdistribu));
+
+    // Solve once per node
+    ChargeDensityCalculator const local_rhs(get_const_field(local_quadrature_coeffs));
+    MpiChargeDensityCalculator const mpi_rhs(
+            MPI_COMM_WORLD,
+            local_rhs,
+            MpiChargeDensityCalculator::Reduction::NodeAware);
+    MpiNodeQNSolver const node_poisson(fft_poisson_solver, mpi_rhs);
+    DFieldMemXY electrostatic_potential(idx_range_xy);
+    DFieldMemXY electric_field_x(idx_range_xy);
+    DFieldMemXY electric_field_y(idx_range_xy);
+    node_poisson(
+            get_field(electrostatic_potential),
+            get_field(electric_field_x),
+            get_field(electric_field_y),
+            get_const_field(local_allfdistribu));
+
+    expect_fields_near(
+            get_const_field(electrostatic_potential),
+            get_const_field(electrostatic_potential_ref),
+            1e-12);
+    expect_fields_near(
+            get_const_field(electric_field_x),
+            get_const_field(electric_field_x_ref),
+            1e-12);
+    expect_fields_near(
+            get_const_field(electric_field_y),
+            get_const_field(electric_field_y_ref),
+            1e-12);
+}
+
+TEST(MpiGatherQNSolver, MatchesSerial)
+{
+    IdxRangeSpVxVyXY const global_idx_range = init_global_idx_range();
+    IdxRangeSpVxVyXY const local_idx_range = get_local_idx_range_x2Dsplit(global_idx_range);
+    IdxRangeXY const idx_range_xy(global_idx_range);
+    IdxRangeXY const local_idx_range_xy(local_idx_range);
+
+    DFieldMemSpVxVyXY global_allfdistribu(global_idx_range);
+    fill_fdistribu(get_field(global_allfdistribu));
+    DFieldMemSpVxVyXY local_allfdistribu
+            = get_local_fdistribu(get_const_field(global_allfdistribu), local_idx_range);
+
+    DFieldMemVxVy const quadrature_coeffs(
+            trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(
+                    IdxRangeVxVy(global_idx_range)));
+
+    FFTPoissonSolver<IdxRangeXY> fft_poisson_solver(idx_range_xy);
+    ChargeDensityCalculator const rhs(get_const_field(quadrature_coeffs));
+
+    // Serial reference
+    QNSolver const serial_poisson(fft_poisson_solver, rhs);
+    DFieldMemXY electrostatic_potential_ref(idx_range_xy);
+    DFieldMemXY electric_field_x_ref(idx_range_xy);
+    DFieldMemXY electric_field_y_ref(idx_range_xy);
+    serial_poisson(
+            get_field(electrostatic_potential_ref),
+            get_field(electric_field_x_ref),
+            get_field(electric_field_y_ref),
+            get_const_field(global_allfdistribu));
+
+    // Gather the local charge densities and solve on the global spatial index range
+    MpiGatherQNSolver const gather_poisson(fft_poisson_solver, rhs, idx_range_xy, MPI_COMM_WORLD);
+    DFieldMemXY electrostatic_potential(local_idx_range_xy);
+    DFieldMemXY electric_field_x(local_idx_range_xy);
+    DFieldMemXY electric_field_y(local_idx_range_xy);
+    gather_poisson(
+            get_field(electrostatic_potential),
+            get_field(electric_field_x),
+            get_field(electric_field_y),
+            get_const_field(local_allfdistribu));
+
+    // Each rank compares its block with the serial result
+    DFieldMemXY const local_electrostatic_potential_ref = get_local_field(
+            get_const_field(electrostatic_potential_ref),
+            local_idx_range_xy);
+    DFieldMemXY const local_electric_field_x_ref
+            = get_local_field(get_const_field(electric_field_x_ref), local_idx_range_xy);
+    DFieldMemXY const local_electric_field_y_ref
+            = get_local_field(get_const_field(electric_field_y_ref), local_idx_range_xy);
+    expect_fields_near(
+            get_const_field(electrostatic_potential),
+            get_const_field(local_electrostatic_potential_ref),
+            1e-12);
+    expect_fields_near(
+            get_const_field(electric_field_x),
+            get_const_field(local_electric_field_x_ref),
+            1e-12);
+    expect_fields_near(
+            get_const_field(electric_field_y),
+            get_const_field(local_electric_field_y_ref),
+            1e-12);
+}
@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: MIT
+#include <array>
+#include <cmath>
+
+#include <mpi.h>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "bsl_advection_vx.hpp"
+#include "bsl_advection_x.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "geometry.hpp"
+#include "mpisplitvlasovsolver.hpp"
+#include "mpitransposealltoall.hpp"
+#include "species_info.hpp"
+#include "spline_interpolator.hpp"
+#include "trapezoid_quadrature.hpp"
+
+namespace {
+
+using IdxSpVxVyXY = Idx<Species, GridVx, GridVy, GridX, GridY>;
+
+/**
+ * Initialise a small 4D mesh and two species. The number of points in the spatial and in the
+ * velocity dimensions can be distributed over 2 MPI ranks.
+ */
+IdxRangeSpXYVxVy init_global_idx_range()
+{
+    CoordX const x_min(0.0);
+    CoordX const x_max(2 * M_PI);
+    IdxStepX const x_ncells(8);
+    CoordY const y_min(0.0);
+    CoordY const y_max(2 * M_PI);
+    IdxStepY const y_ncells(8);
+    CoordVx const vx_min(-6.0);
+    CoordVx const vx_max(6.0);
+    IdxStepVx const vx_ncells(9);
+    CoordVy const vy_min(-6.0);
+    CoordVy const vy_max(6.0);
+    IdxStepVy const vy_ncells(9);
+
+    ddc::init_discrete_space<BSplinesX>(x_min, x_max, x_ncells);
+    ddc::init_discrete_space<BSplinesY>(y_min, y_max, y_ncells);
+    ddc::init_discrete_space<BSplinesVx>(vx_min, vx_max, vx_ncells);
+    ddc::init_discrete_space<BSplinesVy>(vy_min, vy_max, vy_ncells);
+
+    ddc::init_discrete_space<GridX>(SplineInterpPointsX::get_sampling<GridX>());
+    ddc::init_discrete_space<GridY>(SplineInterpPointsY::get_sampling<GridY>());
+    ddc::init_discrete_space<GridVx>(SplineInterpPointsVx::get_sampling<GridVx>());
+    ddc::init_discrete_space<GridVy>(SplineInterpPointsVy::get_sampling<GridVy>());
+
+    IdxRangeSp const idx_range_sp(IdxSp(0), IdxStepSp(2));
+    host_t<DFieldMemSp> charges(idx_range_sp);
+    host_t<DFieldMemSp> masses(idx_range_sp);
+    charges(idx_range_sp.front()) = -1.;
+    charges(idx_range_sp.back()) = 1.;
+    masses(idx_range_sp.front()) = 0.01;
+    masses(idx_range_sp.back()) = 1.;
+    ddc::init_discrete_space<Species>(std::move(charges), std::move(masses));
+
+    return IdxRangeSpXYVxVy(
+            idx_range_sp,
+            SplineInterpPointsX::get_domain<GridX>(),
+            SplineInterpPointsY::get_domain<GridY>(),
+            SplineInterpPointsVx::get_domain<GridVx>(),
+            SplineInterpPointsVy::get_domain<GridVy>());
+}
+
+/// Fill a perturbed Maxwellian distribution function.
+void fill_fdistribu(DFieldSpVxVyXY const allfdistribu)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(allfdistribu),
+            KOKKOS_LAMBDA(IdxSpVxVyXY const ispvxvyxy) {
+                double const x = ddc::coordinate(IdxX(ispvxvyxy));
+                double const y = ddc::coordinate(IdxY(ispvxvyxy));
+                double const vx = ddc::coordinate(IdxVx(ispvxvyxy));
+                double const vy = ddc::coordinate(IdxVy(ispvxvyxy));
+                allfdistribu(ispvxvyxy) = Kokkos::exp(-0.5 * (vx * vx + vy * vy))
+                                          * (1.0 + 0.1 * Kokkos::cos(x) + 0.05 * Kokkos::sin(y));
+            });
+}
+
+/// Fill an electric field which varies in x and y.
+void fill_electric_field(DFieldXY const electric_field_x, DFieldXY const electric_field_y)
+{
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(electric_field_x),
+            KOKKOS_LAMBDA(IdxXY const ixy) {
+                electric_field_x(ixy) = 0.1 * Kokkos::sin(ddc::coordinate(IdxX(ixy)));
+                electric_field_y(ixy) = 0.1 * Kokkos::cos(ddc::coordinate(IdxY(ixy)));
+            });
+}
+
+/**
+ * Compute the mass and the kinetic energy of the distribution function summed over all the
+ * ranks. The spatial cells are uniform so the spatial integral is a sum up to a constant factor.
+ */
+std::array<double, 2> compute_mass_and_energy(
+        DConstFieldSpVxVyXY const allfdistribu,
+        DConstFieldVxVy const quadrature_coeffs)
+{
+    double const local_mass = ddc::parallel_transform_reduce(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(allfdistribu),
+            0.0,
+            ddc::reducer::sum<double>(),
+            KOKKOS_LAMBDA(IdxSpVxVyXY const ispvxvyxy) {
+                return quadrature_coeffs(IdxVxVy(ispvxvyxy)) * allfdistribu(ispvxvyxy);
+            });
+    double const local_energy = ddc::parallel_transform_reduce(
+            Kokkos::DefaultExecutionSpace(),
+            get_idx_range(allfdistribu),
+            0.0,
+            ddc::reducer::sum<double>(),
+            KOKKOS_LAMBDA(IdxSpVxVyXY const ispvxvyxy) {
+                double const vx = ddc::coordinate(IdxVx(ispvxvyxy));
+                double const vy = ddc::coordinate(IdxVy(ispvxvyxy));
+                return 0.5 * (vx * vx + vy * vy) * quadrature_coeffs(IdxVxVy(ispvxvyxy))
+                       * allfdistribu(ispvxvyxy);
+            });
+    std::array<double, 2> local_values {local_mass, local_energy};
+    std::array<double, 2> values;
+    MPI_Allreduce(local_values.data(), values.data(), 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    return values;
+}
+
+} // namespace
+
+TEST(MpiSplitVlasovSolverXYVxVy, SinglePrecisionTransposes)
+{
+    IdxRangeSpXYVxVy const global_idx_range = init_global_idx_range();
+    IdxRangeXY const idx_range_xy(global_idx_range);
+    IdxRangeVx const idx_range_vx(global_idx_range);
+    IdxRangeVy const idx_range_vy(global_idx_range);
+
+    MPITransposeAllToAll<X2DSplit, V2DSplit> transpose(global_idx_range, MPI_COMM_WORLD);
+    IdxRangeSpXYVxVy const idxrange_x2Dsplit(transpose.get_local_idx_range<X2DSplit>());
+    IdxRangeSpVxVyXY const idxrange_v2Dsplit(transpose.get_local_idx_range<V2DSplit>());
+    IdxRangeVxVy const idxrange_vxvy_v2Dsplit(idxrange_v2Dsplit);
+
+    SplineXBuilder const builder_x((IdxRangeVxVyXY(idxrange_v2Dsplit)));
+    SplineYBuilder const builder_y((IdxRangeVxVyXY(idxrange_v2Dsplit)));
+    SplineVxBuilder const builder_vx(idxrange_x2Dsplit);
+    SplineVyBuilder const builder_vy(idxrange_x2Dsplit);
+
+    ddc::PeriodicExtrapolationRule<X> bv_x_min;
+    ddc::PeriodicExtrapolationRule<X> bv_x_max;
+    SplineXEvaluator const spline_x_evaluator(bv_x_min, bv_x_max);
+    ddc::PeriodicExtrapolationRule<Y> bv_y_min;
+    ddc::PeriodicExtrapolationRule<Y> bv_y_max;
+    SplineYEvaluator const spline_y_evaluator(bv_y_min, bv_y_max);
+    ddc::ConstantExtrapolationRule<Vx> bv_vx_min(ddc::coordinate(idx_range_vx.front()));
+    ddc::ConstantExtrapolationRule<Vx> bv_vx_max(ddc::coordinate(idx_range_vx.back()));
+    SplineVxEvaluator const spline_vx_evaluator(bv_vx_min, bv_vx_max);
+    ddc::ConstantExtrapolationRule<Vy> bv_vy_min(ddc::coordinate(idx_range_vy.front()));
+    ddc::ConstantExtrapolationRule<Vy> bv_vy_max(ddc::coordinate(idx_range_vy.back()));
+    SplineVyEvaluator const spline_vy_evaluator(bv_vy_min, bv_vy_max);
+
+    PreallocatableSplineInterpolator const spline_x_interpolator(builder_x, spline_x_evaluator);
+    PreallocatableSplineInterpolator const spline_y_interpolator(builder_y, spline_y_evaluator);
+    PreallocatableSplineInterpolator const spline_vx_interpolator(builder_vx, spline_vx_evaluator);
+    PreallocatableSplineInterpolator const spline_vy_interpolator(builder_vy, spline_vy_evaluator);
+
+    BslAdvectionSpatial<GeometryVxVyXY, GridX> const advection_x(spline_x_interpolator);
+    BslAdvectionSpatial<GeometryVxVyXY, GridY> const advection_y(spline_y_interpolator);
+    BslAdvectionVelocity<GeometryXYVxVy, GridVx> const advection_vx(spline_vx_interpolator);
+    BslAdvectionVelocity<GeometryXYVxVy, GridVy> const advection_vy(spline_vy_interpolator);
+
+    MpiSplitVlasovSolver const vlasov_double(
+            advection_x,
+            advection_y,
+            advection_vx,
+            advection_vy,
+            transpose,
+            MpiSplitVlasovSolver::TransposePrecision::Double);
+    MpiSplitVlasovSolver const vlasov_single(
+            advection_x,
+            advection_y,
+            advection_vx,
+            advection_vy,
+            transpose,
+            MpiSplitVlasovSolver::TransposePrecision::Single);
+
+    DFieldMemVxVy const quadrature_coeffs(
+            trapezoid_quadrature_coefficients<Kokkos::DefaultExecutionSpace>(
+                    IdxRangeVxVy(global_idx_range)));
+    DFieldMemVxVy local_quadrature_coeffs(idxrange_vxvy_v2Dsplit);
+    ddc::parallel_deepcopy(
+            get_field(local_quadrature_coeffs),
+            quadrature_coeffs[idxrange_vxvy_v2Dsplit]);
+
+    DFieldMemXY electric_field_x(idx_range_xy);
+    DFieldMemXY electric_field_y(idx_range_xy);
+    fill_electric_field(get_field(electric_field_x), get_field(electric_field_y));
+
+    DFieldMemSpVxVyXY allfdistribu_double(idxrange_v2Dsplit);
+    DFieldMemSpVxVyXY allfdistribu_single(idxrange_v2Dsplit);
+    fill_fdistribu(get_field(allfdistribu_double));
+    fill_fdistribu(get_field(allfdistribu_single));
+
+    double const dt = 0.1;
+    int const nbiter = 5;
+    for (int iter(0); iter < nbiter; ++iter) {
+        vlasov_double(
+                get_field(allfdistribu_double),
+                get_const_field(electric_field_x),
+                get_const_field(electric_field_y),
+                dt);
+        vlasov_single(
+                get_field(allfdistribu_single),
+                get_const_field(electric_field_x),
+                get_const_field(electric_field_y),
+                dt);
+    }
+
+    std::array<double, 2> const mass_energy_double = compute_mass_and_energy(
+            get_const_field(allfdistribu_double),
+            get_const_field(local_quadrature_coeffs));
+    std::array<double, 2> const mass_energy_single = compute_mass_and_energy(
+            get_const_field(allfdistribu_single),
+            get_const_field(local_quadrature_coeffs));
+
+    // The rounding errors of the transposes only perturb the invariants at the float precision
+    double const tol = 1e-6;
+    EXPECT_NEAR(mass_energy_single[0], mass_energy_double[0], tol * mass_energy_double[0]);
+    EXPECT_NEAR(mass_energy_single[1], mass_energy_double[1], tol * mass_energy_double[1]);
+
+    auto allfdistribu_double_host
+            = ddc::create_mirror_view_and_copy(get_field(allfdistribu_double));
+    auto allfdistribu_single_host
+            = ddc::create_mirror_view_and_copy(get_field(allfdistribu_single));
+    ddc::for_each(idxrange_v2Dsplit, [&](IdxSpVxVyXY const ispvxvyxy) {
+        EXPECT_NEAR(allfdistribu_single_host(ispvxvyxy), allfdistribu_double_host(ispvxvyxy), 1e-6);
+    });
+}
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: MIT
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+#include <paraconf.h>
+#include <pdi.h>
+
+#include "operator_cache.hpp"
+
+namespace {
+
+constexpr char const* const operator_cache_pdi_cfg = R"PDI_CFG(
+data:
+  operator_cache_key: int64
+  operator_cache_size: int
+  operator_cache_nnz: int
+  operator_cache_stored_key: int64
+  operator_cache_values: {type: array, subtype: double, size: [1, '$operator_cache_nnz']}
+  operator_cache_col_idx: {type: array, subtype: int, size: '$operator_cache_nnz'}
+  operator_cache_row_ptr: {type: array, subtype: int, size: '${operator_cache_size} + 1'}
+
+plugins:
+  decl_hdf5:
+    - file: 'test_operator_cache_${operator_cache_key}.h5'
+      on_event: [operator_cache_read]
+      read: [operator_cache_values, operator_cache_col_idx, operator_cache_row_ptr, operator_cache_stored_key]
+    - file: 'test_operator_cache_${operator_cache_key}.h5'
+      on_event: [operator_cache_write]
+      collision_policy: replace_and_warn
+      write: [operator_cache_values, operator_cache_col_idx, operator_cache_row_ptr, operator_cache_stored_key]
+)PDI_CFG";
+
+} // namespace
+
+TEST(OperatorCache, Hash)
+{
+    std::array<double, 3> data {1.0, 2.0, 3.0};
+    std::uint64_t const hash = OperatorCache::hash(data.data(), sizeof(data));
+    EXPECT_EQ(hash, OperatorCache::hash(data.data(), sizeof(data)));
+    EXPECT_NE(hash, OperatorCache::hash(data.data(), 0));
+    EXPECT_EQ(OperatorCache::hash(data.data(), 0), OperatorCache::hash_seed);
+
+    // Hashing the data in two parts is equivalent to hashing it at once
+    std::uint64_t const partial_hash = OperatorCache::hash(data.data(), sizeof(double));
+    EXPECT_EQ(hash, OperatorCache::hash(data.data() + 1, 2 * sizeof(double), partial_hash));
+
+    data[1] = 2.5;
+    EXPECT_NE(hash, OperatorCache::hash(data.data(), sizeof(data)));
+}
+
+TEST(OperatorCache, Inactive)
+{
+    OperatorCache const cache(false);
+    OperatorCache::ValuesView values("values", 1, 4);
+    OperatorCache::IndexView col_idx("col_idx", 4);
+    OperatorCache::IndexView row_ptr("row_ptr", 3);
+    EXPECT_FALSE(cache.is_active());
+    EXPECT_FALSE(cache.load(1, values, col_idx, row_ptr));
+}
+
+TEST(OperatorCache, SaveAndLoad)
+{
+    PC_tree_t conf_pdi = PC_parse_string(operator_cache_pdi_cfg);
+    PDI_init(conf_pdi);
+
+    int const size = 3;
+    int const nnz = 7;
+    std::uint64_t const key = OperatorCache::hash(&nnz, sizeof(int));
+
+    // Tridiagonal matrix
+    OperatorCache::ValuesView values("values", 1, nnz);
+    OperatorCache::IndexView col_idx("col_idx", nnz);
+    OperatorCache::IndexView row_ptr("row_ptr", size + 1);
+    int k = 0;
+    for (int i(0); i < size; ++i) {
+        row_ptr(i) = k;
+        for (int j(std::max(i - 1, 0)); j < std::min(i + 2, size); ++j) {
+            col_idx(k) = j;
+            values(0, k) = (i == j) ? 2. : -1. / (i + j + 1);
+            ++k;
+        }
+    }
+    row_ptr(size) = k;
+
+    OperatorCache const cache(true);
+
+    OperatorCache::ValuesView values_read("values_read", 1, nnz);
+    OperatorCache::IndexView col_idx_read("col_idx_read", nnz);
+    OperatorCache::IndexView row_ptr_read("row_ptr_read", size + 1);
+
+    // The file does not exist yet
+    EXPECT_FALSE(cache.load(key, values_read, col_idx_read, row_ptr_read));
+
+    cache.save(key, values, col_idx, row_ptr);
+    EXPECT_TRUE(cache.load(key, values_read, col_idx_read, row_ptr_read));
+    for (int i(0); i < nnz; ++i) {
+        EXPECT_EQ(values_read(0, i), values(0, i));
+        EXPECT_EQ(col_idx_read(i), col_idx(i));
+    }
+    for (int i(0); i < size + 1; ++i) {
+        EXPECT_EQ(row_ptr_read(i), row_ptr(i));
+    }
+
+    // An operator with a different key is not found
+    EXPECT_FALSE(cache.load(key + 1, values_read, col_idx_read, row_ptr_read));
+
+    std::remove(("test_operator_cache_" + std::to_string(std::int64_t(key)) + ".h5").c_str());
+
+    PC_tree_destroy(&conf_pdi);
+    PDI_finalize();
+}
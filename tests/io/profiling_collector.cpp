@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: MIT
+#include <sstream>
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include "profiling_collector.hpp"
+
+namespace {
+
+void profiled_work(int n_elements)
+{
+    Kokkos::Profiling::pushRegion("Outer");
+    Kokkos::View<double*> values("values", n_elements);
+    Kokkos::Profiling::pushRegion("Inner");
+    Kokkos::deep_copy(values, 1.0);
+    Kokkos::Profiling::popRegion();
+    Kokkos::Profiling::popRegion();
+}
+
+} // namespace
+
+TEST(ProfilingCollector, RegionStatistics)
+{
+    int const n_elements = 1000;
+    ProfilingCollector const profiler(true);
+    for (int i(0); i < 3; ++i) {
+        profiled_work(n_elements);
+    }
+    std::map<std::string, ProfilingCollector::RegionStatistics> const statistics
+            = profiler.get_statistics();
+
+    ASSERT_EQ(statistics.count("Outer"), 1);
+    ASSERT_EQ(statistics.count("Inner"), 1);
+    EXPECT_EQ(statistics.at("Outer").nb_calls, 3);
+    EXPECT_EQ(statistics.at("Inner").nb_calls, 3);
+    EXPECT_GE(statistics.at("Outer").time, statistics.at("Inner").time);
+    EXPECT_GE(statistics.at("Outer").allocated_bytes, 3 * n_elements * sizeof(double));
+    EXPECT_EQ(statistics.at("Inner").allocated_bytes, 0);
+    EXPECT_GE(profiler.get_peak_allocated_bytes(), n_elements * sizeof(double));
+
+    std::ostringstream report;
+    profiler.report(report);
+    EXPECT_NE(report.str().find("Outer"), std::string::npos);
+    EXPECT_LT(report.str().find("Outer"), report.str().find("Inner"));
+}
+
+TEST(ProfilingCollector, Inactive)
+{
+    ProfilingCollector const profiler(false);
+    profiled_work(10);
+    EXPECT_TRUE(profiler.get_statistics().empty());
+    EXPECT_EQ(profiler.get_peak_allocated_bytes(), 0);
+}
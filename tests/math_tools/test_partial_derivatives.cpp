@@ -1,4 +1,6 @@
 // SPDX-License-Identifier: MIT
+#include <cmath>
+
 #include <ddc/ddc.hpp>
 #include <ddc/kernels/splines.hpp>
 
@@ -10,6 +12,7 @@
 #include "math_tools.hpp"
 #include "mesh_builder.hpp"
 #include "spline_1d_partial_derivative.hpp"
+#include "spline_1d_precomputed_partial_derivative.hpp"
 #include "spline_2d_partial_derivative.hpp"
 
 namespace {
@@ -24,6 +27,11 @@ struct Y
     static bool constexpr PERIODIC = false;
 };
 
+struct XPeriodic
+{
+    static bool constexpr PERIODIC = true;
+};
+
 auto static constexpr SplineBoundary = ddc::BoundCond::GREVILLE;
 
 std::size_t static constexpr spline_degree = 3;
@@ -98,6 +106,44 @@ public:
     }
 };
 
+/**
+ * @brief Compute the maximum point-wise difference between the derivatives of a field
+ * computed with two partial derivative operators.
+ *
+ * @param[in] field The field to be differentiated.
+ * @param[in] derivative_creator The operator to be tested.
+ * @param[in] derivative_creator_ref The reference operator.
+ *
+ * @return The maximum absolute difference between the two differentiated fields.
+ */
+template <class IdxRangeXY, class DerivativeDimension>
+double compute_max_difference(
+        DConstField<IdxRangeXY> const field,
+        IPartialDerivativeCreator<IdxRangeXY, DerivativeDimension> const& derivative_creator,
+        IPartialDerivativeCreator<IdxRangeXY, DerivativeDimension> const&
+                derivative_creator_ref)
+{
+    using IdxXY = typename IdxRangeXY::discrete_element_type;
+    IdxRangeXY const idxrange_xy = get_idx_range(field);
+
+    DFieldMem<IdxRangeXY> field_differentiated_alloc(idxrange_xy);
+    DFieldMem<IdxRangeXY> field_differentiated_ref_alloc(idxrange_xy);
+    DField<IdxRangeXY> field_differentiated = get_field(field_differentiated_alloc);
+    DField<IdxRangeXY> field_differentiated_ref = get_field(field_differentiated_ref_alloc);
+
+    (*derivative_creator.create_instance(field))(field_differentiated);
+    (*derivative_creator_ref.create_instance(field))(field_differentiated_ref);
+
+    return ddc::parallel_transform_reduce(
+            Kokkos::DefaultExecutionSpace(),
+            idxrange_xy,
+            0.,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(IdxXY const idx) {
+                return Kokkos::abs(field_differentiated(idx) - field_differentiated_ref(idx));
+            });
+}
+
 /**
  * @brief A class that represents a test for partial derivatives.
  * The test can be used with several implementations for computing
@@ -298,7 +344,7 @@ public:
         ddc::init_discrete_space<GridY>(SplineInterpPointsY::template get_sampling<GridY>());
     }
 
-    double compute_error(double& max_distance) const
+    double compute_error(double& max_distance, bool use_precomputed_operator = false) const
     {
         IdxRangeX const idxrange_x = SplineInterpPointsX::template get_domain<GridX>();
         IdxRangeY const idxrange_y = SplineInterpPointsY::template get_domain<GridY>();
@@ -318,10 +364,21 @@ public:
         SplineDDimBuilder const spline_builder(idxrange);
         SplineDDimEvaluator const spline_evaluator(bv_min, bv_max);
 
+        FunctionToDifferentiateCosine function_to_differentiate;
+        if (use_precomputed_operator) {
+            Spline1DPrecomputedPartialDerivativeCreator<SplineDDimBuilder> const
+                    derivative_creator(spline_builder);
+            return base_type::
+                    template compute_max_error<DerivativeDimension, FunctionToDifferentiateCosine>(
+                            idxrange,
+                            function_to_differentiate,
+                            derivative_creator,
+                            max_distance);
+        }
+
         Spline1DPartialDerivativeCreator<SplineDDimBuilder, SplineDDimEvaluator> const
                 derivative_creator(spline_builder, spline_evaluator);
 
-        FunctionToDifferentiateCosine function_to_differentiate;
         double const max_error = base_type::
                 template compute_max_error<DerivativeDimension, FunctionToDifferentiateCosine>(
                         idxrange,
@@ -331,6 +388,168 @@ public:
 
         return max_error;
     }
+
+    /**
+     * @brief Compare point by point the derivative computed with the precomputed operator
+     * with the derivative of the spline interpolation.
+     *
+     * @return The maximum absolute difference between the two derivatives.
+     */
+    double compute_max_difference_with_precomputed() const
+    {
+        IdxRangeX const idxrange_x = SplineInterpPointsX::template get_domain<GridX>();
+        IdxRangeY const idxrange_y = SplineInterpPointsY::template get_domain<GridY>();
+        IdxRangeXY const idxrange = IdxRangeXY(idxrange_x, idxrange_y);
+
+        double dmin, dmax;
+        if constexpr (std::is_same_v<DDim, X>) {
+            dmin = base_type::m_xmin;
+            dmax = base_type::m_xmax;
+        } else {
+            dmin = base_type::m_ymin;
+            dmax = base_type::m_ymax;
+        }
+        ddc::ConstantExtrapolationRule<DDim> const bv_min(Coord<DDim> {dmin});
+        ddc::ConstantExtrapolationRule<DDim> const bv_max(Coord<DDim> {dmax});
+
+        SplineDDimBuilder const spline_builder(idxrange);
+        SplineDDimEvaluator const spline_evaluator(bv_min, bv_max);
+
+        DFieldMem<IdxRangeXY> field_alloc(idxrange);
+        DField<IdxRangeXY> field = get_field(field_alloc);
+        FunctionToDifferentiateCosine function_to_differentiate;
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                idxrange,
+                KOKKOS_LAMBDA(typename base_type::IdxXY const idx) {
+                    field(idx) = function_to_differentiate(ddc::coordinate(idx));
+                });
+
+        Spline1DPrecomputedPartialDerivativeCreator<SplineDDimBuilder> const
+                precomputed_derivative_creator(spline_builder);
+        Spline1DPartialDerivativeCreator<SplineDDimBuilder, SplineDDimEvaluator> const
+                derivative_creator(spline_builder, spline_evaluator);
+
+        return compute_max_difference(
+                get_const_field(field),
+                precomputed_derivative_creator,
+                derivative_creator);
+    }
+};
+
+/**
+ * @brief A class that represents a test for the precomputed spline derivative
+ * along a periodic dimension. The stencils near the boundaries wrap around
+ * the grid.
+ */
+template <std::size_t ncells_x, std::size_t ncells_y>
+class PeriodicPartialDerivativeTestSpline1D
+{
+public:
+    struct BSplinesX : ddc::NonUniformBSplines<XPeriodic, spline_degree>
+    {
+    };
+    using SplineInterpPointsX = ddc::GrevilleInterpolationPoints<
+            BSplinesX,
+            ddc::BoundCond::PERIODIC,
+            ddc::BoundCond::PERIODIC>;
+
+    struct GridX : NonUniformGridBase<XPeriodic>
+    {
+    };
+
+    struct GridY : NonUniformGridBase<Y>
+    {
+    };
+
+    using IdxRangeX = IdxRange<GridX>;
+    using IdxRangeY = IdxRange<GridY>;
+    using IdxRangeXY = IdxRange<GridX, GridY>;
+    using IdxXY = Idx<GridX, GridY>;
+
+    using SplineXBuilder = ddc::SplineBuilder<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            BSplinesX,
+            GridX,
+            ddc::BoundCond::PERIODIC,
+            ddc::BoundCond::PERIODIC,
+            ddc::SplineSolver::LAPACK,
+            GridX,
+            GridY>;
+
+    using SplineXEvaluator = ddc::SplineEvaluator<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            BSplinesX,
+            GridX,
+            ddc::PeriodicExtrapolationRule<XPeriodic>,
+            ddc::PeriodicExtrapolationRule<XPeriodic>,
+            GridX,
+            GridY>;
+
+private:
+    IdxRangeY m_idxrange_y;
+
+public:
+    PeriodicPartialDerivativeTestSpline1D(double const ymin, double const ymax)
+        : m_idxrange_y(Idx<GridY>(0), IdxStep<GridY>(ncells_y + 1))
+    {
+        std::vector<Coord<XPeriodic>> point_sampling_x = build_random_non_uniform_break_points(
+                Coord<XPeriodic>(0.),
+                Coord<XPeriodic>(2 * M_PI),
+                IdxStep<GridX>(ncells_x),
+                0.2);
+        ddc::init_discrete_space<BSplinesX>(point_sampling_x);
+        ddc::init_discrete_space<GridX>(SplineInterpPointsX::template get_sampling<GridX>());
+
+        std::vector<CoordY> point_sampling_y = build_random_non_uniform_break_points(
+                CoordY(ymin),
+                CoordY(ymax),
+                IdxStep<GridY>(ncells_y),
+                0.2);
+        ddc::init_discrete_space<GridY>(point_sampling_y);
+    }
+
+    /**
+     * @brief Compare point by point the derivative computed with the precomputed operator
+     * with the derivative of the spline interpolation.
+     *
+     * @param[out] stencil_width The width of the stencil of the precomputed operator.
+     *
+     * @return The maximum absolute difference between the two derivatives.
+     */
+    double compute_max_difference_with_precomputed(int& stencil_width) const
+    {
+        IdxRangeX const idxrange_x = SplineInterpPointsX::template get_domain<GridX>();
+        IdxRangeXY const idxrange(idxrange_x, m_idxrange_y);
+
+        SplineXBuilder const spline_builder(idxrange);
+        ddc::PeriodicExtrapolationRule<XPeriodic> const bv_x;
+        SplineXEvaluator const spline_evaluator(bv_x, bv_x);
+
+        DFieldMem<IdxRangeXY> field_alloc(idxrange);
+        DField<IdxRangeXY> field = get_field(field_alloc);
+        ddc::parallel_for_each(
+                Kokkos::DefaultExecutionSpace(),
+                idxrange,
+                KOKKOS_LAMBDA(IdxXY const idx) {
+                    double const x = ddc::coordinate(Idx<GridX>(idx));
+                    double const y = ddc::coordinate(Idx<GridY>(idx));
+                    field(idx) = Kokkos::cos(x) * Kokkos::cos(y) + 0.5 * Kokkos::sin(2 * x);
+                });
+
+        Spline1DPrecomputedPartialDerivativeCreator<SplineXBuilder> const
+                precomputed_derivative_creator(spline_builder);
+        Spline1DPartialDerivativeCreator<SplineXBuilder, SplineXEvaluator> const
+                derivative_creator(spline_builder, spline_evaluator);
+        stencil_width = precomputed_derivative_creator.stencil_width();
+
+        return compute_max_difference(
+                get_const_field(field),
+                precomputed_derivative_creator,
+                derivative_creator);
+    }
 };
 
 /**
@@ -569,6 +788,63 @@ TEST(PartialDerivative, Spline1DPartialDerivative)
 }
 
 
+TEST(PartialDerivative, Spline1DPrecomputedPartialDerivative)
+{
+    double const xmin(0.1);
+    double const xmax(1.1);
+    double const ymin(0.2);
+    double const ymax(1.2);
+    // relative error of convergence should be less than 15%
+    double const TOL = 0.15;
+
+    // Partial Derivative in X direction
+    double delta_low_x,
+            delta_high_x; // the maximum distance between points in the derivative direction
+    PartialDerivativeTestSpline1D<X, 10, 5> const test_low_x(xmin, xmax, ymin, ymax);
+    PartialDerivativeTestSpline1D<X, 100, 5> const test_high_x(xmin, xmax, ymin, ymax);
+    double const error_low_x = test_low_x.compute_error(delta_low_x, true);
+    double const error_high_x = test_high_x.compute_error(delta_high_x, true);
+
+    // The precomputed operator should give the same result as the spline interpolation
+    EXPECT_LE(test_high_x.compute_max_difference_with_precomputed(), 1e-10);
+
+    double const order_x
+            = std::log(error_high_x / error_low_x) / std::log(delta_high_x / delta_low_x);
+    double const relative_error_order_x = std::fabs((spline_degree - order_x) / spline_degree);
+
+    EXPECT_LE(relative_error_order_x, TOL);
+
+    // Partial Derivative in Y direction
+    double delta_low_y,
+            delta_high_y; // the maximum distance between points in the derivative direction
+    PartialDerivativeTestSpline1D<Y, 5, 10> const test_low_y(xmin, xmax, ymin, ymax);
+    PartialDerivativeTestSpline1D<Y, 5, 100> const test_high_y(xmin, xmax, ymin, ymax);
+    double const error_low_y = test_low_y.compute_error(delta_low_y, true);
+    double const error_high_y = test_high_y.compute_error(delta_high_y, true);
+
+    EXPECT_LE(test_high_y.compute_max_difference_with_precomputed(), 1e-10);
+
+    double const order_y
+            = std::log(error_high_y / error_low_y) / std::log(delta_high_y / delta_low_y);
+    double const relative_error_order_y = std::fabs((spline_degree - order_y) / spline_degree);
+
+    EXPECT_LE(relative_error_order_y, TOL);
+}
+
+
+TEST(PartialDerivative, Spline1DPrecomputedPartialDerivativePeriodic)
+{
+    int constexpr ncells_x = 100;
+    PeriodicPartialDerivativeTestSpline1D<ncells_x, 5> const test(0.2, 1.2);
+    int stencil_width;
+    double const max_difference = test.compute_max_difference_with_precomputed(stencil_width);
+
+    // The stencil must be truncated so that the wrapping around the grid is tested
+    EXPECT_LT(stencil_width, ncells_x);
+    EXPECT_LE(max_difference, 1e-10);
+}
+
+
 TEST(PartialDerivative, Spline2DPartialDerivative)
 {
     double const xmin(0.1);
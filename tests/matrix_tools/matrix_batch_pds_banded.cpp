@@ -0,0 +1,120 @@
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "matrix_batch_pds_banded.hpp"
+
+using DView3D = Kokkos::View<double***, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace>;
+using DView2D = Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::DefaultExecutionSpace>;
+using DHostView3D = Kokkos::View<double***, Kokkos::LayoutRight, Kokkos::DefaultHostExecutionSpace>;
+using DHostView2D = Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::DefaultHostExecutionSpace>;
+
+/**
+ * Get the element (i, j) of a symmetric banded matrix stored as in MatrixBatchPdsBanded.
+ */
+double get_element(DHostView3D bands, int batch_idx, int i, int j)
+{
+    int const n_bands = bands.extent(2) - 1;
+    if (i < j) {
+        std::swap(i, j);
+    }
+    return (i - j <= n_bands) ? bands(batch_idx, i, i - j) : 0.0;
+}
+
+TEST(MatrixBatchPdsBanded, Pentadiagonal)
+{
+    int const batch_size = 3;
+    int const mat_size = 10;
+    int const n_bands = 2;
+
+    DHostView3D bands_host("bands", batch_size, mat_size, n_bands + 1);
+    DHostView2D x_host("x", batch_size, mat_size);
+    DHostView2D rhs_host("rhs", batch_size, mat_size);
+    for (int batch_idx = 0; batch_idx < batch_size; ++batch_idx) {
+        for (int i = 0; i < mat_size; ++i) {
+            // Diagonally dominant so positive definite
+            bands_host(batch_idx, i, 0) = 6.0 + batch_idx + 0.1 * i;
+            bands_host(batch_idx, i, 1) = -1.5 + 0.05 * i;
+            bands_host(batch_idx, i, 2) = 0.5 - 0.02 * batch_idx;
+            x_host(batch_idx, i) = std::cos(0.3 * i + batch_idx);
+        }
+    }
+    for (int batch_idx = 0; batch_idx < batch_size; ++batch_idx) {
+        for (int i = 0; i < mat_size; ++i) {
+            rhs_host(batch_idx, i) = 0.0;
+            for (int j = 0; j < mat_size; ++j) {
+                rhs_host(batch_idx, i)
+                        += get_element(bands_host, batch_idx, i, j) * x_host(batch_idx, j);
+            }
+        }
+    }
+
+    DView3D bands("bands", batch_size, mat_size, n_bands + 1);
+    DView2D rhs("rhs", batch_size, mat_size);
+    Kokkos::deep_copy(bands, bands_host);
+    Kokkos::deep_copy(rhs, rhs_host);
+
+    MatrixBatchPdsBanded<Kokkos::DefaultExecutionSpace>
+            matrix(batch_size, mat_size, n_bands, bands);
+    matrix.setup_solver();
+    matrix.solve(rhs);
+    Kokkos::deep_copy(rhs_host, rhs);
+
+    for (int batch_idx = 0; batch_idx < batch_size; ++batch_idx) {
+        for (int i = 0; i < mat_size; ++i) {
+            EXPECT_NEAR(rhs_host(batch_idx, i), x_host(batch_idx, i), 1e-13);
+        }
+    }
+}
+
+TEST(MatrixBatchPdsBanded, Tridiagonal)
+{
+    int const batch_size = 2;
+    int const mat_size = 4;
+    int const n_bands = 1;
+
+    DHostView3D bands_host("bands", batch_size, mat_size, n_bands + 1);
+    for (int batch_idx = 0; batch_idx < batch_size; ++batch_idx) {
+        for (int i = 0; i < mat_size; ++i) {
+            bands_host(batch_idx, i, 0) = 2.0;
+            bands_host(batch_idx, i, 1) = 0.5;
+        }
+    }
+    DView3D bands("bands", batch_size, mat_size, n_bands + 1);
+    DView2D rhs("rhs", batch_size, mat_size);
+    Kokkos::deep_copy(bands, bands_host);
+    Kokkos::deep_copy(rhs, 1.0);
+
+    MatrixBatchPdsBanded<Kokkos::DefaultExecutionSpace>
+            matrix(batch_size, mat_size, n_bands, bands);
+    matrix.setup_solver();
+    matrix.solve(rhs);
+    auto rhs_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rhs);
+
+    // Same system as in the MatrixBatchTridiag.Symmetric test
+    for (int batch_idx = 0; batch_idx < batch_size; ++batch_idx) {
+        EXPECT_NEAR(rhs_host(batch_idx, 0), 8. / 19., 1e-14);
+        EXPECT_NEAR(rhs_host(batch_idx, 1), 6. / 19., 1e-14);
+        EXPECT_NEAR(rhs_host(batch_idx, 2), 6. / 19., 1e-14);
+        EXPECT_NEAR(rhs_host(batch_idx, 3), 8. / 19., 1e-14);
+    }
+}
+
+TEST(MatrixBatchPdsBanded, NotPositiveDefinite)
+{
+    int const batch_size = 1;
+    int const mat_size = 4;
+    int const n_bands = 1;
+
+    DView3D bands("bands", batch_size, mat_size, n_bands + 1);
+    auto bands_diag = Kokkos::subview(bands, Kokkos::ALL, Kokkos::ALL, 0);
+    auto bands_subdiag = Kokkos::subview(bands, Kokkos::ALL, Kokkos::ALL, 1);
+    Kokkos::deep_copy(bands_diag, 1.0);
+    Kokkos::deep_copy(bands_subdiag, 2.0);
+
+    MatrixBatchPdsBanded<Kokkos::DefaultExecutionSpace>
+            matrix(batch_size, mat_size, n_bands, bands);
+    EXPECT_THROW(matrix.setup_solver(), std::runtime_error);
+}
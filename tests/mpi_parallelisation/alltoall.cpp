@@ -1,4 +1,7 @@
 // SPDX-License-Identifier: MIT
+#include <cmath>
+#include <limits>
+
 #include <ddc/ddc.hpp>
 
 #include <gtest/gtest.h>
@@ -79,6 +82,9 @@ using IFieldMemYZWX = host_t<FieldMem<std::size_t, IdxRangeYZWX>>;
 
 using IFieldYX = host_t<Field<std::size_t, IdxRangeYX>>;
 
+using DFieldMemXY = host_t<DFieldMem<IdxRangeXY>>;
+using DFieldMemYX = host_t<DFieldMem<IdxRangeYX>>;
+
 using XDistribLayout = MPILayout<IdxRangeXY, GridX>;
 using YDistribLayout = MPILayout<IdxRangeYX, GridY>;
 
@@ -178,6 +184,49 @@ TEST(MPIParallelisation, AllToAll2D_GPU)
     test_AllToAll2D_GPU();
 }
 
+TEST(MPIParallelisation, AllToAll2DSinglePrecision_CPU)
+{
+    IdxStepX x_size(10);
+    IdxStepY y_size(12);
+
+    IdxXY idx_range_start(0, 0);
+    IdxStepXY idx_range_size(x_size, y_size);
+    IdxRangeXY full_idx_range(idx_range_start, idx_range_size);
+
+    MPITransposeAllToAll<XDistribLayout, YDistribLayout> transpose(full_idx_range, MPI_COMM_WORLD);
+
+    DFieldMemYX send_buffer(transpose.get_local_idx_range<YDistribLayout>());
+    DFieldMemXY recv_buffer(transpose.get_local_idx_range<XDistribLayout>());
+
+    // Values which cannot be represented exactly in single precision
+    ddc::for_each(get_idx_range(send_buffer), [&](IdxYX ixy) {
+        send_buffer(ixy) = 1.0 + std::sqrt(2.0) * get_unique_id(IdxXY(ixy), full_idx_range);
+    });
+
+    // Send the values as floats, they are converted back to doubles on reception
+    transpose.transpose_to<XDistribLayout, float>(
+            Kokkos::DefaultHostExecutionSpace(),
+            get_field(recv_buffer),
+            get_const_field(send_buffer));
+
+    double const tol = 2 * std::numeric_limits<float>::epsilon();
+    double local_sum = 0.0;
+    double local_expected_sum = 0.0;
+    ddc::for_each(get_idx_range(recv_buffer), [&](IdxXY ixy) {
+        double const expected = 1.0 + std::sqrt(2.0) * get_unique_id(ixy, full_idx_range);
+        EXPECT_NEAR(recv_buffer(ixy), expected, tol * expected);
+        local_sum += recv_buffer(ixy);
+        local_expected_sum += expected;
+    });
+
+    // The total mass is only perturbed by the rounding errors
+    double sum;
+    double expected_sum;
+    MPI_Allreduce(&local_sum, &sum, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&local_expected_sum, &expected_sum, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    EXPECT_NEAR(sum, expected_sum, 1e-6 * expected_sum);
+}
+
 TEST(MPIParallelisation, AllToAll3D_CPU)
 {
     IdxStepX x_size(10);
@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: MIT
+#include <cmath>
+#include <stdexcept>
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "ddc_alias_inline_functions.hpp"
+#include "mpi_lagrange_advection_x.hpp"
+#include "mpihaloexchange.hpp"
+#include "mpilayout.hpp"
+#include "species_info.hpp"
+
+namespace {
+
+struct X
+{
+    /// @brief A boolean indicating if the dimension is periodic.
+    static bool constexpr PERIODIC = true;
+};
+struct Y
+{
+};
+struct Vx
+{
+    /// @brief A boolean indicating if the dimension is periodic.
+    static bool constexpr PERIODIC = false;
+};
+
+struct GridX : UniformGridBase<X>
+{
+};
+struct GridY : UniformGridBase<Y>
+{
+};
+struct GridVx : UniformGridBase<Vx>
+{
+};
+
+using IdxX = Idx<GridX>;
+using IdxY = Idx<GridY>;
+using IdxVx = Idx<GridVx>;
+using IdxXY = Idx<GridX, GridY>;
+using IdxSpXVx = Idx<Species, GridX, GridVx>;
+
+using IdxStepX = IdxStep<GridX>;
+using IdxStepY = IdxStep<GridY>;
+using IdxStepVx = IdxStep<GridVx>;
+using IdxStepSp = IdxStep<Species>;
+
+using IdxRangeX = IdxRange<GridX>;
+using IdxRangeVx = IdxRange<GridVx>;
+using IdxRangeSp = IdxRange<Species>;
+using IdxRangeXY = IdxRange<GridX, GridY>;
+using IdxRangeSpXVx = IdxRange<Species, GridX, GridVx>;
+
+using CoordX = Coord<X>;
+using CoordVx = Coord<Vx>;
+
+using IFieldMemXY = host_t<FieldMem<std::size_t, IdxRangeXY>>;
+using DFieldMemSp = DFieldMem<IdxRangeSp>;
+using DFieldMemSpXVx = DFieldMem<IdxRangeSpXVx>;
+using DFieldSpXVx = DField<IdxRangeSpXVx>;
+
+using XDistribLayout = MPILayout<IdxRangeXY, GridX>;
+using XDistribLayoutSpXVx = MPILayout<IdxRangeSpXVx, GridX>;
+
+/// A geometry where the distribution function is distributed along the spatial dimension.
+class GeometryXVx
+{
+public:
+    template <class T>
+    using velocity_dim_for = std::conditional_t<std::is_same_v<T, GridX>, GridVx, void>;
+
+    using IdxRangeSpatial = IdxRangeX;
+
+    using IdxRangeVelocity = IdxRangeVx;
+
+    using IdxRangeFdistribu = IdxRangeSpXVx;
+};
+
+std::size_t get_unique_id(IdxXY ixy, IdxRangeXY full_idx_range)
+{
+    IdxStepY const y_size = ddc::select<GridY>(full_idx_range.extents());
+    return (ddc::select<GridX>(ixy) - IdxX(0)).value() * y_size.value()
+           + (ddc::select<GridY>(ixy) - IdxY(0)).value();
+}
+
+double lagrange_advection_halo_error(
+        IAdvectionSpatial<GeometryXVx, GridX> const& advection_x,
+        IdxRangeSpXVx const global_idx_range,
+        double const timestep)
+{
+    int comm_size;
+    int rank;
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    IdxRangeSpXVx const local_idx_range
+            = XDistribLayoutSpXVx::distribute_idx_range(global_idx_range, comm_size, rank);
+
+    DFieldMemSpXVx allfdistribu_alloc(local_idx_range);
+    DFieldSpXVx allfdistribu = get_field(allfdistribu_alloc);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            local_idx_range,
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                double const x = ddc::coordinate(ddc::select<GridX>(ispxvx));
+                allfdistribu(ispxvx) = Kokkos::cos(x) + 0.5 * Kokkos::sin(2 * x);
+            });
+
+    advection_x(allfdistribu, timestep);
+
+    double const local_max_error = ddc::parallel_transform_reduce(
+            Kokkos::DefaultExecutionSpace(),
+            local_idx_range,
+            0.0,
+            ddc::reducer::max<double>(),
+            KOKKOS_LAMBDA(IdxSpXVx const ispxvx) {
+                IdxSp const isp(ispxvx);
+                double const x = ddc::coordinate(ddc::select<GridX>(ispxvx));
+                double const vx = ddc::coordinate(ddc::select<GridVx>(ispxvx));
+                double const dx = Kokkos::sqrt(mass(ielec()) / mass(isp)) * vx * timestep;
+                return Kokkos::abs(
+                        allfdistribu(ispxvx)
+                        - (Kokkos::cos(x - dx) + 0.5 * Kokkos::sin(2 * (x - dx))));
+            });
+    double max_error;
+    MPI_Allreduce(&local_max_error, &max_error, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    return max_error;
+}
+
+} // namespace
+
+TEST(MPIParallelisation, HaloExchange2D_CPU)
+{
+    IdxStepX const x_size(8);
+    IdxStepY const y_size(3);
+    IdxRangeXY const full_idx_range(IdxXY(0, 0), IdxStep<GridX, GridY>(x_size, y_size));
+    int const n_ghosts = 2;
+
+    MPIHaloExchange<XDistribLayout, GridX> const
+            halo_exchange(full_idx_range, n_ghosts, MPI_COMM_WORLD);
+
+    IFieldMemXY local_field(halo_exchange.get_local_idx_range());
+    IFieldMemXY left_ghosts(halo_exchange.get_left_ghosts_idx_range());
+    IFieldMemXY right_ghosts(halo_exchange.get_right_ghosts_idx_range());
+
+    ddc::for_each(get_idx_range(local_field), [&](IdxXY ixy) {
+        local_field(ixy) = get_unique_id(ixy, full_idx_range);
+    });
+
+    halo_exchange(
+            Kokkos::DefaultHostExecutionSpace(),
+            get_field(left_ghosts),
+            get_field(right_ghosts),
+            get_const_field(local_field));
+
+    // The ghost points are the points directly on either side of the local index range
+    IdxRangeX const local_idx_range_x(get_idx_range(local_field));
+    IdxRangeX const left_idx_range_x(get_idx_range(left_ghosts));
+    IdxRangeX const right_idx_range_x(get_idx_range(right_ghosts));
+    int const n_x = IdxRangeX(full_idx_range).size();
+    int const local_front = (local_idx_range_x.front() - IdxX(0)).value();
+    int const local_back = (local_idx_range_x.back() - IdxX(0)).value();
+    EXPECT_EQ(left_idx_range_x.size(), std::size_t(n_ghosts));
+    EXPECT_EQ(right_idx_range_x.size(), std::size_t(n_ghosts));
+    EXPECT_EQ((left_idx_range_x.back() - IdxX(0)).value(), (local_front - 1 + n_x) % n_x);
+    EXPECT_EQ((right_idx_range_x.front() - IdxX(0)).value(), (local_back + 1) % n_x);
+
+    bool success = true;
+    ddc::for_each(get_idx_range(left_ghosts), [&](IdxXY ixy) {
+        success = success and (left_ghosts(ixy) == get_unique_id(ixy, full_idx_range));
+    });
+    ddc::for_each(get_idx_range(right_ghosts), [&](IdxXY ixy) {
+        success = success and (right_ghosts(ixy) == get_unique_id(ixy, full_idx_range));
+    });
+    EXPECT_TRUE(success);
+}
+
+TEST(MPIParallelisation, LagrangeAdvectionHalo)
+{
+    IdxStepX const x_size(64);
+    IdxStepVx const vx_size(21);
+    // The periodic point x_max is not included in the index range
+    ddc::init_discrete_space<GridX>(
+            GridX::init<GridX>(CoordX(-M_PI), CoordX(M_PI), x_size + 1));
+    ddc::init_discrete_space<GridVx>(
+            GridVx::init<GridVx>(CoordVx(-6.), CoordVx(6.), vx_size));
+
+    // Electrons and ions with a mass ratio of 4
+    IdxRangeSp const idx_range_sp(IdxSp(0), IdxStepSp(2));
+    host_t<DFieldMemSp> masses_host(idx_range_sp);
+    host_t<DFieldMemSp> charges_host(idx_range_sp);
+    masses_host(idx_range_sp.front()) = 1.;
+    masses_host(idx_range_sp.back()) = 4.;
+    charges_host(idx_range_sp.front()) = -1.;
+    charges_host(idx_range_sp.back()) = 1.;
+    ddc::init_discrete_space<Species>(std::move(charges_host), std::move(masses_host));
+
+    IdxRangeSpXVx const global_idx_range(
+            idx_range_sp,
+            IdxRangeX(IdxX(0), x_size),
+            IdxRangeVx(IdxVx(0), vx_size));
+
+    double const timestep = 0.1;
+    MpiLagrangeAdvectionSpatial<GeometryXVx, GridX, XDistribLayoutSpXVx> const
+            advection_x(global_idx_range, 5, timestep, MPI_COMM_WORLD);
+
+    double const max_error
+            = lagrange_advection_halo_error(advection_x, global_idx_range, timestep);
+    EXPECT_LE(max_error, 1.e-6);
+
+    // The time step is too large for the ghost layers
+    EXPECT_THROW(
+            lagrange_advection_halo_error(advection_x, global_idx_range, 4 * timestep),
+            std::runtime_error);
+}
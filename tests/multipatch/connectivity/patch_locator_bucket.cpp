@@ -0,0 +1,670 @@
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "2patches_2d_non_periodic_uniform.hpp"
+#include "2patches_2d_onion_shape_uniform.hpp"
+#include "5patches_figure_of_eight.hpp"
+#include "9patches_2d_periodic_strips_uniform.hpp"
+#include "bucket_patch_locator.hpp"
+#include "cartesian_to_circular.hpp"
+#include "circular_to_cartesian.hpp"
+#include "multipatch_type.hpp"
+#include "patch.hpp"
+#include "physical_geometry.hpp"
+#include "types.hpp"
+
+
+using physical_geometry::PhysicalCoordXY;
+using physical_geometry::X;
+using physical_geometry::Y;
+
+
+namespace {
+namespace onion = onion_shape_uniform_2d_2patches;
+namespace sheared = non_periodic_uniform_2d_2patches;
+namespace eight = figure_of_eight_5patches;
+namespace strips = periodic_strips_uniform_2d_9patches;
+
+/// The same circular mapping is used on every patch of the onion geometry.
+template <class Patch>
+using CircularToCartesianOnPatch = CircularToCartesian<onion::R, onion::Theta, X, Y>;
+
+template <class Patch>
+using CartesianToCircularOnPatch = CartesianToCircular<X, Y, onion::R, onion::Theta>;
+
+/// Mapping (xi, eta) -> (x_shift + xi + shear * eta, eta).
+template <class Patch>
+class ShearToCartesian
+{
+    using Dim1 = typename Patch::Dim1;
+    using Dim2 = typename Patch::Dim2;
+
+    double m_x_shift;
+    double m_shear;
+
+public:
+    using CoordArg = Coord<Dim1, Dim2>;
+    using CoordResult = Coord<X, Y>;
+
+    ShearToCartesian(double x_shift, double shear) : m_x_shift(x_shift), m_shear(shear) {}
+
+    KOKKOS_FUNCTION CoordResult operator()(CoordArg const& coord) const
+    {
+        double const xi = ddc::get<Dim1>(coord);
+        double const eta = ddc::get<Dim2>(coord);
+        return CoordResult(m_x_shift + xi + m_shear * eta, eta);
+    }
+};
+
+/// Inverse of ShearToCartesian.
+template <class Patch>
+class CartesianToShear
+{
+    using Dim1 = typename Patch::Dim1;
+    using Dim2 = typename Patch::Dim2;
+
+    double m_x_shift;
+    double m_shear;
+
+public:
+    using CoordArg = Coord<X, Y>;
+    using CoordResult = Coord<Dim1, Dim2>;
+
+    CartesianToShear(double x_shift, double shear) : m_x_shift(x_shift), m_shear(shear) {}
+
+    KOKKOS_FUNCTION CoordResult operator()(CoordArg const& coord) const
+    {
+        double const x = ddc::get<X>(coord);
+        double const y = ddc::get<Y>(coord);
+        return CoordResult(x - m_x_shift - m_shear * y, y);
+    }
+};
+
+/// Mapping (xi, eta) -> (x_shift + xi, y_shift + eta).
+template <class Patch>
+class TranslationToCartesian
+{
+    using Dim1 = typename Patch::Dim1;
+    using Dim2 = typename Patch::Dim2;
+
+    double m_x_shift;
+    double m_y_shift;
+
+public:
+    using CoordArg = Coord<Dim1, Dim2>;
+    using CoordResult = Coord<X, Y>;
+
+    TranslationToCartesian(double x_shift, double y_shift) : m_x_shift(x_shift), m_y_shift(y_shift)
+    {
+    }
+
+    KOKKOS_FUNCTION CoordResult operator()(CoordArg const& coord) const
+    {
+        return CoordResult(ddc::get<Dim1>(coord) + m_x_shift, ddc::get<Dim2>(coord) + m_y_shift);
+    }
+};
+
+/// Inverse of TranslationToCartesian.
+template <class Patch>
+class CartesianToTranslation
+{
+    using Dim1 = typename Patch::Dim1;
+    using Dim2 = typename Patch::Dim2;
+
+    double m_x_shift;
+    double m_y_shift;
+
+public:
+    using CoordArg = Coord<X, Y>;
+    using CoordResult = Coord<Dim1, Dim2>;
+
+    CartesianToTranslation(double x_shift, double y_shift) : m_x_shift(x_shift), m_y_shift(y_shift)
+    {
+    }
+
+    KOKKOS_FUNCTION CoordResult operator()(CoordArg const& coord) const
+    {
+        return CoordResult(ddc::get<X>(coord) - m_x_shift, ddc::get<Y>(coord) - m_y_shift);
+    }
+};
+
+/// The number of points along each logical dimension of the unit square patches.
+int constexpr n_points_unit_square = 5;
+
+/// Initialise uniform grids on [0, 1] x [0, 1] on the logical domain of the patch.
+template <class Patch>
+void init_unit_square_grids()
+{
+    using Grid1 = typename Patch::Grid1;
+    using Grid2 = typename Patch::Grid2;
+    ddc::init_discrete_space<Grid1>(Grid1::init(
+            typename Patch::Coord1(0.0),
+            typename Patch::Coord1(1.0),
+            typename Patch::IdxStep1(n_points_unit_square)));
+    ddc::init_discrete_space<Grid2>(Grid2::init(
+            typename Patch::Coord2(0.0),
+            typename Patch::Coord2(1.0),
+            typename Patch::IdxStep2(n_points_unit_square)));
+}
+
+/// Get the index range of the grids initialised by init_unit_square_grids.
+template <class Patch>
+typename Patch::IdxRange12 get_unit_square_idx_range()
+{
+    return typename Patch::IdxRange12(
+            typename Patch::IdxRange1(
+                    typename Patch::Idx1(0),
+                    typename Patch::IdxStep1(n_points_unit_square)),
+            typename Patch::IdxRange2(
+                    typename Patch::Idx2(0),
+                    typename Patch::IdxStep2(n_points_unit_square)));
+}
+
+
+class BucketPatchLocatorOnionTest : public ::testing::Test
+{
+private:
+    static constexpr onion::Patch1::IdxStep1 r1_size = onion::Patch1::IdxStep1(10);
+    static constexpr onion::Patch1::IdxStep2 theta1_size = onion::Patch1::IdxStep2(10);
+
+    static constexpr onion::Patch2::IdxStep1 r2_size = onion::Patch2::IdxStep1(10);
+    static constexpr onion::Patch2::IdxStep2 theta2_size = onion::Patch2::IdxStep2(10);
+
+public:
+    using MultipatchIdxRanges = MultipatchType<IdxRangeOnPatch, onion::Patch1, onion::Patch2>;
+    using PatchLocator = BucketPatchLocator<
+            MultipatchIdxRanges,
+            CircularToCartesianOnPatch,
+            CartesianToCircularOnPatch>;
+
+    MultipatchIdxRanges const all_idx_ranges;
+
+public:
+    BucketPatchLocatorOnionTest()
+        : all_idx_ranges(
+                onion::Patch1::IdxRange12(
+                        onion::Patch1::IdxRange1(onion::Patch1::Idx1(0), r1_size),
+                        onion::Patch1::IdxRange2(onion::Patch1::Idx2(0), theta1_size)),
+                onion::Patch2::IdxRange12(
+                        onion::Patch2::IdxRange1(onion::Patch2::Idx1(0), r2_size),
+                        onion::Patch2::IdxRange2(onion::Patch2::Idx2(0), theta2_size))) {};
+
+    static void SetUpTestSuite()
+    {
+        // Creating of meshes and supports ...........................................................
+        // Patch 1
+        onion::Patch1::Coord1 const r1_min(0.2);
+        onion::Patch1::Coord1 const r1_max(1.0);
+
+        onion::Patch1::Coord2 const theta1_min(0.0);
+        onion::Patch1::Coord2 const theta1_max(2 * M_PI);
+
+        ddc::init_discrete_space<onion::GridR<1>>(onion::GridR<1>::init(r1_min, r1_max, r1_size));
+        ddc::init_discrete_space<onion::GridTheta<1>>(
+                onion::GridTheta<1>::init(theta1_min, theta1_max, theta1_size));
+
+        // Patch 2
+        onion::Patch2::Coord1 const r2_min(1.0);
+        onion::Patch2::Coord1 const r2_max(1.5);
+
+        onion::Patch2::Coord2 const theta2_min(0.0);
+        onion::Patch2::Coord2 const theta2_max(2 * M_PI);
+
+        ddc::init_discrete_space<onion::GridR<2>>(onion::GridR<2>::init(r2_min, r2_max, r2_size));
+        ddc::init_discrete_space<onion::GridTheta<2>>(
+                onion::GridTheta<2>::init(theta2_min, theta2_max, theta2_size));
+    }
+};
+
+
+class BucketPatchLocatorShearedTest : public ::testing::Test
+{
+private:
+    static constexpr sheared::Patch1::IdxStep1 x1_size = sheared::Patch1::IdxStep1(10);
+    static constexpr sheared::Patch1::IdxStep2 y1_size = sheared::Patch1::IdxStep2(10);
+
+    static constexpr sheared::Patch2::IdxStep1 x2_size = sheared::Patch2::IdxStep1(10);
+    static constexpr sheared::Patch2::IdxStep2 y2_size = sheared::Patch2::IdxStep2(10);
+
+public:
+    using MultipatchIdxRanges = MultipatchType<IdxRangeOnPatch, sheared::Patch1, sheared::Patch2>;
+    using PatchLocator
+            = BucketPatchLocator<MultipatchIdxRanges, ShearToCartesian, CartesianToShear>;
+
+    MultipatchIdxRanges const all_idx_ranges;
+
+    // Patch 1 is mapped on the unit square and patch 2 on a parallelogram on its right.
+    // The two patches only share the point (1, 0).
+    MultipatchType<ShearToCartesian, sheared::Patch1, sheared::Patch2> const to_physical_mappings;
+    MultipatchType<CartesianToShear, sheared::Patch1, sheared::Patch2> const to_logical_mappings;
+
+public:
+    BucketPatchLocatorShearedTest()
+        : all_idx_ranges(
+                sheared::Patch1::IdxRange12(
+                        sheared::Patch1::IdxRange1(sheared::Patch1::Idx1(0), x1_size),
+                        sheared::Patch1::IdxRange2(sheared::Patch1::Idx2(0), y1_size)),
+                sheared::Patch2::IdxRange12(
+                        sheared::Patch2::IdxRange1(sheared::Patch2::Idx1(0), x2_size),
+                        sheared::Patch2::IdxRange2(sheared::Patch2::Idx2(0), y2_size)))
+        , to_physical_mappings(
+                  ShearToCartesian<sheared::Patch1>(0.0, 0.0),
+                  ShearToCartesian<sheared::Patch2>(1.0, 0.5))
+        , to_logical_mappings(
+                  CartesianToShear<sheared::Patch1>(0.0, 0.0),
+                  CartesianToShear<sheared::Patch2>(1.0, 0.5)) {};
+
+    static void SetUpTestSuite()
+    {
+        // Creating of meshes and supports ...........................................................
+        // Patch 1
+        sheared::Patch1::Coord1 const x1_min(0.0);
+        sheared::Patch1::Coord1 const x1_max(1.0);
+
+        sheared::Patch1::Coord2 const y1_min(0.0);
+        sheared::Patch1::Coord2 const y1_max(1.0);
+
+        ddc::init_discrete_space<sheared::GridX<1>>(
+                sheared::GridX<1>::init(x1_min, x1_max, x1_size));
+        ddc::init_discrete_space<sheared::GridY<1>>(
+                sheared::GridY<1>::init(y1_min, y1_max, y1_size));
+
+        // Patch 2
+        sheared::Patch2::Coord1 const x2_min(0.0);
+        sheared::Patch2::Coord1 const x2_max(1.0);
+
+        sheared::Patch2::Coord2 const y2_min(0.0);
+        sheared::Patch2::Coord2 const y2_max(1.0);
+
+        ddc::init_discrete_space<sheared::GridX<2>>(
+                sheared::GridX<2>::init(x2_min, x2_max, x2_size));
+        ddc::init_discrete_space<sheared::GridY<2>>(
+                sheared::GridY<2>::init(y2_min, y2_max, y2_size));
+    }
+};
+
+
+/**
+ * The figure of eight geometry laid out as a cross of unit squares:
+ *
+ *          |  1  |
+ *    -----------------
+ *       2  |  3  |  4
+ *    -----------------
+ *          |  5  |
+ *
+ * Each patch has its own logical dimensions.
+ */
+class BucketPatchLocatorFigureOfEightTest : public ::testing::Test
+{
+public:
+    using MultipatchIdxRanges = MultipatchType<
+            IdxRangeOnPatch,
+            eight::Patch1,
+            eight::Patch2,
+            eight::Patch3,
+            eight::Patch4,
+            eight::Patch5>;
+    using PatchLocator = BucketPatchLocator<
+            MultipatchIdxRanges,
+            TranslationToCartesian,
+            CartesianToTranslation>;
+
+    MultipatchIdxRanges const all_idx_ranges;
+    MultipatchType<
+            TranslationToCartesian,
+            eight::Patch1,
+            eight::Patch2,
+            eight::Patch3,
+            eight::Patch4,
+            eight::Patch5> const to_physical_mappings;
+    MultipatchType<
+            CartesianToTranslation,
+            eight::Patch1,
+            eight::Patch2,
+            eight::Patch3,
+            eight::Patch4,
+            eight::Patch5> const to_logical_mappings;
+
+public:
+    BucketPatchLocatorFigureOfEightTest()
+        : all_idx_ranges(
+                get_unit_square_idx_range<eight::Patch1>(),
+                get_unit_square_idx_range<eight::Patch2>(),
+                get_unit_square_idx_range<eight::Patch3>(),
+                get_unit_square_idx_range<eight::Patch4>(),
+                get_unit_square_idx_range<eight::Patch5>())
+        , to_physical_mappings(
+                  TranslationToCartesian<eight::Patch1>(1.0, 2.0),
+                  TranslationToCartesian<eight::Patch2>(0.0, 1.0),
+                  TranslationToCartesian<eight::Patch3>(1.0, 1.0),
+                  TranslationToCartesian<eight::Patch4>(2.0, 1.0),
+                  TranslationToCartesian<eight::Patch5>(1.0, 0.0))
+        , to_logical_mappings(
+                  CartesianToTranslation<eight::Patch1>(1.0, 2.0),
+                  CartesianToTranslation<eight::Patch2>(0.0, 1.0),
+                  CartesianToTranslation<eight::Patch3>(1.0, 1.0),
+                  CartesianToTranslation<eight::Patch4>(2.0, 1.0),
+                  CartesianToTranslation<eight::Patch5>(1.0, 0.0)) {};
+
+    static void SetUpTestSuite()
+    {
+        init_unit_square_grids<eight::Patch1>();
+        init_unit_square_grids<eight::Patch2>();
+        init_unit_square_grids<eight::Patch3>();
+        init_unit_square_grids<eight::Patch4>();
+        init_unit_square_grids<eight::Patch5>();
+    }
+};
+
+
+/**
+ * The 9 patches geometry laid out as a 3x3 grid of unit squares:
+ *
+ *      1  |  2  |  3
+ *    -----------------
+ *      4  |  5  |  6
+ *    -----------------
+ *      7  |  8  |  9
+ */
+class BucketPatchLocatorStripsTest : public ::testing::Test
+{
+public:
+    using MultipatchIdxRanges = MultipatchType<
+            IdxRangeOnPatch,
+            strips::Patch1,
+            strips::Patch2,
+            strips::Patch3,
+            strips::Patch4,
+            strips::Patch5,
+            strips::Patch6,
+            strips::Patch7,
+            strips::Patch8,
+            strips::Patch9>;
+    using PatchLocator = BucketPatchLocator<
+            MultipatchIdxRanges,
+            TranslationToCartesian,
+            CartesianToTranslation>;
+
+    MultipatchIdxRanges const all_idx_ranges;
+    MultipatchType<
+            TranslationToCartesian,
+            strips::Patch1,
+            strips::Patch2,
+            strips::Patch3,
+            strips::Patch4,
+            strips::Patch5,
+            strips::Patch6,
+            strips::Patch7,
+            strips::Patch8,
+            strips::Patch9> const to_physical_mappings;
+    MultipatchType<
+            CartesianToTranslation,
+            strips::Patch1,
+            strips::Patch2,
+            strips::Patch3,
+            strips::Patch4,
+            strips::Patch5,
+            strips::Patch6,
+            strips::Patch7,
+            strips::Patch8,
+            strips::Patch9> const to_logical_mappings;
+
+public:
+    BucketPatchLocatorStripsTest()
+        : all_idx_ranges(
+                get_unit_square_idx_range<strips::Patch1>(),
+                get_unit_square_idx_range<strips::Patch2>(),
+                get_unit_square_idx_range<strips::Patch3>(),
+                get_unit_square_idx_range<strips::Patch4>(),
+                get_unit_square_idx_range<strips::Patch5>(),
+                get_unit_square_idx_range<strips::Patch6>(),
+                get_unit_square_idx_range<strips::Patch7>(),
+                get_unit_square_idx_range<strips::Patch8>(),
+                get_unit_square_idx_range<strips::Patch9>())
+        , to_physical_mappings(
+                  TranslationToCartesian<strips::Patch1>(0.0, 2.0),
+                  TranslationToCartesian<strips::Patch2>(1.0, 2.0),
+                  TranslationToCartesian<strips::Patch3>(2.0, 2.0),
+                  TranslationToCartesian<strips::Patch4>(0.0, 1.0),
+                  TranslationToCartesian<strips::Patch5>(1.0, 1.0),
+                  TranslationToCartesian<strips::Patch6>(2.0, 1.0),
+                  TranslationToCartesian<strips::Patch7>(0.0, 0.0),
+                  TranslationToCartesian<strips::Patch8>(1.0, 0.0),
+                  TranslationToCartesian<strips::Patch9>(2.0, 0.0))
+        , to_logical_mappings(
+                  CartesianToTranslation<strips::Patch1>(0.0, 2.0),
+                  CartesianToTranslation<strips::Patch2>(1.0, 2.0),
+                  CartesianToTranslation<strips::Patch3>(2.0, 2.0),
+                  CartesianToTranslation<strips::Patch4>(0.0, 1.0),
+                  CartesianToTranslation<strips::Patch5>(1.0, 1.0),
+                  CartesianToTranslation<strips::Patch6>(2.0, 1.0),
+                  CartesianToTranslation<strips::Patch7>(0.0, 0.0),
+                  CartesianToTranslation<strips::Patch8>(1.0, 0.0),
+                  CartesianToTranslation<strips::Patch9>(2.0, 0.0)) {};
+
+    static void SetUpTestSuite()
+    {
+        init_unit_square_grids<strips::Patch1>();
+        init_unit_square_grids<strips::Patch2>();
+        init_unit_square_grids<strips::Patch3>();
+        init_unit_square_grids<strips::Patch4>();
+        init_unit_square_grids<strips::Patch5>();
+        init_unit_square_grids<strips::Patch6>();
+        init_unit_square_grids<strips::Patch7>();
+        init_unit_square_grids<strips::Patch8>();
+        init_unit_square_grids<strips::Patch9>();
+    }
+};
+
+
+template <class PatchLocator>
+void test_operator_assignment(
+        PatchLocator const& patch_locator,
+        Kokkos::View<Coord<X, Y>*, Kokkos::DefaultHostExecutionSpace> coords_host,
+        Kokkos::View<int*, Kokkos::DefaultHostExecutionSpace> patches_host)
+{
+    auto coords = Kokkos::create_mirror_view_and_copy(Kokkos::DefaultExecutionSpace(), coords_host);
+    auto patches
+            = Kokkos::create_mirror_view_and_copy(Kokkos::DefaultExecutionSpace(), patches_host);
+
+    std::size_t failed_attempt = 0;
+    Kokkos::parallel_reduce(
+            coords.extent(0),
+            KOKKOS_LAMBDA(int const i, std::size_t& attempt) {
+                int patch_idx = patch_locator(coords(i));
+                if (patch_idx != patches(i)) {
+                    attempt++;
+                }
+            },
+            failed_attempt);
+    EXPECT_EQ(failed_attempt, 0);
+}
+
+} // namespace
+
+
+
+TEST_F(BucketPatchLocatorOnionTest, DeviceCircular)
+{
+    CircularToCartesian<onion::R, onion::Theta, X, Y> to_physical_mapping;
+    CartesianToCircular<X, Y, onion::R, onion::Theta> to_logical_mapping;
+
+    PatchLocator patch_locator(
+            all_idx_ranges,
+            MultipatchType<CircularToCartesianOnPatch, onion::Patch1, onion::Patch2>(
+                    to_physical_mapping,
+                    to_physical_mapping),
+            MultipatchType<CartesianToCircularOnPatch, onion::Patch1, onion::Patch2>(
+                    to_logical_mapping,
+                    to_logical_mapping));
+
+    int constexpr n_elements = 8;
+    Kokkos::View<Coord<X, Y>*, Kokkos::DefaultHostExecutionSpace>
+            coords_host("coords_host", n_elements);
+    Kokkos::View<int*, Kokkos::DefaultHostExecutionSpace> patches_host("patches_host", n_elements);
+
+    coords_host(0) = PhysicalCoordXY(0.15, .03);
+    coords_host(1) = PhysicalCoordXY(0.2, 0);
+    coords_host(2) = PhysicalCoordXY(0.25, .03);
+    coords_host(3) = PhysicalCoordXY(1, 1);
+    coords_host(4) = PhysicalCoordXY(1, 0);
+    coords_host(5) = PhysicalCoordXY(1.5, 0);
+    coords_host(6) = PhysicalCoordXY(-2.1, 0);
+    coords_host(7) = PhysicalCoordXY(-0.4, -0.7);
+
+    patches_host(0) = PatchLocator::outside_domain;
+    patches_host(1) = 0;
+    patches_host(2) = 0;
+    patches_host(3) = 1;
+    // On the interface, the first patch is returned.
+    patches_host(4) = 0;
+    patches_host(5) = 1;
+    patches_host(6) = PatchLocator::outside_domain;
+    patches_host(7) = 0;
+
+    test_operator_assignment(patch_locator, coords_host, patches_host);
+}
+
+
+TEST_F(BucketPatchLocatorShearedTest, DeviceSheared)
+{
+    int constexpr n_elements = 8;
+    Kokkos::View<Coord<X, Y>*, Kokkos::DefaultHostExecutionSpace>
+            coords_host("coords_host", n_elements);
+    Kokkos::View<int*, Kokkos::DefaultHostExecutionSpace> patches_host("patches_host", n_elements);
+
+    coords_host(0) = PhysicalCoordXY(0.5, 0.5);
+    coords_host(1) = PhysicalCoordXY(1.6, 0.5);
+    // In the bounding box of patch 2 but between the two patches.
+    coords_host(2) = PhysicalCoordXY(1.2, 0.8);
+    coords_host(3) = PhysicalCoordXY(2.4, 0.9);
+    coords_host(4) = PhysicalCoordXY(1.0, 0.0);
+    coords_host(5) = PhysicalCoordXY(2.0, 0.1);
+    coords_host(6) = PhysicalCoordXY(-0.5, 0.5);
+    coords_host(7) = PhysicalCoordXY(0.5, 1.5);
+
+    patches_host(0) = 0;
+    patches_host(1) = 1;
+    patches_host(2) = PatchLocator::outside_domain;
+    patches_host(3) = 1;
+    // On the interface, the first patch is returned.
+    patches_host(4) = 0;
+    patches_host(5) = 1;
+    patches_host(6) = PatchLocator::outside_domain;
+    patches_host(7) = PatchLocator::outside_domain;
+
+    // The result must not depend on the resolution of the bucket grid.
+    for (std::size_t n_buckets : {0, 1, 4, 1000}) {
+        PatchLocator patch_locator(
+                all_idx_ranges,
+                to_physical_mappings,
+                to_logical_mappings,
+                n_buckets);
+        test_operator_assignment(patch_locator, coords_host, patches_host);
+    }
+}
+
+
+TEST_F(BucketPatchLocatorShearedTest, HostSheared)
+{
+    BucketPatchLocator<
+            MultipatchIdxRanges,
+            ShearToCartesian,
+            CartesianToShear,
+            Kokkos::DefaultHostExecutionSpace>
+            patch_locator(all_idx_ranges, to_physical_mappings, to_logical_mappings);
+
+    EXPECT_EQ(patch_locator(PhysicalCoordXY(0.5, 0.5)), 0);
+    EXPECT_EQ(patch_locator(PhysicalCoordXY(1.6, 0.5)), 1);
+    EXPECT_EQ(patch_locator(PhysicalCoordXY(1.2, 0.8)), PatchLocator::outside_domain);
+    EXPECT_EQ(patch_locator(PhysicalCoordXY(0.5, 1.5)), PatchLocator::outside_domain);
+
+    sheared::Patch2::Coord12 const logical_coord(0.3, 0.6);
+    PhysicalCoordXY const physical_coord(
+            patch_locator.get_mapping_on_patch<sheared::Patch2>()(logical_coord));
+    EXPECT_NEAR(ddc::get<X>(physical_coord), 1.6, 1e-14);
+    EXPECT_NEAR(ddc::get<Y>(physical_coord), 0.6, 1e-14);
+    EXPECT_EQ(patch_locator(physical_coord), 1);
+}
+
+
+TEST_F(BucketPatchLocatorFigureOfEightTest, DeviceFigureOfEight)
+{
+    int constexpr n_elements = 10;
+    Kokkos::View<Coord<X, Y>*, Kokkos::DefaultHostExecutionSpace>
+            coords_host("coords_host", n_elements);
+    Kokkos::View<int*, Kokkos::DefaultHostExecutionSpace> patches_host("patches_host", n_elements);
+
+    coords_host(0) = PhysicalCoordXY(1.5, 2.5);
+    coords_host(1) = PhysicalCoordXY(0.3, 1.6);
+    coords_host(2) = PhysicalCoordXY(1.5, 1.5);
+    coords_host(3) = PhysicalCoordXY(2.7, 1.2);
+    coords_host(4) = PhysicalCoordXY(1.4, 0.3);
+    // In the bounding box of the domain but in the corners of the cross.
+    coords_host(5) = PhysicalCoordXY(0.5, 0.5);
+    coords_host(6) = PhysicalCoordXY(2.5, 2.5);
+    // On the interfaces between patches 1 and 3, and between patches 2 and 3.
+    coords_host(7) = PhysicalCoordXY(1.5, 2.0);
+    coords_host(8) = PhysicalCoordXY(1.0, 1.5);
+    coords_host(9) = PhysicalCoordXY(3.5, 1.5);
+
+    patches_host(0) = 0;
+    patches_host(1) = 1;
+    patches_host(2) = 2;
+    patches_host(3) = 3;
+    patches_host(4) = 4;
+    patches_host(5) = PatchLocator::outside_domain;
+    patches_host(6) = PatchLocator::outside_domain;
+    // On the interface, the first patch is returned.
+    patches_host(7) = 0;
+    patches_host(8) = 1;
+    patches_host(9) = PatchLocator::outside_domain;
+
+    for (std::size_t n_buckets : {0, 1, 9, 1000}) {
+        PatchLocator patch_locator(
+                all_idx_ranges,
+                to_physical_mappings,
+                to_logical_mappings,
+                n_buckets);
+        test_operator_assignment(patch_locator, coords_host, patches_host);
+    }
+}
+
+
+TEST_F(BucketPatchLocatorStripsTest, DeviceStrips)
+{
+    int constexpr n_elements = 12;
+    Kokkos::View<Coord<X, Y>*, Kokkos::DefaultHostExecutionSpace>
+            coords_host("coords_host", n_elements);
+    Kokkos::View<int*, Kokkos::DefaultHostExecutionSpace> patches_host("patches_host", n_elements);
+
+    // One point in the middle of each patch.
+    for (int i = 0; i < 9; ++i) {
+        double const x = 0.5 + i % 3;
+        double const y = 2.5 - i / 3;
+        coords_host(i) = PhysicalCoordXY(x, y);
+        patches_host(i) = i;
+    }
+    // On the corner shared by the patches 4, 5, 7 and 8.
+    coords_host(9) = PhysicalCoordXY(1.0, 1.0);
+    coords_host(10) = PhysicalCoordXY(3.2, 1.5);
+    coords_host(11) = PhysicalCoordXY(1.5, -0.2);
+
+    // On the interface, the first patch is returned.
+    patches_host(9) = 3;
+    patches_host(10) = PatchLocator::outside_domain;
+    patches_host(11) = PatchLocator::outside_domain;
+
+    for (std::size_t n_buckets : {0, 1, 9, 1000}) {
+        PatchLocator patch_locator(
+                all_idx_ranges,
+                to_physical_mappings,
+                to_logical_mappings,
+                n_buckets);
+        test_operator_assignment(patch_locator, coords_host, patches_host);
+    }
+}
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MIT
+
+#include <ddc/ddc.hpp>
+
+#include <gtest/gtest.h>
+
+#include "9patches_2d_periodic_strips_uniform.hpp"
+#include "ddc_alias_inline_functions.hpp"
+#include "ddc_aliases.hpp"
+#include "multipatch_field.hpp"
+#include "multipatch_field_mem.hpp"
+#include "multipatch_flat_idx_range.hpp"
+#include "multipatch_type.hpp"
+#include "types.hpp"
+
+using namespace periodic_strips_uniform_2d_9patches;
+
+namespace {
+
+using MultipatchIdxRange357 = MultipatchType<IdxRangeOnPatch, Patch3, Patch5, Patch7>;
+
+/// Save the patch number and the flat index at a point if this point is on the patch.
+template <class Patch, int PatchNumber, class FlatIdxRange, class MultipatchFieldType>
+KOKKOS_FUNCTION void fill_on_patch(
+        FlatIdxRange const& flat_idx_range,
+        int const flat_idx,
+        MultipatchFieldType const& patch_numbers,
+        MultipatchFieldType const& flat_indices)
+{
+    if (flat_idx_range.template contains<Patch>(flat_idx)) {
+        typename Patch::Idx12 const idx
+                = flat_idx_range.template to_discrete_element<Patch>(flat_idx);
+        patch_numbers.template get<Patch>()(idx) = PatchNumber;
+        flat_indices.template get<Patch>()(idx) = flat_idx;
+    }
+}
+
+class MultipatchFlatIdxRangeTest : public ::testing::Test
+{
+protected:
+    static constexpr Patch3::IdxStep12 n_pts_3 = Patch3::IdxStep12(5, 7);
+    static constexpr Patch5::IdxStep12 n_pts_5 = Patch5::IdxStep12(9, 11);
+    static constexpr Patch7::IdxStep12 n_pts_7 = Patch7::IdxStep12(4, 8);
+
+    Patch3::IdxRange12 const idx_range_3;
+    Patch5::IdxRange12 const idx_range_5;
+    Patch7::IdxRange12 const idx_range_7;
+
+public:
+    MultipatchFlatIdxRangeTest()
+        : idx_range_3(Patch3::Idx12(0, 0), n_pts_3)
+        , idx_range_5(Patch5::Idx12(2, 1), n_pts_5)
+        , idx_range_7(Patch7::Idx12(0, 3), n_pts_7)
+    {
+    }
+
+    static void SetUpTestSuite()
+    {
+        init_grids<Patch3>();
+        init_grids<Patch5>();
+        init_grids<Patch7>();
+    }
+
+    template <class Patch>
+    static void init_grids()
+    {
+        // The grids are larger than the index ranges used in the tests
+        typename Patch::IdxStep1 const n_cells_1(20);
+        typename Patch::IdxStep2 const n_cells_2(20);
+        ddc::init_discrete_space<typename Patch::Grid1>(Patch::Grid1::init(
+                typename Patch::Coord1(0.0),
+                typename Patch::Coord1(1.0),
+                n_cells_1));
+        ddc::init_discrete_space<typename Patch::Grid2>(Patch::Grid2::init(
+                typename Patch::Coord2(0.0),
+                typename Patch::Coord2(1.0),
+                n_cells_2));
+    }
+};
+
+} // namespace
+
+TEST_F(MultipatchFlatIdxRangeTest, Host)
+{
+    MultipatchIdxRange357 const idx_ranges(idx_range_3, idx_range_5, idx_range_7);
+    MultipatchFlatIdxRange const flat_idx_range(idx_ranges);
+
+    int const n_3 = idx_range_3.size();
+    int const n_5 = idx_range_5.size();
+    int const n_7 = idx_range_7.size();
+    ASSERT_EQ(flat_idx_range.size(), n_3 + n_5 + n_7);
+
+    // Each patch is numbered in the order of the patches
+    for (int i(0); i < flat_idx_range.size(); ++i) {
+        EXPECT_EQ(flat_idx_range.contains<Patch3>(i), i < n_3);
+        EXPECT_EQ(flat_idx_range.contains<Patch5>(i), (n_3 <= i) && (i < n_3 + n_5));
+        EXPECT_EQ(flat_idx_range.contains<Patch7>(i), n_3 + n_5 <= i);
+    }
+
+    // The indices are numbered in the order of the index range
+    int i = n_3;
+    ddc::for_each(idx_range_5, [&](Patch5::Idx12 idx) {
+        EXPECT_EQ(flat_idx_range.to_discrete_element<Patch5>(i), idx);
+        i++;
+    });
+    EXPECT_EQ(flat_idx_range.to_discrete_element<Patch3>(0), idx_range_3.front());
+    EXPECT_EQ(flat_idx_range.to_discrete_element<Patch7>(n_3 + n_5 + n_7 - 1), idx_range_7.back());
+}
+
+TEST_F(MultipatchFlatIdxRangeTest, Device)
+{
+    MultipatchIdxRange357 const idx_ranges(idx_range_3, idx_range_5, idx_range_7);
+    MultipatchFieldMem<DFieldMemOnPatch, Patch3, Patch5, Patch7> patch_numbers_alloc(idx_ranges);
+    MultipatchFieldMem<DFieldMemOnPatch, Patch3, Patch5, Patch7> flat_indices_alloc(idx_ranges);
+    MultipatchField<DFieldOnPatch, Patch3, Patch5, Patch7> patch_numbers(patch_numbers_alloc);
+    MultipatchField<DFieldOnPatch, Patch3, Patch5, Patch7> flat_indices(flat_indices_alloc);
+
+    MultipatchFlatIdxRange const flat_idx_range(patch_numbers.idx_range());
+    Kokkos::parallel_for(
+            Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, flat_idx_range.size()),
+            KOKKOS_LAMBDA(int const flat_idx) {
+                fill_on_patch<Patch3, 3>(flat_idx_range, flat_idx, patch_numbers, flat_indices);
+                fill_on_patch<Patch5, 5>(flat_idx_range, flat_idx, patch_numbers, flat_indices);
+                fill_on_patch<Patch7, 7>(flat_idx_range, flat_idx, patch_numbers, flat_indices);
+            });
+
+    auto patch_numbers_3 = ddc::create_mirror_view_and_copy(patch_numbers.get<Patch3>());
+    auto patch_numbers_5 = ddc::create_mirror_view_and_copy(patch_numbers.get<Patch5>());
+    auto patch_numbers_7 = ddc::create_mirror_view_and_copy(patch_numbers.get<Patch7>());
+    auto flat_indices_5 = ddc::create_mirror_view_and_copy(flat_indices.get<Patch5>());
+
+    ddc::for_each(idx_range_3, [&](Patch3::Idx12 idx) { EXPECT_EQ(patch_numbers_3(idx), 3); });
+    ddc::for_each(idx_range_5, [&](Patch5::Idx12 idx) { EXPECT_EQ(patch_numbers_5(idx), 5); });
+    ddc::for_each(idx_range_7, [&](Patch7::Idx12 idx) { EXPECT_EQ(patch_numbers_7(idx), 7); });
+
+    // The last point of patch 5 is followed by the first point of patch 7
+    EXPECT_EQ(
+            flat_indices_5(idx_range_5.back()),
+            int(idx_range_3.size() + idx_range_5.size()) - 1);
+}
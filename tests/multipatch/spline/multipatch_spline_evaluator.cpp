@@ -43,6 +43,28 @@ using HostMultipatchSplineRThetaEvaluator = MultipatchSplineEvaluator2D<
         Patch1,
         Patch2>;
 
+// Batch dimension (e.g. species) for the batched evaluations.
+struct GridBatch
+{
+};
+
+template <class Patch>
+using DFieldBatchedOnPatch
+        = DField<IdxRange<GridBatch, typename Patch::Grid1, typename Patch::Grid2>>;
+
+using DeviceBatchedMultipatchSplineRThetaEvaluator = MultipatchSplineEvaluator2D<
+        DeviceExecSpace,
+        typename DeviceExecSpace::memory_space,
+        BSplines1OnPatch,
+        BSplines2OnPatch,
+        Grid1OnPatch,
+        Grid2OnPatch,
+        ConstantExtrapolationRuleOnion<PatchLocator<DeviceExecSpace>>,
+        DFieldBatchedOnPatch,
+        PatchLocator<DeviceExecSpace>,
+        Patch1,
+        Patch2>;
+
 
 class MultipatchSplineEvaluatorTest : public MultipatchSplineOnionShapeTest
 {
@@ -936,3 +958,143 @@ TEST_F(MultipatchSplineEvaluatorTest, HostIntegrateOnCoordField)
             function is only defined on batch domain.
     */
 }
+
+
+/* -----------------------------------------------------------------------------------------------
+    Test operator() and deriv_dim_1() for batched fields of values called from host but stored
+    on device. The spline of the b-th batch element is (b+1) times the non-batched spline.
+    --------------------------------------------------------------------------------------------*/
+TEST_F(MultipatchSplineEvaluatorTest, EvaluateOnCoordFieldBatched)
+{
+    IdxRange<GridBatch> const batch_idx_range(Idx<GridBatch>(0), IdxStep<GridBatch>(3));
+
+    // Evaluation points
+    Patch1::IdxRange1 const reduced_idx_range_r1(
+            Patch1::IdxRange1(Patch1::Idx1(0), Patch1::IdxStep1(idx_range_r1.size() - 1)));
+    Patch1::IdxRange12 const reduced_idx_range_rtheta1(reduced_idx_range_r1, idx_range_theta1);
+    FieldMem<Patch1::Coord12, Patch1::IdxRange12> eval_points_1_alloc(reduced_idx_range_rtheta1);
+    Field<Patch1::Coord12, Patch1::IdxRange12> eval_points_1 = get_field(eval_points_1_alloc);
+
+    Patch2::IdxRange1 const reduced_idx_range_r2(
+            Patch2::IdxRange1(Patch2::Idx1(0), Patch2::IdxStep1(idx_range_r2.size() - 1)));
+    Patch2::IdxRange12 const reduced_idx_range_rtheta2(reduced_idx_range_r2, idx_range_theta2);
+    FieldMem<Patch2::Coord12, Patch2::IdxRange12> eval_points_2_alloc(reduced_idx_range_rtheta2);
+    Field<Patch2::Coord12, Patch2::IdxRange12> eval_points_2 = get_field(eval_points_2_alloc);
+
+    set_eval_points_2D<Patch1::Grid1, Patch1::Grid2>(eval_points_1);
+    set_eval_points_2D<Patch2::Grid1, Patch2::Grid2>(eval_points_2);
+
+    MultipatchField<CoordConstFieldOnPatch, Patch1, Patch2> const
+            eval_points(get_const_field(eval_points_1), get_const_field(eval_points_2));
+
+    // Batched spline coefficients
+    using IdxRangeBatchBS1 = IdxRange<GridBatch, BSplinesR<1>, BSplinesTheta<1>>;
+    using IdxRangeBatchBS2 = IdxRange<GridBatch, BSplinesR<2>, BSplinesTheta<2>>;
+    IdxRangeBatchBS1 const batched_spline_idx_range_1(
+            batch_idx_range,
+            get_idx_range(function_1_coef));
+    IdxRangeBatchBS2 const batched_spline_idx_range_2(
+            batch_idx_range,
+            get_idx_range(function_2_coef));
+    DFieldMem<IdxRangeBatchBS1> batched_function_1_coef_alloc(batched_spline_idx_range_1);
+    DFieldMem<IdxRangeBatchBS2> batched_function_2_coef_alloc(batched_spline_idx_range_2);
+    DField<IdxRangeBatchBS1> batched_function_1_coef = get_field(batched_function_1_coef_alloc);
+    DField<IdxRangeBatchBS2> batched_function_2_coef = get_field(batched_function_2_coef_alloc);
+    DConstField<IdxRange<BSplinesR<1>, BSplinesTheta<1>>> const function_1_coef_proxy
+            = get_const_field(function_1_coef);
+    DConstField<IdxRange<BSplinesR<2>, BSplinesTheta<2>>> const function_2_coef_proxy
+            = get_const_field(function_2_coef);
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            batched_spline_idx_range_1,
+            KOKKOS_LAMBDA(Idx<GridBatch, BSplinesR<1>, BSplinesTheta<1>> const idx) {
+                double const factor = (Idx<GridBatch>(idx) - Idx<GridBatch>(0)).value() + 1;
+                batched_function_1_coef(idx)
+                        = factor
+                          * function_1_coef_proxy(Idx<BSplinesR<1>, BSplinesTheta<1>>(idx));
+            });
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            batched_spline_idx_range_2,
+            KOKKOS_LAMBDA(Idx<GridBatch, BSplinesR<2>, BSplinesTheta<2>> const idx) {
+                double const factor = (Idx<GridBatch>(idx) - Idx<GridBatch>(0)).value() + 1;
+                batched_function_2_coef(idx)
+                        = factor
+                          * function_2_coef_proxy(Idx<BSplinesR<2>, BSplinesTheta<2>>(idx));
+            });
+    MultipatchField<DeviceBatchedMultipatchSplineRThetaEvaluator::BatchedSplineCoeffOnPatch,
+                    Patch1,
+                    Patch2> const
+            batched_splines(
+                    get_const_field(batched_function_1_coef),
+                    get_const_field(batched_function_2_coef));
+
+    // Evaluated functions
+    IdxRange<GridBatch, Patch1::Grid1, Patch1::Grid2> const
+            batched_idx_range_1(batch_idx_range, reduced_idx_range_rtheta1);
+    IdxRange<GridBatch, Patch2::Grid1, Patch2::Grid2> const
+            batched_idx_range_2(batch_idx_range, reduced_idx_range_rtheta2);
+    DFieldMem<IdxRange<GridBatch, Patch1::Grid1, Patch1::Grid2>> eval_function_1_alloc(
+            batched_idx_range_1);
+    DFieldMem<IdxRange<GridBatch, Patch2::Grid1, Patch2::Grid2>> eval_function_2_alloc(
+            batched_idx_range_2);
+    DFieldMem<IdxRange<GridBatch, Patch1::Grid1, Patch1::Grid2>> eval_deriv_1_alloc(
+            batched_idx_range_1);
+    DFieldMem<IdxRange<GridBatch, Patch2::Grid1, Patch2::Grid2>> eval_deriv_2_alloc(
+            batched_idx_range_2);
+    MultipatchField<DFieldBatchedOnPatch, Patch1, Patch2> const
+            eval_functions(get_field(eval_function_1_alloc), get_field(eval_function_2_alloc));
+    MultipatchField<DFieldBatchedOnPatch, Patch1, Patch2> const
+            eval_derivs(get_field(eval_deriv_1_alloc), get_field(eval_deriv_2_alloc));
+
+    // Definition of MultipatchSplineEvaluator2D
+    PatchLocator<DeviceExecSpace> const
+            patch_locator(all_idx_ranges, to_physical_mapping, to_logical_mapping);
+    ConstantExtrapolationRuleOnion<PatchLocator<DeviceExecSpace>>
+            extrapolation_rule(r1_min, r2_max);
+    DeviceBatchedMultipatchSplineRThetaEvaluator const
+            batched_evaluators(patch_locator, extrapolation_rule);
+    DeviceMultipatchSplineRThetaEvaluator const evaluators(patch_locator, extrapolation_rule);
+
+    // Evaluate the functions at the evaluation points.
+    batched_evaluators(eval_functions, eval_points, batched_splines);
+    batched_evaluators.deriv_dim_1(eval_derivs, eval_points, batched_splines);
+
+    // Expected functions (non-batched)
+    DFieldMem<Patch1::IdxRange12> expected_function_1_alloc(reduced_idx_range_rtheta1);
+    DFieldMem<Patch2::IdxRange12> expected_function_2_alloc(reduced_idx_range_rtheta2);
+    DFieldMem<Patch1::IdxRange12> expected_deriv_1_alloc(reduced_idx_range_rtheta1);
+    DFieldMem<Patch2::IdxRange12> expected_deriv_2_alloc(reduced_idx_range_rtheta2);
+    MultipatchField<DFieldOnPatch, Patch1, Patch2> const expected_functions(
+            get_field(expected_function_1_alloc),
+            get_field(expected_function_2_alloc));
+    MultipatchField<DFieldOnPatch, Patch1, Patch2> const
+            expected_derivs(get_field(expected_deriv_1_alloc), get_field(expected_deriv_2_alloc));
+    evaluators(expected_functions, eval_points, splines);
+    evaluators.deriv_dim_1(expected_derivs, eval_points, splines);
+
+    // Compare the evaluated functions with the expected functions.
+    auto const expected_function_1_host
+            = ddc::create_mirror_and_copy(expected_functions.get<Patch1>());
+    auto const expected_function_2_host
+            = ddc::create_mirror_and_copy(expected_functions.get<Patch2>());
+    auto const expected_deriv_1_host = ddc::create_mirror_and_copy(expected_derivs.get<Patch1>());
+    auto const expected_deriv_2_host = ddc::create_mirror_and_copy(expected_derivs.get<Patch2>());
+    auto const eval_function_1_host = ddc::create_mirror_and_copy(eval_functions.get<Patch1>());
+    auto const eval_function_2_host = ddc::create_mirror_and_copy(eval_functions.get<Patch2>());
+    auto const eval_deriv_1_host = ddc::create_mirror_and_copy(eval_derivs.get<Patch1>());
+    auto const eval_deriv_2_host = ddc::create_mirror_and_copy(eval_derivs.get<Patch2>());
+
+    ddc::for_each(batched_idx_range_1, [&](Idx<GridBatch, Patch1::Grid1, Patch1::Grid2> idx) {
+        double const factor = (Idx<GridBatch>(idx) - Idx<GridBatch>(0)).value() + 1;
+        Patch1::Idx12 const idx_12(idx);
+        EXPECT_NEAR(eval_function_1_host(idx), factor * expected_function_1_host(idx_12), 1e-14);
+        EXPECT_NEAR(eval_deriv_1_host(idx), factor * expected_deriv_1_host(idx_12), 1e-13);
+    });
+    ddc::for_each(batched_idx_range_2, [&](Idx<GridBatch, Patch2::Grid1, Patch2::Grid2> idx) {
+        double const factor = (Idx<GridBatch>(idx) - Idx<GridBatch>(0)).value() + 1;
+        Patch2::Idx12 const idx_12(idx);
+        EXPECT_NEAR(eval_function_2_host(idx), factor * expected_function_2_host(idx_12), 1e-14);
+        EXPECT_NEAR(eval_deriv_2_host(idx), factor * expected_deriv_2_host(idx_12), 1e-13);
+    });
+}
@@ -0,0 +1,302 @@
+// SPDX-License-Identifier: MIT
+#include <array>
+
+#include <ddc/ddc.hpp>
+#include <ddc/kernels/splines.hpp>
+
+#include <gtest/gtest.h>
+
+#include "9patches_2d_periodic_strips_uniform.hpp"
+#include "bucket_patch_locator.hpp"
+#include "multipatch_field.hpp"
+#include "multipatch_field_mem.hpp"
+#include "multipatch_spline_evaluator_2d.hpp"
+#include "multipatch_type.hpp"
+#include "null_extrapolation_rules.hpp"
+#include "physical_geometry.hpp"
+#include "types.hpp"
+
+
+using physical_geometry::X;
+using physical_geometry::Y;
+
+
+namespace {
+namespace strips = periodic_strips_uniform_2d_9patches;
+
+/// The number of cells along each logical dimension of the unit square patches.
+int constexpr n_cells_unit_square = 6;
+
+/// A FieldMem of 2D spline coefficients defined on both of the Patch's logical dimensions.
+template <class Patch>
+using SplineCoeffMemOnPatch_2D = DFieldMem<typename Patch::IdxRangeBS12>;
+
+/// Get the shift of the Patch in the 3x3 layout of the strips geometry.
+template <class Patch>
+std::array<double, 2> get_shift()
+{
+    std::size_t const patch_idx = ddc::type_seq_rank_v<Patch, strips::PatchOrdering>;
+    return {double(patch_idx % 3), double(2 - patch_idx / 3)};
+}
+
+/// Mapping (xi, eta) -> (x_shift + xi, y_shift + eta).
+template <class Patch>
+class TranslationToCartesian
+{
+    using Dim1 = typename Patch::Dim1;
+    using Dim2 = typename Patch::Dim2;
+
+    double m_x_shift;
+    double m_y_shift;
+
+public:
+    using CoordArg = Coord<Dim1, Dim2>;
+    using CoordResult = Coord<X, Y>;
+
+    TranslationToCartesian() : m_x_shift(get_shift<Patch>()[0]), m_y_shift(get_shift<Patch>()[1])
+    {
+    }
+
+    KOKKOS_FUNCTION CoordResult operator()(CoordArg const& coord) const
+    {
+        return CoordResult(ddc::get<Dim1>(coord) + m_x_shift, ddc::get<Dim2>(coord) + m_y_shift);
+    }
+};
+
+/// Inverse of TranslationToCartesian.
+template <class Patch>
+class CartesianToTranslation
+{
+    using Dim1 = typename Patch::Dim1;
+    using Dim2 = typename Patch::Dim2;
+
+    double m_x_shift;
+    double m_y_shift;
+
+public:
+    using CoordArg = Coord<X, Y>;
+    using CoordResult = Coord<Dim1, Dim2>;
+
+    CartesianToTranslation() : m_x_shift(get_shift<Patch>()[0]), m_y_shift(get_shift<Patch>()[1])
+    {
+    }
+
+    KOKKOS_FUNCTION CoordResult operator()(CoordArg const& coord) const
+    {
+        return CoordResult(ddc::get<X>(coord) - m_x_shift, ddc::get<Y>(coord) - m_y_shift);
+    }
+};
+
+/// Function on the physical domain exactly represented by the cubic splines.
+KOKKOS_INLINE_FUNCTION double physical_function(double const x, double const y)
+{
+    return 1.0 + 2.0 * x - 3.0 * y + x * y;
+}
+
+/// Initialise uniform grids and B-splines on [0, 1] x [0, 1] on the logical domain of the patch.
+template <class Patch>
+void init_unit_square_splines()
+{
+    using Grid1 = typename Patch::Grid1;
+    using Grid2 = typename Patch::Grid2;
+    typename Patch::Coord1 const min_1(0.0);
+    typename Patch::Coord1 const max_1(1.0);
+    typename Patch::Coord2 const min_2(0.0);
+    typename Patch::Coord2 const max_2(1.0);
+    ddc::init_discrete_space<typename Patch::BSplines1>(min_1, max_1, n_cells_unit_square);
+    ddc::init_discrete_space<typename Patch::BSplines2>(min_2, max_2, n_cells_unit_square);
+    ddc::init_discrete_space<Grid1>(
+            Grid1::init(min_1, max_1, typename Patch::IdxStep1(n_cells_unit_square + 1)));
+    ddc::init_discrete_space<Grid2>(
+            Grid2::init(min_2, max_2, typename Patch::IdxStep2(n_cells_unit_square + 1)));
+}
+
+/// Get the index range of the grids initialised by init_unit_square_splines.
+template <class Patch>
+typename Patch::IdxRange12 get_unit_square_idx_range()
+{
+    return typename Patch::IdxRange12(
+            typename Patch::IdxRange1(
+                    typename Patch::Idx1(0),
+                    typename Patch::IdxStep1(n_cells_unit_square + 1)),
+            typename Patch::IdxRange2(
+                    typename Patch::Idx2(0),
+                    typename Patch::IdxStep2(n_cells_unit_square + 1)));
+}
+
+/// Get the index range of the B-splines initialised by init_unit_square_splines.
+template <class Patch>
+typename Patch::IdxRangeBS12 get_unit_square_spline_idx_range()
+{
+    return typename Patch::IdxRangeBS12(
+            ddc::discrete_space<typename Patch::BSplines1>().full_domain(),
+            ddc::discrete_space<typename Patch::BSplines2>().full_domain());
+}
+
+/**
+ * @brief Set the spline coefficients representing physical_function on the Patch.
+ *
+ * The coefficients of a bilinear function are its values at the Greville abscissae. For
+ * uniform B-splines of degree d on [0, 1] the Greville abscissa of the j-th B-spline is
+ * (j - (d-1)/2) h where h is the cell width.
+ */
+template <class Patch>
+void set_spline_coefficients(SplineCoeffOnPatch_2D<Patch> const& spline_coef)
+{
+    using BSplines1 = typename Patch::BSplines1;
+    using BSplines2 = typename Patch::BSplines2;
+    double const h = 1.0 / n_cells_unit_square;
+    double const greville_offset_1 = (BSplines1::degree() - 1) / 2.0;
+    double const greville_offset_2 = (BSplines2::degree() - 1) / 2.0;
+    std::array<double, 2> const shift = get_shift<Patch>();
+    double const x_shift = shift[0];
+    double const y_shift = shift[1];
+
+    typename Patch::IdxRangeBS12 const idx_range = get_idx_range(spline_coef);
+    Idx<BSplines1> const idx_1_front(idx_range.front());
+    Idx<BSplines2> const idx_2_front(idx_range.front());
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range,
+            KOKKOS_LAMBDA(Idx<BSplines1, BSplines2> const idx) {
+                double const greville_1
+                        = ((Idx<BSplines1>(idx) - idx_1_front).value() - greville_offset_1) * h;
+                double const greville_2
+                        = ((Idx<BSplines2>(idx) - idx_2_front).value() - greville_offset_2) * h;
+                spline_coef(idx) = physical_function(x_shift + greville_1, y_shift + greville_2);
+            });
+}
+
+/**
+ * @brief Evaluate the multipatch spline through a BucketPatchLocator at coordinates stored
+ * on the first patch and compare with the expected values.
+ */
+template <class StoringPatch, class... Patches>
+void test_evaluation_on_strips(
+        Kokkos::View<typename StoringPatch::Coord12*, Kokkos::DefaultHostExecutionSpace> const
+                coords_host,
+        Kokkos::View<double*, Kokkos::DefaultHostExecutionSpace> const expected_host)
+{
+    using MultipatchIdxRanges = MultipatchType<IdxRangeOnPatch, Patches...>;
+    using PatchLocator = BucketPatchLocator<
+            MultipatchIdxRanges,
+            TranslationToCartesian,
+            CartesianToTranslation>;
+    using Evaluator = MultipatchSplineEvaluator2D<
+            Kokkos::DefaultExecutionSpace,
+            Kokkos::DefaultExecutionSpace::memory_space,
+            BSplines1OnPatch,
+            BSplines2OnPatch,
+            Grid1OnPatch,
+            Grid2OnPatch,
+            NullExtrapolationRule,
+            DFieldOnPatch,
+            PatchLocator,
+            Patches...>;
+
+    PatchLocator const patch_locator(
+            MultipatchIdxRanges(get_unit_square_idx_range<Patches>()...),
+            MultipatchType<TranslationToCartesian, Patches...>(
+                    TranslationToCartesian<Patches>()...),
+            MultipatchType<CartesianToTranslation, Patches...>(
+                    CartesianToTranslation<Patches>()...));
+    Evaluator const evaluator(patch_locator, NullExtrapolationRule());
+
+    MultipatchFieldMem<SplineCoeffMemOnPatch_2D, Patches...> splines_alloc(
+            SplineCoeffMemOnPatch_2D<Patches>(get_unit_square_spline_idx_range<Patches>())...);
+    (set_spline_coefficients<Patches>(splines_alloc.template get<Patches>()), ...);
+    MultipatchField<ConstSplineCoeffOnPatch_2D, Patches...> const splines(splines_alloc);
+
+    auto coords = Kokkos::create_mirror_view_and_copy(Kokkos::DefaultExecutionSpace(), coords_host);
+    auto expected
+            = Kokkos::create_mirror_view_and_copy(Kokkos::DefaultExecutionSpace(), expected_host);
+
+    double max_error = 0;
+    Kokkos::parallel_reduce(
+            coords.extent(0),
+            KOKKOS_LAMBDA(int const i, double& err) {
+                double const value = evaluator(coords(i), splines);
+                err = Kokkos::max(Kokkos::abs(value - expected(i)), err);
+            },
+            Kokkos::Max<double>(max_error));
+    EXPECT_LE(max_error, 1e-12);
+}
+
+
+/**
+ * The 9 patches geometry laid out as a 3x3 grid of unit squares. Each patch is defined on
+ * its own logical continuous dimensions:
+ *
+ *      1  |  2  |  3
+ *    -----------------
+ *      4  |  5  |  6
+ *    -----------------
+ *      7  |  8  |  9
+ */
+class MultipatchSplineEvaluatorStripsTest : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        init_unit_square_splines<strips::Patch1>();
+        init_unit_square_splines<strips::Patch2>();
+        init_unit_square_splines<strips::Patch3>();
+        init_unit_square_splines<strips::Patch4>();
+        init_unit_square_splines<strips::Patch5>();
+        init_unit_square_splines<strips::Patch6>();
+        init_unit_square_splines<strips::Patch7>();
+        init_unit_square_splines<strips::Patch8>();
+        init_unit_square_splines<strips::Patch9>();
+    }
+};
+
+} // namespace
+
+
+
+TEST_F(MultipatchSplineEvaluatorStripsTest, EvaluateThroughBucketLocator)
+{
+    int constexpr n_points_1d = 9;
+    int constexpr n_outside = 3;
+    int constexpr n_elements = n_points_1d * n_points_1d + n_outside;
+    Kokkos::View<strips::Patch1::Coord12*, Kokkos::DefaultHostExecutionSpace>
+            coords_host("coords_host", n_elements);
+    Kokkos::View<double*, Kokkos::DefaultHostExecutionSpace> expected_host(
+            "expected_host",
+            n_elements);
+
+    // The coordinates are stored on the first patch but are located on every patch.
+    std::array<double, 2> const shift_1 = get_shift<strips::Patch1>();
+    for (int i = 0; i < n_points_1d; ++i) {
+        for (int j = 0; j < n_points_1d; ++j) {
+            double const x = 0.1 + 0.35 * i;
+            double const y = 0.1 + 0.35 * j;
+            coords_host(i * n_points_1d + j)
+                    = strips::Patch1::Coord12(x - shift_1[0], y - shift_1[1]);
+            expected_host(i * n_points_1d + j) = physical_function(x, y);
+        }
+    }
+    // Outside of the domain, the null extrapolation rule is applied.
+    std::array<std::array<double, 2>, n_outside> const outside_points {
+            std::array<double, 2> {3.5, 1.2},
+            std::array<double, 2> {1.2, -0.4},
+            std::array<double, 2> {-0.3, 3.3}};
+    for (int i = 0; i < n_outside; ++i) {
+        coords_host(n_points_1d * n_points_1d + i) = strips::Patch1::Coord12(
+                outside_points[i][0] - shift_1[0],
+                outside_points[i][1] - shift_1[1]);
+        expected_host(n_points_1d * n_points_1d + i) = 0.0;
+    }
+
+    test_evaluation_on_strips<
+            strips::Patch1,
+            strips::Patch1,
+            strips::Patch2,
+            strips::Patch3,
+            strips::Patch4,
+            strips::Patch5,
+            strips::Patch6,
+            strips::Patch7,
+            strips::Patch8,
+            strips::Patch9>(coords_host, expected_host);
+}
@@ -1,8 +1,11 @@
 // SPDX-License-Identifier: MIT
+#include <limits>
+
 #include <ddc/ddc.hpp>
 
 #include <gtest/gtest.h>
 
+#include "ddc_alias_inline_functions.hpp"
 #include "ddc_aliases.hpp"
 #include "ddc_helper.hpp"
 #include "mesh_builder.hpp"
@@ -216,3 +219,53 @@ TEST(DDCHelper, ComputeMaxDistanceNonUniformGridLast)
 
     EXPECT_NEAR(max_dx, max_dx_ddchelper, 1e-12);
 }
+
+namespace {
+
+/**
+ * A test for the parallel_convert function, rounding doubles to floats
+ * and converting them back.
+ */
+void test_parallel_convert_precision()
+{
+    using Idx = Idx<GridUniform>;
+    using IdxStep = IdxStep<GridUniform>;
+    using IdxRange = IdxRange<GridUniform>;
+
+    IdxRange idx_range(Idx(0), IdxStep(10));
+    DFieldMem<IdxRange> values_alloc(idx_range);
+    FieldMem<float, IdxRange> values_single_alloc(idx_range);
+    DFieldMem<IdxRange> values_round_trip_alloc(idx_range);
+    DField<IdxRange> values = get_field(values_alloc);
+
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            idx_range,
+            KOKKOS_LAMBDA(Idx const idx) { values(idx) = 1.0 / (1 + (idx - Idx(0)).value()); });
+
+    ddcHelper::parallel_convert(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(values_single_alloc),
+            get_const_field(values));
+    ddcHelper::parallel_convert(
+            Kokkos::DefaultExecutionSpace(),
+            get_field(values_round_trip_alloc),
+            get_const_field(values_single_alloc));
+
+    auto values_host = ddc::create_mirror_view_and_copy(values);
+    auto values_round_trip_host
+            = ddc::create_mirror_view_and_copy(get_field(values_round_trip_alloc));
+    ddc::for_each(idx_range, [&](Idx const idx) {
+        EXPECT_NEAR(
+                values_round_trip_host(idx),
+                values_host(idx),
+                std::numeric_limits<float>::epsilon() * values_host(idx));
+    });
+}
+
+} // namespace
+
+TEST(DDCHelper, ParallelConvertPrecision)
+{
+    test_parallel_convert_precision();
+}
@@ -295,4 +295,66 @@ TEST(LayoutTransposition, Transpose3D)
     });
 }
 
+static void TestTiledTranspose3D(bool on_device)
+{
+    // Sizes which are not multiples of the tile size to test the partial tiles
+    IdxXYZ start_idx_range_origin(0, 0, 0);
+    IdxStepXYZ start_idx_range_size(5, 40, 70);
+    IdxZYX end_idx_range_origin(0, 0, 0);
+    IdxStepZYX end_idx_range_size(70, 40, 5);
+    IdxRangeXYZ start_idx_range(start_idx_range_origin, start_idx_range_size);
+    IdxRangeZYX end_idx_range(end_idx_range_origin, end_idx_range_size);
+
+    device_t<DFieldMem<IdxRangeXYZ>> start_values_alloc(start_idx_range);
+    device_t<DFieldMem<IdxRangeZYX>> end_values_alloc(end_idx_range);
+
+    device_t<DField<IdxRangeXYZ>> start_values = get_field(start_values_alloc);
+    device_t<DField<IdxRangeZYX>> end_values = get_field(end_values_alloc);
+
+    ddc::parallel_for_each(
+            Kokkos::DefaultExecutionSpace(),
+            start_idx_range,
+            KOKKOS_LAMBDA(IdxXYZ ixyz) {
+                double coord_x = get_coordinate(ddc::select<GridX>(ixyz));
+                double coord_y = get_coordinate(ddc::select<GridY>(ixyz));
+                double coord_z = get_coordinate(ddc::select<GridZ>(ixyz));
+                start_values(ixyz) = coord_x + 10 * coord_y + 100 * coord_z;
+            });
+
+    if (on_device) {
+        transpose_layout(
+                Kokkos::DefaultExecutionSpace(),
+                end_values,
+                get_const_field(start_values));
+    } else {
+        auto start_values_host = ddc::create_mirror_view_and_copy(get_const_field(start_values));
+        auto end_values_host = ddc::create_mirror_view(end_values);
+        transpose_layout(
+                Kokkos::DefaultHostExecutionSpace(),
+                get_field(end_values_host),
+                get_const_field(start_values_host));
+        ddc::parallel_deepcopy(end_values, end_values_host);
+    }
+
+    auto start_values_host = ddc::create_mirror_view_and_copy(get_const_field(start_values));
+    auto end_values_host = ddc::create_mirror_view_and_copy(get_const_field(end_values));
+
+    ddc::for_each(start_idx_range, [&](IdxXYZ ixyz) {
+        IdxX ix(ixyz);
+        IdxY iy(ixyz);
+        IdxZ iz(ixyz);
+        EXPECT_EQ(start_values_host(ix, iy, iz), end_values_host(ix, iy, iz));
+    });
+}
+
+TEST(LayoutTransposition, TiledTranspose3D_Host)
+{
+    TestTiledTranspose3D(false);
+}
+
+TEST(LayoutTransposition, TiledTranspose3D_Device)
+{
+    TestTiledTranspose3D(true);
+}
+
 } // namespace